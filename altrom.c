@@ -2,6 +2,7 @@
 #include "defs.h"
 #include "log.h"
 #include "memory.h"
+#include "rewind.h"
 
 
 #define NOT_LOCKED  0
@@ -19,7 +20,7 @@ typedef struct self_t {
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 static void altrom_refresh_ptr(void) {
@@ -46,6 +47,8 @@ static void altrom_refresh_ptr(void) {
       log_wrn("altrom: locking not implemented for machine type %u\n", self.machine_type);
       return;
   }
+
+  memory_remapped(0, 2);
 }
 
 
@@ -60,6 +63,8 @@ int altrom_init(u8_t* sram) {
 
   altrom_refresh_ptr();
 
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -78,6 +83,11 @@ void altrom_write(u16_t address, u8_t value) {
 }
 
 
+u32_t altrom_sram_offset(u16_t address) {
+  return ((self.ptr == self.rom1_48k) ? MEMORY_RAM_OFFSET_ALTROM1_48K : MEMORY_RAM_OFFSET_ALTROM0_128K) + address;
+}
+
+
 int altrom_is_active_on_read(void) {
   return self.is_active && !self.on_write;
 }
@@ -10,6 +10,7 @@ int   altrom_init(u8_t* sram);
 void  altrom_finit(void);
 u8_t  altrom_read(u16_t address);
 void  altrom_write(u16_t address, u8_t value);
+u32_t altrom_sram_offset(u16_t address);
 int   altrom_is_active_on_read(void);
 int   altrom_is_active_on_write(void);
 void  altrom_activate(int active, int on_write);
@@ -2,6 +2,9 @@
 #include "audio.h"
 #include "clock.h"
 #include "defs.h"
+#include "replay.h"
+#include "rewind.h"
+#include "stats.h"
 
 
 #define N_SOURCES       (E_AUDIO_SOURCE_LAST - E_AUDIO_SOURCE_FIRST + 1)
@@ -13,20 +16,23 @@ typedef struct self_t {
   audio_channel_t   channels[N_SOURCES];
   s8_t              last_sample[N_SOURCES];
   s8_t              mixed[AUDIO_BUFFER_LENGTH * AUDIO_N_CHANNELS];
+  s8_t              flushed[AUDIO_BUFFER_LENGTH * AUDIO_N_CHANNELS];
   const s8_t*       mixed_end;
   s16_t             mixed_last_sample_sum_left;
   s16_t             mixed_last_sample_sum_right;
   s8_t              mixed_last_sample_left;
   s8_t              mixed_last_sample_right;
   u64_t             emptied_ticks_28mhz;
+  u32_t             clock_28mhz;
   SDL_bool          is_empty;
+  u32_t             n_underruns;  /* Since the last host sync, under the lock. */
   SDL_cond*         emptied;
   SDL_mutex*        lock;
-  u32_t             clock_28mhz;
+  int               is_deterministic;
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 int audio_init(SDL_AudioDeviceID device) {
@@ -49,11 +55,16 @@ int audio_init(SDL_AudioDeviceID device) {
   self.channels[E_AUDIO_SOURCE_DAC_C         ] = E_AUDIO_CHANNEL_RIGHT;
   self.channels[E_AUDIO_SOURCE_DAC_D         ] = E_AUDIO_CHANNEL_RIGHT;
 
+  /* The mix follows emulated time, the rest belongs to the host. */
+  rewind_register(self.channels, offsetof(self_t, is_empty) - offsetof(self_t, channels), NULL);
+
   return 0;
 }
 
 
 void audio_finit(void) {
+  SDL_DestroyMutex(self.lock);
+  SDL_DestroyCond(self.emptied);
 }
 
 
@@ -66,7 +77,13 @@ void audio_add_sample(audio_source_t source, s8_t sample) {
   size_t index;
 
   /* Prevent a race condition between us and the audio callback. */
-  SDL_LockAudioDevice(self.device);
+  if (stats_is_enabled()) {
+    const u64_t start = stats_now();
+    SDL_LockAudioDevice(self.device);
+    stats_timer_add(E_STATS_TIMER_AUDIO_LOCK, start);
+  } else {
+    SDL_LockAudioDevice(self.device);
+  }
 
   /* Calculate where to place the new sample. */
   index = AUDIO_SAMPLE_RATE * (clock_ticks() - self.emptied_ticks_28mhz) / self.clock_28mhz;
@@ -115,6 +132,9 @@ void audio_pause(void) {
 
 
 void audio_sync(void) {
+  const u64_t start = stats_now();
+  u32_t       n_underruns;
+
   SDL_LockMutex(self.lock);
 
   while (!self.is_empty) {
@@ -122,28 +142,86 @@ void audio_sync(void) {
   }
   self.is_empty = SDL_FALSE;
 
+  n_underruns      = self.n_underruns;
+  self.n_underruns = 0;
+
   SDL_UnlockMutex(self.lock);
+
+  /* Counted here, as the statistics belong to this thread. */
+  while (n_underruns-- > 0) {
+    stats_count(E_STATS_COUNTER_AUDIO_UNDERRUNS);
+  }
+
+  stats_timer_add(E_STATS_TIMER_AUDIO_WAIT, start);
 }
 
 
-void audio_callback(void* userdata, u8_t* stream, int length) {
+/**
+ * Resets the mix to silence, i.e. to the last samples.
+ */
+static void audio_silence(void) {
   s8_t* mixed = self.mixed;
 
-  /* Copy audio mix to SDL stream. */
-  memcpy(stream, self.mixed, sizeof(self.mixed));
-
-  /* Reset to silence. */
   while (mixed < self.mixed_end) {
     *mixed++ = self.mixed_last_sample_left;
     *mixed++ = self.mixed_last_sample_right;
   }
+}
+
+
+/**
+ * In deterministic mode the mix is handed over on host syncs, which happen
+ * at fixed points in emulated time, rather than whenever the audio device
+ * asks for it.
+ */
+void audio_flush(void) {
+  SDL_LockAudioDevice(self.device);
 
-  /* Record when we last emptied the buffer, so we can know where in the buffer
-   * to place freshly arriving audio samples. */
+  memcpy(self.flushed, self.mixed, sizeof(self.mixed));
+  audio_silence();
   self.emptied_ticks_28mhz = clock_ticks();
 
+  SDL_UnlockAudioDevice(self.device);
+
+  replay_audio_completed(self.flushed, sizeof(self.flushed));
+}
+
+
+/**
+ * Returns the mix handed over by the last flush, AUDIO_BUFFER_LENGTH
+ * interleaved samples per channel.
+ */
+const s8_t* audio_flushed_get(void) {
+  return self.flushed;
+}
+
+
+void audio_deterministic_set(int is_deterministic) {
+  self.is_deterministic = is_deterministic;
+}
+
+
+void audio_callback(void* userdata, u8_t* stream, int length) {
+  if (self.is_deterministic) {
+    memcpy(stream, self.flushed, sizeof(self.flushed));
+  } else {
+    /* Copy audio mix to SDL stream. */
+    memcpy(stream, self.mixed, sizeof(self.mixed));
+
+    /* Reset to silence. */
+    audio_silence();
+
+    /* Record when we last emptied the buffer, so we can know where in the
+     * buffer to place freshly arriving audio samples. */
+    self.emptied_ticks_28mhz = clock_ticks();
+  }
+
   /* Signal the main thread that we emptied the audio buffer. */
   SDL_LockMutex(self.lock);
+  if (self.is_empty) {
+    /* The main thread did not produce a new buffer in time. */
+    self.n_underruns++;
+  }
   self.is_empty = SDL_TRUE;
   SDL_CondSignal(self.emptied);
   SDL_UnlockMutex(self.lock);
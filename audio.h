@@ -39,15 +39,18 @@ typedef enum {
 #define AUDIO_MAX_VOLUME        63
 
 
-int  audio_init(SDL_AudioDeviceID device);
-void audio_finit(void);
-void audio_pause(void);
-void audio_resume(void);
-void audio_assign_channel(audio_source_t source, audio_channel_t channel);
-void audio_add_sample(audio_source_t source, s8_t sample);
-void audio_sync(void);
-void audio_callback(void* userdata, u8_t* stream, int length);
-void audio_clock_28mhz_set(u32_t freq_28mhz);
+int         audio_init(SDL_AudioDeviceID device);
+void        audio_finit(void);
+void        audio_pause(void);
+void        audio_resume(void);
+void        audio_assign_channel(audio_source_t source, audio_channel_t channel);
+void        audio_add_sample(audio_source_t source, s8_t sample);
+void        audio_sync(void);
+void        audio_flush(void);
+const s8_t* audio_flushed_get(void);
+void        audio_deterministic_set(int is_deterministic);
+void        audio_callback(void* userdata, u8_t* stream, int length);
+void        audio_clock_28mhz_set(u32_t freq_28mhz);
 
 
 #endif  /* __AUDIO_H */
@@ -2,6 +2,7 @@
 #include "ay.h"
 #include "defs.h"
 #include "log.h"
+#include "rewind.h"
 
 #define MAX(a, b)       ((a) > (b) ? (a) : (b))
 #define LEVEL(voltage)  ((s8_t) (AUDIO_MAX_VOLUME * voltage))
@@ -112,7 +113,7 @@ typedef struct self_t {
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 int ay_init(void) {
@@ -121,6 +122,9 @@ int ay_init(void) {
   self.ays[2].source = E_AUDIO_SOURCE_AY_3_CHANNEL_A;
 
   ay_reset(E_RESET_HARD);
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -0,0 +1,791 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_net.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "clock.h"
+#include "config.h"
+#include "copper.h"
+#include "cpu.h"
+#include "defs.h"
+#include "dma.h"
+#include "esp.h"
+#include "log.h"
+#include "memory.h"
+#include "nextreg.h"
+#include "rewind.h"
+#include "sprites.h"
+#include "stats.h"
+#include "uart.h"
+
+
+/**
+ * Fixed workloads to measure emulator performance with. Each starts from a
+ * hard reset, leaves config mode as a 128K machine with the boot ROM out of
+ * the way, puts a small program at $8000 and runs it with interrupts
+ * disabled, unless it enables them, for a fixed number of emulated frames.
+ */
+
+
+#define BENCH_DEFAULT_FRAMES  500
+#define BENCH_ORIGIN          0x8000
+#define BENCH_REWIND_FRAMES   10
+#define BENCH_ESP_PORT        9001  /* The ESP takes at most four digits. */
+#define BENCH_ESP_CHUNK       2048
+
+
+/**
+ * Mix of loads, ALU, stack and branch instructions over a 256-byte buffer:
+ *
+ * 8000  LD   HL,$C000
+ * 8003  LD   B,0
+ * 8005  LD   A,(HL)
+ * 8006  ADD  A,B
+ * 8007  XOR  $55
+ * 8009  LD   (HL),A
+ * 800A  INC  HL
+ * 800B  PUSH BC
+ * 800C  POP  BC
+ * 800D  DJNZ $8005
+ * 800F  JP   $8000
+ */
+static const u8_t bench_program_z80[] = {
+  0x21, 0x00, 0xC0,
+  0x06, 0x00,
+  0x7E,
+  0x80,
+  0xEE, 0x55,
+  0x77,
+  0x23,
+  0xC5,
+  0xC1,
+  0x10, 0xF6,
+  0xC3, 0x00, 0x80
+};
+
+
+/**
+ * Reads sector 0 of the first SD card over SPI, forever:
+ *
+ * 8000  LD   A,$FE
+ * 8002  OUT  ($E7),A    ; Select first SD card.
+ * 8004  LD   HL,$8030
+ * 8007  LD   BC,$06EB
+ * 800A  OTIR            ; CMD17 READ_SINGLE_BLOCK.
+ * 800C  LD   HL,$C000
+ * 800F  LD   B,0
+ * 8011  INIR            ; R1, start token and 255 bytes.
+ * 8013  INIR            ; 256 bytes.
+ * 8015  IN   A,(C)      ; Last byte and CRC.
+ * 8017  IN   A,(C)
+ * 8019  IN   A,(C)
+ * 801B  IN   A,(C)
+ * 801D  LD   A,$FF
+ * 801F  OUT  ($E7),A    ; Deselect.
+ * 8021  JR   $8000
+ * 8030  DB   $51,$00,$00,$00,$00,$FF
+ */
+static const u8_t bench_program_sd[] = {
+  0x3E, 0xFE,
+  0xD3, 0xE7,
+  0x21, 0x30, 0x80,
+  0x01, 0xEB, 0x06,
+  0xED, 0xB3,
+  0x21, 0x00, 0xC0,
+  0x06, 0x00,
+  0xED, 0xB2,
+  0xED, 0xB2,
+  0xED, 0x78,
+  0xED, 0x78,
+  0xED, 0x78,
+  0xED, 0x78,
+  0x3E, 0xFF,
+  0xD3, 0xE7,
+  0x18, 0xDD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x00, 0xFF
+};
+
+
+/**
+ * Idles in IM 2, waking up for the frame and line interrupts only:
+ *
+ * 8000  LD   A,$80
+ * 8002  LD   I,A
+ * 8004  IM   2
+ * 8006  EI
+ * 8007  HALT
+ * 8008  JR   $8006
+ * 800A  RETI            ; Vectored via $80FF.
+ */
+static const u8_t bench_program_halt[] = {
+  0x3E, 0x80,
+  0xED, 0x47,
+  0xED, 0x5E,
+  0xFB,
+  0x76,
+  0x18, 0xFC,
+  0xED, 0x4D
+};
+
+
+/**
+ * Idles in IM 2 at 3.5 MHz like the halt workload, but from contended bank 5,
+ * where every repeat of the HALT is delayed:
+ *
+ * 8000  LD   A,$80
+ * 8002  LD   I,A
+ * 8004  IM   2
+ * 8006  JP   $6000
+ * 8009  RETI            ; Vectored via $80FF.
+ *
+ * 6000  EI
+ * 6001  HALT
+ * 6002  JR   $6000
+ */
+static const u8_t bench_program_halt5[] = {
+  0x3E, 0x80,
+  0xED, 0x47,
+  0xED, 0x5E,
+  0xC3, 0x00, 0x60,
+  0xED, 0x4D
+};
+
+
+/**
+ * Block instructions in a loop, interrupted by the frame interrupt:
+ *
+ * 8000  LD   A,$80
+ * 8002  LD   I,A
+ * 8004  IM   2
+ * 8006  EI
+ * 8007  LD   HL,$C000
+ * 800A  LD   DE,$4000
+ * 800D  LD   BC,$1B00
+ * 8010  LDIR            ; Screen copy.
+ * 8012  LD   HL,$DAFF
+ * 8015  LD   DE,$5AFF
+ * 8018  LD   BC,$1B00
+ * 801B  LDDR
+ * 801D  LD   A,$E3
+ * 801F  LD   HL,$C000
+ * 8022  LD   DE,$E000
+ * 8025  LD   BC,$1000
+ * 8028  LDIRX
+ * 802A  LD   HL,$C000
+ * 802D  LD   DE,$F000
+ * 8030  LD   BC,$0800
+ * 8033  LDPIRX
+ * 8035  LD   HL,$C000
+ * 8038  LD   BC,$005B
+ * 803B  OTIR            ; 256 bytes of sprite patterns.
+ * 803D  JR   $8006
+ * 803F  RETI            ; Vectored via $80FF.
+ */
+static const u8_t bench_program_block[] = {
+  0x3E, 0x80,
+  0xED, 0x47,
+  0xED, 0x5E,
+  0xFB,
+  0x21, 0x00, 0xC0,
+  0x11, 0x00, 0x40,
+  0x01, 0x00, 0x1B,
+  0xED, 0xB0,
+  0x21, 0xFF, 0xDA,
+  0x11, 0xFF, 0x5A,
+  0x01, 0x00, 0x1B,
+  0xED, 0xB8,
+  0x3E, 0xE3,
+  0x21, 0x00, 0xC0,
+  0x11, 0x00, 0xE0,
+  0x01, 0x00, 0x10,
+  0xED, 0xB4,
+  0x21, 0x00, 0xC0,
+  0x11, 0x00, 0xF0,
+  0x01, 0x00, 0x08,
+  0xED, 0xB7,
+  0x21, 0x00, 0xC0,
+  0x01, 0x5B, 0x00,
+  0xED, 0xB3,
+  0x18, 0xC7,
+  0xED, 0x4D
+};
+
+
+/**
+ * Stays in config mode and pages every 128K bank in at $C000 through port
+ * $7FFD, and one of the eight RAM banks above those at $0000 through NextReg
+ * $04, writing to both, many times per frame:
+ *
+ * 8000  LD      BC,$7FFD
+ * 8003  LD      E,0
+ * 8005  LD      A,E
+ * 8006  OUT     (C),A
+ * 8008  OR      $18           ; RAM banks 8-15, in 16K SRAM banks.
+ * 800A  NEXTREG $04,A
+ * 800D  LD      HL,$C100      ; Clear of this program in bank 2.
+ * 8010  INC     (HL)
+ * 8011  LD      H,$01
+ * 8013  INC     (HL)
+ * 8014  INC     E
+ * 8015  LD      A,E
+ * 8016  AND     7
+ * 8018  LD      E,A
+ * 8019  JR      $8005
+ */
+static const u8_t bench_program_paging[] = {
+  0x01, 0xFD, 0x7F,
+  0x1E, 0x00,
+  0x7B,
+  0xED, 0x79,
+  0xF6, 0x18,
+  0xED, 0x92, 0x04,
+  0x21, 0x00, 0xC1,
+  0x34,
+  0x26, 0x01,
+  0x34,
+  0x1C,
+  0x7B,
+  0xE6, 0x07,
+  0x5F,
+  0x18, 0xEA
+};
+
+
+/**
+ * Counts the bytes received from the ESP in DE:HL, forever:
+ *
+ * 8000  LD   BC,$133B
+ * 8003  LD   HL,0
+ * 8006  LD   DE,0
+ * 8009  IN   A,(C)      ; Wait until the receive FIFO holds a byte.
+ * 800B  RRA
+ * 800C  JR   NC,$8009
+ * 800E  INC  B
+ * 800F  IN   A,(C)      ; Read it from port $143B.
+ * 8011  DEC  B
+ * 8012  INC  HL
+ * 8013  LD   A,H
+ * 8014  OR   L
+ * 8015  JR   NZ,$8009
+ * 8017  INC  DE
+ * 8018  JR   $8009
+ */
+static const u8_t bench_program_esp[] = {
+  0x01, 0x3B, 0x13,
+  0x21, 0x00, 0x00,
+  0x11, 0x00, 0x00,
+  0xED, 0x78,
+  0x1F,
+  0x30, 0xFB,
+  0x04,
+  0xED, 0x78,
+  0x05,
+  0x23,
+  0x7C,
+  0xB5,
+  0x20, 0xF2,
+  0x13,
+  0x18, 0xEF
+};
+
+
+static void bench_setup_none(void) {
+}
+
+
+static void bench_setup_config(void) {
+  config_activate();
+}
+
+
+static void bench_setup_sprites(void) {
+  int i;
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_SPRITE_LAYERS_SYSTEM, 0x03);  /* Visible, over border. */
+
+  sprites_slot_set(0);
+  for (i = 0; i < 16 * 1024; i++) {
+    sprites_next_pattern_set((u8_t) (i * 7 + (i >> 8)));
+  }
+
+  for (i = 0; i < 128; i++) {
+    sprites_attribute_set(i, 0, (u8_t) (i * 37));
+    sprites_attribute_set(i, 1, (u8_t) (32 + (i * 23) % 192));
+    sprites_attribute_set(i, 2, 0x00);
+    sprites_attribute_set(i, 3, 0x80 | (i & 0x3F));
+  }
+}
+
+
+static void bench_setup_layers(void) {
+  bench_setup_sprites();
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_DISPLAY_CONTROL_1, 0x80);  /* Layer 2 on. */
+  nextreg_write_internal(E_NEXTREG_REGISTER_TILEMAP_CONTROL,   0x80);  /* Tilemap on. */
+}
+
+
+/**
+ * Rasterbars: on every content line change a palette entry and the ULA
+ * horizontal scroll, restarting at every vertical blank.
+ */
+static void bench_setup_copper(void) {
+  u16_t row;
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_CONTROL, 0x00);
+  nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_ADDRESS, 0x00);
+
+  for (row = 0; row < 192; row++) {
+    const u16_t wait = 0x8000 | row;
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, wait >> 8);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, wait & 0xFF);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, E_NEXTREG_REGISTER_PALETTE_INDEX);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, 0x00);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, E_NEXTREG_REGISTER_PALETTE_VALUE_8BITS);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, (u8_t) row);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, E_NEXTREG_REGISTER_ULA_X_SCROLL);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, (u8_t) row);
+  }
+
+  /* HALT. */
+  nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, 0xFF);
+  nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, 0xFF);
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_CONTROL, 0xC0);
+}
+
+
+static void bench_setup_halt(void) {
+  memory_write(0x80FF, 0x0A);
+  memory_write(0x8100, 0x80);
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_LINE_INTERRUPT_VALUE_LSB, 96);
+  nextreg_write_internal(E_NEXTREG_REGISTER_LINE_INTERRUPT_CONTROL,   0x02);  /* Line interrupt on. */
+}
+
+
+static void bench_setup_halt5(void) {
+  const u8_t idle[] = {
+    0xFB,
+    0x76,
+    0x18, 0xFC
+  };
+  size_t i;
+
+  for (i = 0; i < sizeof(idle); i++) {
+    memory_write(0x6000 + i, idle[i]);
+  }
+
+  memory_write(0x80FF, 0x09);
+  memory_write(0x8100, 0x80);
+}
+
+
+static void bench_setup_block(void) {
+  u16_t i;
+
+  for (i = 0; i < 0x1B00; i++) {
+    memory_write(0xC000 + i, (u8_t) (i * 13 + (i >> 5)));
+  }
+
+  memory_write(0x80FF, 0x3F);
+  memory_write(0x8100, 0x80);
+}
+
+
+/**
+ * Streams a 256-byte sample from $C000 to the Specdrum DAC at port $DF at
+ * roughly 16 kHz, in prescaled burst mode with auto-restart.
+ */
+static void bench_setup_dma(void) {
+  const u8_t program[] = {
+    0x83,                          /* Disable DMA.                            */
+    0x7D, 0x00, 0xC0, 0x00, 0x01,  /* WR0: A -> B, A = $C000, length = 256.   */
+    0x14,                          /* WR1: A is memory, incrementing.         */
+    0x68, 0x22, 55,                /* WR2: B is I/O, fixed, prescaler 55.     */
+    0xCD, 0xDF, 0x00,              /* WR4: burst mode, B = $00DF.             */
+    0xA2,                          /* WR5: auto-restart.                      */
+    0xCF,                          /* LOAD.                                   */
+    0x87                           /* Enable DMA.                             */
+  };
+  size_t i;
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_PERIPHERAL_3_SETTING, 0x08);  /* Enable DACs. */
+
+  for (i = 0; i < 256; i++) {
+    memory_write(0xC000 + i, (u8_t) (i < 128 ? i * 2 : 511 - i * 2));
+  }
+
+  for (i = 0; i < sizeof(program); i++) {
+    dma_write(0x6B, program[i]);
+  }
+}
+
+
+/**
+ * Continuous memory-to-memory DMA copying 6K into the screen, restarting
+ * whenever it is done.
+ */
+static void bench_setup_dma_copy(void) {
+  const u8_t program[] = {
+    0x83,                          /* Disable DMA.                            */
+    0x7D, 0x00, 0x98, 0x00, 0x18,  /* WR0: A -> B, A = $9800, length = 6K.    */
+    0x14,                          /* WR1: A is memory, incrementing.         */
+    0x10,                          /* WR2: B is memory, incrementing.         */
+    0xAD, 0x00, 0x40,              /* WR4: continuous mode, B = $4000.        */
+    0xA2,                          /* WR5: auto-restart.                      */
+    0xCF,                          /* LOAD.                                   */
+    0x87                           /* Enable DMA.                             */
+  };
+  size_t i;
+
+  for (i = 0; i < 0x1800; i++) {
+    memory_write(0x9800 + i, (u8_t) (i ^ (i >> 8)));
+  }
+
+  for (i = 0; i < sizeof(program); i++) {
+    dma_write(0x6B, program[i]);
+  }
+}
+
+
+/**
+ * Loopback server for the ESP workload, streaming to the first client that
+ * connects until told to stop or until the client goes away.
+ */
+typedef struct bench_server_t {
+  TCPsocket   socket;
+  SDL_Thread* thread;
+  int         do_stop;
+} bench_server_t;
+
+
+static bench_server_t bench_server;
+
+
+static int bench_server_thread(void* data) {
+  SDLNet_SocketSet socket_set;
+  TCPsocket        client = NULL;
+  u8_t             chunk[BENCH_ESP_CHUNK];
+  size_t           i;
+
+  for (i = 0; i < sizeof(chunk); i++) {
+    chunk[i] = (u8_t) i;
+  }
+
+  socket_set = SDLNet_AllocSocketSet(1);
+  if (socket_set == NULL) {
+    log_err("bench: SDLNet_AllocSocketSet: %s\n", SDLNet_GetError());
+    return -1;
+  }
+  SDLNet_TCP_AddSocket(socket_set, bench_server.socket);
+
+  while (client == NULL && !bench_server.do_stop) {
+    if (SDLNet_CheckSockets(socket_set, 100) > 0) {
+      client = SDLNet_TCP_Accept(bench_server.socket);
+    }
+  }
+
+  SDLNet_FreeSocketSet(socket_set);
+
+  if (client != NULL) {
+    while (!bench_server.do_stop && SDLNet_TCP_Send(client, chunk, sizeof(chunk)) == sizeof(chunk)) {
+    }
+    SDLNet_TCP_Close(client);
+  }
+
+  return 0;
+}
+
+
+/**
+ * Starts the loopback server and connects to it over the ESP, whose UART is
+ * not held back by its baud rate for the occasion.
+ */
+static void bench_setup_esp(void) {
+  char        command[64];
+  const char* c;
+  IPaddress   ip;
+
+  if (SDLNet_ResolveHost(&ip, NULL, BENCH_ESP_PORT) != 0) {
+    log_err("bench: SDLNet_ResolveHost: %s\n", SDLNet_GetError());
+    return;
+  }
+
+  bench_server.socket = SDLNet_TCP_Open(&ip);
+  if (bench_server.socket == NULL) {
+    log_err("bench: cannot listen on port %u: %s\n", BENCH_ESP_PORT, SDLNet_GetError());
+    return;
+  }
+
+  bench_server.do_stop = 0;
+  bench_server.thread  = SDL_CreateThread(bench_server_thread, "bench_server", NULL);
+  if (bench_server.thread == NULL) {
+    log_err("bench: SDL_CreateThread: %s\n", SDL_GetError());
+    return;
+  }
+
+  uart_unlimited_set(1);
+
+  snprintf(command, sizeof(command), "AT+CIPSTART=\"TCP\",\"127.0.0.1\",%u\r\n", BENCH_ESP_PORT);
+  for (c = command; *c != '\0'; c++) {
+    uart_tx_write(*c);
+  }
+}
+
+
+/**
+ * Stops the loopback server, and reports how fast the Z80 received.
+ */
+static void bench_finish_esp(double seconds) {
+  const cpu_t* cpu   = cpu_get();
+  const u32_t  bytes = (u32_t) cpu->de.w << 16 | cpu->hl.w;
+
+  if (bench_server.thread != NULL) {
+    bench_server.do_stop = 1;
+
+    /* Close the link, in case the server waits for room to send. */
+    esp_reset(E_RESET_HARD);
+
+    SDL_WaitThread(bench_server.thread, NULL);
+    bench_server.thread = NULL;
+  }
+
+  if (bench_server.socket != NULL) {
+    SDLNet_TCP_Close(bench_server.socket);
+    bench_server.socket = NULL;
+  }
+
+  uart_unlimited_set(0);
+
+  printf("      \"esp_bytes\": %u,\n", bytes);
+  printf("      \"esp_mb_per_second\": %.3f,\n", bytes / seconds / 1e6);
+}
+
+
+typedef struct bench_workload_t {
+  const char* name;
+  const char* description;
+  cpu_speed_t speed;
+  const u8_t* program;
+  size_t      program_length;
+  void      (*setup)(void);
+  void      (*finish)(double seconds);  /* Reports and cleans up, if need be. */
+  int         is_rewinding;             /* Snapshot every frame, then check a rewind. */
+} bench_workload_t;
+
+
+static const bench_workload_t bench_workloads[] = {
+  { "z80",     "Z80 instruction mix",                        E_CPU_SPEED_28MHZ, bench_program_z80,    sizeof(bench_program_z80),    bench_setup_none,     NULL,             0 },
+  { "layers",  "28 MHz with ULA, layer 2, tilemap, sprites", E_CPU_SPEED_28MHZ, bench_program_z80,    sizeof(bench_program_z80),    bench_setup_layers,   NULL,             0 },
+  { "sprites", "128 sprites over the border",                E_CPU_SPEED_3MHZ,  bench_program_z80,    sizeof(bench_program_z80),    bench_setup_sprites,  NULL,             0 },
+  { "copper",  "Copper rasterbars",                          E_CPU_SPEED_3MHZ,  bench_program_z80,    sizeof(bench_program_z80),    bench_setup_copper,   NULL,             0 },
+  { "dma",     "Prescaled DMA streaming to a DAC",           E_CPU_SPEED_3MHZ,  bench_program_z80,    sizeof(bench_program_z80),    bench_setup_dma,      NULL,             0 },
+  { "dmacopy", "Continuous DMA memory-to-memory copy",       E_CPU_SPEED_28MHZ, bench_program_z80,    sizeof(bench_program_z80),    bench_setup_dma_copy, NULL,             0 },
+  { "sd",      "SD card sector reads over SPI",              E_CPU_SPEED_28MHZ, bench_program_sd,     sizeof(bench_program_sd),     bench_setup_none,     NULL,             0 },
+  { "halt",    "Idling in HALT between interrupts",          E_CPU_SPEED_28MHZ, bench_program_halt,   sizeof(bench_program_halt),   bench_setup_halt,     NULL,             0 },
+  { "halt5",   "Idling in HALT in contended bank 5",         E_CPU_SPEED_3MHZ,  bench_program_halt5,  sizeof(bench_program_halt5),  bench_setup_halt5,    NULL,             0 },
+  { "block",   "Block copies and port output",               E_CPU_SPEED_28MHZ, bench_program_block,  sizeof(bench_program_block),  bench_setup_block,    NULL,             0 },
+  { "esp",     "ESP link from a loopback server",            E_CPU_SPEED_28MHZ, bench_program_esp,    sizeof(bench_program_esp),    bench_setup_esp,      bench_finish_esp, 0 },
+  { "paging",  "128K and config paging while rewinding",     E_CPU_SPEED_28MHZ, bench_program_paging, sizeof(bench_program_paging), bench_setup_config,   NULL,             1 }
+};
+
+
+#define N_WORKLOADS  (sizeof(bench_workloads) / sizeof(*bench_workloads))
+
+
+static u64_t bench_frames(void) {
+  return stats_counter_get(E_STATS_COUNTER_FRAMES_RENDERED) + stats_counter_get(E_STATS_COUNTER_FRAMES_SKIPPED);
+}
+
+
+static void bench_prepare(const bench_workload_t* workload) {
+  cpu_t* cpu;
+  size_t i;
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_RESET, 0x02);
+
+  /* Let the CPU act on the reset request. */
+  (void) cpu_step();
+
+  /* Leave config mode as a 128K machine, which also disables the boot ROM. */
+  nextreg_write_internal(E_NEXTREG_REGISTER_MACHINE_TYPE, 0x80 | (E_MACHINE_TYPE_ZX_128K_PLUS2 << 4) | E_MACHINE_TYPE_ZX_128K_PLUS2);
+  nextreg_write_internal(E_NEXTREG_REGISTER_CPU_SPEED, workload->speed);
+
+  for (i = 0; i < workload->program_length; i++) {
+    memory_write(BENCH_ORIGIN + i, workload->program[i]);
+  }
+
+  workload->setup();
+
+  cpu       = cpu_get();
+  cpu->pc.w = BENCH_ORIGIN;
+  cpu->sp.w = 0xFFFE;
+  cpu->iff1 = 0;
+  cpu->iff2 = 0;
+}
+
+
+/**
+ * Takes a snapshot after every frame. The state at the one taken
+ * BENCH_REWIND_FRAMES before the end is kept in expected.
+ */
+static void bench_rewind_snapshot(u64_t frame, u32_t n_frames, u8_t* expected) {
+  rewind_snapshot();
+
+  if (frame + BENCH_REWIND_FRAMES == n_frames) {
+    rewind_state_save(expected);
+  }
+}
+
+
+/**
+ * Rewinds to the kept snapshot, which is only right when every page written
+ * since the keyframe before it made it into the snapshots. Returns whether
+ * the state matches.
+ */
+static int bench_rewind_check(const u8_t* expected) {
+  const size_t size   = rewind_state_size();
+  u8_t*        actual = malloc(size);
+  int          is_ok;
+
+  if (actual == NULL) {
+    log_err("bench: out of memory\n");
+    return 0;
+  }
+
+  is_ok = rewind_restore(BENCH_REWIND_FRAMES + 1) == 0;
+  if (is_ok) {
+    rewind_state_save(actual);
+    is_ok = memcmp(actual, expected, size) == 0;
+  }
+
+  free(actual);
+
+  return is_ok;
+}
+
+
+static void bench_workload_run(const bench_workload_t* workload, u32_t n_frames, int is_last) {
+  const unsigned int clock_divider[E_CPU_SPEED_LAST - E_CPU_SPEED_FIRST + 1] = {
+    8, 4, 2, 1
+  };
+
+  u64_t  start_frames;
+  u64_t  start_ticks;
+  u64_t  start_host;
+  u64_t  ticks;
+  u64_t  frame;
+  u8_t*  expected = NULL;
+  double seconds;
+  double emulated_seconds;
+
+  bench_prepare(workload);
+
+  if (workload->is_rewinding) {
+    expected = malloc(rewind_state_size());
+    if (expected == NULL) {
+      log_err("bench: out of memory\n");
+      return;
+    }
+    (void) rewind_enable(1);
+  }
+
+  start_frames = bench_frames();
+  start_ticks  = clock_ticks();
+  start_host   = SDL_GetPerformanceCounter();
+
+  while ((frame = bench_frames() - start_frames) < n_frames) {
+    (void) cpu_step();
+
+    if (expected != NULL && bench_frames() - start_frames != frame) {
+      bench_rewind_snapshot(frame + 1, n_frames, expected);
+    }
+  }
+
+  seconds          = (double) (SDL_GetPerformanceCounter() - start_host) / SDL_GetPerformanceFrequency();
+  ticks            = clock_ticks() - start_ticks;
+  emulated_seconds = (double) ticks / clock_28mhz_get();
+
+  printf("    {\n");
+  printf("      \"name\": \"%s\",\n", workload->name);
+  printf("      \"description\": \"%s\",\n", workload->description);
+  printf("      \"frames\": %u,\n", n_frames);
+  if (expected != NULL) {
+    printf("      \"rewind_check\": \"%s\",\n", n_frames > BENCH_REWIND_FRAMES && bench_rewind_check(expected) ? "ok" : "failed");
+    (void) rewind_enable(0);
+    free(expected);
+  }
+  if (workload->finish != NULL) {
+    workload->finish(seconds);
+  }
+  printf("      \"host_seconds\": %.6f,\n", seconds);
+  printf("      \"emulated_seconds\": %.6f,\n", emulated_seconds);
+  printf("      \"emulated_mhz\": %.3f,\n", (double) ticks / clock_divider[workload->speed] / seconds / 1e6);
+  printf("      \"fps\": %.2f,\n", n_frames / seconds);
+  printf("      \"speed\": %.3f\n", emulated_seconds / seconds);
+  printf("    }%s\n", is_last ? "" : ",");
+  fflush(stdout);
+}
+
+
+static const bench_workload_t* bench_find(const char* name) {
+  size_t i;
+
+  for (i = 0; i < N_WORKLOADS; i++) {
+    if (strcmp(bench_workloads[i].name, name) == 0) {
+      return &bench_workloads[i];
+    }
+  }
+
+  return NULL;
+}
+
+
+/**
+ * Usage: zxnxt --bench [-f frames] [workload ...]
+ *
+ * Runs the named workloads, or all of them, and prints the results as JSON
+ * on stdout.
+ */
+int bench_run(int argc, char* argv[]) {
+  const bench_workload_t* selected[N_WORKLOADS];
+  size_t                  n_selected = 0;
+  u32_t                   n_frames   = BENCH_DEFAULT_FRAMES;
+  size_t                  i;
+  int                     j;
+
+  for (j = 0; j < argc; j++) {
+    if (strcmp(argv[j], "-f") == 0 && j + 1 < argc) {
+      n_frames = strtoul(argv[++j], NULL, 10);
+      continue;
+    }
+
+    if (n_selected == N_WORKLOADS || (selected[n_selected] = bench_find(argv[j])) == NULL) {
+      log_err("bench: unknown workload '%s'\n", argv[j]);
+      return -1;
+    }
+    n_selected++;
+  }
+
+  if (n_selected == 0) {
+    for (i = 0; i < N_WORKLOADS; i++) {
+      selected[n_selected++] = &bench_workloads[i];
+    }
+  }
+
+  printf("{\n");
+  printf("  \"frames\": %u,\n", n_frames);
+  printf("  \"workloads\": [\n");
+
+  for (i = 0; i < n_selected; i++) {
+    bench_workload_run(selected[i], n_frames, i == n_selected - 1);
+  }
+
+  printf("  ]\n");
+  printf("}\n");
+
+  return 0;
+}
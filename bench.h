@@ -0,0 +1,11 @@
+#ifndef __BENCH_H
+#define __BENCH_H
+
+
+#include "defs.h"
+
+
+int bench_run(int argc, char* argv[]);
+
+
+#endif  /* __BENCH_H */
@@ -3,6 +3,7 @@
 #include "log.h"
 #include "memory.h"
 #include "nextreg.h"
+#include "rewind.h"
 #include "utils.h"
 
 
@@ -19,7 +20,7 @@ typedef struct bootrom_t {
 } bootrom_t;
 
 
-static bootrom_t self;
+static MACHINE_LOCAL bootrom_t self;
 
 
 int bootrom_init(u8_t* sram) {
@@ -37,6 +38,9 @@ int bootrom_init(u8_t* sram) {
   }
 
   self.is_active = 1;
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -1,36 +1,34 @@
 #include <SDL2/SDL.h>
+#include <stdatomic.h>
+#include <string.h>
 #include "buffer.h"
 #include "defs.h"
 #include "log.h"
 
 
-int buffer_init(buffer_t* buffer, size_t size) {
-  buffer->size      = size;
-  buffer->data      = malloc(size);
-  buffer->mutex     = SDL_CreateMutex();
-  buffer->element_added = SDL_CreateCond();
-  buffer->element_removed  = SDL_CreateCond();
+#define MIN(a,b)  ((a) < (b) ? (a) : (b))
 
-  if (buffer->data == NULL || buffer->mutex == NULL || buffer->element_added == NULL || buffer->element_removed == NULL) {
-    log_wrn("buffer: out of memory\n");
+/* Upper bound on a missed wake-up of a blocked producer. */
+#define MAX_WAIT_SLICE_MS  10
+
+
+int buffer_init(buffer_t* buffer, size_t size) {
+  if (size & (size - 1)) {
+    log_err("buffer: size %lu is not a power of two\n", size);
+    return 1;
+  }
 
-    if (buffer->data) {
-      free(buffer->data);
-      buffer->data = NULL;
-    }
-    if (buffer->mutex) {
-      SDL_DestroyMutex(buffer->mutex);
-      buffer->mutex = NULL;
-    }
-    if (buffer->element_added) {
-      SDL_DestroyCond(buffer->element_added);
-      buffer->element_added = NULL;
-    }
-    if (buffer->element_removed) {
-      SDL_DestroyCond(buffer->element_removed);
-      buffer->element_removed = NULL;
-    }
+  buffer->size            = size;
+  buffer->data            = malloc(size);
+  buffer->mutex           = SDL_CreateMutex();
+  buffer->element_removed = SDL_CreateCond();
+  atomic_init(&buffer->read_index,          0);
+  atomic_init(&buffer->write_index,         0);
+  atomic_init(&buffer->is_producer_waiting, 0);
 
+  if (buffer->data == NULL || buffer->mutex == NULL || buffer->element_removed == NULL) {
+    log_wrn("buffer: out of memory\n");
+    buffer_finit(buffer);
     return 1;
   }
 
@@ -47,10 +45,6 @@ void buffer_finit(buffer_t* buffer) {
     SDL_DestroyMutex(buffer->mutex);
     buffer->mutex = NULL;
   }
-  if (buffer->element_added) {
-    SDL_DestroyCond(buffer->element_added);
-    buffer->element_added = NULL;
-  }
   if (buffer->element_removed) {
     SDL_DestroyCond(buffer->element_removed);
     buffer->element_removed = NULL;
@@ -58,67 +52,138 @@ void buffer_finit(buffer_t* buffer) {
 }
 
 
+/**
+ * Copies between the ring and a linear array, in at most two spans.
+ */
+static void buffer_copy_out(buffer_t* buffer, size_t index, size_t n, u8_t* values) {
+  const size_t start   = index & (buffer->size - 1);
+  const size_t n_first = MIN(n, buffer->size - start);
+
+  memcpy(values, &buffer->data[start], n_first);
+  memcpy(&values[n_first], buffer->data, n - n_first);
+}
+
+
+static void buffer_copy_in(buffer_t* buffer, size_t index, size_t n, const u8_t* values) {
+  const size_t start   = index & (buffer->size - 1);
+  const size_t n_first = MIN(n, buffer->size - start);
+
+  memcpy(&buffer->data[start], values, n_first);
+  memcpy(buffer->data, &values[n_first], n - n_first);
+}
+
+
+/**
+ * Discards everything written so far.
+ */
 void buffer_reset(buffer_t* buffer) {
-  buffer->read_index = 0;
-  buffer->n_elements = 0;
+  const size_t write_index = atomic_load_explicit(&buffer->write_index, memory_order_acquire);
+
+  atomic_store_explicit(&buffer->read_index, write_index, memory_order_release);
 }
 
 
-size_t buffer_read_n(buffer_t* buffer, size_t n, u8_t* values) {
-  size_t i;
+size_t buffer_used(buffer_t* buffer) {
+  const size_t write_index = atomic_load_explicit(&buffer->write_index, memory_order_acquire);
+  const size_t read_index  = atomic_load_explicit(&buffer->read_index,  memory_order_relaxed);
 
-  SDL_LockMutex(buffer->mutex);
+  return write_index - read_index;
+}
 
-  for (i = 0; buffer->n_elements && (i < n); i++) {
-    if (values) {
-      values[i] = buffer->data[buffer->read_index];
-    }
-    buffer->n_elements--;
-    buffer->read_index = (buffer->read_index + 1) % buffer->size;
-  }
 
-  if (n > 0) {
-    SDL_CondSignal(buffer->element_removed);
+size_t buffer_peek_n(buffer_t* buffer, size_t index, size_t n, u8_t* values) {
+  const size_t used = buffer_used(buffer);
+
+  if (index >= used) {
+    return 0;
   }
 
-  SDL_UnlockMutex(buffer->mutex);
+  n = MIN(n, used - index);
+  buffer_copy_out(buffer, atomic_load_explicit(&buffer->read_index, memory_order_relaxed) + index, n, values);
 
-  return i;
+  return n;
 }
 
 
-size_t buffer_peek_n(buffer_t* buffer, size_t index, size_t n, u8_t* values) {
-  size_t i;
+/**
+ * Reads up to n values, or skips them when values is NULL.
+ */
+size_t buffer_read_n(buffer_t* buffer, size_t n, u8_t* values) {
+  const size_t read_index = atomic_load_explicit(&buffer->read_index, memory_order_relaxed);
 
-  SDL_LockMutex(buffer->mutex);
+  n = MIN(n, buffer_used(buffer));
+  if (n == 0) {
+    return 0;
+  }
 
-  for (i = 0; (index + i < buffer->n_elements) && (i < n); i++) {
-    values[i] = buffer->data[(buffer->read_index + index + i) % buffer->size];
+  if (values) {
+    buffer_copy_out(buffer, read_index, n, values);
   }
 
-  SDL_UnlockMutex(buffer->mutex);
+  atomic_store_explicit(&buffer->read_index, read_index + n, memory_order_release);
+
+  if (atomic_load_explicit(&buffer->is_producer_waiting, memory_order_relaxed)) {
+    SDL_LockMutex(buffer->mutex);
+    SDL_CondSignal(buffer->element_removed);
+    SDL_UnlockMutex(buffer->mutex);
+  }
 
-  return i;
+  return n;
+}
+
+
+size_t buffer_free(buffer_t* buffer) {
+  const size_t read_index  = atomic_load_explicit(&buffer->read_index,  memory_order_acquire);
+  const size_t write_index = atomic_load_explicit(&buffer->write_index, memory_order_relaxed);
+
+  return buffer->size - (write_index - read_index);
 }
 
 
 size_t buffer_write(buffer_t* buffer, u8_t value) {
+  return buffer_write_n(buffer, 1, &value);
+}
 
-  SDL_LockMutex(buffer->mutex);
 
-  if (buffer->n_elements == buffer->size) {
-    SDL_UnlockMutex(buffer->mutex);
+/**
+ * Writes either all values, or none at all when they do not fit. The
+ * consumer sees them all at once.
+ */
+size_t buffer_write_n(buffer_t* buffer, size_t n, const u8_t* values) {
+  const size_t write_index = atomic_load_explicit(&buffer->write_index, memory_order_relaxed);
+
+  if (buffer_free(buffer) < n) {
     return 0;
   }
 
-  buffer->data[(buffer->read_index + buffer->n_elements) % buffer->size] = value;
-  buffer->n_elements++;
+  buffer_copy_in(buffer, write_index, n, values);
+  atomic_store_explicit(&buffer->write_index, write_index + n, memory_order_release);
 
-  SDL_CondSignal(buffer->element_added);
-
-  SDL_UnlockMutex(buffer->mutex);
-  
-  return 1;
+  return n;
 }
 
 
+/**
+ * Blocks the producer until there is room for n values, or until the
+ * timeout expires. Returns zero when there is room.
+ */
+int buffer_wait_free(buffer_t* buffer, size_t n, u32_t timeout_ms) {
+  const u32_t start = SDL_GetTicks();
+
+  if (n > buffer->size) {
+    return -1;
+  }
+
+  SDL_LockMutex(buffer->mutex);
+  atomic_store(&buffer->is_producer_waiting, 1);
+
+  while (buffer_free(buffer) < n && SDL_GetTicks() - start < timeout_ms) {
+    /* A read racing the flag goes unnoticed, hence wait in slices. */
+    SDL_CondWaitTimeout(buffer->element_removed, buffer->mutex, MAX_WAIT_SLICE_MS);
+  }
+
+  atomic_store(&buffer->is_producer_waiting, 0);
+  SDL_UnlockMutex(buffer->mutex);
+
+  return buffer_free(buffer) < n ? -1 : 0;
+}
@@ -3,26 +3,40 @@
 
 
 #include <SDL2/SDL.h>
+#include <stdatomic.h>
 #include "defs.h"
 
 
+/**
+ * Lock-free ring buffer for a single producer and a single consumer, which
+ * may live in different threads. The indices run freely and are masked on
+ * access, hence the size must be a power of two.
+ */
 typedef struct {
-  u8_t*      data;
-  size_t     size;
-  size_t     read_index;
-  size_t     n_elements;
-  SDL_mutex* mutex;
-  SDL_cond*  element_added;
-  SDL_cond*  element_removed;
+  u8_t*         data;
+  size_t        size;
+  atomic_size_t read_index;           /* Written by the consumer only. */
+  atomic_size_t write_index;          /* Written by the producer only. */
+  atomic_int    is_producer_waiting;
+  SDL_mutex*    mutex;                /* Only used to block the producer. */
+  SDL_cond*     element_removed;
 } buffer_t;
 
 
 int    buffer_init(buffer_t* buffer, size_t size);
 void   buffer_finit(buffer_t* buffer);
+
+/* Consumer side. */
 void   buffer_reset(buffer_t* buffer);
+size_t buffer_used(buffer_t* buffer);
 size_t buffer_peek_n(buffer_t* buffer, size_t index, size_t n, u8_t* values);
 size_t buffer_read_n(buffer_t* buffer, size_t n, u8_t* values);
+
+/* Producer side. */
+size_t buffer_free(buffer_t* buffer);
 size_t buffer_write(buffer_t* buffer, u8_t value);
+size_t buffer_write_n(buffer_t* buffer, size_t n, const u8_t* values);
+int    buffer_wait_free(buffer_t* buffer, size_t n, u32_t timeout_ms);
 
 
 #endif  /* __BUFFER_H */
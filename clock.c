@@ -3,9 +3,13 @@
 #include "ay.h"
 #include "clock.h"
 #include "defs.h"
+#include "dma.h"
 #include "log.h"
 #include "main.h"
+#include "rewind.h"
 #include "slu.h"
+#include "stats.h"
+#include "uart.h"
 #include "ula.h"
 
 
@@ -21,26 +25,67 @@ static const u32_t clock_28mhz[E_TIMING_LAST - E_TIMING_FIRST + 1] = {
 };
 
 
+/* Number of 28 MHz ticks per CPU tick, per CPU speed. */
+static const unsigned int clock_divider[E_CPU_SPEED_LAST - E_CPU_SPEED_FIRST + 1] = {
+  8, 4, 2, 1
+};
+
+
 typedef struct clck_t {
   timing_t    clock_timing;
   cpu_speed_t cpu_speed;
   u64_t       ticks_28mhz;      /* At max dot clock overflows in 20k years. */
   u64_t       sync_14mhz;       /* Last 28 MHz tick where we synced the 14 MHz ULA clck. */
   u64_t       sync_2mhz;        /* Last 28 MHz tick where we synced the 1.75 MHz AY-3-8912 clck. */
-  u64_t       sync_host_next;   /* Next moment at which to sync with reality. */
+  u64_t       events[E_CLOCK_EVENT_LAST - E_CLOCK_EVENT_FIRST + 1];  /* When each event fires. */
+  u64_t       next_event;       /* Earliest of the above. */
+  int         is_timed;         /* Whether to time the subsystems, refreshed on host sync. */
 } clck_t;
 
 
-static clck_t clck;
+static MACHINE_LOCAL clck_t clck;
+
+
+static void clock_next_event_update(void) {
+  clck.next_event = CLOCK_EVENT_NEVER;
+  for (clock_event_t event = E_CLOCK_EVENT_FIRST; event <= E_CLOCK_EVENT_LAST; event++) {
+    if (clck.events[event] < clck.next_event) {
+      clck.next_event = clck.events[event];
+    }
+  }
+}
+
+
+void clock_event_schedule(clock_event_t event, u64_t ticks_28mhz) {
+  clck.events[event] = ticks_28mhz;
+  clock_next_event_update();
+}
+
+
+void clock_event_cancel(clock_event_t event) {
+  clock_event_schedule(event, CLOCK_EVENT_NEVER);
+}
+
+
+u64_t clock_event_get(clock_event_t event) {
+  return clck.events[event];
+}
 
 
 int clock_init(void) {
-  clck.clock_timing   = E_TIMING_HDMI;
-  clck.cpu_speed      = E_CPU_SPEED_3MHZ;
-  clck.ticks_28mhz    = 0;
-  clck.sync_14mhz     = clck.ticks_28mhz;
-  clck.sync_2mhz      = clck.ticks_28mhz;
-  clck.sync_host_next = clck.ticks_28mhz + main_next_host_sync_get(clock_28mhz[clck.clock_timing]);
+  clck.clock_timing = E_TIMING_HDMI;
+  clck.cpu_speed    = E_CPU_SPEED_3MHZ;
+  clck.ticks_28mhz  = 0;
+  clck.sync_14mhz   = clck.ticks_28mhz;
+  clck.sync_2mhz    = clck.ticks_28mhz;
+  clck.is_timed     = 0;
+
+  for (clock_event_t event = E_CLOCK_EVENT_FIRST; event <= E_CLOCK_EVENT_LAST; event++) {
+    clck.events[event] = CLOCK_EVENT_NEVER;
+  }
+  clock_event_schedule(E_CLOCK_EVENT_HOST_SYNC, clck.ticks_28mhz + main_next_host_sync_get(clock_28mhz[clck.clock_timing]));
+
+  rewind_register(&clck, sizeof(clck), NULL);
 
   return 0;
 }
@@ -62,13 +107,14 @@ cpu_speed_t clock_cpu_speed_get(void) {
 
 void clock_cpu_speed_set(cpu_speed_t speed) {
   clck.cpu_speed = speed;
+  ula_contention_refresh();
 
   main_show_cpu_speed(clck.cpu_speed);
 }
 
 
 inline
-static void clock_run_28mhz_ticks(u64_t ticks) {
+static void clock_advance(u64_t ticks) {
   u32_t ticks_14mhz;
   u32_t ticks_2mhz;
 
@@ -78,41 +124,139 @@ static void clock_run_28mhz_ticks(u64_t ticks) {
   /* Update 14 MHz clock for SLU. */
   ticks_14mhz = (clck.ticks_28mhz - clck.sync_14mhz) / 2;
   if (ticks_14mhz > 0) {
-    slu_run(ticks_14mhz);
+    if (clck.is_timed) {
+      const u64_t start = stats_now();
+      slu_run(ticks_14mhz);
+      stats_timer_add(E_STATS_TIMER_SLU, start);
+    } else {
+      slu_run(ticks_14mhz);
+    }
     clck.sync_14mhz += ticks_14mhz * 2;
   }
 
   /* Update 2 MHz clock for AY. */
   ticks_2mhz = (clck.ticks_28mhz - clck.sync_2mhz) / 16;
   if (ticks_2mhz > 0) {
-    ay_run(ticks_2mhz);
+    if (clck.is_timed) {
+      const u64_t start = stats_now();
+      ay_run(ticks_2mhz);
+      stats_timer_add(E_STATS_TIMER_AY, start);
+    } else {
+      ay_run(ticks_2mhz);
+    }
     clck.sync_2mhz += ticks_2mhz * 16;
   }
+}
+
+
+static void clock_host_sync(void) {
+  const u64_t start = stats_now();
+
+  main_sync();
+  stats_timer_add(E_STATS_TIMER_SYNC, start);
+  stats_sync(clck.ticks_28mhz, clock_28mhz[clck.clock_timing]);
+  clck.is_timed = stats_is_enabled();
+
+  clock_event_schedule(E_CLOCK_EVENT_HOST_SYNC, clck.ticks_28mhz + main_next_host_sync_get(clock_28mhz[clck.clock_timing]));
+}
+
+
+/**
+ * Fires all events that are due. Events are one-shot and are unscheduled
+ * before their handler runs, which may advance the clock and reschedule.
+ */
+static void clock_events_fire(void) {
+  for (clock_event_t event = E_CLOCK_EVENT_FIRST; event <= E_CLOCK_EVENT_LAST; event++) {
+    if (clck.events[event] > clck.ticks_28mhz) {
+      continue;
+    }
+
+    clock_event_cancel(event);
+
+    switch (event) {
+      case E_CLOCK_EVENT_HOST_SYNC:
+        clock_host_sync();
+        break;
+
+      case E_CLOCK_EVENT_DMA:
+        dma_clock_event();
+        break;
+
+      case E_CLOCK_EVENT_UART_RX:
+        uart_rx_clock_event();
+        break;
+
+      case E_CLOCK_EVENT_UART_TX:
+        uart_tx_clock_event();
+        break;
+    }
+  }
+}
 
-  if (clck.ticks_28mhz >= clck.sync_host_next) {
-    main_sync();
-    clck.sync_host_next = clck.ticks_28mhz + main_next_host_sync_get(clock_28mhz[clck.clock_timing]);
+
+/**
+ * Advances the clock, stopping at each event on the way. Time spent by event
+ * handlers, e.g. a DMA transfer holding the bus, comes on top of the ticks
+ * asked for, unless the caller is idle and merely waiting for time to pass.
+ */
+inline
+static void clock_run_28mhz_ticks_internal(u64_t ticks, int is_idle) {
+  while (clck.ticks_28mhz + ticks >= clck.next_event) {
+    const u64_t start = clck.ticks_28mhz;
+    const u64_t until = (clck.next_event > start) ? clck.next_event - start : 0;
+    u64_t       spent;
+
+    clock_advance(until);
+    clock_events_fire();
+
+    spent  = is_idle ? clck.ticks_28mhz - start : until;
+    ticks -= (spent < ticks) ? spent : ticks;
   }
+
+  clock_advance(ticks);
+}
+
+
+inline
+static void clock_run_28mhz_ticks(u64_t ticks) {
+  clock_run_28mhz_ticks_internal(ticks, 0);
+}
+
+
+inline
+static void clock_wait_28mhz_ticks(u64_t ticks) {
+  clock_run_28mhz_ticks_internal(ticks, 1);
 }
 
 
 inline
 static void clock_run_inline(u32_t cpu_ticks) {
-  const unsigned int clock_divider[E_CPU_SPEED_LAST - E_CPU_SPEED_FIRST + 1] = {
-    8, 4, 2, 1
-  };
   clock_run_28mhz_ticks(cpu_ticks * clock_divider[clck.cpu_speed]);
 }
 
 
 void clock_run(u32_t cpu_ticks) {
-  const unsigned int clock_divider[E_CPU_SPEED_LAST - E_CPU_SPEED_FIRST + 1] = {
-    8, 4, 2, 1
-  };
   clock_run_28mhz_ticks(cpu_ticks * clock_divider[clck.cpu_speed]);
 }
 
 
+/**
+ * Returns how many CPU ticks can pass before the first tick on which
+ * something might happen that the CPU has to respond to: a clock event, an
+ * IRQ being raised or the copper waking up.
+ */
+static u64_t clock_cpu_ticks_until_irq(void) {
+  const u64_t lag     = clck.ticks_28mhz - clck.sync_14mhz;
+  u64_t       horizon = 2 * (u64_t) slu_ticks_until_irq() - lag;
+
+  if (clck.next_event < clck.ticks_28mhz + horizon) {
+    horizon = (clck.next_event > clck.ticks_28mhz) ? clck.next_event - clck.ticks_28mhz : 0;
+  }
+
+  return (horizon > 0) ? (horizon - 1) / clock_divider[clck.cpu_speed] : 0;
+}
+
+
 u32_t clock_28mhz_get(void) {
   return clock_28mhz[clck.clock_timing];
 }
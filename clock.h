@@ -5,6 +5,20 @@
 #include "defs.h"
 
 
+#define CLOCK_EVENT_NEVER  0xFFFFFFFFFFFFFFFFULL
+
+
+/* Events that fire at a given 28 MHz tick. */
+typedef enum clock_event_t {
+  E_CLOCK_EVENT_FIRST     = 0,
+  E_CLOCK_EVENT_HOST_SYNC = E_CLOCK_EVENT_FIRST,
+  E_CLOCK_EVENT_DMA,
+  E_CLOCK_EVENT_UART_RX,
+  E_CLOCK_EVENT_UART_TX,
+  E_CLOCK_EVENT_LAST      = E_CLOCK_EVENT_UART_TX
+} clock_event_t;
+
+
 int         clock_init(void);
 void        clock_finit(void);
 cpu_speed_t clock_cpu_speed_get(void);
@@ -15,6 +29,9 @@ u32_t       clock_28mhz_get(void);
 timing_t    clock_timing_get(void);
 u8_t        clock_timing_read(void);
 void        clock_timing_write(u8_t value);
+void        clock_event_schedule(clock_event_t event, u64_t ticks_28mhz);
+void        clock_event_cancel(clock_event_t event);
+u64_t       clock_event_get(clock_event_t event);
 
 
 #endif  /* __CLOCK_H */
@@ -1,6 +1,7 @@
 #include "defs.h"
 #include "log.h"
 #include "memory.h"
+#include "rewind.h"
 
 
 typedef struct config_t {
@@ -11,7 +12,7 @@ typedef struct config_t {
 } config_t;
 
 
-static config_t self;
+static MACHINE_LOCAL config_t self;
 
 
 int config_init(u8_t* sram) {
@@ -20,6 +21,8 @@ int config_init(u8_t* sram) {
   self.rom_ram_bank_base = 0;
   self.is_active         = 1;
 
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -66,7 +69,14 @@ void config_write(u16_t address, u8_t value) {
 }
 
 
+u32_t config_sram_offset(u16_t address) {
+  return self.rom_ram_bank_base + address;
+}
+
+
 void config_set_rom_ram_bank(u8_t bank) {
   self.rom_ram_bank      = bank;
   self.rom_ram_bank_base = bank * 16 * 1024;
+
+  memory_remapped(0, 2);
 }
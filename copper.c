@@ -5,6 +5,8 @@
 #include "copper.h"
 #include "log.h"
 #include "nextreg.h"
+#include "rewind.h"
+#include "slu.h"
 
 
 /**
@@ -37,6 +39,16 @@ typedef enum opcode_t {
 } opcode_t;
 
 
+/* Decoded form of an instruction. */
+typedef struct compiled_t {
+  opcode_t opcode;
+  u32_t    wait_row;
+  u32_t    wait_column;
+  u8_t     move_reg;
+  u8_t     move_value;
+} compiled_t;
+
+
 typedef struct copper_t {
   u16_t         cpc;      /** 0 - 1023 */
   u16_t         address;  /** 0 - 2047 */
@@ -44,21 +56,56 @@ typedef struct copper_t {
   u8_t          cached;
   int           is_running;
   int           do_reset_pc_on_irq;
-  int           do_move_wait_one_cycle;
-  opcode_t      opcode;
-  u32_t         wait_row;
-  u32_t         wait_column;
-  u8_t          move_reg;
-  u8_t          move_value;
+  int           is_move_pending;  /* Second cycle of a MOVE. */
+  compiled_t    current;
 } copper_t;
 
 
-static copper_t copper;
+static MACHINE_LOCAL copper_t copper;
+
+
+/**
+ * Every instruction decoded, kept in step with the program as it is
+ * written. Derived from the program, hence kept out of it.
+ */
+static MACHINE_LOCAL compiled_t copper_compiled[1024];
+
+
+/**
+ * Decodes the instruction at the given index.
+ */
+static void copper_compile(u16_t index) {
+  const u16_t instruction = (copper.instructions[index].msb << 8) | copper.instructions[index].lsb;
+  compiled_t* compiled    = &copper_compiled[index];
+
+  if (instruction == 0x0000) {
+    compiled->opcode      = E_OPCODE_NOOP;
+  } else if (instruction & 0x8000) {
+    compiled->opcode      = E_OPCODE_WAIT;
+    compiled->wait_row    = instruction & 0x01FF;
+    compiled->wait_column = (instruction & 0x7E00) >> 5;  /* (>> 6) * 2 b/c sub-pixel beam */
+  } else {
+    compiled->opcode      = E_OPCODE_MOVE;
+    compiled->move_reg    = (instruction & 0x7F00) >> 8;
+    compiled->move_value  = instruction & 0x00FF;
+  }
+}
+
+
+static void copper_compile_all(void) {
+  for (u16_t i = 0; i < 1024; i++) {
+    copper_compile(i);
+  }
+}
 
 
 int copper_init(void) {
   memset(&copper, 0, sizeof(copper));
   copper_reset(E_RESET_HARD);
+  copper_compile_all();
+
+  rewind_register(&copper, sizeof(copper), copper_compile_all);
+
   return 0;
 }
 
@@ -75,15 +122,17 @@ void copper_reset(reset_t reset) {
 
 void copper_data_8bit_write(u8_t value) {
   ((u8_t*) copper.instructions)[copper.address] = value;
+  copper_compile(copper.address >> 1);
   copper.address = (copper.address + 1) & 0x7FF;
 }
 
 
 void copper_data_16bit_write(u8_t value)  {
   if (copper.address & 1) {
-    const u16_t even = copper.address - 1;
-    copper.instructions[even].msb = copper.cached;
-    copper.instructions[even].lsb = value;
+    const u16_t index = copper.address >> 1;
+    copper.instructions[index].msb = copper.cached;
+    copper.instructions[index].lsb = value;
+    copper_compile(index);
   } else {
     copper.cached = value;
   }
@@ -103,20 +152,8 @@ u16_t copper_program_get(u16_t address) {
 
 
 static void copper_decode(void) {
-  const u16_t instruction = (copper.instructions[copper.cpc].msb << 8) | copper.instructions[copper.cpc].lsb;
-    
-  if (instruction == 0x0000) {
-    copper.opcode = E_OPCODE_NOOP;
-  } else if (instruction & 0x8000) {
-    copper.opcode      = E_OPCODE_WAIT;
-    copper.wait_row    = instruction & 0x01FF;
-    copper.wait_column = (instruction & 0x7E00) >> 5;  /* (>> 6) * 2 b/c sub-pixel beam */
-  } else {      
-    copper.opcode                 = E_OPCODE_MOVE;
-    copper.move_reg               = (instruction & 0x7F00) >> 8;
-    copper.move_value             = instruction & 0x00FF;
-    copper.do_move_wait_one_cycle = 1;
-  }
+  copper.current         = copper_compiled[copper.cpc];
+  copper.is_move_pending = 0;
 }
 
 
@@ -129,10 +166,9 @@ void copper_control_write(u8_t value) {
       break;
 
     case 1:
-      copper.cpc                    = 0;
-      copper.do_move_wait_one_cycle = 0;
-      copper.do_reset_pc_on_irq     = 0;
-      copper.is_running             = 1;
+      copper.cpc                = 0;
+      copper.do_reset_pc_on_irq = 0;
+      copper.is_running         = 1;
       break;
 
     case 2:
@@ -141,26 +177,50 @@ void copper_control_write(u8_t value) {
       break;
 
     case 3:
-      copper.cpc                    = 0;
-      copper.do_move_wait_one_cycle = 0;
-      copper.do_reset_pc_on_irq     = 1;
-      copper.is_running             = 1;
+      copper.cpc                = 0;
+      copper.do_reset_pc_on_irq = 1;
+      copper.is_running         = 1;
       break;
   }
 
   if (copper.is_running) {
     copper_decode();
   }
+
+  slu_copper_wake();
+}
+
+
+/**
+ * Number of 14 MHz ticks from the current beam position until the one a
+ * WAIT matches at, minus the tick on which this is called.
+ */
+static u32_t copper_ticks_until_wait(u32_t beam_row, u32_t beam_column, u32_t display_rows, u32_t display_columns) {
+  if (copper.current.wait_row >= display_rows) {
+    /* Never matches, until the program counter is reset. */
+    return COPPER_SLEEP_FOREVER;
+  }
+
+  if (beam_row == copper.current.wait_row) {
+    return copper.current.wait_column - beam_column - 1;
+  }
+
+  return ((copper.current.wait_row + display_rows - beam_row) % display_rows) * display_columns + copper.current.wait_column - beam_column - 1;
 }
 
 
-void copper_tick(u32_t beam_row, u32_t beam_column, int ticks_28mhz) {
+/**
+ * Runs the copper for a number of 28 MHz ticks at the given beam position.
+ * Returns how many 14 MHz ticks it can sleep before it needs to be called
+ * again, which is non-zero only while it waits for the beam.
+ */
+u32_t copper_tick(u32_t beam_row, u32_t beam_column, int ticks_28mhz, u32_t display_rows, u32_t display_columns) {
   if (!copper.is_running) {
-    return;
+    return COPPER_SLEEP_FOREVER;
   }
 
   for (int tick = 0; tick < ticks_28mhz; tick++) {
-    switch (copper.opcode) {
+    switch (copper.current.opcode) {
       case E_OPCODE_NOOP:
         /* NOOP: 1 cycle. */
         copper.cpc = (copper.cpc + 1) & 0x3FF;
@@ -169,25 +229,31 @@ void copper_tick(u32_t beam_row, u32_t beam_column, int ticks_28mhz) {
 
       case E_OPCODE_WAIT:
         /* WAIT: 1 cycle. */
-        if (beam_row == copper.wait_row && beam_column >= copper.wait_column) {
+        if (beam_row == copper.current.wait_row && beam_column >= copper.current.wait_column) {
           copper.cpc = (copper.cpc + 1) & 0x3FF;
           copper_decode();
+        } else if (tick == 0) {
+          /* Sleep until the beam is where we need it. */
+          return copper_ticks_until_wait(beam_row, beam_column, display_rows, display_columns);
         } else {
-          /* No need to waste cycles if the beam is not where we need it. */
-          return;
+          return 0;
         }
         break;
 
       case E_OPCODE_MOVE:
-        /* MOVE: 2 cycles. */
-        if (copper.do_move_wait_one_cycle) {
-          nextreg_write_internal(copper.move_reg, copper.move_value);
-          copper.cpc  = (copper.cpc + 1) & 0x3FF;
+        /* MOVE: 2 cycles, the write happens in the first. */
+        if (!copper.is_move_pending) {
+          nextreg_write_internal(copper.current.move_reg, copper.current.move_value);
+          copper.is_move_pending = 1;
+        } else {
+          copper.cpc = (copper.cpc + 1) & 0x3FF;
           copper_decode();
         }
-        copper.do_move_wait_one_cycle = !copper.do_move_wait_one_cycle;
+        break;
     }
   }
+
+  return 0;
 }
 
 
@@ -195,5 +261,6 @@ void copper_irq(void) {
   if (copper.do_reset_pc_on_irq) {
     copper.cpc = 0;
     copper_decode();
+    slu_copper_wake();
   }
 }
@@ -5,6 +5,9 @@
 #include "defs.h"
 
 
+#define COPPER_SLEEP_FOREVER  0xFFFFFFFF
+
+
 int   copper_init(void);
 void  copper_finit(void);
 void  copper_reset(reset_t reset);
@@ -14,7 +17,7 @@ void  copper_address_write(u8_t value);
 void  copper_control_write(u8_t value);
 void  copper_irq(void);
 u16_t copper_program_get(u16_t address);
-void copper_tick(u32_t beam_row, u32_t beam_column, int ticks_28mhz);
+u32_t copper_tick(u32_t beam_row, u32_t beam_column, int ticks_28mhz, u32_t display_rows, u32_t display_columns);
 
 
 #endif  /* __COPPER_H */
@@ -10,6 +10,7 @@
 #include "memory.h"
 #include "mf.h"
 #include "nextreg.h"
+#include "rewind.h"
 
 
 #include "clock.c"
@@ -146,12 +147,263 @@ static const u8_t parity[256] = {
 
 /* Look-up tables to set multiple flags at once and prevent needing to
  * calculate things every time. */
-static u8_t sz53[256];
-static u8_t sz53p[256];
+static MACHINE_LOCAL u8_t sz53[256];
+static MACHINE_LOCAL u8_t sz53p[256];
 
 
 /* Local-global cpu for fast reference. */
-static cpu_t self;
+static MACHINE_LOCAL cpu_t self;
+
+
+/* Ticks taken by an iteration of a block instruction that repeats, which
+ * includes fetching the instruction again. */
+#define LDXR_REPEAT_TICKS  21
+#define LXRX_REPEAT_TICKS  21  /* At most, when the byte is written. */
+#define INXR_REPEAT_TICKS  26
+#define OTXR_REPEAT_TICKS  21
+
+
+/**
+ * Returns how many CPU ticks can pass in one go from the current instruction
+ * boundary, without anything getting a chance to interrupt or stop the CPU.
+ */
+static u64_t cpu_ticks_uninterrupted(void) {
+  if ((self.requests & (CPU_REQUEST_RESET | CPU_REQUEST_NMI)) || ((self.requests & CPU_REQUEST_IRQ) && IFF1) || dma.is_stepped) {
+    return 0;
+  }
+
+  /* Allow the debugger to stop at the instruction. */
+  if (debug_is_breakpoint(PC)) {
+    return 0;
+  }
+
+  /* Fetching the instruction again, ED and all for a block instruction, may
+   * be contended. */
+  if (memory_may_contend(PC) || memory_may_contend(PC + 1)) {
+    return 0;
+  }
+
+  return clock_cpu_ticks_until_irq();
+}
+
+
+/**
+ * Returns how many more iterations of a repeating block instruction can run
+ * in a batch, given how many are left. The last one is always stepped, as it
+ * differs in timing and flags.
+ */
+static u32_t cpu_block_iterations(u32_t repeat_ticks, u32_t left) {
+  const u64_t n = cpu_ticks_uninterrupted() / repeat_ticks;
+  return (n < left - 1) ? (u32_t) n : left - 1;
+}
+
+
+/**
+ * Returns how many bytes can be written from an address onwards before the
+ * block instruction itself is overwritten, which must then be fetched anew.
+ */
+static u32_t cpu_block_bytes_until_pc(u16_t address, int delta) {
+  const u16_t to_opcode = (u16_t) ((PC - address) * delta);
+  const u16_t to_suffix = (u16_t) ((PC + 1 - address) * delta);
+  return (to_opcode < to_suffix) ? to_opcode : to_suffix;
+}
+
+
+static u32_t cpu_block_min(u32_t a, u32_t b) {
+  return (a < b) ? a : b;
+}
+
+
+/**
+ * Accounts for a batch of block instruction iterations, each of which
+ * would have fetched the instruction once more.
+ */
+static void cpu_block_batched(u32_t n, u32_t ticks) {
+  R = (R & 0x80) | ((R + n) & 0x7F);
+  T(ticks);
+}
+
+
+/**
+ * LDIR and LDDR, once the first iteration has run and asked to repeat.
+ */
+static void cpu_ldxr_batch(int delta) {
+  u32_t n = cpu_block_iterations(LDXR_REPEAT_TICKS, BC);
+  u8_t* src;
+  u8_t* dst;
+  u32_t i;
+
+  n = cpu_block_min(n, memory_page_run_length(HL, delta));
+  n = cpu_block_min(n, memory_page_run_length(DE, delta));
+  n = cpu_block_min(n, cpu_block_bytes_until_pc(DE, delta));
+  if (n == 0) {
+    return;
+  }
+
+  src = memory_host_pointer(HL, 0);
+  dst = memory_host_pointer(DE, 1);
+  if (src == NULL || dst == NULL) {
+    return;
+  }
+
+  /* Byte by byte, as overlapping copies are used to fill memory. */
+  for (i = 0; i < n; i++) {
+    *dst = *src;
+    src += delta;
+    dst += delta;
+  }
+
+  HL += delta * (int) n;
+  DE += delta * (int) n;
+  BC -= n;
+
+  cpu_block_batched(n, n * LDXR_REPEAT_TICKS);
+}
+
+
+/**
+ * LDIRX and LDDRX, which skip bytes equal to A.
+ */
+static void cpu_lxrx_batch(int delta) {
+  u32_t n     = cpu_block_iterations(LXRX_REPEAT_TICKS, BC);
+  u32_t ticks = 0;
+  u8_t* src;
+  u8_t* dst;
+  u32_t i;
+
+  n = cpu_block_min(n, memory_page_run_length(HL, delta));
+  n = cpu_block_min(n, memory_page_run_length(DE, delta));
+  n = cpu_block_min(n, cpu_block_bytes_until_pc(DE, delta));
+  if (n == 0) {
+    return;
+  }
+
+  src = memory_host_pointer(HL, 0);
+  dst = memory_host_pointer(DE, 1);
+  if (src == NULL || dst == NULL) {
+    return;
+  }
+
+  for (i = 0; i < n; i++) {
+    if (*src != A) {
+      *dst   = *src;
+      ticks += LXRX_REPEAT_TICKS;
+    } else {
+      ticks += LXRX_REPEAT_TICKS - 5;
+    }
+    src += delta;
+    dst += delta;
+  }
+
+  HL += delta * (int) n;
+  DE += delta * (int) n;
+  BC -= n;
+
+  cpu_block_batched(n, ticks);
+}
+
+
+/**
+ * LDPIRX, which copies from an eight-byte pattern at HL, indexed by E.
+ */
+static void cpu_ldpirx_batch(void) {
+  u32_t n     = cpu_block_iterations(LXRX_REPEAT_TICKS, BC);
+  u32_t ticks = 0;
+  u8_t* pattern;
+  u8_t* dst;
+  u32_t i;
+
+  n = cpu_block_min(n, memory_page_run_length(DE, +1));
+  n = cpu_block_min(n, cpu_block_bytes_until_pc(DE, +1));
+  if (n == 0) {
+    return;
+  }
+
+  pattern = memory_host_pointer(HL & 0xFFF8, 0);
+  dst     = memory_host_pointer(DE, 1);
+  if (pattern == NULL || dst == NULL) {
+    return;
+  }
+
+  for (i = 0; i < n; i++) {
+    const u8_t value = pattern[(E + i) & 0x07];
+    if (value != A) {
+      *dst   = value;
+      ticks += LXRX_REPEAT_TICKS;
+    } else {
+      ticks += LXRX_REPEAT_TICKS - 5;
+    }
+    dst++;
+  }
+
+  DE += n;
+  BC -= n;
+
+  cpu_block_batched(n, ticks);
+}
+
+
+/**
+ * INIR and INDR, from a port that streams data.
+ */
+static void cpu_inxr_batch(int delta) {
+  u32_t n = cpu_block_iterations(INXR_REPEAT_TICKS, B);
+  u8_t* dst;
+  u32_t i;
+
+  n = cpu_block_min(n, memory_page_run_length(HL, delta));
+  n = cpu_block_min(n, cpu_block_bytes_until_pc(HL, delta));
+  if (n == 0) {
+    return;
+  }
+
+  dst = memory_host_pointer(HL, 1);
+  if (dst == NULL) {
+    return;
+  }
+
+  /* The port changes along with B. */
+  for (i = 0; i < n && io_is_batchable(BC, 0); i++) {
+    *dst = io_batch_read(BC);
+    dst += delta;
+    B--;
+  }
+
+  HL += delta * (int) i;
+
+  cpu_block_batched(i, i * INXR_REPEAT_TICKS);
+}
+
+
+/**
+ * OTIR and OTDR, to a port that streams data.
+ */
+static void cpu_otxr_batch(int delta) {
+  u32_t n = cpu_block_iterations(OTXR_REPEAT_TICKS, B);
+  u8_t* src;
+  u32_t i;
+
+  n = cpu_block_min(n, memory_page_run_length(HL, delta));
+  if (n == 0) {
+    return;
+  }
+
+  src = memory_host_pointer(HL, 0);
+  if (src == NULL) {
+    return;
+  }
+
+  /* B is decremented before the port is written. */
+  for (i = 0; i < n && io_is_batchable(BC - 0x0100, 1); i++) {
+    B--;
+    io_batch_write(BC, *src);
+    src += delta;
+  }
+
+  HL += delta * (int) i;
+
+  cpu_block_batched(i, i * OTXR_REPEAT_TICKS);
+}
 
 
 #include "opcodes.c"
@@ -169,6 +421,7 @@ static void cpu_fill_tables(void) {
 
 static void cpu_reset_internal(void) {
   self.requests                 = 0;
+  self.is_halted                = 0;
   self.is_stackless_nmi_enabled = 0;
 
   IFF1 = 0;
@@ -202,6 +455,8 @@ int cpu_init(void) {
 
   cpu_reset_internal();
 
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -345,7 +600,8 @@ static void cpu_nmi_pending(void) {
   }
 
   /* Jump to the NMI routine. */ 
-  PC = 0x0066;
+  PC             = 0x0066;
+  self.is_halted = 0;
 
   if (self.requests & CPU_REQUEST_NMI_MF) {
     mf_activate();
@@ -356,6 +612,23 @@ static void cpu_nmi_pending(void) {
 }
 
 
+/**
+ * A repeating HALT fetches the same opcode over and over, incrementing R and
+ * taking four ticks each time. Rather than doing so one by one, lets all the
+ * repeats pass in one go that cannot be interrupted by anything.
+ */
+static void cpu_halt_repeat(void) {
+  const u64_t n = cpu_ticks_uninterrupted() / 4;
+
+  self.is_halted = 0;
+
+  if (n > 0) {
+    R = (R & 0x80) | ((R + n) & 0x7F);
+    T((u32_t) n * 4);
+  }
+}
+
+
 int cpu_step(void) {
   dma_run();
   cpu_execute_next_opcode();
@@ -375,6 +648,10 @@ int cpu_step(void) {
     self.irq_delay = 0;
   }
 
+  if (self.is_halted) {
+    cpu_halt_repeat();
+  }
+
   return debug_is_breakpoint(self.pc.w);
 }
 
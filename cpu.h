@@ -65,6 +65,7 @@ typedef struct cpu_t {
   /* IRQ. */
   u8_t im;                      /* Interrupt mode.                                      */
   int  irq_delay;               /* Number of instructions by which IRQ must be delayed. */
+  int  is_halted;               /* Whether HALT is repeating.                           */
 
   /* NMI. */
   int  is_stackless_nmi_enabled;  /* Whether stackless NMI is enabled. */
@@ -2,6 +2,7 @@
 #include "dac.h"
 #include "defs.h"
 #include "log.h"
+#include "rewind.h"
 
 
 typedef struct dac_t {
@@ -9,11 +10,14 @@ typedef struct dac_t {
 } dac_t;
 
 
-static dac_t self;
+static MACHINE_LOCAL dac_t self;
 
 
 int dac_init(void) {
   dac_reset(E_RESET_HARD);
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
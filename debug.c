@@ -7,11 +7,15 @@
 #include "cpu.h"
 #include "debug.h"
 #include "divmmc.h"
+#include "io.h"
+#include "log.h"
 #include "memory.h"
 #include "mf.h"
 #include "mmu.h"
 #include "nextreg.h"
+#include "rewind.h"
 #include "rom.h"
+#include "stats.h"
 
 
 #include "disassemble.c"
@@ -33,39 +37,152 @@ typedef enum debug_cmd_t {
   E_DEBUG_CMD_BREAKPOINTS_LIST,
   E_DEBUG_CMD_BREAKPOINTS_ADD,
   E_DEBUG_CMD_BREAKPOINTS_DELETE,
-  E_DEBUG_CMD_ROM
+  E_DEBUG_CMD_PHYSICAL_BREAKPOINTS_ADD,
+  E_DEBUG_CMD_PHYSICAL_BREAKPOINTS_DELETE,
+  E_DEBUG_CMD_REWIND,
+  E_DEBUG_CMD_ROM,
+  E_DEBUG_CMD_STATS,
+  E_DEBUG_CMD_WATCHPOINTS_ADD,
+  E_DEBUG_CMD_WATCHPOINTS_DELETE,
+  E_DEBUG_CMD_WATCHPOINTS_LIST
 } debug_cmd_t;
 
 
 #define MAX_DEBUG_ARGS   10
-#define MAX_BREAKPOINTS  11
 
 
+/**
+ * Breakpoints live in bitmaps, one bit per address, so that checking the PC
+ * after every instruction costs the same regardless of how many are set.
+ * Logical breakpoints are keyed by 16-bit address, physical ones by SRAM
+ * offset so they only trigger in a specific bank.
+ */
 typedef struct breakpoint_t {
   int   is_set;
   u16_t address;
 } breakpoint_t;
 
 
+/**
+ * Watchpoints use the same kind of bitmaps, one for reads and one for writes.
+ * Memory, I/O and Next register accesses are only routed through here while
+ * watchpoints of their kind exist, see debug_watch_refresh().
+ */
+typedef struct watch_t {
+  u8_t* bits[2];                          /* Read, write. */
+  u32_t n[2];
+} watch_t;
+
+
 typedef struct debug_t {
-  debug_cmd_t command;
-  int          nr_args;
-  u16_t        args[MAX_DEBUG_ARGS];
-  int          has_breakpoints;
-  breakpoint_t breakpoints[MAX_BREAKPOINTS];  /* First one is for 'over' functionality. */
+  debug_cmd_t   command;
+  int           nr_args;
+  u16_t         args[MAX_DEBUG_ARGS];
+  u32_t         offsets[MAX_DEBUG_ARGS];  /* Arguments of physical breakpoint and watchpoint commands. */
+  debug_watch_t watch_type;
+  int           watch_mode;
+  int           is_active;                /* Accesses by the debugger itself do not trigger watchpoints. */
+  int           has_breakpoints;
+  breakpoint_t  over;                     /* For 'over' and 'c addr' functionality. */
+  u8_t          logical[0x10000 / 8];
+  u8_t*         physical;
+  u32_t         n_logical;
+  u32_t         n_physical;
+  watch_t       watches[E_DEBUG_WATCH_LAST - E_DEBUG_WATCH_FIRST + 1];
+  char          watch_hit[80];
 } debug_t;
 
 
-static debug_t self;
+static MACHINE_LOCAL debug_t self;
+
+
+static const struct {
+  const char* name;
+  u32_t       size;
+  int         digits;
+} watch_kinds[E_DEBUG_WATCH_LAST - E_DEBUG_WATCH_FIRST + 1] = {
+  { "memory",  0x10000,          4 },
+  { "SRAM",    MEMORY_SRAM_SIZE, 6 },
+  { "port",    0x10000,          4 },
+  { "nextreg", 0x100,            2 }
+};
 
 
 int debug_init(void) {
   memset(&self, 0, sizeof(self));
+
+  self.physical = calloc(MEMORY_SRAM_SIZE / 8, 1);
+  if (self.physical == NULL) {
+    log_err("debug: out of memory\n");
+    return -1;
+  }
+
+  for (int type = E_DEBUG_WATCH_FIRST; type <= E_DEBUG_WATCH_LAST; type++) {
+    for (int rw = 0; rw < 2; rw++) {
+      self.watches[type].bits[rw] = calloc(watch_kinds[type].size / 8, 1);
+      if (self.watches[type].bits[rw] == NULL) {
+        log_err("debug: out of memory\n");
+        debug_finit();
+        return -1;
+      }
+    }
+  }
+
   return 0;
 }
 
 
 void debug_finit(void) {
+  if (self.physical != NULL) {
+    free(self.physical);
+    self.physical = NULL;
+  }
+
+  for (int type = E_DEBUG_WATCH_FIRST; type <= E_DEBUG_WATCH_LAST; type++) {
+    for (int rw = 0; rw < 2; rw++) {
+      if (self.watches[type].bits[rw] != NULL) {
+        free(self.watches[type].bits[rw]);
+        self.watches[type].bits[rw] = NULL;
+      }
+    }
+  }
+}
+
+
+inline
+static int debug_bit_test(const u8_t* bitmap, u32_t index) {
+  return bitmap[index / 8] & (1 << (index % 8));
+}
+
+
+/**
+ * Sets or clears a bit, returns whether it changed.
+ */
+static int debug_bit_set(u8_t* bitmap, u32_t index, int set) {
+  const u8_t mask = 1 << (index % 8);
+
+  if (!(bitmap[index / 8] & mask) == !set) {
+    return 0;
+  }
+
+  bitmap[index / 8] ^= mask;
+  return 1;
+}
+
+
+static int debug_has_watchpoints(void) {
+  for (int type = E_DEBUG_WATCH_FIRST; type <= E_DEBUG_WATCH_LAST; type++) {
+    if (self.watches[type].n[0] > 0 || self.watches[type].n[1] > 0) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+
+static void debug_set_has_breakpoints(void) {
+  self.has_breakpoints = self.over.is_set || self.n_logical > 0 || self.n_physical > 0 || debug_has_watchpoints();
 }
 
 
@@ -193,6 +310,56 @@ static int debug_parse(char* s) {
     return 0;
   }
 
+  if (strcmp("bp", p) == 0 || strcmp("bpd", p) == 0) {
+    self.command = (p[2] == 'd') ? E_DEBUG_CMD_PHYSICAL_BREAKPOINTS_DELETE : E_DEBUG_CMD_PHYSICAL_BREAKPOINTS_ADD;
+    self.nr_args = 0;
+    while (self.nr_args < MAX_DEBUG_ARGS && debug_next_word(q + 1, &p, &q) == 0) {
+      self.offsets[self.nr_args++] = strtoul(p, NULL, 16);
+    }
+    return 0;
+  }
+
+  if (strcmp("wl", p) == 0) {
+    self.command = E_DEBUG_CMD_WATCHPOINTS_LIST;
+    return 0;
+  }
+
+  if (p[0] == 'w' && p[1] != '\0' && strchr("mpin", p[1]) != NULL && (p[2] == '\0' || (p[2] == 'd' && p[3] == '\0'))) {
+    self.command    = (p[2] == 'd') ? E_DEBUG_CMD_WATCHPOINTS_DELETE : E_DEBUG_CMD_WATCHPOINTS_ADD;
+    self.watch_type = (p[1] == 'm') ? E_DEBUG_WATCH_MEMORY
+                    : (p[1] == 'p') ? E_DEBUG_WATCH_SRAM
+                    : (p[1] == 'i') ? E_DEBUG_WATCH_PORT
+                    :                 E_DEBUG_WATCH_NEXTREG;
+    if (debug_next_word(q + 1, &p, &q) != 0) {
+      return -1;
+    }
+    *q = '\0';
+    self.watch_mode = 0;
+    if (strcmp("r", p) == 0 || strcmp("rw", p) == 0) {
+      self.watch_mode |= DEBUG_WATCH_READ;
+    }
+    if (strcmp("w", p) == 0 || strcmp("rw", p) == 0) {
+      self.watch_mode |= DEBUG_WATCH_WRITE;
+    }
+    if (self.watch_mode == 0) {
+      return -1;
+    }
+    self.nr_args = 0;
+    while (self.nr_args < 2 && debug_next_word(q + 1, &p, &q) == 0) {
+      self.offsets[self.nr_args++] = strtoul(p, NULL, 16);
+    }
+    return (self.nr_args == 0) ? -1 : 0;
+  }
+
+  if (strcmp("rew", p) == 0) {
+    self.command = E_DEBUG_CMD_REWIND;
+    self.nr_args = 0;
+    if (debug_next_word(q + 1, &p, &q) == 0) {
+      self.args[self.nr_args++] = strtol(p, NULL, 16);
+    }
+    return 0;
+  }
+
   if (strcmp("rom", p) == 0) {
     self.command = E_DEBUG_CMD_ROM;
     self.nr_args = 0;
@@ -202,6 +369,15 @@ static int debug_parse(char* s) {
     return 0;
   }
 
+  if (strcmp("stats", p) == 0) {
+    self.command = E_DEBUG_CMD_STATS;
+    self.nr_args = 0;
+    if (debug_next_word(q + 1, &p, &q) == 0) {
+      self.args[self.nr_args++] = strtol(p, NULL, 16);
+    }
+    return 0;
+  }
+
   if (strcmp("cop", p) == 0) {
     self.command = E_DEBUG_CMD_SHOW_COPPER;
     return 0;
@@ -371,9 +547,9 @@ static int debug_show_copper(void) {
 
 static int debug_continue(void) {
   if (self.nr_args > 0) {
-    self.breakpoints[0].address = self.args[0];
-    self.breakpoints[0].is_set  = 1;
-    self.has_breakpoints        = 1;
+    self.over.address    = self.args[0];
+    self.over.is_set     = 1;
+    self.has_breakpoints = 1;
   }
 
   /* Continue running. */
@@ -381,9 +557,20 @@ static int debug_continue(void) {
 }
 
 
+static void debug_show_watch_hit(void) {
+  if (self.watch_hit[0] != '\0') {
+    fprintf(stderr, "%s\n", self.watch_hit);
+    self.watch_hit[0] = '\0';
+  }
+}
+
+
 static int debug_step(void) {
+  self.is_active = 0;
   cpu_step();
-  
+  self.is_active = 1;
+
+  debug_show_watch_hit();
   (void) debug_disassemble(cpu_get()->pc.w);
 
   return 0;
@@ -414,9 +601,9 @@ static int debug_over(void) {
   const u16_t pc   = cpu_get()->pc.w;
   const u16_t next = pc + debug_instruction_length(pc);
   
-  self.breakpoints[0].address = next;
-  self.breakpoints[0].is_set  = 1;
-  self.has_breakpoints        = 1;
+  self.over.address    = next;
+  self.over.is_set     = 1;
+  self.has_breakpoints = 1;
 
   /* Continue running. */
   return 1;
@@ -427,6 +614,7 @@ static int debug_show_info(void) {
   const char* reader;
   const char* writer;
   u8_t        mmu_page;
+  u32_t       offset;
 
   fprintf(stderr, "ROM Alt MF DivMMC Auto Bank MapRAM\n");
   fprintf(stderr, "%2x   %c   %c   %c     %c   %2x     %c\n\n",
@@ -438,12 +626,16 @@ static int debug_show_info(void) {
     divmmc_bank(),
     divmmc_is_mapram_enabled() ? 'Y' : 'N');
 
-  fprintf(stderr, "          page %12s %12s\n", "read", "write");
+  fprintf(stderr, "          page %12s %12s    SRAM\n", "read", "write");
   for (int page = 0; page < 8; page++) {
     memory_describe_accessor(page, &reader, &writer);
     mmu_page = mmu_page_get(page);
 
-    fprintf(stderr, "%04X-%04X  %02X  %12s %12s\n", page * 8192, (page + 1) * 8192 - 1, mmu_page, reader, writer);
+    fprintf(stderr, "%04X-%04X  %02X  %12s %12s", page * 8192, (page + 1) * 8192 - 1, mmu_page, reader, writer);
+    if (memory_sram_offset(page * 8192, &offset) == 0) {
+      fprintf(stderr, "  %06X", offset);
+    }
+    fprintf(stderr, "\n");
   }
 
   return 0;
@@ -481,9 +673,23 @@ static int debug_show_disassembly(void) {
 
 
 static int debug_breakpoints_list(void) {
-  for (int i = 0; i < MAX_BREAKPOINTS; i++) {
-    if (self.breakpoints[i].is_set) {
-      fprintf(stderr, "$%04X\n", self.breakpoints[i].address);
+  if (self.over.is_set) {
+    fprintf(stderr, "$%04X (over)\n", self.over.address);
+  }
+
+  if (self.n_logical > 0) {
+    for (u32_t address = 0; address < 0x10000; address++) {
+      if (debug_bit_test(self.logical, address)) {
+        fprintf(stderr, "$%04X\n", address);
+      }
+    }
+  }
+
+  if (self.n_physical > 0) {
+    for (u32_t offset = 0; offset < MEMORY_SRAM_SIZE; offset++) {
+      if (debug_bit_test(self.physical, offset)) {
+        fprintf(stderr, "SRAM $%06X (page $%02X offset $%04X)\n", offset, offset / 0x2000, offset % 0x2000);
+      }
     }
   }
 
@@ -491,49 +697,256 @@ static int debug_breakpoints_list(void) {
 }
 
 
+void debug_breakpoint_set(u16_t address, int set) {
+  if (set) {
+    self.n_logical += debug_bit_set(self.logical, address, 1);
+  } else {
+    self.n_logical -= debug_bit_set(self.logical, address, 0);
+  }
+
+  debug_set_has_breakpoints();
+}
+
+
 static int debug_breakpoints_add(void) {
   for (int i = 0; i < self.nr_args; i++) {
-    const u16_t address = self.args[i];
-    /* Add except for the 'over' breakpoint. */
-    for (int j = 1; j < MAX_BREAKPOINTS; j++) {
-      if (!self.breakpoints[j].is_set || self.breakpoints[j].address == address) {
-        self.breakpoints[j].address = address;
-        self.breakpoints[j].is_set  = 1;
-        self.has_breakpoints        = 1;
-        break;
-      }
+    debug_breakpoint_set(self.args[i], 1);
+  }
+
+  return 0;
+}
+
+
+static int debug_breakpoints_delete(void) {
+  for (int i = 0; i < self.nr_args; i++) {
+    if (self.over.is_set && self.over.address == self.args[i]) {
+      self.over.is_set = 0;
     }
+    debug_breakpoint_set(self.args[i], 0);
   }
 
   return 0;
 }
 
 
-static void debug_set_has_breakpoints(void) {
-  self.has_breakpoints = 0;
-  for (int j = 0; j < MAX_BREAKPOINTS; j++) {
-    self.has_breakpoints |= self.breakpoints[j].is_set;
+static int debug_physical_breakpoints_add(void) {
+  for (int i = 0; i < self.nr_args; i++) {
+    if (self.offsets[i] >= MEMORY_SRAM_SIZE) {
+      fprintf(stderr, "Invalid SRAM offset $%X\n", self.offsets[i]);
+      continue;
+    }
+    self.n_physical += debug_bit_set(self.physical, self.offsets[i], 1);
   }
+
+  debug_set_has_breakpoints();
+
+  return 0;
 }
 
 
-static int debug_breakpoints_delete(void) {
+static int debug_physical_breakpoints_delete(void) {
   for (int i = 0; i < self.nr_args; i++) {
-    const u16_t address = self.args[i];
-    for (int j = 0; j < MAX_BREAKPOINTS; j++) {
-      if (self.breakpoints[j].address == address) {
-        self.breakpoints[j].is_set = 0;
-        break;
+    if (self.offsets[i] < MEMORY_SRAM_SIZE) {
+      self.n_physical -= debug_bit_set(self.physical, self.offsets[i], 0);
+    }
+  }
+
+  debug_set_has_breakpoints();
+
+  return 0;
+}
+
+
+/**
+ * Only pages with watchpoints get trapping accessors. Any SRAM watchpoint
+ * traps all pages, as the mapping can change at any time.
+ */
+static void debug_watch_refresh(void) {
+  const watch_t* memory = &self.watches[E_DEBUG_WATCH_MEMORY];
+  const watch_t* sram   = &self.watches[E_DEBUG_WATCH_SRAM];
+  int            traps[2];
+
+  for (int page = 0; page < 8; page++) {
+    for (int rw = 0; rw < 2; rw++) {
+      traps[rw] = sram->n[rw] > 0;
+      for (int i = page * 1024; i < (page + 1) * 1024 && !traps[rw]; i++) {
+        traps[rw] = memory->bits[rw][i] != 0;
       }
     }
+    memory_trap_set(page, traps[0], traps[1]);
   }
 
+  io_watch_enable(self.watches[E_DEBUG_WATCH_PORT].n[0] > 0 || self.watches[E_DEBUG_WATCH_PORT].n[1] > 0);
+  nextreg_watch_enable(self.watches[E_DEBUG_WATCH_NEXTREG].n[0] > 0 || self.watches[E_DEBUG_WATCH_NEXTREG].n[1] > 0);
+
   debug_set_has_breakpoints();
+}
+
+
+static void debug_watch_set(watch_t* watch, u32_t address, int mode, int set) {
+  for (int rw = 0; rw < 2; rw++) {
+    if (mode & (1 << rw)) {
+      if (set) {
+        watch->n[rw] += debug_bit_set(watch->bits[rw], address, 1);
+      } else {
+        watch->n[rw] -= debug_bit_set(watch->bits[rw], address, 0);
+      }
+    }
+  }
+}
+
+
+/**
+ * Sets or clears watchpoints of one kind on a range of addresses, for reads
+ * and/or writes depending on mode.
+ */
+int debug_watchpoint_set(debug_watch_t type, u32_t start, u32_t length, int mode, int set) {
+  watch_t*    watch = &self.watches[type];
+  const u32_t size  = watch_kinds[type].size;
+
+  if (length == 0 || start >= size || length > size - start) {
+    return -1;
+  }
+
+  for (u32_t address = start; address < start + length; address++) {
+    if (type == E_DEBUG_WATCH_PORT && start + length <= 0x100) {
+      /* A port given as a single byte matches any high byte. */
+      for (u32_t high = 0; high < 0x100; high++) {
+        debug_watch_set(watch, (high << 8) | address, mode, set);
+      }
+    } else {
+      debug_watch_set(watch, address, mode, set);
+    }
+  }
+
+  debug_watch_refresh();
+
+  return 0;
+}
+
+
+void debug_watch_hit_clear(void) {
+  self.watch_hit[0] = '\0';
+}
+
+
+static int debug_watchpoints_change(int set) {
+  const u32_t length = (self.nr_args > 1) ? self.offsets[1] : 1;
+
+  if (debug_watchpoint_set(self.watch_type, self.offsets[0], length, self.watch_mode, set) != 0) {
+    fprintf(stderr, "Invalid %s range\n", watch_kinds[self.watch_type].name);
+  }
 
   return 0;
 }
 
 
+static int debug_watchpoints_add(void) {
+  return debug_watchpoints_change(1);
+}
+
+
+static int debug_watchpoints_delete(void) {
+  return debug_watchpoints_change(0);
+}
+
+
+/**
+ * Whether a port watchpoint was given as a single byte.
+ */
+static int debug_watch_is_any_high(int rw, u32_t port) {
+  for (u32_t high = 0; high < 0x100; high++) {
+    if (!debug_bit_test(self.watches[E_DEBUG_WATCH_PORT].bits[rw], (high << 8) | (port & 0xFF))) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+
+static int debug_watchpoints_list(void) {
+  for (int type = E_DEBUG_WATCH_FIRST; type <= E_DEBUG_WATCH_LAST; type++) {
+    const watch_t* watch  = &self.watches[type];
+    const int      digits = watch_kinds[type].digits;
+
+    for (int rw = 0; rw < 2; rw++) {
+      u32_t start;
+
+      if (watch->n[rw] == 0) {
+        continue;
+      }
+
+      if (type == E_DEBUG_WATCH_PORT) {
+        for (u32_t port = 0; port < 0x100; port++) {
+          if (debug_watch_is_any_high(rw, port)) {
+            fprintf(stderr, "%-7s %c $xx%02X\n", watch_kinds[type].name, rw ? 'w' : 'r', port);
+          }
+        }
+      }
+
+      /* Show consecutive addresses as a single range. */
+      for (u32_t address = 0; address < watch_kinds[type].size; address++) {
+        if (!debug_bit_test(watch->bits[rw], address)) {
+          continue;
+        }
+        if (type == E_DEBUG_WATCH_PORT && debug_watch_is_any_high(rw, address)) {
+          continue;
+        }
+        start = address;
+        while (address + 1 < watch_kinds[type].size && debug_bit_test(watch->bits[rw], address + 1)) {
+          address++;
+        }
+        if (address == start) {
+          fprintf(stderr, "%-7s %c $%0*X\n", watch_kinds[type].name, rw ? 'w' : 'r', digits, start);
+        } else {
+          fprintf(stderr, "%-7s %c $%0*X-$%0*X\n", watch_kinds[type].name, rw ? 'w' : 'r', digits, start, digits, address);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+static void debug_watch_hit(debug_watch_t type, u32_t address, u8_t value, int is_write) {
+  /* Report only the first hit of an instruction. */
+  if (self.watch_hit[0] != '\0') {
+    return;
+  }
+
+  snprintf(self.watch_hit, sizeof(self.watch_hit), "Watchpoint: %s $%02X %s %s $%0*X",
+    is_write ? "write" : "read",
+    value,
+    is_write ? "to" : "from",
+    watch_kinds[type].name,
+    watch_kinds[type].digits,
+    address);
+}
+
+
+void debug_watch_access(debug_watch_t type, u32_t address, u8_t value, int is_write) {
+  const watch_t* sram = &self.watches[E_DEBUG_WATCH_SRAM];
+  u32_t          offset;
+
+  if (self.is_active) {
+    return;
+  }
+
+  if (debug_bit_test(self.watches[type].bits[is_write], address)) {
+    debug_watch_hit(type, address, value, is_write);
+    return;
+  }
+
+  if (type == E_DEBUG_WATCH_MEMORY && sram->n[is_write] > 0) {
+    if (memory_sram_offset(address, &offset) == 0 && debug_bit_test(sram->bits[is_write], offset)) {
+      debug_watch_hit(E_DEBUG_WATCH_SRAM, offset, value, is_write);
+    }
+  }
+}
+
+
 static int debug_rom(void) {
   if (self.nr_args != 1) {
     fprintf(stderr, "ROM %u\n", rom_selected());
@@ -548,13 +961,52 @@ static int debug_rom(void) {
 }
 
 
+/**
+ * Goes back to the start of the current frame, or further back.
+ */
+static int debug_rewind(void) {
+  const u32_t n_frames = (self.nr_args == 1) ? self.args[0] : 1;
+
+  if (rewind_restore(n_frames) != 0) {
+    fprintf(stderr, "Can rewind %X frames\n", rewind_available());
+    return 0;
+  }
+
+  (void) debug_disassemble(cpu_get()->pc.w);
+  return 0;
+}
+
+
+static int debug_stats(void) {
+  if (self.nr_args == 1) {
+    stats_enable(self.args[0] != 0);
+  }
+  stats_show();
+  return 0;
+}
+
+
 int debug_is_breakpoint(u16_t address) {
   if (!self.has_breakpoints) {
     return 0;
   }
 
-  for (int j = 0; j < MAX_BREAKPOINTS; j++) {
-    if (self.breakpoints[j].is_set && self.breakpoints[j].address == address) {
+  if (self.watch_hit[0] != '\0') {
+    return 1;
+  }
+
+  if (debug_bit_test(self.logical, address)) {
+    return 1;
+  }
+
+  if (self.over.is_set && self.over.address == address) {
+    return 1;
+  }
+
+  if (self.n_physical > 0) {
+    u32_t offset;
+
+    if (memory_sram_offset(address, &offset) == 0 && debug_bit_test(self.physical, offset)) {
       return 1;
     }
   }
@@ -567,19 +1019,26 @@ static const struct {
   debug_cmd_t command;
   int (*handler)(void);
 } debug_commands[] = {
-  { E_DEBUG_CMD_BREAKPOINTS_ADD,     debug_breakpoints_add     },
-  { E_DEBUG_CMD_BREAKPOINTS_DELETE,  debug_breakpoints_delete  },
-  { E_DEBUG_CMD_BREAKPOINTS_LIST,    debug_breakpoints_list    },
-  { E_DEBUG_CMD_CONTINUE,            debug_continue            },
-  { E_DEBUG_CMD_OVER,                debug_over                },
-  { E_DEBUG_CMD_ROM,                 debug_rom                 },
-  { E_DEBUG_CMD_SHOW_DISASSEMBLY,    debug_show_disassembly    },
-  { E_DEBUG_CMD_SHOW_INFO,           debug_show_info           },
-  { E_DEBUG_CMD_SHOW_MEMORY,         debug_show_memory         },
-  { E_DEBUG_CMD_SHOW_NEXT_REGISTERS, debug_show_next_registers },
-  { E_DEBUG_CMD_SHOW_REGISTERS,      debug_show_registers      },
-  { E_DEBUG_CMD_SHOW_COPPER,         debug_show_copper         },
-  { E_DEBUG_CMD_STEP,                debug_step                }
+  { E_DEBUG_CMD_BREAKPOINTS_ADD,             debug_breakpoints_add             },
+  { E_DEBUG_CMD_BREAKPOINTS_DELETE,          debug_breakpoints_delete          },
+  { E_DEBUG_CMD_BREAKPOINTS_LIST,            debug_breakpoints_list            },
+  { E_DEBUG_CMD_CONTINUE,                    debug_continue                    },
+  { E_DEBUG_CMD_OVER,                        debug_over                        },
+  { E_DEBUG_CMD_PHYSICAL_BREAKPOINTS_ADD,    debug_physical_breakpoints_add    },
+  { E_DEBUG_CMD_PHYSICAL_BREAKPOINTS_DELETE, debug_physical_breakpoints_delete },
+  { E_DEBUG_CMD_REWIND,                      debug_rewind                      },
+  { E_DEBUG_CMD_ROM,                         debug_rom                         },
+  { E_DEBUG_CMD_SHOW_DISASSEMBLY,            debug_show_disassembly            },
+  { E_DEBUG_CMD_SHOW_INFO,                   debug_show_info                   },
+  { E_DEBUG_CMD_SHOW_MEMORY,                 debug_show_memory                 },
+  { E_DEBUG_CMD_SHOW_NEXT_REGISTERS,         debug_show_next_registers         },
+  { E_DEBUG_CMD_SHOW_REGISTERS,              debug_show_registers              },
+  { E_DEBUG_CMD_SHOW_COPPER,                 debug_show_copper                 },
+  { E_DEBUG_CMD_STATS,                       debug_stats                       },
+  { E_DEBUG_CMD_STEP,                        debug_step                        },
+  { E_DEBUG_CMD_WATCHPOINTS_ADD,             debug_watchpoints_add             },
+  { E_DEBUG_CMD_WATCHPOINTS_DELETE,          debug_watchpoints_delete          },
+  { E_DEBUG_CMD_WATCHPOINTS_LIST,            debug_watchpoints_list            }
 };
 
 
@@ -605,11 +1064,14 @@ static void debug_prompt(void) {
 int debug_enter(void) {
   char input[80 + 1];
 
+  self.is_active = 1;
+
+  debug_show_watch_hit();
   (void) debug_disassemble(cpu_get()->pc.w);
 
   /* When we completed 'over', clear its breakpoint. */
-  if (self.breakpoints[0].is_set && cpu_get()->pc.w == self.breakpoints[0].address) {
-    self.breakpoints[0].is_set = 0;
+  if (self.over.is_set && cpu_get()->pc.w == self.over.address) {
+    self.over.is_set = 0;
     debug_set_has_breakpoints();
   }
 
@@ -630,6 +1092,7 @@ int debug_enter(void) {
       return -1;
     }
     if (debug_execute()) {
+      self.is_active = 0;
       return 0;
     }
   }
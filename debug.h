@@ -5,10 +5,28 @@
 #include "defs.h"
 
 
+#define DEBUG_WATCH_READ   0x01
+#define DEBUG_WATCH_WRITE  0x02
+
+
+typedef enum debug_watch_t {
+  E_DEBUG_WATCH_FIRST   = 0,
+  E_DEBUG_WATCH_MEMORY  = E_DEBUG_WATCH_FIRST,
+  E_DEBUG_WATCH_SRAM,
+  E_DEBUG_WATCH_PORT,
+  E_DEBUG_WATCH_NEXTREG,
+  E_DEBUG_WATCH_LAST    = E_DEBUG_WATCH_NEXTREG
+} debug_watch_t;
+
+
 int  debug_init(void);
 void debug_finit(void);
 int  debug_enter(void);
 int  debug_is_breakpoint(u16_t address);
+void debug_breakpoint_set(u16_t address, int set);
+int  debug_watchpoint_set(debug_watch_t type, u32_t start, u32_t length, int mode, int set);
+void debug_watch_access(debug_watch_t type, u32_t address, u8_t value, int is_write);
+void debug_watch_hit_clear(void);
 
 
 #endif  /* __DEBUG_H */
\ No newline at end of file
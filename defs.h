@@ -48,6 +48,25 @@
 #define FULLSCREEN_MIN_REFRESH_RATE  60
 
 
+/**
+ * Modules keep their state in file-static variables, which holds a single
+ * machine. Built as libzxnxt.a those are per thread instead, so that every
+ * thread can run a machine of its own.
+ */
+#ifdef ZXNXT_LIBRARY
+#define MACHINE_LOCAL  _Thread_local
+#else
+#define MACHINE_LOCAL
+#endif
+
+
+/**
+ * Video state is per thread in any case, such that a render thread can keep
+ * a copy of its own. See slu_pipeline_start().
+ */
+#define VIDEO_LOCAL    _Thread_local
+
+
 typedef enum {
   E_RESET_SOFT = 0,
   E_RESET_HARD
@@ -0,0 +1,1824 @@
+
+#define MAXARGS 5
+
+typedef struct table_entry_t {
+  size_t length;
+  union {
+    char*                 instr[MAXARGS];
+    struct table_entry_t* table;
+  } payload;
+} table_entry_t;
+
+static table_entry_t tableCB[256] = {
+  /* 0x00 */ { 2, { .instr = {"RLC  ","B",NULL,NULL,NULL} } },
+  /* 0x01 */ { 2, { .instr = {"RLC  ","C",NULL,NULL,NULL} } },
+  /* 0x02 */ { 2, { .instr = {"RLC  ","D",NULL,NULL,NULL} } },
+  /* 0x03 */ { 2, { .instr = {"RLC  ","E",NULL,NULL,NULL} } },
+  /* 0x04 */ { 2, { .instr = {"RLC  ","H",NULL,NULL,NULL} } },
+  /* 0x05 */ { 2, { .instr = {"RLC  ","L",NULL,NULL,NULL} } },
+  /* 0x06 */ { 2, { .instr = {"RLC  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x07 */ { 2, { .instr = {"RLC  ","A",NULL,NULL,NULL} } },
+  /* 0x08 */ { 2, { .instr = {"RRC  ","B",NULL,NULL,NULL} } },
+  /* 0x09 */ { 2, { .instr = {"RRC  ","C",NULL,NULL,NULL} } },
+  /* 0x0A */ { 2, { .instr = {"RRC  ","D",NULL,NULL,NULL} } },
+  /* 0x0B */ { 2, { .instr = {"RRC  ","E",NULL,NULL,NULL} } },
+  /* 0x0C */ { 2, { .instr = {"RRC  ","H",NULL,NULL,NULL} } },
+  /* 0x0D */ { 2, { .instr = {"RRC  ","L",NULL,NULL,NULL} } },
+  /* 0x0E */ { 2, { .instr = {"RRC  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x0F */ { 2, { .instr = {"RRC  ","A",NULL,NULL,NULL} } },
+  /* 0x10 */ { 2, { .instr = {"RL   ","B",NULL,NULL,NULL} } },
+  /* 0x11 */ { 2, { .instr = {"RL   ","C",NULL,NULL,NULL} } },
+  /* 0x12 */ { 2, { .instr = {"RL   ","D",NULL,NULL,NULL} } },
+  /* 0x13 */ { 2, { .instr = {"RL   ","E",NULL,NULL,NULL} } },
+  /* 0x14 */ { 2, { .instr = {"RL   ","H",NULL,NULL,NULL} } },
+  /* 0x15 */ { 2, { .instr = {"RL   ","L",NULL,NULL,NULL} } },
+  /* 0x16 */ { 2, { .instr = {"RL   ","(HL)",NULL,NULL,NULL} } },
+  /* 0x17 */ { 2, { .instr = {"RL   ","A",NULL,NULL,NULL} } },
+  /* 0x18 */ { 2, { .instr = {"RR   ","B",NULL,NULL,NULL} } },
+  /* 0x19 */ { 2, { .instr = {"RR   ","C",NULL,NULL,NULL} } },
+  /* 0x1A */ { 2, { .instr = {"RR   ","D",NULL,NULL,NULL} } },
+  /* 0x1B */ { 2, { .instr = {"RR   ","E",NULL,NULL,NULL} } },
+  /* 0x1C */ { 2, { .instr = {"RR   ","H",NULL,NULL,NULL} } },
+  /* 0x1D */ { 2, { .instr = {"RR   ","L",NULL,NULL,NULL} } },
+  /* 0x1E */ { 2, { .instr = {"RR   ","(HL)",NULL,NULL,NULL} } },
+  /* 0x1F */ { 2, { .instr = {"RR   ","A",NULL,NULL,NULL} } },
+  /* 0x20 */ { 2, { .instr = {"SLA  ","B",NULL,NULL,NULL} } },
+  /* 0x21 */ { 2, { .instr = {"SLA  ","C",NULL,NULL,NULL} } },
+  /* 0x22 */ { 2, { .instr = {"SLA  ","D",NULL,NULL,NULL} } },
+  /* 0x23 */ { 2, { .instr = {"SLA  ","E",NULL,NULL,NULL} } },
+  /* 0x24 */ { 2, { .instr = {"SLA  ","H",NULL,NULL,NULL} } },
+  /* 0x25 */ { 2, { .instr = {"SLA  ","L",NULL,NULL,NULL} } },
+  /* 0x26 */ { 2, { .instr = {"SLA  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x27 */ { 2, { .instr = {"SLA  ","A",NULL,NULL,NULL} } },
+  /* 0x28 */ { 2, { .instr = {"SRA  ","B",NULL,NULL,NULL} } },
+  /* 0x29 */ { 2, { .instr = {"SRA  ","C",NULL,NULL,NULL} } },
+  /* 0x2A */ { 2, { .instr = {"SRA  ","D",NULL,NULL,NULL} } },
+  /* 0x2B */ { 2, { .instr = {"SRA  ","E",NULL,NULL,NULL} } },
+  /* 0x2C */ { 2, { .instr = {"SRA  ","H",NULL,NULL,NULL} } },
+  /* 0x2D */ { 2, { .instr = {"SRA  ","L",NULL,NULL,NULL} } },
+  /* 0x2E */ { 2, { .instr = {"SRA  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x2F */ { 2, { .instr = {"SRA  ","A",NULL,NULL,NULL} } },
+  /* 0x30 */ { 2, { .instr = {"SLL  ","B",NULL,NULL,NULL} } },
+  /* 0x31 */ { 2, { .instr = {"SLL  ","C",NULL,NULL,NULL} } },
+  /* 0x32 */ { 2, { .instr = {"SLL  ","D",NULL,NULL,NULL} } },
+  /* 0x33 */ { 2, { .instr = {"SLL  ","E",NULL,NULL,NULL} } },
+  /* 0x34 */ { 2, { .instr = {"SLL  ","H",NULL,NULL,NULL} } },
+  /* 0x35 */ { 2, { .instr = {"SLL  ","L",NULL,NULL,NULL} } },
+  /* 0x36 */ { 2, { .instr = {"SLL  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x37 */ { 2, { .instr = {"SLL  ","A",NULL,NULL,NULL} } },
+  /* 0x38 */ { 2, { .instr = {"SRL  ","B",NULL,NULL,NULL} } },
+  /* 0x39 */ { 2, { .instr = {"SRL  ","C",NULL,NULL,NULL} } },
+  /* 0x3A */ { 2, { .instr = {"SRL  ","D",NULL,NULL,NULL} } },
+  /* 0x3B */ { 2, { .instr = {"SRL  ","E",NULL,NULL,NULL} } },
+  /* 0x3C */ { 2, { .instr = {"SRL  ","H",NULL,NULL,NULL} } },
+  /* 0x3D */ { 2, { .instr = {"SRL  ","L",NULL,NULL,NULL} } },
+  /* 0x3E */ { 2, { .instr = {"SRL  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x3F */ { 2, { .instr = {"SRL  ","A",NULL,NULL,NULL} } },
+  /* 0x40 */ { 2, { .instr = {"BIT  ","0,B",NULL,NULL,NULL} } },
+  /* 0x41 */ { 2, { .instr = {"BIT  ","0,C",NULL,NULL,NULL} } },
+  /* 0x42 */ { 2, { .instr = {"BIT  ","0,D",NULL,NULL,NULL} } },
+  /* 0x43 */ { 2, { .instr = {"BIT  ","0,E",NULL,NULL,NULL} } },
+  /* 0x44 */ { 2, { .instr = {"BIT  ","0,H",NULL,NULL,NULL} } },
+  /* 0x45 */ { 2, { .instr = {"BIT  ","0,L",NULL,NULL,NULL} } },
+  /* 0x46 */ { 2, { .instr = {"BIT  ","0,(HL)",NULL,NULL,NULL} } },
+  /* 0x47 */ { 2, { .instr = {"BIT  ","0,A",NULL,NULL,NULL} } },
+  /* 0x48 */ { 2, { .instr = {"BIT  ","1,B",NULL,NULL,NULL} } },
+  /* 0x49 */ { 2, { .instr = {"BIT  ","1,C",NULL,NULL,NULL} } },
+  /* 0x4A */ { 2, { .instr = {"BIT  ","1,D",NULL,NULL,NULL} } },
+  /* 0x4B */ { 2, { .instr = {"BIT  ","1,E",NULL,NULL,NULL} } },
+  /* 0x4C */ { 2, { .instr = {"BIT  ","1,H",NULL,NULL,NULL} } },
+  /* 0x4D */ { 2, { .instr = {"BIT  ","1,L",NULL,NULL,NULL} } },
+  /* 0x4E */ { 2, { .instr = {"BIT  ","1,(HL)",NULL,NULL,NULL} } },
+  /* 0x4F */ { 2, { .instr = {"BIT  ","1,A",NULL,NULL,NULL} } },
+  /* 0x50 */ { 2, { .instr = {"BIT  ","2,B",NULL,NULL,NULL} } },
+  /* 0x51 */ { 2, { .instr = {"BIT  ","2,C",NULL,NULL,NULL} } },
+  /* 0x52 */ { 2, { .instr = {"BIT  ","2,D",NULL,NULL,NULL} } },
+  /* 0x53 */ { 2, { .instr = {"BIT  ","2,E",NULL,NULL,NULL} } },
+  /* 0x54 */ { 2, { .instr = {"BIT  ","2,H",NULL,NULL,NULL} } },
+  /* 0x55 */ { 2, { .instr = {"BIT  ","2,L",NULL,NULL,NULL} } },
+  /* 0x56 */ { 2, { .instr = {"BIT  ","2,(HL)",NULL,NULL,NULL} } },
+  /* 0x57 */ { 2, { .instr = {"BIT  ","2,A",NULL,NULL,NULL} } },
+  /* 0x58 */ { 2, { .instr = {"BIT  ","3,B",NULL,NULL,NULL} } },
+  /* 0x59 */ { 2, { .instr = {"BIT  ","3,C",NULL,NULL,NULL} } },
+  /* 0x5A */ { 2, { .instr = {"BIT  ","3,D",NULL,NULL,NULL} } },
+  /* 0x5B */ { 2, { .instr = {"BIT  ","3,E",NULL,NULL,NULL} } },
+  /* 0x5C */ { 2, { .instr = {"BIT  ","3,H",NULL,NULL,NULL} } },
+  /* 0x5D */ { 2, { .instr = {"BIT  ","3,L",NULL,NULL,NULL} } },
+  /* 0x5E */ { 2, { .instr = {"BIT  ","3,(HL)",NULL,NULL,NULL} } },
+  /* 0x5F */ { 2, { .instr = {"BIT  ","3,A",NULL,NULL,NULL} } },
+  /* 0x60 */ { 2, { .instr = {"BIT  ","4,B",NULL,NULL,NULL} } },
+  /* 0x61 */ { 2, { .instr = {"BIT  ","4,C",NULL,NULL,NULL} } },
+  /* 0x62 */ { 2, { .instr = {"BIT  ","4,D",NULL,NULL,NULL} } },
+  /* 0x63 */ { 2, { .instr = {"BIT  ","4,E",NULL,NULL,NULL} } },
+  /* 0x64 */ { 2, { .instr = {"BIT  ","4,H",NULL,NULL,NULL} } },
+  /* 0x65 */ { 2, { .instr = {"BIT  ","4,L",NULL,NULL,NULL} } },
+  /* 0x66 */ { 2, { .instr = {"BIT  ","4,(HL)",NULL,NULL,NULL} } },
+  /* 0x67 */ { 2, { .instr = {"BIT  ","4,A",NULL,NULL,NULL} } },
+  /* 0x68 */ { 2, { .instr = {"BIT  ","5,B",NULL,NULL,NULL} } },
+  /* 0x69 */ { 2, { .instr = {"BIT  ","5,C",NULL,NULL,NULL} } },
+  /* 0x6A */ { 2, { .instr = {"BIT  ","5,D",NULL,NULL,NULL} } },
+  /* 0x6B */ { 2, { .instr = {"BIT  ","5,E",NULL,NULL,NULL} } },
+  /* 0x6C */ { 2, { .instr = {"BIT  ","5,H",NULL,NULL,NULL} } },
+  /* 0x6D */ { 2, { .instr = {"BIT  ","5,L",NULL,NULL,NULL} } },
+  /* 0x6E */ { 2, { .instr = {"BIT  ","5,(HL)",NULL,NULL,NULL} } },
+  /* 0x6F */ { 2, { .instr = {"BIT  ","5,A",NULL,NULL,NULL} } },
+  /* 0x70 */ { 2, { .instr = {"BIT  ","6,B",NULL,NULL,NULL} } },
+  /* 0x71 */ { 2, { .instr = {"BIT  ","6,C",NULL,NULL,NULL} } },
+  /* 0x72 */ { 2, { .instr = {"BIT  ","6,D",NULL,NULL,NULL} } },
+  /* 0x73 */ { 2, { .instr = {"BIT  ","6,E",NULL,NULL,NULL} } },
+  /* 0x74 */ { 2, { .instr = {"BIT  ","6,H",NULL,NULL,NULL} } },
+  /* 0x75 */ { 2, { .instr = {"BIT  ","6,L",NULL,NULL,NULL} } },
+  /* 0x76 */ { 2, { .instr = {"BIT  ","6,(HL)",NULL,NULL,NULL} } },
+  /* 0x77 */ { 2, { .instr = {"BIT  ","6,A",NULL,NULL,NULL} } },
+  /* 0x78 */ { 2, { .instr = {"BIT  ","7,B",NULL,NULL,NULL} } },
+  /* 0x79 */ { 2, { .instr = {"BIT  ","7,C",NULL,NULL,NULL} } },
+  /* 0x7A */ { 2, { .instr = {"BIT  ","7,D",NULL,NULL,NULL} } },
+  /* 0x7B */ { 2, { .instr = {"BIT  ","7,E",NULL,NULL,NULL} } },
+  /* 0x7C */ { 2, { .instr = {"BIT  ","7,H",NULL,NULL,NULL} } },
+  /* 0x7D */ { 2, { .instr = {"BIT  ","7,L",NULL,NULL,NULL} } },
+  /* 0x7E */ { 2, { .instr = {"BIT  ","7,(HL)",NULL,NULL,NULL} } },
+  /* 0x7F */ { 2, { .instr = {"BIT  ","7,A",NULL,NULL,NULL} } },
+  /* 0x80 */ { 2, { .instr = {"RES  ","0,B",NULL,NULL,NULL} } },
+  /* 0x81 */ { 2, { .instr = {"RES  ","0,C",NULL,NULL,NULL} } },
+  /* 0x82 */ { 2, { .instr = {"RES  ","0,D",NULL,NULL,NULL} } },
+  /* 0x83 */ { 2, { .instr = {"RES  ","0,E",NULL,NULL,NULL} } },
+  /* 0x84 */ { 2, { .instr = {"RES  ","0,H",NULL,NULL,NULL} } },
+  /* 0x85 */ { 2, { .instr = {"RES  ","0,L",NULL,NULL,NULL} } },
+  /* 0x86 */ { 2, { .instr = {"RES  ","0,(HL)",NULL,NULL,NULL} } },
+  /* 0x87 */ { 2, { .instr = {"RES  ","0,A",NULL,NULL,NULL} } },
+  /* 0x88 */ { 2, { .instr = {"RES  ","1,B",NULL,NULL,NULL} } },
+  /* 0x89 */ { 2, { .instr = {"RES  ","1,C",NULL,NULL,NULL} } },
+  /* 0x8A */ { 2, { .instr = {"RES  ","1,D",NULL,NULL,NULL} } },
+  /* 0x8B */ { 2, { .instr = {"RES  ","1,E",NULL,NULL,NULL} } },
+  /* 0x8C */ { 2, { .instr = {"RES  ","1,H",NULL,NULL,NULL} } },
+  /* 0x8D */ { 2, { .instr = {"RES  ","1,L",NULL,NULL,NULL} } },
+  /* 0x8E */ { 2, { .instr = {"RES  ","1,(HL)",NULL,NULL,NULL} } },
+  /* 0x8F */ { 2, { .instr = {"RES  ","1,A",NULL,NULL,NULL} } },
+  /* 0x90 */ { 2, { .instr = {"RES  ","2,B",NULL,NULL,NULL} } },
+  /* 0x91 */ { 2, { .instr = {"RES  ","2,C",NULL,NULL,NULL} } },
+  /* 0x92 */ { 2, { .instr = {"RES  ","2,D",NULL,NULL,NULL} } },
+  /* 0x93 */ { 2, { .instr = {"RES  ","2,E",NULL,NULL,NULL} } },
+  /* 0x94 */ { 2, { .instr = {"RES  ","2,H",NULL,NULL,NULL} } },
+  /* 0x95 */ { 2, { .instr = {"RES  ","2,L",NULL,NULL,NULL} } },
+  /* 0x96 */ { 2, { .instr = {"RES  ","2,(HL)",NULL,NULL,NULL} } },
+  /* 0x97 */ { 2, { .instr = {"RES  ","2,A",NULL,NULL,NULL} } },
+  /* 0x98 */ { 2, { .instr = {"RES  ","3,B",NULL,NULL,NULL} } },
+  /* 0x99 */ { 2, { .instr = {"RES  ","3,C",NULL,NULL,NULL} } },
+  /* 0x9A */ { 2, { .instr = {"RES  ","3,D",NULL,NULL,NULL} } },
+  /* 0x9B */ { 2, { .instr = {"RES  ","3,E",NULL,NULL,NULL} } },
+  /* 0x9C */ { 2, { .instr = {"RES  ","3,H",NULL,NULL,NULL} } },
+  /* 0x9D */ { 2, { .instr = {"RES  ","3,L",NULL,NULL,NULL} } },
+  /* 0x9E */ { 2, { .instr = {"RES  ","3,(HL)",NULL,NULL,NULL} } },
+  /* 0x9F */ { 2, { .instr = {"RES  ","3,A",NULL,NULL,NULL} } },
+  /* 0xA0 */ { 2, { .instr = {"RES  ","4,B",NULL,NULL,NULL} } },
+  /* 0xA1 */ { 2, { .instr = {"RES  ","4,C",NULL,NULL,NULL} } },
+  /* 0xA2 */ { 2, { .instr = {"RES  ","4,D",NULL,NULL,NULL} } },
+  /* 0xA3 */ { 2, { .instr = {"RES  ","4,E",NULL,NULL,NULL} } },
+  /* 0xA4 */ { 2, { .instr = {"RES  ","4,H",NULL,NULL,NULL} } },
+  /* 0xA5 */ { 2, { .instr = {"RES  ","4,L",NULL,NULL,NULL} } },
+  /* 0xA6 */ { 2, { .instr = {"RES  ","4,(HL)",NULL,NULL,NULL} } },
+  /* 0xA7 */ { 2, { .instr = {"RES  ","4,A",NULL,NULL,NULL} } },
+  /* 0xA8 */ { 2, { .instr = {"RES  ","5,B",NULL,NULL,NULL} } },
+  /* 0xA9 */ { 2, { .instr = {"RES  ","5,C",NULL,NULL,NULL} } },
+  /* 0xAA */ { 2, { .instr = {"RES  ","5,D",NULL,NULL,NULL} } },
+  /* 0xAB */ { 2, { .instr = {"RES  ","5,E",NULL,NULL,NULL} } },
+  /* 0xAC */ { 2, { .instr = {"RES  ","5,H",NULL,NULL,NULL} } },
+  /* 0xAD */ { 2, { .instr = {"RES  ","5,L",NULL,NULL,NULL} } },
+  /* 0xAE */ { 2, { .instr = {"RES  ","5,(HL)",NULL,NULL,NULL} } },
+  /* 0xAF */ { 2, { .instr = {"RES  ","5,A",NULL,NULL,NULL} } },
+  /* 0xB0 */ { 2, { .instr = {"RES  ","6,B",NULL,NULL,NULL} } },
+  /* 0xB1 */ { 2, { .instr = {"RES  ","6,C",NULL,NULL,NULL} } },
+  /* 0xB2 */ { 2, { .instr = {"RES  ","6,D",NULL,NULL,NULL} } },
+  /* 0xB3 */ { 2, { .instr = {"RES  ","6,E",NULL,NULL,NULL} } },
+  /* 0xB4 */ { 2, { .instr = {"RES  ","6,H",NULL,NULL,NULL} } },
+  /* 0xB5 */ { 2, { .instr = {"RES  ","6,L",NULL,NULL,NULL} } },
+  /* 0xB6 */ { 2, { .instr = {"RES  ","6,(HL)",NULL,NULL,NULL} } },
+  /* 0xB7 */ { 2, { .instr = {"RES  ","6,A",NULL,NULL,NULL} } },
+  /* 0xB8 */ { 2, { .instr = {"RES  ","7,B",NULL,NULL,NULL} } },
+  /* 0xB9 */ { 2, { .instr = {"RES  ","7,C",NULL,NULL,NULL} } },
+  /* 0xBA */ { 2, { .instr = {"RES  ","7,D",NULL,NULL,NULL} } },
+  /* 0xBB */ { 2, { .instr = {"RES  ","7,E",NULL,NULL,NULL} } },
+  /* 0xBC */ { 2, { .instr = {"RES  ","7,H",NULL,NULL,NULL} } },
+  /* 0xBD */ { 2, { .instr = {"RES  ","7,L",NULL,NULL,NULL} } },
+  /* 0xBE */ { 2, { .instr = {"RES  ","7,(HL)",NULL,NULL,NULL} } },
+  /* 0xBF */ { 2, { .instr = {"RES  ","7,A",NULL,NULL,NULL} } },
+  /* 0xC0 */ { 2, { .instr = {"SET  ","0,B",NULL,NULL,NULL} } },
+  /* 0xC1 */ { 2, { .instr = {"SET  ","0,C",NULL,NULL,NULL} } },
+  /* 0xC2 */ { 2, { .instr = {"SET  ","0,D",NULL,NULL,NULL} } },
+  /* 0xC3 */ { 2, { .instr = {"SET  ","0,E",NULL,NULL,NULL} } },
+  /* 0xC4 */ { 2, { .instr = {"SET  ","0,H",NULL,NULL,NULL} } },
+  /* 0xC5 */ { 2, { .instr = {"SET  ","0,L",NULL,NULL,NULL} } },
+  /* 0xC6 */ { 2, { .instr = {"SET  ","0,(HL)",NULL,NULL,NULL} } },
+  /* 0xC7 */ { 2, { .instr = {"SET  ","0,A",NULL,NULL,NULL} } },
+  /* 0xC8 */ { 2, { .instr = {"SET  ","1,B",NULL,NULL,NULL} } },
+  /* 0xC9 */ { 2, { .instr = {"SET  ","1,C",NULL,NULL,NULL} } },
+  /* 0xCA */ { 2, { .instr = {"SET  ","1,D",NULL,NULL,NULL} } },
+  /* 0xCB */ { 2, { .instr = {"SET  ","1,E",NULL,NULL,NULL} } },
+  /* 0xCC */ { 2, { .instr = {"SET  ","1,H",NULL,NULL,NULL} } },
+  /* 0xCD */ { 2, { .instr = {"SET  ","1,L",NULL,NULL,NULL} } },
+  /* 0xCE */ { 2, { .instr = {"SET  ","1,(HL)",NULL,NULL,NULL} } },
+  /* 0xCF */ { 2, { .instr = {"SET  ","1,A",NULL,NULL,NULL} } },
+  /* 0xD0 */ { 2, { .instr = {"SET  ","2,B",NULL,NULL,NULL} } },
+  /* 0xD1 */ { 2, { .instr = {"SET  ","2,C",NULL,NULL,NULL} } },
+  /* 0xD2 */ { 2, { .instr = {"SET  ","2,D",NULL,NULL,NULL} } },
+  /* 0xD3 */ { 2, { .instr = {"SET  ","2,E",NULL,NULL,NULL} } },
+  /* 0xD4 */ { 2, { .instr = {"SET  ","2,H",NULL,NULL,NULL} } },
+  /* 0xD5 */ { 2, { .instr = {"SET  ","2,L",NULL,NULL,NULL} } },
+  /* 0xD6 */ { 2, { .instr = {"SET  ","2,(HL)",NULL,NULL,NULL} } },
+  /* 0xD7 */ { 2, { .instr = {"SET  ","2,A",NULL,NULL,NULL} } },
+  /* 0xD8 */ { 2, { .instr = {"SET  ","3,B",NULL,NULL,NULL} } },
+  /* 0xD9 */ { 2, { .instr = {"SET  ","3,C",NULL,NULL,NULL} } },
+  /* 0xDA */ { 2, { .instr = {"SET  ","3,D",NULL,NULL,NULL} } },
+  /* 0xDB */ { 2, { .instr = {"SET  ","3,E",NULL,NULL,NULL} } },
+  /* 0xDC */ { 2, { .instr = {"SET  ","3,H",NULL,NULL,NULL} } },
+  /* 0xDD */ { 2, { .instr = {"SET  ","3,L",NULL,NULL,NULL} } },
+  /* 0xDE */ { 2, { .instr = {"SET  ","3,(HL)",NULL,NULL,NULL} } },
+  /* 0xDF */ { 2, { .instr = {"SET  ","3,A",NULL,NULL,NULL} } },
+  /* 0xE0 */ { 2, { .instr = {"SET  ","4,B",NULL,NULL,NULL} } },
+  /* 0xE1 */ { 2, { .instr = {"SET  ","4,C",NULL,NULL,NULL} } },
+  /* 0xE2 */ { 2, { .instr = {"SET  ","4,D",NULL,NULL,NULL} } },
+  /* 0xE3 */ { 2, { .instr = {"SET  ","4,E",NULL,NULL,NULL} } },
+  /* 0xE4 */ { 2, { .instr = {"SET  ","4,H",NULL,NULL,NULL} } },
+  /* 0xE5 */ { 2, { .instr = {"SET  ","4,L",NULL,NULL,NULL} } },
+  /* 0xE6 */ { 2, { .instr = {"SET  ","4,(HL)",NULL,NULL,NULL} } },
+  /* 0xE7 */ { 2, { .instr = {"SET  ","4,A",NULL,NULL,NULL} } },
+  /* 0xE8 */ { 2, { .instr = {"SET  ","5,B",NULL,NULL,NULL} } },
+  /* 0xE9 */ { 2, { .instr = {"SET  ","5,C",NULL,NULL,NULL} } },
+  /* 0xEA */ { 2, { .instr = {"SET  ","5,D",NULL,NULL,NULL} } },
+  /* 0xEB */ { 2, { .instr = {"SET  ","5,E",NULL,NULL,NULL} } },
+  /* 0xEC */ { 2, { .instr = {"SET  ","5,H",NULL,NULL,NULL} } },
+  /* 0xED */ { 2, { .instr = {"SET  ","5,L",NULL,NULL,NULL} } },
+  /* 0xEE */ { 2, { .instr = {"SET  ","5,(HL)",NULL,NULL,NULL} } },
+  /* 0xEF */ { 2, { .instr = {"SET  ","5,A",NULL,NULL,NULL} } },
+  /* 0xF0 */ { 2, { .instr = {"SET  ","6,B",NULL,NULL,NULL} } },
+  /* 0xF1 */ { 2, { .instr = {"SET  ","6,C",NULL,NULL,NULL} } },
+  /* 0xF2 */ { 2, { .instr = {"SET  ","6,D",NULL,NULL,NULL} } },
+  /* 0xF3 */ { 2, { .instr = {"SET  ","6,E",NULL,NULL,NULL} } },
+  /* 0xF4 */ { 2, { .instr = {"SET  ","6,H",NULL,NULL,NULL} } },
+  /* 0xF5 */ { 2, { .instr = {"SET  ","6,L",NULL,NULL,NULL} } },
+  /* 0xF6 */ { 2, { .instr = {"SET  ","6,(HL)",NULL,NULL,NULL} } },
+  /* 0xF7 */ { 2, { .instr = {"SET  ","6,A",NULL,NULL,NULL} } },
+  /* 0xF8 */ { 2, { .instr = {"SET  ","7,B",NULL,NULL,NULL} } },
+  /* 0xF9 */ { 2, { .instr = {"SET  ","7,C",NULL,NULL,NULL} } },
+  /* 0xFA */ { 2, { .instr = {"SET  ","7,D",NULL,NULL,NULL} } },
+  /* 0xFB */ { 2, { .instr = {"SET  ","7,E",NULL,NULL,NULL} } },
+  /* 0xFC */ { 2, { .instr = {"SET  ","7,H",NULL,NULL,NULL} } },
+  /* 0xFD */ { 2, { .instr = {"SET  ","7,L",NULL,NULL,NULL} } },
+  /* 0xFE */ { 2, { .instr = {"SET  ","7,(HL)",NULL,NULL,NULL} } },
+  /* 0xFF */ { 2, { .instr = {"SET  ","7,A",NULL,NULL,NULL} } },
+};
+
+static table_entry_t tableDDCB[256] = {
+  /* 0x00 */ { 3, { .instr = {"RLC  ","B",NULL,NULL,NULL} } },
+  /* 0x01 */ { 3, { .instr = {"RLC  ","C",NULL,NULL,NULL} } },
+  /* 0x02 */ { 3, { .instr = {"RLC  ","D",NULL,NULL,NULL} } },
+  /* 0x03 */ { 3, { .instr = {"RLC  ","E",NULL,NULL,NULL} } },
+  /* 0x04 */ { 3, { .instr = {"RLC  ","H",NULL,NULL,NULL} } },
+  /* 0x05 */ { 3, { .instr = {"RLC  ","L",NULL,NULL,NULL} } },
+  /* 0x06 */ { 4, { .instr = {"RLC  ","(IX+","d",")",NULL} } },
+  /* 0x07 */ { 3, { .instr = {"RLC  ","A",NULL,NULL,NULL} } },
+  /* 0x08 */ { 3, { .instr = {"RRC  ","B",NULL,NULL,NULL} } },
+  /* 0x09 */ { 3, { .instr = {"RRC  ","C",NULL,NULL,NULL} } },
+  /* 0x0A */ { 3, { .instr = {"RRC  ","D",NULL,NULL,NULL} } },
+  /* 0x0B */ { 3, { .instr = {"RRC  ","E",NULL,NULL,NULL} } },
+  /* 0x0C */ { 3, { .instr = {"RRC  ","H",NULL,NULL,NULL} } },
+  /* 0x0D */ { 3, { .instr = {"RRC  ","L",NULL,NULL,NULL} } },
+  /* 0x0E */ { 4, { .instr = {"RRC  ","(IX+","d",")",NULL} } },
+  /* 0x0F */ { 3, { .instr = {"RRC  ","A",NULL,NULL,NULL} } },
+  /* 0x10 */ { 3, { .instr = {"RL   ","B",NULL,NULL,NULL} } },
+  /* 0x11 */ { 3, { .instr = {"RL   ","C",NULL,NULL,NULL} } },
+  /* 0x12 */ { 3, { .instr = {"RL   ","D",NULL,NULL,NULL} } },
+  /* 0x13 */ { 3, { .instr = {"RL   ","E",NULL,NULL,NULL} } },
+  /* 0x14 */ { 3, { .instr = {"RL   ","H",NULL,NULL,NULL} } },
+  /* 0x15 */ { 3, { .instr = {"RL   ","L",NULL,NULL,NULL} } },
+  /* 0x16 */ { 4, { .instr = {"RL   ","(IX+","d",")",NULL} } },
+  /* 0x17 */ { 3, { .instr = {"RL   ","A",NULL,NULL,NULL} } },
+  /* 0x18 */ { 3, { .instr = {"RR   ","B",NULL,NULL,NULL} } },
+  /* 0x19 */ { 3, { .instr = {"RR   ","C",NULL,NULL,NULL} } },
+  /* 0x1A */ { 3, { .instr = {"RR   ","D",NULL,NULL,NULL} } },
+  /* 0x1B */ { 3, { .instr = {"RR   ","E",NULL,NULL,NULL} } },
+  /* 0x1C */ { 3, { .instr = {"RR   ","H",NULL,NULL,NULL} } },
+  /* 0x1D */ { 3, { .instr = {"RR   ","L",NULL,NULL,NULL} } },
+  /* 0x1E */ { 4, { .instr = {"RR   ","(IX+","d",")",NULL} } },
+  /* 0x1F */ { 3, { .instr = {"RR   ","A",NULL,NULL,NULL} } },
+  /* 0x20 */ { 3, { .instr = {"SLA  ","B",NULL,NULL,NULL} } },
+  /* 0x21 */ { 3, { .instr = {"SLA  ","C",NULL,NULL,NULL} } },
+  /* 0x22 */ { 3, { .instr = {"SLA  ","D",NULL,NULL,NULL} } },
+  /* 0x23 */ { 3, { .instr = {"SLA  ","E",NULL,NULL,NULL} } },
+  /* 0x24 */ { 3, { .instr = {"SLA  ","H",NULL,NULL,NULL} } },
+  /* 0x25 */ { 3, { .instr = {"SLA  ","L",NULL,NULL,NULL} } },
+  /* 0x26 */ { 4, { .instr = {"SLA  ","(IX+","d",")",NULL} } },
+  /* 0x27 */ { 3, { .instr = {"SLA  ","A",NULL,NULL,NULL} } },
+  /* 0x28 */ { 3, { .instr = {"SRA  ","B",NULL,NULL,NULL} } },
+  /* 0x29 */ { 3, { .instr = {"SRA  ","C",NULL,NULL,NULL} } },
+  /* 0x2A */ { 3, { .instr = {"SRA  ","D",NULL,NULL,NULL} } },
+  /* 0x2B */ { 3, { .instr = {"SRA  ","E",NULL,NULL,NULL} } },
+  /* 0x2C */ { 3, { .instr = {"SRA  ","H",NULL,NULL,NULL} } },
+  /* 0x2D */ { 3, { .instr = {"SRA  ","L",NULL,NULL,NULL} } },
+  /* 0x2E */ { 4, { .instr = {"SRA  ","(IX+","d",")",NULL} } },
+  /* 0x2F */ { 3, { .instr = {"SRA  ","A",NULL,NULL,NULL} } },
+  /* 0x30 */ { 3, { .instr = {"SLL  ","B",NULL,NULL,NULL} } },
+  /* 0x31 */ { 3, { .instr = {"SLL  ","C",NULL,NULL,NULL} } },
+  /* 0x32 */ { 3, { .instr = {"SLL  ","D",NULL,NULL,NULL} } },
+  /* 0x33 */ { 3, { .instr = {"SLL  ","E",NULL,NULL,NULL} } },
+  /* 0x34 */ { 3, { .instr = {"SLL  ","H",NULL,NULL,NULL} } },
+  /* 0x35 */ { 3, { .instr = {"SLL  ","L",NULL,NULL,NULL} } },
+  /* 0x36 */ { 4, { .instr = {"SLL  ","(IX+","d",")",NULL} } },
+  /* 0x37 */ { 3, { .instr = {"SLL  ","A",NULL,NULL,NULL} } },
+  /* 0x38 */ { 3, { .instr = {"SRL  ","B",NULL,NULL,NULL} } },
+  /* 0x39 */ { 3, { .instr = {"SRL  ","C",NULL,NULL,NULL} } },
+  /* 0x3A */ { 3, { .instr = {"SRL  ","D",NULL,NULL,NULL} } },
+  /* 0x3B */ { 3, { .instr = {"SRL  ","E",NULL,NULL,NULL} } },
+  /* 0x3C */ { 3, { .instr = {"SRL  ","H",NULL,NULL,NULL} } },
+  /* 0x3D */ { 3, { .instr = {"SRL  ","L",NULL,NULL,NULL} } },
+  /* 0x3E */ { 4, { .instr = {"SRL  ","(IX+","d",")",NULL} } },
+  /* 0x3F */ { 3, { .instr = {"SRL  ","A",NULL,NULL,NULL} } },
+  /* 0x40 */ { 3, { .instr = {"BIT  ","0,B",NULL,NULL,NULL} } },
+  /* 0x41 */ { 3, { .instr = {"BIT  ","0,C",NULL,NULL,NULL} } },
+  /* 0x42 */ { 3, { .instr = {"BIT  ","0,D",NULL,NULL,NULL} } },
+  /* 0x43 */ { 3, { .instr = {"BIT  ","0,E",NULL,NULL,NULL} } },
+  /* 0x44 */ { 3, { .instr = {"BIT  ","0,H",NULL,NULL,NULL} } },
+  /* 0x45 */ { 3, { .instr = {"BIT  ","0,L",NULL,NULL,NULL} } },
+  /* 0x46 */ { 4, { .instr = {"BIT  ","0,(IX+","d",")",NULL} } },
+  /* 0x47 */ { 3, { .instr = {"BIT  ","0,A",NULL,NULL,NULL} } },
+  /* 0x48 */ { 3, { .instr = {"BIT  ","1,B",NULL,NULL,NULL} } },
+  /* 0x49 */ { 3, { .instr = {"BIT  ","1,C",NULL,NULL,NULL} } },
+  /* 0x4A */ { 3, { .instr = {"BIT  ","1,D",NULL,NULL,NULL} } },
+  /* 0x4B */ { 3, { .instr = {"BIT  ","1,E",NULL,NULL,NULL} } },
+  /* 0x4C */ { 3, { .instr = {"BIT  ","1,H",NULL,NULL,NULL} } },
+  /* 0x4D */ { 3, { .instr = {"BIT  ","1,L",NULL,NULL,NULL} } },
+  /* 0x4E */ { 4, { .instr = {"BIT  ","1,(IX+","d",")",NULL} } },
+  /* 0x4F */ { 3, { .instr = {"BIT  ","1,A",NULL,NULL,NULL} } },
+  /* 0x50 */ { 3, { .instr = {"BIT  ","2,B",NULL,NULL,NULL} } },
+  /* 0x51 */ { 3, { .instr = {"BIT  ","2,C",NULL,NULL,NULL} } },
+  /* 0x52 */ { 3, { .instr = {"BIT  ","2,D",NULL,NULL,NULL} } },
+  /* 0x53 */ { 3, { .instr = {"BIT  ","2,E",NULL,NULL,NULL} } },
+  /* 0x54 */ { 3, { .instr = {"BIT  ","2,H",NULL,NULL,NULL} } },
+  /* 0x55 */ { 3, { .instr = {"BIT  ","2,L",NULL,NULL,NULL} } },
+  /* 0x56 */ { 4, { .instr = {"BIT  ","2,(IX+","d",")",NULL} } },
+  /* 0x57 */ { 3, { .instr = {"BIT  ","2,A",NULL,NULL,NULL} } },
+  /* 0x58 */ { 3, { .instr = {"BIT  ","3,B",NULL,NULL,NULL} } },
+  /* 0x59 */ { 3, { .instr = {"BIT  ","3,C",NULL,NULL,NULL} } },
+  /* 0x5A */ { 3, { .instr = {"BIT  ","3,D",NULL,NULL,NULL} } },
+  /* 0x5B */ { 3, { .instr = {"BIT  ","3,E",NULL,NULL,NULL} } },
+  /* 0x5C */ { 3, { .instr = {"BIT  ","3,H",NULL,NULL,NULL} } },
+  /* 0x5D */ { 3, { .instr = {"BIT  ","3,L",NULL,NULL,NULL} } },
+  /* 0x5E */ { 4, { .instr = {"BIT  ","3,(IX+","d",")",NULL} } },
+  /* 0x5F */ { 3, { .instr = {"BIT  ","3,A",NULL,NULL,NULL} } },
+  /* 0x60 */ { 3, { .instr = {"BIT  ","4,B",NULL,NULL,NULL} } },
+  /* 0x61 */ { 3, { .instr = {"BIT  ","4,C",NULL,NULL,NULL} } },
+  /* 0x62 */ { 3, { .instr = {"BIT  ","4,D",NULL,NULL,NULL} } },
+  /* 0x63 */ { 3, { .instr = {"BIT  ","4,E",NULL,NULL,NULL} } },
+  /* 0x64 */ { 3, { .instr = {"BIT  ","4,H",NULL,NULL,NULL} } },
+  /* 0x65 */ { 3, { .instr = {"BIT  ","4,L",NULL,NULL,NULL} } },
+  /* 0x66 */ { 4, { .instr = {"BIT  ","4,(IX+","d",")",NULL} } },
+  /* 0x67 */ { 3, { .instr = {"BIT  ","4,A",NULL,NULL,NULL} } },
+  /* 0x68 */ { 3, { .instr = {"BIT  ","5,B",NULL,NULL,NULL} } },
+  /* 0x69 */ { 3, { .instr = {"BIT  ","5,C",NULL,NULL,NULL} } },
+  /* 0x6A */ { 3, { .instr = {"BIT  ","5,D",NULL,NULL,NULL} } },
+  /* 0x6B */ { 3, { .instr = {"BIT  ","5,E",NULL,NULL,NULL} } },
+  /* 0x6C */ { 3, { .instr = {"BIT  ","5,H",NULL,NULL,NULL} } },
+  /* 0x6D */ { 3, { .instr = {"BIT  ","5,L",NULL,NULL,NULL} } },
+  /* 0x6E */ { 4, { .instr = {"BIT  ","5,(IX+","d",")",NULL} } },
+  /* 0x6F */ { 3, { .instr = {"BIT  ","5,A",NULL,NULL,NULL} } },
+  /* 0x70 */ { 3, { .instr = {"BIT  ","6,B",NULL,NULL,NULL} } },
+  /* 0x71 */ { 3, { .instr = {"BIT  ","6,C",NULL,NULL,NULL} } },
+  /* 0x72 */ { 3, { .instr = {"BIT  ","6,D",NULL,NULL,NULL} } },
+  /* 0x73 */ { 3, { .instr = {"BIT  ","6,E",NULL,NULL,NULL} } },
+  /* 0x74 */ { 3, { .instr = {"BIT  ","6,H",NULL,NULL,NULL} } },
+  /* 0x75 */ { 3, { .instr = {"BIT  ","6,L",NULL,NULL,NULL} } },
+  /* 0x76 */ { 4, { .instr = {"BIT  ","6,(IX+","d",")",NULL} } },
+  /* 0x77 */ { 3, { .instr = {"BIT  ","6,A",NULL,NULL,NULL} } },
+  /* 0x78 */ { 3, { .instr = {"BIT  ","7,B",NULL,NULL,NULL} } },
+  /* 0x79 */ { 3, { .instr = {"BIT  ","7,C",NULL,NULL,NULL} } },
+  /* 0x7A */ { 3, { .instr = {"BIT  ","7,D",NULL,NULL,NULL} } },
+  /* 0x7B */ { 3, { .instr = {"BIT  ","7,E",NULL,NULL,NULL} } },
+  /* 0x7C */ { 3, { .instr = {"BIT  ","7,H",NULL,NULL,NULL} } },
+  /* 0x7D */ { 3, { .instr = {"BIT  ","7,L",NULL,NULL,NULL} } },
+  /* 0x7E */ { 4, { .instr = {"BIT  ","7,(IX+","d",")",NULL} } },
+  /* 0x7F */ { 3, { .instr = {"BIT  ","7,A",NULL,NULL,NULL} } },
+  /* 0x80 */ { 3, { .instr = {"RES  ","0,B",NULL,NULL,NULL} } },
+  /* 0x81 */ { 3, { .instr = {"RES  ","0,C",NULL,NULL,NULL} } },
+  /* 0x82 */ { 3, { .instr = {"RES  ","0,D",NULL,NULL,NULL} } },
+  /* 0x83 */ { 3, { .instr = {"RES  ","0,E",NULL,NULL,NULL} } },
+  /* 0x84 */ { 3, { .instr = {"RES  ","0,H",NULL,NULL,NULL} } },
+  /* 0x85 */ { 3, { .instr = {"RES  ","0,L",NULL,NULL,NULL} } },
+  /* 0x86 */ { 4, { .instr = {"RES  ","0,(IX+","d",")",NULL} } },
+  /* 0x87 */ { 3, { .instr = {"RES  ","0,A",NULL,NULL,NULL} } },
+  /* 0x88 */ { 3, { .instr = {"RES  ","1,B",NULL,NULL,NULL} } },
+  /* 0x89 */ { 3, { .instr = {"RES  ","1,C",NULL,NULL,NULL} } },
+  /* 0x8A */ { 3, { .instr = {"RES  ","1,D",NULL,NULL,NULL} } },
+  /* 0x8B */ { 3, { .instr = {"RES  ","1,E",NULL,NULL,NULL} } },
+  /* 0x8C */ { 3, { .instr = {"RES  ","1,H",NULL,NULL,NULL} } },
+  /* 0x8D */ { 3, { .instr = {"RES  ","1,L",NULL,NULL,NULL} } },
+  /* 0x8E */ { 4, { .instr = {"RES  ","1,(IX+","d",")",NULL} } },
+  /* 0x8F */ { 3, { .instr = {"RES  ","1,A",NULL,NULL,NULL} } },
+  /* 0x90 */ { 3, { .instr = {"RES  ","2,B",NULL,NULL,NULL} } },
+  /* 0x91 */ { 3, { .instr = {"RES  ","2,C",NULL,NULL,NULL} } },
+  /* 0x92 */ { 3, { .instr = {"RES  ","2,D",NULL,NULL,NULL} } },
+  /* 0x93 */ { 3, { .instr = {"RES  ","2,E",NULL,NULL,NULL} } },
+  /* 0x94 */ { 3, { .instr = {"RES  ","2,H",NULL,NULL,NULL} } },
+  /* 0x95 */ { 3, { .instr = {"RES  ","2,L",NULL,NULL,NULL} } },
+  /* 0x96 */ { 4, { .instr = {"RES  ","2,(IX+","d",")",NULL} } },
+  /* 0x97 */ { 3, { .instr = {"RES  ","2,A",NULL,NULL,NULL} } },
+  /* 0x98 */ { 3, { .instr = {"RES  ","3,B",NULL,NULL,NULL} } },
+  /* 0x99 */ { 3, { .instr = {"RES  ","3,C",NULL,NULL,NULL} } },
+  /* 0x9A */ { 3, { .instr = {"RES  ","3,D",NULL,NULL,NULL} } },
+  /* 0x9B */ { 3, { .instr = {"RES  ","3,E",NULL,NULL,NULL} } },
+  /* 0x9C */ { 3, { .instr = {"RES  ","3,H",NULL,NULL,NULL} } },
+  /* 0x9D */ { 3, { .instr = {"RES  ","3,L",NULL,NULL,NULL} } },
+  /* 0x9E */ { 4, { .instr = {"RES  ","3,(IX+","d",")",NULL} } },
+  /* 0x9F */ { 3, { .instr = {"RES  ","3,A",NULL,NULL,NULL} } },
+  /* 0xA0 */ { 3, { .instr = {"RES  ","4,B",NULL,NULL,NULL} } },
+  /* 0xA1 */ { 3, { .instr = {"RES  ","4,C",NULL,NULL,NULL} } },
+  /* 0xA2 */ { 3, { .instr = {"RES  ","4,D",NULL,NULL,NULL} } },
+  /* 0xA3 */ { 3, { .instr = {"RES  ","4,E",NULL,NULL,NULL} } },
+  /* 0xA4 */ { 3, { .instr = {"RES  ","4,H",NULL,NULL,NULL} } },
+  /* 0xA5 */ { 3, { .instr = {"RES  ","4,L",NULL,NULL,NULL} } },
+  /* 0xA6 */ { 4, { .instr = {"RES  ","4,(IX+","d",")",NULL} } },
+  /* 0xA7 */ { 3, { .instr = {"RES  ","4,A",NULL,NULL,NULL} } },
+  /* 0xA8 */ { 3, { .instr = {"RES  ","5,B",NULL,NULL,NULL} } },
+  /* 0xA9 */ { 3, { .instr = {"RES  ","5,C",NULL,NULL,NULL} } },
+  /* 0xAA */ { 3, { .instr = {"RES  ","5,D",NULL,NULL,NULL} } },
+  /* 0xAB */ { 3, { .instr = {"RES  ","5,E",NULL,NULL,NULL} } },
+  /* 0xAC */ { 3, { .instr = {"RES  ","5,H",NULL,NULL,NULL} } },
+  /* 0xAD */ { 3, { .instr = {"RES  ","5,L",NULL,NULL,NULL} } },
+  /* 0xAE */ { 4, { .instr = {"RES  ","5,(IX+","d",")",NULL} } },
+  /* 0xAF */ { 3, { .instr = {"RES  ","5,A",NULL,NULL,NULL} } },
+  /* 0xB0 */ { 3, { .instr = {"RES  ","6,B",NULL,NULL,NULL} } },
+  /* 0xB1 */ { 3, { .instr = {"RES  ","6,C",NULL,NULL,NULL} } },
+  /* 0xB2 */ { 3, { .instr = {"RES  ","6,D",NULL,NULL,NULL} } },
+  /* 0xB3 */ { 3, { .instr = {"RES  ","6,E",NULL,NULL,NULL} } },
+  /* 0xB4 */ { 3, { .instr = {"RES  ","6,H",NULL,NULL,NULL} } },
+  /* 0xB5 */ { 3, { .instr = {"RES  ","6,L",NULL,NULL,NULL} } },
+  /* 0xB6 */ { 4, { .instr = {"RES  ","6,(IX+","d",")",NULL} } },
+  /* 0xB7 */ { 3, { .instr = {"RES  ","6,A",NULL,NULL,NULL} } },
+  /* 0xB8 */ { 3, { .instr = {"RES  ","7,B",NULL,NULL,NULL} } },
+  /* 0xB9 */ { 3, { .instr = {"RES  ","7,C",NULL,NULL,NULL} } },
+  /* 0xBA */ { 3, { .instr = {"RES  ","7,D",NULL,NULL,NULL} } },
+  /* 0xBB */ { 3, { .instr = {"RES  ","7,E",NULL,NULL,NULL} } },
+  /* 0xBC */ { 3, { .instr = {"RES  ","7,H",NULL,NULL,NULL} } },
+  /* 0xBD */ { 3, { .instr = {"RES  ","7,L",NULL,NULL,NULL} } },
+  /* 0xBE */ { 4, { .instr = {"RES  ","7,(IX+","d",")",NULL} } },
+  /* 0xBF */ { 3, { .instr = {"RES  ","7,A",NULL,NULL,NULL} } },
+  /* 0xC0 */ { 3, { .instr = {"SET  ","0,B",NULL,NULL,NULL} } },
+  /* 0xC1 */ { 3, { .instr = {"SET  ","0,C",NULL,NULL,NULL} } },
+  /* 0xC2 */ { 3, { .instr = {"SET  ","0,D",NULL,NULL,NULL} } },
+  /* 0xC3 */ { 3, { .instr = {"SET  ","0,E",NULL,NULL,NULL} } },
+  /* 0xC4 */ { 3, { .instr = {"SET  ","0,H",NULL,NULL,NULL} } },
+  /* 0xC5 */ { 3, { .instr = {"SET  ","0,L",NULL,NULL,NULL} } },
+  /* 0xC6 */ { 4, { .instr = {"SET  ","0,(IX+","d",")",NULL} } },
+  /* 0xC7 */ { 3, { .instr = {"SET  ","0,A",NULL,NULL,NULL} } },
+  /* 0xC8 */ { 3, { .instr = {"SET  ","1,B",NULL,NULL,NULL} } },
+  /* 0xC9 */ { 3, { .instr = {"SET  ","1,C",NULL,NULL,NULL} } },
+  /* 0xCA */ { 3, { .instr = {"SET  ","1,D",NULL,NULL,NULL} } },
+  /* 0xCB */ { 3, { .instr = {"SET  ","1,E",NULL,NULL,NULL} } },
+  /* 0xCC */ { 3, { .instr = {"SET  ","1,H",NULL,NULL,NULL} } },
+  /* 0xCD */ { 3, { .instr = {"SET  ","1,L",NULL,NULL,NULL} } },
+  /* 0xCE */ { 4, { .instr = {"SET  ","1,(IX+","d",")",NULL} } },
+  /* 0xCF */ { 3, { .instr = {"SET  ","1,A",NULL,NULL,NULL} } },
+  /* 0xD0 */ { 3, { .instr = {"SET  ","2,B",NULL,NULL,NULL} } },
+  /* 0xD1 */ { 3, { .instr = {"SET  ","2,C",NULL,NULL,NULL} } },
+  /* 0xD2 */ { 3, { .instr = {"SET  ","2,D",NULL,NULL,NULL} } },
+  /* 0xD3 */ { 3, { .instr = {"SET  ","2,E",NULL,NULL,NULL} } },
+  /* 0xD4 */ { 3, { .instr = {"SET  ","2,H",NULL,NULL,NULL} } },
+  /* 0xD5 */ { 3, { .instr = {"SET  ","2,L",NULL,NULL,NULL} } },
+  /* 0xD6 */ { 4, { .instr = {"SET  ","2,(IX+","d",")",NULL} } },
+  /* 0xD7 */ { 3, { .instr = {"SET  ","2,A",NULL,NULL,NULL} } },
+  /* 0xD8 */ { 3, { .instr = {"SET  ","3,B",NULL,NULL,NULL} } },
+  /* 0xD9 */ { 3, { .instr = {"SET  ","3,C",NULL,NULL,NULL} } },
+  /* 0xDA */ { 3, { .instr = {"SET  ","3,D",NULL,NULL,NULL} } },
+  /* 0xDB */ { 3, { .instr = {"SET  ","3,E",NULL,NULL,NULL} } },
+  /* 0xDC */ { 3, { .instr = {"SET  ","3,H",NULL,NULL,NULL} } },
+  /* 0xDD */ { 3, { .instr = {"SET  ","3,L",NULL,NULL,NULL} } },
+  /* 0xDE */ { 4, { .instr = {"SET  ","3,(IX+","d",")",NULL} } },
+  /* 0xDF */ { 3, { .instr = {"SET  ","3,A",NULL,NULL,NULL} } },
+  /* 0xE0 */ { 3, { .instr = {"SET  ","4,B",NULL,NULL,NULL} } },
+  /* 0xE1 */ { 3, { .instr = {"SET  ","4,C",NULL,NULL,NULL} } },
+  /* 0xE2 */ { 3, { .instr = {"SET  ","4,D",NULL,NULL,NULL} } },
+  /* 0xE3 */ { 3, { .instr = {"SET  ","4,E",NULL,NULL,NULL} } },
+  /* 0xE4 */ { 3, { .instr = {"SET  ","4,H",NULL,NULL,NULL} } },
+  /* 0xE5 */ { 3, { .instr = {"SET  ","4,L",NULL,NULL,NULL} } },
+  /* 0xE6 */ { 4, { .instr = {"SET  ","4,(IX+","d",")",NULL} } },
+  /* 0xE7 */ { 3, { .instr = {"SET  ","4,A",NULL,NULL,NULL} } },
+  /* 0xE8 */ { 3, { .instr = {"SET  ","5,B",NULL,NULL,NULL} } },
+  /* 0xE9 */ { 3, { .instr = {"SET  ","5,C",NULL,NULL,NULL} } },
+  /* 0xEA */ { 3, { .instr = {"SET  ","5,D",NULL,NULL,NULL} } },
+  /* 0xEB */ { 3, { .instr = {"SET  ","5,E",NULL,NULL,NULL} } },
+  /* 0xEC */ { 3, { .instr = {"SET  ","5,H",NULL,NULL,NULL} } },
+  /* 0xED */ { 3, { .instr = {"SET  ","5,L",NULL,NULL,NULL} } },
+  /* 0xEE */ { 4, { .instr = {"SET  ","5,(IX+","d",")",NULL} } },
+  /* 0xEF */ { 3, { .instr = {"SET  ","5,A",NULL,NULL,NULL} } },
+  /* 0xF0 */ { 3, { .instr = {"SET  ","6,B",NULL,NULL,NULL} } },
+  /* 0xF1 */ { 3, { .instr = {"SET  ","6,C",NULL,NULL,NULL} } },
+  /* 0xF2 */ { 3, { .instr = {"SET  ","6,D",NULL,NULL,NULL} } },
+  /* 0xF3 */ { 3, { .instr = {"SET  ","6,E",NULL,NULL,NULL} } },
+  /* 0xF4 */ { 3, { .instr = {"SET  ","6,H",NULL,NULL,NULL} } },
+  /* 0xF5 */ { 3, { .instr = {"SET  ","6,L",NULL,NULL,NULL} } },
+  /* 0xF6 */ { 4, { .instr = {"SET  ","6,(IX+","d",")",NULL} } },
+  /* 0xF7 */ { 3, { .instr = {"SET  ","6,A",NULL,NULL,NULL} } },
+  /* 0xF8 */ { 3, { .instr = {"SET  ","7,B",NULL,NULL,NULL} } },
+  /* 0xF9 */ { 3, { .instr = {"SET  ","7,C",NULL,NULL,NULL} } },
+  /* 0xFA */ { 3, { .instr = {"SET  ","7,D",NULL,NULL,NULL} } },
+  /* 0xFB */ { 3, { .instr = {"SET  ","7,E",NULL,NULL,NULL} } },
+  /* 0xFC */ { 3, { .instr = {"SET  ","7,H",NULL,NULL,NULL} } },
+  /* 0xFD */ { 3, { .instr = {"SET  ","7,L",NULL,NULL,NULL} } },
+  /* 0xFE */ { 4, { .instr = {"SET  ","7,(IX+","d",")",NULL} } },
+  /* 0xFF */ { 3, { .instr = {"SET  ","7,A",NULL,NULL,NULL} } },
+};
+
+static table_entry_t tableDD[256] = {
+  /* 0x00 */ { 2, { .instr = {"NOP  ",NULL,NULL,NULL,NULL} } },
+  /* 0x01 */ { 4, { .instr = {"LD   ","BC,","nn",NULL,NULL} } },
+  /* 0x02 */ { 2, { .instr = {"LD   ","(BC),A",NULL,NULL,NULL} } },
+  /* 0x03 */ { 2, { .instr = {"INC  ","BC",NULL,NULL,NULL} } },
+  /* 0x04 */ { 2, { .instr = {"INC  ","B",NULL,NULL,NULL} } },
+  /* 0x05 */ { 2, { .instr = {"DEC  ","B",NULL,NULL,NULL} } },
+  /* 0x06 */ { 3, { .instr = {"LD   ","B,","n",NULL,NULL} } },
+  /* 0x07 */ { 2, { .instr = {"RLCA ",NULL,NULL,NULL,NULL} } },
+  /* 0x08 */ { 2, { .instr = {"EX   ","AF,AF'",NULL,NULL,NULL} } },
+  /* 0x09 */ { 2, { .instr = {"ADD  ","IX,BC",NULL,NULL,NULL} } },
+  /* 0x0A */ { 2, { .instr = {"LD   ","A,(BC)",NULL,NULL,NULL} } },
+  /* 0x0B */ { 2, { .instr = {"DEC  ","BC",NULL,NULL,NULL} } },
+  /* 0x0C */ { 2, { .instr = {"INC  ","C",NULL,NULL,NULL} } },
+  /* 0x0D */ { 2, { .instr = {"DEC  ","C",NULL,NULL,NULL} } },
+  /* 0x0E */ { 3, { .instr = {"LD   ","C,","n",NULL,NULL} } },
+  /* 0x0F */ { 2, { .instr = {"RRCA ",NULL,NULL,NULL,NULL} } },
+  /* 0x10 */ { 3, { .instr = {"DJNZ ","e",NULL,NULL,NULL} } },
+  /* 0x11 */ { 4, { .instr = {"LD   ","DE,","nn",NULL,NULL} } },
+  /* 0x12 */ { 2, { .instr = {"LD   ","(DE),A",NULL,NULL,NULL} } },
+  /* 0x13 */ { 2, { .instr = {"INC  ","DE",NULL,NULL,NULL} } },
+  /* 0x14 */ { 2, { .instr = {"INC  ","D",NULL,NULL,NULL} } },
+  /* 0x15 */ { 2, { .instr = {"DEC  ","D",NULL,NULL,NULL} } },
+  /* 0x16 */ { 3, { .instr = {"LD   ","D,","n",NULL,NULL} } },
+  /* 0x17 */ { 2, { .instr = {"RLA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x18 */ { 3, { .instr = {"JR   ","e",NULL,NULL,NULL} } },
+  /* 0x19 */ { 2, { .instr = {"ADD  ","IX,DE",NULL,NULL,NULL} } },
+  /* 0x1A */ { 2, { .instr = {"LD   ","A,(DE)",NULL,NULL,NULL} } },
+  /* 0x1B */ { 2, { .instr = {"DEC  ","DE",NULL,NULL,NULL} } },
+  /* 0x1C */ { 2, { .instr = {"INC  ","E",NULL,NULL,NULL} } },
+  /* 0x1D */ { 2, { .instr = {"DEC  ","E",NULL,NULL,NULL} } },
+  /* 0x1E */ { 3, { .instr = {"LD   ","E,","n",NULL,NULL} } },
+  /* 0x1F */ { 2, { .instr = {"RRA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x20 */ { 3, { .instr = {"JR   ","NZ,","e",NULL,NULL} } },
+  /* 0x21 */ { 4, { .instr = {"LD   ","IX,","nn",NULL,NULL} } },
+  /* 0x22 */ { 4, { .instr = {"LD   ","(","nn","),IX",NULL} } },
+  /* 0x23 */ { 2, { .instr = {"INC  ","IX",NULL,NULL,NULL} } },
+  /* 0x24 */ { 2, { .instr = {"INC  ","IXH",NULL,NULL,NULL} } },
+  /* 0x25 */ { 2, { .instr = {"DEC  ","IXH",NULL,NULL,NULL} } },
+  /* 0x26 */ { 3, { .instr = {"LD   ","IXH,","n",NULL,NULL} } },
+  /* 0x27 */ { 2, { .instr = {"DAA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x28 */ { 3, { .instr = {"JR   ","Z,","e",NULL,NULL} } },
+  /* 0x29 */ { 2, { .instr = {"ADD  ","IX,IX",NULL,NULL,NULL} } },
+  /* 0x2A */ { 4, { .instr = {"LD   ","IX,(","nn",")",NULL} } },
+  /* 0x2B */ { 2, { .instr = {"DEC  ","IX",NULL,NULL,NULL} } },
+  /* 0x2C */ { 2, { .instr = {"INC  ","IXL",NULL,NULL,NULL} } },
+  /* 0x2D */ { 2, { .instr = {"DEC  ","IXL",NULL,NULL,NULL} } },
+  /* 0x2E */ { 3, { .instr = {"LD   ","IXL,","n",NULL,NULL} } },
+  /* 0x2F */ { 2, { .instr = {"CPL  ",NULL,NULL,NULL,NULL} } },
+  /* 0x30 */ { 3, { .instr = {"JR   ","NC,","e",NULL,NULL} } },
+  /* 0x31 */ { 4, { .instr = {"LD   ","SP,","nn",NULL,NULL} } },
+  /* 0x32 */ { 4, { .instr = {"LD   ","(","nn","),A",NULL} } },
+  /* 0x33 */ { 2, { .instr = {"INC  ","SP",NULL,NULL,NULL} } },
+  /* 0x34 */ { 3, { .instr = {"INC  ","(IX+","d",")",NULL} } },
+  /* 0x35 */ { 3, { .instr = {"DEC  ","(IX+","d",")",NULL} } },
+  /* 0x36 */ { 4, { .instr = {"LD   ","(IX+","d","),","n"} } },
+  /* 0x37 */ { 2, { .instr = {"SCF  ",NULL,NULL,NULL,NULL} } },
+  /* 0x38 */ { 3, { .instr = {"JR   ","C,","e",NULL,NULL} } },
+  /* 0x39 */ { 2, { .instr = {"ADD  ","IX,SP",NULL,NULL,NULL} } },
+  /* 0x3A */ { 4, { .instr = {"LD   ","A,(","nn",")",NULL} } },
+  /* 0x3B */ { 2, { .instr = {"DEC  ","SP",NULL,NULL,NULL} } },
+  /* 0x3C */ { 2, { .instr = {"INC  ","A",NULL,NULL,NULL} } },
+  /* 0x3D */ { 2, { .instr = {"DEC  ","A",NULL,NULL,NULL} } },
+  /* 0x3E */ { 3, { .instr = {"LD   ","A,","n",NULL,NULL} } },
+  /* 0x3F */ { 2, { .instr = {"CCF  ",NULL,NULL,NULL,NULL} } },
+  /* 0x40 */ { 2, { .instr = {"LD   ","B,B",NULL,NULL,NULL} } },
+  /* 0x41 */ { 2, { .instr = {"LD   ","B,C",NULL,NULL,NULL} } },
+  /* 0x42 */ { 2, { .instr = {"LD   ","B,D",NULL,NULL,NULL} } },
+  /* 0x43 */ { 2, { .instr = {"LD   ","B,E",NULL,NULL,NULL} } },
+  /* 0x44 */ { 2, { .instr = {"LD   ","B,IXH",NULL,NULL,NULL} } },
+  /* 0x45 */ { 2, { .instr = {"LD   ","B,IXL",NULL,NULL,NULL} } },
+  /* 0x46 */ { 3, { .instr = {"LD   ","B,(IX+","d",")",NULL} } },
+  /* 0x47 */ { 2, { .instr = {"LD   ","B,A",NULL,NULL,NULL} } },
+  /* 0x48 */ { 2, { .instr = {"LD   ","C,B",NULL,NULL,NULL} } },
+  /* 0x49 */ { 2, { .instr = {"LD   ","C,C",NULL,NULL,NULL} } },
+  /* 0x4A */ { 2, { .instr = {"LD   ","C,D",NULL,NULL,NULL} } },
+  /* 0x4B */ { 2, { .instr = {"LD   ","C,E",NULL,NULL,NULL} } },
+  /* 0x4C */ { 2, { .instr = {"LD   ","C,IXH",NULL,NULL,NULL} } },
+  /* 0x4D */ { 2, { .instr = {"LD   ","C,IXL",NULL,NULL,NULL} } },
+  /* 0x4E */ { 3, { .instr = {"LD   ","C,(IX+","d",")",NULL} } },
+  /* 0x4F */ { 2, { .instr = {"LD   ","C,A",NULL,NULL,NULL} } },
+  /* 0x50 */ { 2, { .instr = {"LD   ","D,B",NULL,NULL,NULL} } },
+  /* 0x51 */ { 2, { .instr = {"LD   ","D,C",NULL,NULL,NULL} } },
+  /* 0x52 */ { 2, { .instr = {"LD   ","D,D",NULL,NULL,NULL} } },
+  /* 0x53 */ { 2, { .instr = {"LD   ","D,E",NULL,NULL,NULL} } },
+  /* 0x54 */ { 2, { .instr = {"LD   ","D,IXH",NULL,NULL,NULL} } },
+  /* 0x55 */ { 2, { .instr = {"LD   ","D,IXL",NULL,NULL,NULL} } },
+  /* 0x56 */ { 3, { .instr = {"LD   ","D,(IX+","d",")",NULL} } },
+  /* 0x57 */ { 2, { .instr = {"LD   ","D,A",NULL,NULL,NULL} } },
+  /* 0x58 */ { 2, { .instr = {"LD   ","E,B",NULL,NULL,NULL} } },
+  /* 0x59 */ { 2, { .instr = {"LD   ","E,C",NULL,NULL,NULL} } },
+  /* 0x5A */ { 2, { .instr = {"LD   ","E,D",NULL,NULL,NULL} } },
+  /* 0x5B */ { 2, { .instr = {"LD   ","E,E",NULL,NULL,NULL} } },
+  /* 0x5C */ { 2, { .instr = {"LD   ","E,IXH",NULL,NULL,NULL} } },
+  /* 0x5D */ { 2, { .instr = {"LD   ","E,IXL",NULL,NULL,NULL} } },
+  /* 0x5E */ { 3, { .instr = {"LD   ","E,(IX+","d",")",NULL} } },
+  /* 0x5F */ { 2, { .instr = {"LD   ","E,A",NULL,NULL,NULL} } },
+  /* 0x60 */ { 2, { .instr = {"LD   ","IXH,B",NULL,NULL,NULL} } },
+  /* 0x61 */ { 2, { .instr = {"LD   ","IXH,C",NULL,NULL,NULL} } },
+  /* 0x62 */ { 2, { .instr = {"LD   ","IXH,D",NULL,NULL,NULL} } },
+  /* 0x63 */ { 2, { .instr = {"LD   ","IXH,E",NULL,NULL,NULL} } },
+  /* 0x64 */ { 2, { .instr = {"LD   ","IXH,IXH",NULL,NULL,NULL} } },
+  /* 0x65 */ { 2, { .instr = {"LD   ","IXH,IXL",NULL,NULL,NULL} } },
+  /* 0x66 */ { 3, { .instr = {"LD   ","H,(IX+","d",")",NULL} } },
+  /* 0x67 */ { 2, { .instr = {"LD   ","IXH,A",NULL,NULL,NULL} } },
+  /* 0x68 */ { 2, { .instr = {"LD   ","IXL,B",NULL,NULL,NULL} } },
+  /* 0x69 */ { 2, { .instr = {"LD   ","IXL,C",NULL,NULL,NULL} } },
+  /* 0x6A */ { 2, { .instr = {"LD   ","IXL,D",NULL,NULL,NULL} } },
+  /* 0x6B */ { 2, { .instr = {"LD   ","IXL,E",NULL,NULL,NULL} } },
+  /* 0x6C */ { 2, { .instr = {"LD   ","IXL,IXH",NULL,NULL,NULL} } },
+  /* 0x6D */ { 2, { .instr = {"LD   ","IXL,IXL",NULL,NULL,NULL} } },
+  /* 0x6E */ { 3, { .instr = {"LD   ","L,(IX+","d",")",NULL} } },
+  /* 0x6F */ { 2, { .instr = {"LD   ","IXL,A",NULL,NULL,NULL} } },
+  /* 0x70 */ { 3, { .instr = {"LD   ","(IX+","d","),B",NULL} } },
+  /* 0x71 */ { 3, { .instr = {"LD   ","(IX+","d","),C",NULL} } },
+  /* 0x72 */ { 3, { .instr = {"LD   ","(IX+","d","),D",NULL} } },
+  /* 0x73 */ { 3, { .instr = {"LD   ","(IX+","d","),E",NULL} } },
+  /* 0x74 */ { 3, { .instr = {"LD   ","(IX+","d","),H",NULL} } },
+  /* 0x75 */ { 3, { .instr = {"LD   ","(IX+","d","),L",NULL} } },
+  /* 0x76 */ { 2, { .instr = {"HALT ",NULL,NULL,NULL,NULL} } },
+  /* 0x77 */ { 3, { .instr = {"LD   ","(IX+","d","),A",NULL} } },
+  /* 0x78 */ { 2, { .instr = {"LD   ","A,B",NULL,NULL,NULL} } },
+  /* 0x79 */ { 2, { .instr = {"LD   ","A,C",NULL,NULL,NULL} } },
+  /* 0x7A */ { 2, { .instr = {"LD   ","A,D",NULL,NULL,NULL} } },
+  /* 0x7B */ { 2, { .instr = {"LD   ","A,E",NULL,NULL,NULL} } },
+  /* 0x7C */ { 2, { .instr = {"LD   ","A,IXH",NULL,NULL,NULL} } },
+  /* 0x7D */ { 2, { .instr = {"LD   ","A,IXL",NULL,NULL,NULL} } },
+  /* 0x7E */ { 3, { .instr = {"LD   ","A,(IX+","d",")",NULL} } },
+  /* 0x7F */ { 2, { .instr = {"LD   ","A,A",NULL,NULL,NULL} } },
+  /* 0x80 */ { 2, { .instr = {"ADD  ","A,B",NULL,NULL,NULL} } },
+  /* 0x81 */ { 2, { .instr = {"ADD  ","A,C",NULL,NULL,NULL} } },
+  /* 0x82 */ { 2, { .instr = {"ADD  ","A,D",NULL,NULL,NULL} } },
+  /* 0x83 */ { 2, { .instr = {"ADD  ","A,E",NULL,NULL,NULL} } },
+  /* 0x84 */ { 2, { .instr = {"ADD  ","A,IXH",NULL,NULL,NULL} } },
+  /* 0x85 */ { 2, { .instr = {"ADD  ","A,IXL",NULL,NULL,NULL} } },
+  /* 0x86 */ { 3, { .instr = {"ADD  ","A,(IX+","d",")",NULL} } },
+  /* 0x87 */ { 2, { .instr = {"ADD  ","A,A",NULL,NULL,NULL} } },
+  /* 0x88 */ { 2, { .instr = {"ADC  ","A,B",NULL,NULL,NULL} } },
+  /* 0x89 */ { 2, { .instr = {"ADC  ","A,C",NULL,NULL,NULL} } },
+  /* 0x8A */ { 2, { .instr = {"ADC  ","A,D",NULL,NULL,NULL} } },
+  /* 0x8B */ { 2, { .instr = {"ADC  ","A,E",NULL,NULL,NULL} } },
+  /* 0x8C */ { 2, { .instr = {"ADC  ","A,IXH",NULL,NULL,NULL} } },
+  /* 0x8D */ { 2, { .instr = {"ADC  ","A,IXL",NULL,NULL,NULL} } },
+  /* 0x8E */ { 3, { .instr = {"ADC  ","A,(IX+","d",")",NULL} } },
+  /* 0x8F */ { 2, { .instr = {"ADC  ","A,A",NULL,NULL,NULL} } },
+  /* 0x90 */ { 2, { .instr = {"SUB  ","B",NULL,NULL,NULL} } },
+  /* 0x91 */ { 2, { .instr = {"SUB  ","C",NULL,NULL,NULL} } },
+  /* 0x92 */ { 2, { .instr = {"SUB  ","D",NULL,NULL,NULL} } },
+  /* 0x93 */ { 2, { .instr = {"SUB  ","E",NULL,NULL,NULL} } },
+  /* 0x94 */ { 2, { .instr = {"SUB  ","IXH",NULL,NULL,NULL} } },
+  /* 0x95 */ { 2, { .instr = {"SUB  ","IXL",NULL,NULL,NULL} } },
+  /* 0x96 */ { 3, { .instr = {"SUB  ","(IX+","d",")",NULL} } },
+  /* 0x97 */ { 2, { .instr = {"SUB  ","A",NULL,NULL,NULL} } },
+  /* 0x98 */ { 2, { .instr = {"SBC  ","A,B",NULL,NULL,NULL} } },
+  /* 0x99 */ { 2, { .instr = {"SBC  ","A,C",NULL,NULL,NULL} } },
+  /* 0x9A */ { 2, { .instr = {"SBC  ","A,D",NULL,NULL,NULL} } },
+  /* 0x9B */ { 2, { .instr = {"SBC  ","A,E",NULL,NULL,NULL} } },
+  /* 0x9C */ { 2, { .instr = {"SBC  ","A,IXH",NULL,NULL,NULL} } },
+  /* 0x9D */ { 2, { .instr = {"SBC  ","A,IXL",NULL,NULL,NULL} } },
+  /* 0x9E */ { 3, { .instr = {"SBC  ","A,(IX+","d",")",NULL} } },
+  /* 0x9F */ { 2, { .instr = {"SBC  ","A,A",NULL,NULL,NULL} } },
+  /* 0xA0 */ { 2, { .instr = {"AND  ","B",NULL,NULL,NULL} } },
+  /* 0xA1 */ { 2, { .instr = {"AND  ","C",NULL,NULL,NULL} } },
+  /* 0xA2 */ { 2, { .instr = {"AND  ","D",NULL,NULL,NULL} } },
+  /* 0xA3 */ { 2, { .instr = {"AND  ","E",NULL,NULL,NULL} } },
+  /* 0xA4 */ { 2, { .instr = {"AND  ","IXH",NULL,NULL,NULL} } },
+  /* 0xA5 */ { 2, { .instr = {"AND  ","IXL",NULL,NULL,NULL} } },
+  /* 0xA6 */ { 3, { .instr = {"AND  ","(IX+","d",")",NULL} } },
+  /* 0xA7 */ { 2, { .instr = {"AND  ","A",NULL,NULL,NULL} } },
+  /* 0xA8 */ { 2, { .instr = {"XOR  ","B",NULL,NULL,NULL} } },
+  /* 0xA9 */ { 2, { .instr = {"XOR  ","C",NULL,NULL,NULL} } },
+  /* 0xAA */ { 2, { .instr = {"XOR  ","D",NULL,NULL,NULL} } },
+  /* 0xAB */ { 2, { .instr = {"XOR  ","E",NULL,NULL,NULL} } },
+  /* 0xAC */ { 2, { .instr = {"XOR  ","IXH",NULL,NULL,NULL} } },
+  /* 0xAD */ { 2, { .instr = {"XOR  ","IXL",NULL,NULL,NULL} } },
+  /* 0xAE */ { 3, { .instr = {"XOR  ","(IX+","d",")",NULL} } },
+  /* 0xAF */ { 2, { .instr = {"XOR  ","A",NULL,NULL,NULL} } },
+  /* 0xB0 */ { 2, { .instr = {"OR   ","B",NULL,NULL,NULL} } },
+  /* 0xB1 */ { 2, { .instr = {"OR   ","C",NULL,NULL,NULL} } },
+  /* 0xB2 */ { 2, { .instr = {"OR   ","D",NULL,NULL,NULL} } },
+  /* 0xB3 */ { 2, { .instr = {"OR   ","E",NULL,NULL,NULL} } },
+  /* 0xB4 */ { 2, { .instr = {"OR   ","IXH",NULL,NULL,NULL} } },
+  /* 0xB5 */ { 2, { .instr = {"OR   ","IXL",NULL,NULL,NULL} } },
+  /* 0xB6 */ { 3, { .instr = {"OR   ","(IX+","d",")",NULL} } },
+  /* 0xB7 */ { 2, { .instr = {"OR   ","A",NULL,NULL,NULL} } },
+  /* 0xB8 */ { 2, { .instr = {"CP   ","B",NULL,NULL,NULL} } },
+  /* 0xB9 */ { 2, { .instr = {"CP   ","C",NULL,NULL,NULL} } },
+  /* 0xBA */ { 2, { .instr = {"CP   ","D",NULL,NULL,NULL} } },
+  /* 0xBB */ { 2, { .instr = {"CP   ","E",NULL,NULL,NULL} } },
+  /* 0xBC */ { 2, { .instr = {"CP   ","IXH",NULL,NULL,NULL} } },
+  /* 0xBD */ { 2, { .instr = {"CP   ","IXL",NULL,NULL,NULL} } },
+  /* 0xBE */ { 3, { .instr = {"CP   ","(IX+","d",")",NULL} } },
+  /* 0xBF */ { 2, { .instr = {"CP   ","A",NULL,NULL,NULL} } },
+  /* 0xC0 */ { 2, { .instr = {"RET  ","NZ",NULL,NULL,NULL} } },
+  /* 0xC1 */ { 2, { .instr = {"POP  ","BC",NULL,NULL,NULL} } },
+  /* 0xC2 */ { 4, { .instr = {"JP   ","NZ,","nn",NULL,NULL} } },
+  /* 0xC3 */ { 4, { .instr = {"JP   ","nn",NULL,NULL,NULL} } },
+  /* 0xC4 */ { 4, { .instr = {"CALL ","NZ,","nn",NULL,NULL} } },
+  /* 0xC5 */ { 2, { .instr = {"PUSH ","BC",NULL,NULL,NULL} } },
+  /* 0xC6 */ { 3, { .instr = {"ADD  ","A,","n",NULL,NULL} } },
+  /* 0xC7 */ { 2, { .instr = {"RST  ","$00",NULL,NULL,NULL} } },
+  /* 0xC8 */ { 2, { .instr = {"RET  ","Z",NULL,NULL,NULL} } },
+  /* 0xC9 */ { 2, { .instr = {"RET  ",NULL,NULL,NULL,NULL} } },
+  /* 0xCA */ { 4, { .instr = {"JP   ","Z,","nn",NULL,NULL} } },
+  /* 0xCB */ { 0, { .table = tableDDCB } },
+  /* 0xCC */ { 4, { .instr = {"CALL ","Z,","nn",NULL,NULL} } },
+  /* 0xCD */ { 4, { .instr = {"CALL ","nn",NULL,NULL,NULL} } },
+  /* 0xCE */ { 3, { .instr = {"ADC  ","A,","n",NULL,NULL} } },
+  /* 0xCF */ { 2, { .instr = {"RST  ","$08",NULL,NULL,NULL} } },
+  /* 0xD0 */ { 2, { .instr = {"RET  ","NC",NULL,NULL,NULL} } },
+  /* 0xD1 */ { 2, { .instr = {"POP  ","DE",NULL,NULL,NULL} } },
+  /* 0xD2 */ { 4, { .instr = {"JP   ","NC,","nn",NULL,NULL} } },
+  /* 0xD3 */ { 3, { .instr = {"OUT  ","(","n","),A",NULL} } },
+  /* 0xD4 */ { 4, { .instr = {"CALL ","NC,","nn",NULL,NULL} } },
+  /* 0xD5 */ { 2, { .instr = {"PUSH ","DE",NULL,NULL,NULL} } },
+  /* 0xD6 */ { 3, { .instr = {"SUB  ","n",NULL,NULL,NULL} } },
+  /* 0xD7 */ { 2, { .instr = {"RST  ","$10",NULL,NULL,NULL} } },
+  /* 0xD8 */ { 2, { .instr = {"RET  ","C",NULL,NULL,NULL} } },
+  /* 0xD9 */ { 2, { .instr = {"EXX  ",NULL,NULL,NULL,NULL} } },
+  /* 0xDA */ { 4, { .instr = {"JP   ","C,","nn",NULL,NULL} } },
+  /* 0xDB */ { 3, { .instr = {"IN   ","A,(","n",")",NULL} } },
+  /* 0xDC */ { 4, { .instr = {"CALL ","C,","nn",NULL,NULL} } },
+  /* 0xDD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDE */ { 3, { .instr = {"SBC  ","A,","n",NULL,NULL} } },
+  /* 0xDF */ { 2, { .instr = {"RST  ","$18",NULL,NULL,NULL} } },
+  /* 0xE0 */ { 2, { .instr = {"RET  ","PO",NULL,NULL,NULL} } },
+  /* 0xE1 */ { 2, { .instr = {"POP  ","IX",NULL,NULL,NULL} } },
+  /* 0xE2 */ { 4, { .instr = {"JP   ","PO,","nn",NULL,NULL} } },
+  /* 0xE3 */ { 2, { .instr = {"EX   ","(SP),IX",NULL,NULL,NULL} } },
+  /* 0xE4 */ { 4, { .instr = {"CALL ","PO,","nn",NULL,NULL} } },
+  /* 0xE5 */ { 2, { .instr = {"PUSH ","IX",NULL,NULL,NULL} } },
+  /* 0xE6 */ { 3, { .instr = {"AND  ","n",NULL,NULL,NULL} } },
+  /* 0xE7 */ { 2, { .instr = {"RST  ","$20",NULL,NULL,NULL} } },
+  /* 0xE8 */ { 2, { .instr = {"RET  ","PE",NULL,NULL,NULL} } },
+  /* 0xE9 */ { 2, { .instr = {"JP   ","(IX)",NULL,NULL,NULL} } },
+  /* 0xEA */ { 4, { .instr = {"JP   ","PE,","nn",NULL,NULL} } },
+  /* 0xEB */ { 2, { .instr = {"EX   ","DE,HL",NULL,NULL,NULL} } },
+  /* 0xEC */ { 4, { .instr = {"CALL ","PE,","nn",NULL,NULL} } },
+  /* 0xED */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xEE */ { 3, { .instr = {"XOR  ","n",NULL,NULL,NULL} } },
+  /* 0xEF */ { 2, { .instr = {"RST  ","$28",NULL,NULL,NULL} } },
+  /* 0xF0 */ { 2, { .instr = {"RET  ","P",NULL,NULL,NULL} } },
+  /* 0xF1 */ { 2, { .instr = {"POP  ","AF",NULL,NULL,NULL} } },
+  /* 0xF2 */ { 4, { .instr = {"JP   ","P,","nn",NULL,NULL} } },
+  /* 0xF3 */ { 2, { .instr = {"DI   ",NULL,NULL,NULL,NULL} } },
+  /* 0xF4 */ { 4, { .instr = {"CALL ","P,","nn",NULL,NULL} } },
+  /* 0xF5 */ { 2, { .instr = {"PUSH ","AF",NULL,NULL,NULL} } },
+  /* 0xF6 */ { 3, { .instr = {"OR   ","n",NULL,NULL,NULL} } },
+  /* 0xF7 */ { 2, { .instr = {"RST  ","$30",NULL,NULL,NULL} } },
+  /* 0xF8 */ { 2, { .instr = {"RET  ","M",NULL,NULL,NULL} } },
+  /* 0xF9 */ { 2, { .instr = {"LD   ","SP,IX",NULL,NULL,NULL} } },
+  /* 0xFA */ { 4, { .instr = {"JP   ","M,","nn",NULL,NULL} } },
+  /* 0xFB */ { 2, { .instr = {"EI   ",NULL,NULL,NULL,NULL} } },
+  /* 0xFC */ { 4, { .instr = {"CALL ","M,","nn",NULL,NULL} } },
+  /* 0xFD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFE */ { 3, { .instr = {"CP   ","n",NULL,NULL,NULL} } },
+  /* 0xFF */ { 2, { .instr = {"RST  ","$38",NULL,NULL,NULL} } },
+};
+
+static table_entry_t tableED[256] = {
+  /* 0x00 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x01 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x02 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x03 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x04 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x05 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x06 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x07 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x08 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x09 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x0A */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x0B */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x0C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x0D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x0E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x0F */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x10 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x11 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x12 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x13 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x14 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x15 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x16 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x17 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x18 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x19 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x1A */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x1B */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x1C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x1D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x1E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x1F */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x20 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x21 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x22 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x23 */ { 2, { .instr = {"SWAP ",NULL,NULL,NULL,NULL} } },
+  /* 0x24 */ { 2, { .instr = {"MIRR ","A",NULL,NULL,NULL} } },
+  /* 0x25 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x26 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x27 */ { 3, { .instr = {"TEST ","n",NULL,NULL,NULL} } },
+  /* 0x28 */ { 2, { .instr = {"BSLA ","DE,B",NULL,NULL,NULL} } },
+  /* 0x29 */ { 2, { .instr = {"BSRA ","DE,B",NULL,NULL,NULL} } },
+  /* 0x2A */ { 2, { .instr = {"BSRL ","DE,B",NULL,NULL,NULL} } },
+  /* 0x2B */ { 2, { .instr = {"BSRF ","DE,B",NULL,NULL,NULL} } },
+  /* 0x2C */ { 2, { .instr = {"BRLC ","DE,B",NULL,NULL,NULL} } },
+  /* 0x2D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x2E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x2F */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x30 */ { 2, { .instr = {"MUL  ","D,E",NULL,NULL,NULL} } },
+  /* 0x31 */ { 2, { .instr = {"ADD  ","HL,A",NULL,NULL,NULL} } },
+  /* 0x32 */ { 2, { .instr = {"ADD  ","DE,A",NULL,NULL,NULL} } },
+  /* 0x33 */ { 2, { .instr = {"ADD  ","BC,A",NULL,NULL,NULL} } },
+  /* 0x34 */ { 4, { .instr = {"ADD  ","HL,","nn",NULL,NULL} } },
+  /* 0x35 */ { 4, { .instr = {"ADD  ","DE,","nn",NULL,NULL} } },
+  /* 0x36 */ { 4, { .instr = {"ADD  ","BC,","nn",NULL,NULL} } },
+  /* 0x37 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x38 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x39 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x3A */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x3B */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x3C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x3D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x3E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x3F */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x40 */ { 2, { .instr = {"IN   ","B,(C)",NULL,NULL,NULL} } },
+  /* 0x41 */ { 2, { .instr = {"OUT  ","(C),B",NULL,NULL,NULL} } },
+  /* 0x42 */ { 2, { .instr = {"SBC  ","HL,BC",NULL,NULL,NULL} } },
+  /* 0x43 */ { 4, { .instr = {"LD   ","(","nn","),BC",NULL} } },
+  /* 0x44 */ { 2, { .instr = {"NEG  ",NULL,NULL,NULL,NULL} } },
+  /* 0x45 */ { 2, { .instr = {"RETN ",NULL,NULL,NULL,NULL} } },
+  /* 0x46 */ { 2, { .instr = {"IM   ","0",NULL,NULL,NULL} } },
+  /* 0x47 */ { 2, { .instr = {"LD   ","I,A",NULL,NULL,NULL} } },
+  /* 0x48 */ { 2, { .instr = {"IN   ","C,(C)",NULL,NULL,NULL} } },
+  /* 0x49 */ { 2, { .instr = {"OUT  ","(C),C",NULL,NULL,NULL} } },
+  /* 0x4A */ { 2, { .instr = {"ADC  ","HL,BC",NULL,NULL,NULL} } },
+  /* 0x4B */ { 4, { .instr = {"LD   ","BC,(","nn",")",NULL} } },
+  /* 0x4C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x4D */ { 2, { .instr = {"RETI ",NULL,NULL,NULL,NULL} } },
+  /* 0x4E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x4F */ { 2, { .instr = {"LD   ","R,A",NULL,NULL,NULL} } },
+  /* 0x50 */ { 2, { .instr = {"IN   ","D,(C)",NULL,NULL,NULL} } },
+  /* 0x51 */ { 2, { .instr = {"OUT  ","(C),D",NULL,NULL,NULL} } },
+  /* 0x52 */ { 2, { .instr = {"SBC  ","HL,DE",NULL,NULL,NULL} } },
+  /* 0x53 */ { 4, { .instr = {"LD   ","(","nn","),DE",NULL} } },
+  /* 0x54 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x55 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x56 */ { 2, { .instr = {"IM   ","1",NULL,NULL,NULL} } },
+  /* 0x57 */ { 2, { .instr = {"LD   ","A,I",NULL,NULL,NULL} } },
+  /* 0x58 */ { 2, { .instr = {"IN   ","E,(C)",NULL,NULL,NULL} } },
+  /* 0x59 */ { 2, { .instr = {"OUT  ","(C),E",NULL,NULL,NULL} } },
+  /* 0x5A */ { 2, { .instr = {"ADC  ","HL,DE",NULL,NULL,NULL} } },
+  /* 0x5B */ { 4, { .instr = {"LD   ","DE,(","nn",")",NULL} } },
+  /* 0x5C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x5D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x5E */ { 2, { .instr = {"IM   ","2",NULL,NULL,NULL} } },
+  /* 0x5F */ { 2, { .instr = {"LD   ","A,R",NULL,NULL,NULL} } },
+  /* 0x60 */ { 2, { .instr = {"IN   ","H,(C)",NULL,NULL,NULL} } },
+  /* 0x61 */ { 2, { .instr = {"OUT  ","(C),H",NULL,NULL,NULL} } },
+  /* 0x62 */ { 2, { .instr = {"SBC  ","HL,HL",NULL,NULL,NULL} } },
+  /* 0x63 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x64 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x65 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x66 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x67 */ { 2, { .instr = {"RRD  ",NULL,NULL,NULL,NULL} } },
+  /* 0x68 */ { 2, { .instr = {"IN   ","L,(C)",NULL,NULL,NULL} } },
+  /* 0x69 */ { 2, { .instr = {"OUT  ","(C),L",NULL,NULL,NULL} } },
+  /* 0x6A */ { 2, { .instr = {"ADC  ","HL,HL",NULL,NULL,NULL} } },
+  /* 0x6B */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x6C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x6D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x6E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x6F */ { 2, { .instr = {"RLD  ",NULL,NULL,NULL,NULL} } },
+  /* 0x70 */ { 2, { .instr = {"IN   ","(C)",NULL,NULL,NULL} } },
+  /* 0x71 */ { 2, { .instr = {"OUT  ","(C),0",NULL,NULL,NULL} } },
+  /* 0x72 */ { 2, { .instr = {"SBC  ","HL,SP",NULL,NULL,NULL} } },
+  /* 0x73 */ { 4, { .instr = {"LD   ","(","nn","),SP",NULL} } },
+  /* 0x74 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x75 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x76 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x77 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x78 */ { 2, { .instr = {"IN   ","A,(C)",NULL,NULL,NULL} } },
+  /* 0x79 */ { 2, { .instr = {"OUT  ","(C),A",NULL,NULL,NULL} } },
+  /* 0x7A */ { 2, { .instr = {"ADC  ","HL,SP",NULL,NULL,NULL} } },
+  /* 0x7B */ { 4, { .instr = {"LD   ","SP,(","nn",")",NULL} } },
+  /* 0x7C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x7D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x7E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x7F */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x80 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x81 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x82 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x83 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x84 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x85 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x86 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x87 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x88 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x89 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x8A */ { 4, { .instr = {"PUSH ","mm",NULL,NULL,NULL} } },
+  /* 0x8B */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x8C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x8D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x8E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x8F */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x90 */ { 2, { .instr = {"OTIB ",NULL,NULL,NULL,NULL} } },
+  /* 0x91 */ { 2, { .instr = {"NREG ","reg",",","value",NULL} } },
+  /* 0x92 */ { 2, { .instr = {"NREG ","reg",",A",NULL,NULL} } },
+  /* 0x93 */ { 2, { .instr = {"PXDN ",NULL,NULL,NULL,NULL} } },
+  /* 0x94 */ { 2, { .instr = {"PXAD ",NULL,NULL,NULL,NULL} } },
+  /* 0x95 */ { 2, { .instr = {"STAE ",NULL,NULL,NULL,NULL} } },
+  /* 0x96 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x97 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x98 */ { 2, { .instr = {"JP   ","(C)",NULL,NULL,NULL} } },
+  /* 0x99 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x9A */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x9B */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x9C */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x9D */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x9E */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0x9F */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xA0 */ { 2, { .instr = {"LDI  ",NULL,NULL,NULL,NULL} } },
+  /* 0xA1 */ { 2, { .instr = {"CPI  ",NULL,NULL,NULL,NULL} } },
+  /* 0xA2 */ { 2, { .instr = {"INI  ",NULL,NULL,NULL,NULL} } },
+  /* 0xA3 */ { 2, { .instr = {"OUTI ",NULL,NULL,NULL,NULL} } },
+  /* 0xA4 */ { 2, { .instr = {"LDIX ",NULL,NULL,NULL,NULL} } },
+  /* 0xA5 */ { 2, { .instr = {"LDWS ",NULL,NULL,NULL,NULL} } },
+  /* 0xA6 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xA7 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xA8 */ { 2, { .instr = {"LDD  ",NULL,NULL,NULL,NULL} } },
+  /* 0xA9 */ { 2, { .instr = {"CPD  ",NULL,NULL,NULL,NULL} } },
+  /* 0xAA */ { 2, { .instr = {"IND  ",NULL,NULL,NULL,NULL} } },
+  /* 0xAB */ { 2, { .instr = {"OUTD ",NULL,NULL,NULL,NULL} } },
+  /* 0xAC */ { 2, { .instr = {"LDDX ",NULL,NULL,NULL,NULL} } },
+  /* 0xAD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xAE */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xAF */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xB0 */ { 2, { .instr = {"LDIR ",NULL,NULL,NULL,NULL} } },
+  /* 0xB1 */ { 2, { .instr = {"CPIR ",NULL,NULL,NULL,NULL} } },
+  /* 0xB2 */ { 2, { .instr = {"INIR ",NULL,NULL,NULL,NULL} } },
+  /* 0xB3 */ { 2, { .instr = {"OTIR ",NULL,NULL,NULL,NULL} } },
+  /* 0xB4 */ { 2, { .instr = {"LIRX ",NULL,NULL,NULL,NULL} } },
+  /* 0xB5 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xB6 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xB7 */ { 2, { .instr = {"LDPIRX",NULL,NULL,NULL,NULL} } },
+  /* 0xB8 */ { 2, { .instr = {"LDDR ",NULL,NULL,NULL,NULL} } },
+  /* 0xB9 */ { 2, { .instr = {"CPDR ",NULL,NULL,NULL,NULL} } },
+  /* 0xBA */ { 2, { .instr = {"INDR ",NULL,NULL,NULL,NULL} } },
+  /* 0xBB */ { 2, { .instr = {"OTDR ",NULL,NULL,NULL,NULL} } },
+  /* 0xBC */ { 2, { .instr = {"LDRX ",NULL,NULL,NULL,NULL} } },
+  /* 0xBD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xBE */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xBF */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC0 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC1 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC2 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC3 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC4 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC5 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC6 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC7 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC8 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xC9 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xCA */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xCB */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xCC */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xCD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xCE */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xCF */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD0 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD1 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD2 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD3 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD4 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD5 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD6 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD7 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD8 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xD9 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDA */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDB */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDC */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDE */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDF */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE0 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE1 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE2 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE3 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE4 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE5 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE6 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE7 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE8 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xE9 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xEA */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xEB */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xEC */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xED */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xEE */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xEF */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF0 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF1 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF2 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF3 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF4 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF5 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF6 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF7 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF8 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xF9 */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFA */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFB */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFC */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFE */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFF */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+};
+
+static table_entry_t tableFDCB[256] = {
+  /* 0x00 */ { 3, { .instr = {"RLC  ","B",NULL,NULL,NULL} } },
+  /* 0x01 */ { 3, { .instr = {"RLC  ","C",NULL,NULL,NULL} } },
+  /* 0x02 */ { 3, { .instr = {"RLC  ","D",NULL,NULL,NULL} } },
+  /* 0x03 */ { 3, { .instr = {"RLC  ","E",NULL,NULL,NULL} } },
+  /* 0x04 */ { 3, { .instr = {"RLC  ","H",NULL,NULL,NULL} } },
+  /* 0x05 */ { 3, { .instr = {"RLC  ","L",NULL,NULL,NULL} } },
+  /* 0x06 */ { 4, { .instr = {"RLC  ","(IY+","d",")",NULL} } },
+  /* 0x07 */ { 3, { .instr = {"RLC  ","A",NULL,NULL,NULL} } },
+  /* 0x08 */ { 3, { .instr = {"RRC  ","B",NULL,NULL,NULL} } },
+  /* 0x09 */ { 3, { .instr = {"RRC  ","C",NULL,NULL,NULL} } },
+  /* 0x0A */ { 3, { .instr = {"RRC  ","D",NULL,NULL,NULL} } },
+  /* 0x0B */ { 3, { .instr = {"RRC  ","E",NULL,NULL,NULL} } },
+  /* 0x0C */ { 3, { .instr = {"RRC  ","H",NULL,NULL,NULL} } },
+  /* 0x0D */ { 3, { .instr = {"RRC  ","L",NULL,NULL,NULL} } },
+  /* 0x0E */ { 4, { .instr = {"RRC  ","(IY+","d",")",NULL} } },
+  /* 0x0F */ { 3, { .instr = {"RRC  ","A",NULL,NULL,NULL} } },
+  /* 0x10 */ { 3, { .instr = {"RL   ","B",NULL,NULL,NULL} } },
+  /* 0x11 */ { 3, { .instr = {"RL   ","C",NULL,NULL,NULL} } },
+  /* 0x12 */ { 3, { .instr = {"RL   ","D",NULL,NULL,NULL} } },
+  /* 0x13 */ { 3, { .instr = {"RL   ","E",NULL,NULL,NULL} } },
+  /* 0x14 */ { 3, { .instr = {"RL   ","H",NULL,NULL,NULL} } },
+  /* 0x15 */ { 3, { .instr = {"RL   ","L",NULL,NULL,NULL} } },
+  /* 0x16 */ { 4, { .instr = {"RL   ","(IY+","d",")",NULL} } },
+  /* 0x17 */ { 3, { .instr = {"RL   ","A",NULL,NULL,NULL} } },
+  /* 0x18 */ { 3, { .instr = {"RR   ","B",NULL,NULL,NULL} } },
+  /* 0x19 */ { 3, { .instr = {"RR   ","C",NULL,NULL,NULL} } },
+  /* 0x1A */ { 3, { .instr = {"RR   ","D",NULL,NULL,NULL} } },
+  /* 0x1B */ { 3, { .instr = {"RR   ","E",NULL,NULL,NULL} } },
+  /* 0x1C */ { 3, { .instr = {"RR   ","H",NULL,NULL,NULL} } },
+  /* 0x1D */ { 3, { .instr = {"RR   ","L",NULL,NULL,NULL} } },
+  /* 0x1E */ { 4, { .instr = {"RR   ","(IY+","d",")",NULL} } },
+  /* 0x1F */ { 3, { .instr = {"RR   ","A",NULL,NULL,NULL} } },
+  /* 0x20 */ { 3, { .instr = {"SLA  ","B",NULL,NULL,NULL} } },
+  /* 0x21 */ { 3, { .instr = {"SLA  ","C",NULL,NULL,NULL} } },
+  /* 0x22 */ { 3, { .instr = {"SLA  ","D",NULL,NULL,NULL} } },
+  /* 0x23 */ { 3, { .instr = {"SLA  ","E",NULL,NULL,NULL} } },
+  /* 0x24 */ { 3, { .instr = {"SLA  ","H",NULL,NULL,NULL} } },
+  /* 0x25 */ { 3, { .instr = {"SLA  ","L",NULL,NULL,NULL} } },
+  /* 0x26 */ { 4, { .instr = {"SLA  ","(IY+","d",")",NULL} } },
+  /* 0x27 */ { 3, { .instr = {"SLA  ","A",NULL,NULL,NULL} } },
+  /* 0x28 */ { 3, { .instr = {"SRA  ","B",NULL,NULL,NULL} } },
+  /* 0x29 */ { 3, { .instr = {"SRA  ","C",NULL,NULL,NULL} } },
+  /* 0x2A */ { 3, { .instr = {"SRA  ","D",NULL,NULL,NULL} } },
+  /* 0x2B */ { 3, { .instr = {"SRA  ","E",NULL,NULL,NULL} } },
+  /* 0x2C */ { 3, { .instr = {"SRA  ","H",NULL,NULL,NULL} } },
+  /* 0x2D */ { 3, { .instr = {"SRA  ","L",NULL,NULL,NULL} } },
+  /* 0x2E */ { 4, { .instr = {"SRA  ","(IY+","d",")",NULL} } },
+  /* 0x2F */ { 3, { .instr = {"SRA  ","A",NULL,NULL,NULL} } },
+  /* 0x30 */ { 3, { .instr = {"SLL  ","B",NULL,NULL,NULL} } },
+  /* 0x31 */ { 3, { .instr = {"SLL  ","C",NULL,NULL,NULL} } },
+  /* 0x32 */ { 3, { .instr = {"SLL  ","D",NULL,NULL,NULL} } },
+  /* 0x33 */ { 3, { .instr = {"SLL  ","E",NULL,NULL,NULL} } },
+  /* 0x34 */ { 3, { .instr = {"SLL  ","H",NULL,NULL,NULL} } },
+  /* 0x35 */ { 3, { .instr = {"SLL  ","L",NULL,NULL,NULL} } },
+  /* 0x36 */ { 4, { .instr = {"SLL  ","(IY+","d",")",NULL} } },
+  /* 0x37 */ { 3, { .instr = {"SLL  ","A",NULL,NULL,NULL} } },
+  /* 0x38 */ { 3, { .instr = {"SRL  ","B",NULL,NULL,NULL} } },
+  /* 0x39 */ { 3, { .instr = {"SRL  ","C",NULL,NULL,NULL} } },
+  /* 0x3A */ { 3, { .instr = {"SRL  ","D",NULL,NULL,NULL} } },
+  /* 0x3B */ { 3, { .instr = {"SRL  ","E",NULL,NULL,NULL} } },
+  /* 0x3C */ { 3, { .instr = {"SRL  ","H",NULL,NULL,NULL} } },
+  /* 0x3D */ { 3, { .instr = {"SRL  ","L",NULL,NULL,NULL} } },
+  /* 0x3E */ { 4, { .instr = {"SRL  ","(IY+","d",")",NULL} } },
+  /* 0x3F */ { 3, { .instr = {"SRL  ","A",NULL,NULL,NULL} } },
+  /* 0x40 */ { 3, { .instr = {"BIT  ","0,B",NULL,NULL,NULL} } },
+  /* 0x41 */ { 3, { .instr = {"BIT  ","0,C",NULL,NULL,NULL} } },
+  /* 0x42 */ { 3, { .instr = {"BIT  ","0,D",NULL,NULL,NULL} } },
+  /* 0x43 */ { 3, { .instr = {"BIT  ","0,E",NULL,NULL,NULL} } },
+  /* 0x44 */ { 3, { .instr = {"BIT  ","0,H",NULL,NULL,NULL} } },
+  /* 0x45 */ { 3, { .instr = {"BIT  ","0,L",NULL,NULL,NULL} } },
+  /* 0x46 */ { 4, { .instr = {"BIT  ","0,(IY+","d",")",NULL} } },
+  /* 0x47 */ { 3, { .instr = {"BIT  ","0,A",NULL,NULL,NULL} } },
+  /* 0x48 */ { 3, { .instr = {"BIT  ","1,B",NULL,NULL,NULL} } },
+  /* 0x49 */ { 3, { .instr = {"BIT  ","1,C",NULL,NULL,NULL} } },
+  /* 0x4A */ { 3, { .instr = {"BIT  ","1,D",NULL,NULL,NULL} } },
+  /* 0x4B */ { 3, { .instr = {"BIT  ","1,E",NULL,NULL,NULL} } },
+  /* 0x4C */ { 3, { .instr = {"BIT  ","1,H",NULL,NULL,NULL} } },
+  /* 0x4D */ { 3, { .instr = {"BIT  ","1,L",NULL,NULL,NULL} } },
+  /* 0x4E */ { 4, { .instr = {"BIT  ","1,(IY+","d",")",NULL} } },
+  /* 0x4F */ { 3, { .instr = {"BIT  ","1,A",NULL,NULL,NULL} } },
+  /* 0x50 */ { 3, { .instr = {"BIT  ","2,B",NULL,NULL,NULL} } },
+  /* 0x51 */ { 3, { .instr = {"BIT  ","2,C",NULL,NULL,NULL} } },
+  /* 0x52 */ { 3, { .instr = {"BIT  ","2,D",NULL,NULL,NULL} } },
+  /* 0x53 */ { 3, { .instr = {"BIT  ","2,E",NULL,NULL,NULL} } },
+  /* 0x54 */ { 3, { .instr = {"BIT  ","2,H",NULL,NULL,NULL} } },
+  /* 0x55 */ { 3, { .instr = {"BIT  ","2,L",NULL,NULL,NULL} } },
+  /* 0x56 */ { 4, { .instr = {"BIT  ","2,(IY+","d",")",NULL} } },
+  /* 0x57 */ { 3, { .instr = {"BIT  ","2,A",NULL,NULL,NULL} } },
+  /* 0x58 */ { 3, { .instr = {"BIT  ","3,B",NULL,NULL,NULL} } },
+  /* 0x59 */ { 3, { .instr = {"BIT  ","3,C",NULL,NULL,NULL} } },
+  /* 0x5A */ { 3, { .instr = {"BIT  ","3,D",NULL,NULL,NULL} } },
+  /* 0x5B */ { 3, { .instr = {"BIT  ","3,E",NULL,NULL,NULL} } },
+  /* 0x5C */ { 3, { .instr = {"BIT  ","3,H",NULL,NULL,NULL} } },
+  /* 0x5D */ { 3, { .instr = {"BIT  ","3,L",NULL,NULL,NULL} } },
+  /* 0x5E */ { 4, { .instr = {"BIT  ","3,(IY+","d",")",NULL} } },
+  /* 0x5F */ { 3, { .instr = {"BIT  ","3,A",NULL,NULL,NULL} } },
+  /* 0x60 */ { 3, { .instr = {"BIT  ","4,B",NULL,NULL,NULL} } },
+  /* 0x61 */ { 3, { .instr = {"BIT  ","4,C",NULL,NULL,NULL} } },
+  /* 0x62 */ { 3, { .instr = {"BIT  ","4,D",NULL,NULL,NULL} } },
+  /* 0x63 */ { 3, { .instr = {"BIT  ","4,E",NULL,NULL,NULL} } },
+  /* 0x64 */ { 3, { .instr = {"BIT  ","4,H",NULL,NULL,NULL} } },
+  /* 0x65 */ { 3, { .instr = {"BIT  ","4,L",NULL,NULL,NULL} } },
+  /* 0x66 */ { 4, { .instr = {"BIT  ","4,(IY+","d",")",NULL} } },
+  /* 0x67 */ { 3, { .instr = {"BIT  ","4,A",NULL,NULL,NULL} } },
+  /* 0x68 */ { 3, { .instr = {"BIT  ","5,B",NULL,NULL,NULL} } },
+  /* 0x69 */ { 3, { .instr = {"BIT  ","5,C",NULL,NULL,NULL} } },
+  /* 0x6A */ { 3, { .instr = {"BIT  ","5,D",NULL,NULL,NULL} } },
+  /* 0x6B */ { 3, { .instr = {"BIT  ","5,E",NULL,NULL,NULL} } },
+  /* 0x6C */ { 3, { .instr = {"BIT  ","5,H",NULL,NULL,NULL} } },
+  /* 0x6D */ { 3, { .instr = {"BIT  ","5,L",NULL,NULL,NULL} } },
+  /* 0x6E */ { 4, { .instr = {"BIT  ","5,(IY+","d",")",NULL} } },
+  /* 0x6F */ { 3, { .instr = {"BIT  ","5,A",NULL,NULL,NULL} } },
+  /* 0x70 */ { 3, { .instr = {"BIT  ","6,B",NULL,NULL,NULL} } },
+  /* 0x71 */ { 3, { .instr = {"BIT  ","6,C",NULL,NULL,NULL} } },
+  /* 0x72 */ { 3, { .instr = {"BIT  ","6,D",NULL,NULL,NULL} } },
+  /* 0x73 */ { 3, { .instr = {"BIT  ","6,E",NULL,NULL,NULL} } },
+  /* 0x74 */ { 3, { .instr = {"BIT  ","6,H",NULL,NULL,NULL} } },
+  /* 0x75 */ { 3, { .instr = {"BIT  ","6,L",NULL,NULL,NULL} } },
+  /* 0x76 */ { 4, { .instr = {"BIT  ","6,(IY+","d",")",NULL} } },
+  /* 0x77 */ { 3, { .instr = {"BIT  ","6,A",NULL,NULL,NULL} } },
+  /* 0x78 */ { 3, { .instr = {"BIT  ","7,B",NULL,NULL,NULL} } },
+  /* 0x79 */ { 3, { .instr = {"BIT  ","7,C",NULL,NULL,NULL} } },
+  /* 0x7A */ { 3, { .instr = {"BIT  ","7,D",NULL,NULL,NULL} } },
+  /* 0x7B */ { 3, { .instr = {"BIT  ","7,E",NULL,NULL,NULL} } },
+  /* 0x7C */ { 3, { .instr = {"BIT  ","7,H",NULL,NULL,NULL} } },
+  /* 0x7D */ { 3, { .instr = {"BIT  ","7,L",NULL,NULL,NULL} } },
+  /* 0x7E */ { 4, { .instr = {"BIT  ","7,(IY+","d",")",NULL} } },
+  /* 0x7F */ { 3, { .instr = {"BIT  ","7,A",NULL,NULL,NULL} } },
+  /* 0x80 */ { 3, { .instr = {"RES  ","0,B",NULL,NULL,NULL} } },
+  /* 0x81 */ { 3, { .instr = {"RES  ","0,C",NULL,NULL,NULL} } },
+  /* 0x82 */ { 3, { .instr = {"RES  ","0,D",NULL,NULL,NULL} } },
+  /* 0x83 */ { 3, { .instr = {"RES  ","0,E",NULL,NULL,NULL} } },
+  /* 0x84 */ { 3, { .instr = {"RES  ","0,H",NULL,NULL,NULL} } },
+  /* 0x85 */ { 3, { .instr = {"RES  ","0,L",NULL,NULL,NULL} } },
+  /* 0x86 */ { 4, { .instr = {"RES  ","0,(IY+","d",")",NULL} } },
+  /* 0x87 */ { 3, { .instr = {"RES  ","0,A",NULL,NULL,NULL} } },
+  /* 0x88 */ { 3, { .instr = {"RES  ","1,B",NULL,NULL,NULL} } },
+  /* 0x89 */ { 3, { .instr = {"RES  ","1,C",NULL,NULL,NULL} } },
+  /* 0x8A */ { 3, { .instr = {"RES  ","1,D",NULL,NULL,NULL} } },
+  /* 0x8B */ { 3, { .instr = {"RES  ","1,E",NULL,NULL,NULL} } },
+  /* 0x8C */ { 3, { .instr = {"RES  ","1,H",NULL,NULL,NULL} } },
+  /* 0x8D */ { 3, { .instr = {"RES  ","1,L",NULL,NULL,NULL} } },
+  /* 0x8E */ { 4, { .instr = {"RES  ","1,(IY+","d",")",NULL} } },
+  /* 0x8F */ { 3, { .instr = {"RES  ","1,A",NULL,NULL,NULL} } },
+  /* 0x90 */ { 3, { .instr = {"RES  ","2,B",NULL,NULL,NULL} } },
+  /* 0x91 */ { 3, { .instr = {"RES  ","2,C",NULL,NULL,NULL} } },
+  /* 0x92 */ { 3, { .instr = {"RES  ","2,D",NULL,NULL,NULL} } },
+  /* 0x93 */ { 3, { .instr = {"RES  ","2,E",NULL,NULL,NULL} } },
+  /* 0x94 */ { 3, { .instr = {"RES  ","2,H",NULL,NULL,NULL} } },
+  /* 0x95 */ { 3, { .instr = {"RES  ","2,L",NULL,NULL,NULL} } },
+  /* 0x96 */ { 4, { .instr = {"RES  ","2,(IY+","d",")",NULL} } },
+  /* 0x97 */ { 3, { .instr = {"RES  ","2,A",NULL,NULL,NULL} } },
+  /* 0x98 */ { 3, { .instr = {"RES  ","3,B",NULL,NULL,NULL} } },
+  /* 0x99 */ { 3, { .instr = {"RES  ","3,C",NULL,NULL,NULL} } },
+  /* 0x9A */ { 3, { .instr = {"RES  ","3,D",NULL,NULL,NULL} } },
+  /* 0x9B */ { 3, { .instr = {"RES  ","3,E",NULL,NULL,NULL} } },
+  /* 0x9C */ { 3, { .instr = {"RES  ","3,H",NULL,NULL,NULL} } },
+  /* 0x9D */ { 3, { .instr = {"RES  ","3,L",NULL,NULL,NULL} } },
+  /* 0x9E */ { 4, { .instr = {"RES  ","3,(IY+","d",")",NULL} } },
+  /* 0x9F */ { 3, { .instr = {"RES  ","3,A",NULL,NULL,NULL} } },
+  /* 0xA0 */ { 3, { .instr = {"RES  ","4,B",NULL,NULL,NULL} } },
+  /* 0xA1 */ { 3, { .instr = {"RES  ","4,C",NULL,NULL,NULL} } },
+  /* 0xA2 */ { 3, { .instr = {"RES  ","4,D",NULL,NULL,NULL} } },
+  /* 0xA3 */ { 3, { .instr = {"RES  ","4,E",NULL,NULL,NULL} } },
+  /* 0xA4 */ { 3, { .instr = {"RES  ","4,H",NULL,NULL,NULL} } },
+  /* 0xA5 */ { 3, { .instr = {"RES  ","4,L",NULL,NULL,NULL} } },
+  /* 0xA6 */ { 4, { .instr = {"RES  ","4,(IY+","d",")",NULL} } },
+  /* 0xA7 */ { 3, { .instr = {"RES  ","4,A",NULL,NULL,NULL} } },
+  /* 0xA8 */ { 3, { .instr = {"RES  ","5,B",NULL,NULL,NULL} } },
+  /* 0xA9 */ { 3, { .instr = {"RES  ","5,C",NULL,NULL,NULL} } },
+  /* 0xAA */ { 3, { .instr = {"RES  ","5,D",NULL,NULL,NULL} } },
+  /* 0xAB */ { 3, { .instr = {"RES  ","5,E",NULL,NULL,NULL} } },
+  /* 0xAC */ { 3, { .instr = {"RES  ","5,H",NULL,NULL,NULL} } },
+  /* 0xAD */ { 3, { .instr = {"RES  ","5,L",NULL,NULL,NULL} } },
+  /* 0xAE */ { 4, { .instr = {"RES  ","5,(IY+","d",")",NULL} } },
+  /* 0xAF */ { 3, { .instr = {"RES  ","5,A",NULL,NULL,NULL} } },
+  /* 0xB0 */ { 3, { .instr = {"RES  ","6,B",NULL,NULL,NULL} } },
+  /* 0xB1 */ { 3, { .instr = {"RES  ","6,C",NULL,NULL,NULL} } },
+  /* 0xB2 */ { 3, { .instr = {"RES  ","6,D",NULL,NULL,NULL} } },
+  /* 0xB3 */ { 3, { .instr = {"RES  ","6,E",NULL,NULL,NULL} } },
+  /* 0xB4 */ { 3, { .instr = {"RES  ","6,H",NULL,NULL,NULL} } },
+  /* 0xB5 */ { 3, { .instr = {"RES  ","6,L",NULL,NULL,NULL} } },
+  /* 0xB6 */ { 4, { .instr = {"RES  ","6,(IY+","d",")",NULL} } },
+  /* 0xB7 */ { 3, { .instr = {"RES  ","6,A",NULL,NULL,NULL} } },
+  /* 0xB8 */ { 3, { .instr = {"RES  ","7,B",NULL,NULL,NULL} } },
+  /* 0xB9 */ { 3, { .instr = {"RES  ","7,C",NULL,NULL,NULL} } },
+  /* 0xBA */ { 3, { .instr = {"RES  ","7,D",NULL,NULL,NULL} } },
+  /* 0xBB */ { 3, { .instr = {"RES  ","7,E",NULL,NULL,NULL} } },
+  /* 0xBC */ { 3, { .instr = {"RES  ","7,H",NULL,NULL,NULL} } },
+  /* 0xBD */ { 3, { .instr = {"RES  ","7,L",NULL,NULL,NULL} } },
+  /* 0xBE */ { 4, { .instr = {"RES  ","7,(IY+","d",")",NULL} } },
+  /* 0xBF */ { 3, { .instr = {"RES  ","7,A",NULL,NULL,NULL} } },
+  /* 0xC0 */ { 3, { .instr = {"SET  ","0,B",NULL,NULL,NULL} } },
+  /* 0xC1 */ { 3, { .instr = {"SET  ","0,C",NULL,NULL,NULL} } },
+  /* 0xC2 */ { 3, { .instr = {"SET  ","0,D",NULL,NULL,NULL} } },
+  /* 0xC3 */ { 3, { .instr = {"SET  ","0,E",NULL,NULL,NULL} } },
+  /* 0xC4 */ { 3, { .instr = {"SET  ","0,H",NULL,NULL,NULL} } },
+  /* 0xC5 */ { 3, { .instr = {"SET  ","0,L",NULL,NULL,NULL} } },
+  /* 0xC6 */ { 4, { .instr = {"SET  ","0,(IY+","d",")",NULL} } },
+  /* 0xC7 */ { 3, { .instr = {"SET  ","0,A",NULL,NULL,NULL} } },
+  /* 0xC8 */ { 3, { .instr = {"SET  ","1,B",NULL,NULL,NULL} } },
+  /* 0xC9 */ { 3, { .instr = {"SET  ","1,C",NULL,NULL,NULL} } },
+  /* 0xCA */ { 3, { .instr = {"SET  ","1,D",NULL,NULL,NULL} } },
+  /* 0xCB */ { 3, { .instr = {"SET  ","1,E",NULL,NULL,NULL} } },
+  /* 0xCC */ { 3, { .instr = {"SET  ","1,H",NULL,NULL,NULL} } },
+  /* 0xCD */ { 3, { .instr = {"SET  ","1,L",NULL,NULL,NULL} } },
+  /* 0xCE */ { 4, { .instr = {"SET  ","1,(IY+","d",")",NULL} } },
+  /* 0xCF */ { 3, { .instr = {"SET  ","1,A",NULL,NULL,NULL} } },
+  /* 0xD0 */ { 3, { .instr = {"SET  ","2,B",NULL,NULL,NULL} } },
+  /* 0xD1 */ { 3, { .instr = {"SET  ","2,C",NULL,NULL,NULL} } },
+  /* 0xD2 */ { 3, { .instr = {"SET  ","2,D",NULL,NULL,NULL} } },
+  /* 0xD3 */ { 3, { .instr = {"SET  ","2,E",NULL,NULL,NULL} } },
+  /* 0xD4 */ { 3, { .instr = {"SET  ","2,H",NULL,NULL,NULL} } },
+  /* 0xD5 */ { 3, { .instr = {"SET  ","2,L",NULL,NULL,NULL} } },
+  /* 0xD6 */ { 4, { .instr = {"SET  ","2,(IY+","d",")",NULL} } },
+  /* 0xD7 */ { 3, { .instr = {"SET  ","2,A",NULL,NULL,NULL} } },
+  /* 0xD8 */ { 3, { .instr = {"SET  ","3,B",NULL,NULL,NULL} } },
+  /* 0xD9 */ { 3, { .instr = {"SET  ","3,C",NULL,NULL,NULL} } },
+  /* 0xDA */ { 3, { .instr = {"SET  ","3,D",NULL,NULL,NULL} } },
+  /* 0xDB */ { 3, { .instr = {"SET  ","3,E",NULL,NULL,NULL} } },
+  /* 0xDC */ { 3, { .instr = {"SET  ","3,H",NULL,NULL,NULL} } },
+  /* 0xDD */ { 3, { .instr = {"SET  ","3,L",NULL,NULL,NULL} } },
+  /* 0xDE */ { 4, { .instr = {"SET  ","3,(IY+","d",")",NULL} } },
+  /* 0xDF */ { 3, { .instr = {"SET  ","3,A",NULL,NULL,NULL} } },
+  /* 0xE0 */ { 3, { .instr = {"SET  ","4,B",NULL,NULL,NULL} } },
+  /* 0xE1 */ { 3, { .instr = {"SET  ","4,C",NULL,NULL,NULL} } },
+  /* 0xE2 */ { 3, { .instr = {"SET  ","4,D",NULL,NULL,NULL} } },
+  /* 0xE3 */ { 3, { .instr = {"SET  ","4,E",NULL,NULL,NULL} } },
+  /* 0xE4 */ { 3, { .instr = {"SET  ","4,H",NULL,NULL,NULL} } },
+  /* 0xE5 */ { 3, { .instr = {"SET  ","4,L",NULL,NULL,NULL} } },
+  /* 0xE6 */ { 4, { .instr = {"SET  ","4,(IY+","d",")",NULL} } },
+  /* 0xE7 */ { 3, { .instr = {"SET  ","4,A",NULL,NULL,NULL} } },
+  /* 0xE8 */ { 3, { .instr = {"SET  ","5,B",NULL,NULL,NULL} } },
+  /* 0xE9 */ { 3, { .instr = {"SET  ","5,C",NULL,NULL,NULL} } },
+  /* 0xEA */ { 3, { .instr = {"SET  ","5,D",NULL,NULL,NULL} } },
+  /* 0xEB */ { 3, { .instr = {"SET  ","5,E",NULL,NULL,NULL} } },
+  /* 0xEC */ { 3, { .instr = {"SET  ","5,H",NULL,NULL,NULL} } },
+  /* 0xED */ { 3, { .instr = {"SET  ","5,L",NULL,NULL,NULL} } },
+  /* 0xEE */ { 4, { .instr = {"SET  ","5,(IY+","d",")",NULL} } },
+  /* 0xEF */ { 3, { .instr = {"SET  ","5,A",NULL,NULL,NULL} } },
+  /* 0xF0 */ { 3, { .instr = {"SET  ","6,B",NULL,NULL,NULL} } },
+  /* 0xF1 */ { 3, { .instr = {"SET  ","6,C",NULL,NULL,NULL} } },
+  /* 0xF2 */ { 3, { .instr = {"SET  ","6,D",NULL,NULL,NULL} } },
+  /* 0xF3 */ { 3, { .instr = {"SET  ","6,E",NULL,NULL,NULL} } },
+  /* 0xF4 */ { 3, { .instr = {"SET  ","6,H",NULL,NULL,NULL} } },
+  /* 0xF5 */ { 3, { .instr = {"SET  ","6,L",NULL,NULL,NULL} } },
+  /* 0xF6 */ { 4, { .instr = {"SET  ","6,(IY+","d",")",NULL} } },
+  /* 0xF7 */ { 3, { .instr = {"SET  ","6,A",NULL,NULL,NULL} } },
+  /* 0xF8 */ { 3, { .instr = {"SET  ","7,B",NULL,NULL,NULL} } },
+  /* 0xF9 */ { 3, { .instr = {"SET  ","7,C",NULL,NULL,NULL} } },
+  /* 0xFA */ { 3, { .instr = {"SET  ","7,D",NULL,NULL,NULL} } },
+  /* 0xFB */ { 3, { .instr = {"SET  ","7,E",NULL,NULL,NULL} } },
+  /* 0xFC */ { 3, { .instr = {"SET  ","7,H",NULL,NULL,NULL} } },
+  /* 0xFD */ { 3, { .instr = {"SET  ","7,L",NULL,NULL,NULL} } },
+  /* 0xFE */ { 4, { .instr = {"SET  ","7,(IY+","d",")",NULL} } },
+  /* 0xFF */ { 3, { .instr = {"SET  ","7,A",NULL,NULL,NULL} } },
+};
+
+static table_entry_t tableFD[256] = {
+  /* 0x00 */ { 2, { .instr = {"NOP  ",NULL,NULL,NULL,NULL} } },
+  /* 0x01 */ { 4, { .instr = {"LD   ","BC,","nn",NULL,NULL} } },
+  /* 0x02 */ { 2, { .instr = {"LD   ","(BC),A",NULL,NULL,NULL} } },
+  /* 0x03 */ { 2, { .instr = {"INC  ","BC",NULL,NULL,NULL} } },
+  /* 0x04 */ { 2, { .instr = {"INC  ","B",NULL,NULL,NULL} } },
+  /* 0x05 */ { 2, { .instr = {"DEC  ","B",NULL,NULL,NULL} } },
+  /* 0x06 */ { 3, { .instr = {"LD   ","B,","n",NULL,NULL} } },
+  /* 0x07 */ { 2, { .instr = {"RLCA ",NULL,NULL,NULL,NULL} } },
+  /* 0x08 */ { 2, { .instr = {"EX   ","AF,AF'",NULL,NULL,NULL} } },
+  /* 0x09 */ { 2, { .instr = {"ADD  ","IY,BC",NULL,NULL,NULL} } },
+  /* 0x0A */ { 2, { .instr = {"LD   ","A,(BC)",NULL,NULL,NULL} } },
+  /* 0x0B */ { 2, { .instr = {"DEC  ","BC",NULL,NULL,NULL} } },
+  /* 0x0C */ { 2, { .instr = {"INC  ","C",NULL,NULL,NULL} } },
+  /* 0x0D */ { 2, { .instr = {"DEC  ","C",NULL,NULL,NULL} } },
+  /* 0x0E */ { 3, { .instr = {"LD   ","C,","n",NULL,NULL} } },
+  /* 0x0F */ { 2, { .instr = {"RRCA ",NULL,NULL,NULL,NULL} } },
+  /* 0x10 */ { 3, { .instr = {"DJNZ ","e",NULL,NULL,NULL} } },
+  /* 0x11 */ { 4, { .instr = {"LD   ","DE,","nn",NULL,NULL} } },
+  /* 0x12 */ { 2, { .instr = {"LD   ","(DE),A",NULL,NULL,NULL} } },
+  /* 0x13 */ { 2, { .instr = {"INC  ","DE",NULL,NULL,NULL} } },
+  /* 0x14 */ { 2, { .instr = {"INC  ","D",NULL,NULL,NULL} } },
+  /* 0x15 */ { 2, { .instr = {"DEC  ","D",NULL,NULL,NULL} } },
+  /* 0x16 */ { 3, { .instr = {"LD   ","D,","n",NULL,NULL} } },
+  /* 0x17 */ { 2, { .instr = {"RLA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x18 */ { 3, { .instr = {"JR   ","e",NULL,NULL,NULL} } },
+  /* 0x19 */ { 2, { .instr = {"ADD  ","IY,DE",NULL,NULL,NULL} } },
+  /* 0x1A */ { 2, { .instr = {"LD   ","A,(DE)",NULL,NULL,NULL} } },
+  /* 0x1B */ { 2, { .instr = {"DEC  ","DE",NULL,NULL,NULL} } },
+  /* 0x1C */ { 2, { .instr = {"INC  ","E",NULL,NULL,NULL} } },
+  /* 0x1D */ { 2, { .instr = {"DEC  ","E",NULL,NULL,NULL} } },
+  /* 0x1E */ { 3, { .instr = {"LD   ","E,","n",NULL,NULL} } },
+  /* 0x1F */ { 2, { .instr = {"RRA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x20 */ { 3, { .instr = {"JR   ","NZ,","e",NULL,NULL} } },
+  /* 0x21 */ { 4, { .instr = {"LD   ","IY,","nn",NULL,NULL} } },
+  /* 0x22 */ { 4, { .instr = {"LD   ","(","nn","),IY",NULL} } },
+  /* 0x23 */ { 2, { .instr = {"INC  ","IY",NULL,NULL,NULL} } },
+  /* 0x24 */ { 2, { .instr = {"INC  ","IYH",NULL,NULL,NULL} } },
+  /* 0x25 */ { 2, { .instr = {"DEC  ","IYH",NULL,NULL,NULL} } },
+  /* 0x26 */ { 3, { .instr = {"LD   ","IYH,","n",NULL,NULL} } },
+  /* 0x27 */ { 2, { .instr = {"DAA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x28 */ { 3, { .instr = {"JR   ","Z,","e",NULL,NULL} } },
+  /* 0x29 */ { 2, { .instr = {"ADD  ","IY,IY",NULL,NULL,NULL} } },
+  /* 0x2A */ { 4, { .instr = {"LD   ","IY,(","nn",")",NULL} } },
+  /* 0x2B */ { 2, { .instr = {"DEC  ","IY",NULL,NULL,NULL} } },
+  /* 0x2C */ { 2, { .instr = {"INC  ","IYL",NULL,NULL,NULL} } },
+  /* 0x2D */ { 2, { .instr = {"DEC  ","IYL",NULL,NULL,NULL} } },
+  /* 0x2E */ { 3, { .instr = {"LD   ","IYL,","n",NULL,NULL} } },
+  /* 0x2F */ { 2, { .instr = {"CPL  ",NULL,NULL,NULL,NULL} } },
+  /* 0x30 */ { 3, { .instr = {"JR   ","NC,","e",NULL,NULL} } },
+  /* 0x31 */ { 4, { .instr = {"LD   ","SP,","nn",NULL,NULL} } },
+  /* 0x32 */ { 4, { .instr = {"LD   ","(","nn","),A",NULL} } },
+  /* 0x33 */ { 2, { .instr = {"INC  ","SP",NULL,NULL,NULL} } },
+  /* 0x34 */ { 3, { .instr = {"INC  ","(IY+","d",")",NULL} } },
+  /* 0x35 */ { 3, { .instr = {"DEC  ","(IY+","d",")",NULL} } },
+  /* 0x36 */ { 4, { .instr = {"LD   ","(IY+","d","),","n"} } },
+  /* 0x37 */ { 2, { .instr = {"SCF  ",NULL,NULL,NULL,NULL} } },
+  /* 0x38 */ { 3, { .instr = {"JR   ","C,","e",NULL,NULL} } },
+  /* 0x39 */ { 2, { .instr = {"ADD  ","IY,SP",NULL,NULL,NULL} } },
+  /* 0x3A */ { 4, { .instr = {"LD   ","A,(","nn",")",NULL} } },
+  /* 0x3B */ { 2, { .instr = {"DEC  ","SP",NULL,NULL,NULL} } },
+  /* 0x3C */ { 2, { .instr = {"INC  ","A",NULL,NULL,NULL} } },
+  /* 0x3D */ { 2, { .instr = {"DEC  ","A",NULL,NULL,NULL} } },
+  /* 0x3E */ { 3, { .instr = {"LD   ","A,","n",NULL,NULL} } },
+  /* 0x3F */ { 2, { .instr = {"CCF  ",NULL,NULL,NULL,NULL} } },
+  /* 0x40 */ { 2, { .instr = {"LD   ","B,B",NULL,NULL,NULL} } },
+  /* 0x41 */ { 2, { .instr = {"LD   ","B,C",NULL,NULL,NULL} } },
+  /* 0x42 */ { 2, { .instr = {"LD   ","B,D",NULL,NULL,NULL} } },
+  /* 0x43 */ { 2, { .instr = {"LD   ","B,E",NULL,NULL,NULL} } },
+  /* 0x44 */ { 2, { .instr = {"LD   ","B,IYH",NULL,NULL,NULL} } },
+  /* 0x45 */ { 2, { .instr = {"LD   ","B,IYL",NULL,NULL,NULL} } },
+  /* 0x46 */ { 3, { .instr = {"LD   ","B,(IY+","d",")",NULL} } },
+  /* 0x47 */ { 2, { .instr = {"LD   ","B,A",NULL,NULL,NULL} } },
+  /* 0x48 */ { 2, { .instr = {"LD   ","C,B",NULL,NULL,NULL} } },
+  /* 0x49 */ { 2, { .instr = {"LD   ","C,C",NULL,NULL,NULL} } },
+  /* 0x4A */ { 2, { .instr = {"LD   ","C,D",NULL,NULL,NULL} } },
+  /* 0x4B */ { 2, { .instr = {"LD   ","C,E",NULL,NULL,NULL} } },
+  /* 0x4C */ { 2, { .instr = {"LD   ","C,IYH",NULL,NULL,NULL} } },
+  /* 0x4D */ { 2, { .instr = {"LD   ","C,IYL",NULL,NULL,NULL} } },
+  /* 0x4E */ { 3, { .instr = {"LD   ","C,(IY+","d",")",NULL} } },
+  /* 0x4F */ { 2, { .instr = {"LD   ","C,A",NULL,NULL,NULL} } },
+  /* 0x50 */ { 2, { .instr = {"LD   ","D,B",NULL,NULL,NULL} } },
+  /* 0x51 */ { 2, { .instr = {"LD   ","D,C",NULL,NULL,NULL} } },
+  /* 0x52 */ { 2, { .instr = {"LD   ","D,D",NULL,NULL,NULL} } },
+  /* 0x53 */ { 2, { .instr = {"LD   ","D,E",NULL,NULL,NULL} } },
+  /* 0x54 */ { 2, { .instr = {"LD   ","D,IYH",NULL,NULL,NULL} } },
+  /* 0x55 */ { 2, { .instr = {"LD   ","D,IYL",NULL,NULL,NULL} } },
+  /* 0x56 */ { 3, { .instr = {"LD   ","D,(IY+","d",")",NULL} } },
+  /* 0x57 */ { 2, { .instr = {"LD   ","D,A",NULL,NULL,NULL} } },
+  /* 0x58 */ { 2, { .instr = {"LD   ","E,B",NULL,NULL,NULL} } },
+  /* 0x59 */ { 2, { .instr = {"LD   ","E,C",NULL,NULL,NULL} } },
+  /* 0x5A */ { 2, { .instr = {"LD   ","E,D",NULL,NULL,NULL} } },
+  /* 0x5B */ { 2, { .instr = {"LD   ","E,E",NULL,NULL,NULL} } },
+  /* 0x5C */ { 2, { .instr = {"LD   ","E,IYH",NULL,NULL,NULL} } },
+  /* 0x5D */ { 2, { .instr = {"LD   ","E,IYL",NULL,NULL,NULL} } },
+  /* 0x5E */ { 3, { .instr = {"LD   ","E,(IY+","d",")",NULL} } },
+  /* 0x5F */ { 2, { .instr = {"LD   ","E,A",NULL,NULL,NULL} } },
+  /* 0x60 */ { 2, { .instr = {"LD   ","IYH,B",NULL,NULL,NULL} } },
+  /* 0x61 */ { 2, { .instr = {"LD   ","IYH,C",NULL,NULL,NULL} } },
+  /* 0x62 */ { 2, { .instr = {"LD   ","IYH,D",NULL,NULL,NULL} } },
+  /* 0x63 */ { 2, { .instr = {"LD   ","IYH,E",NULL,NULL,NULL} } },
+  /* 0x64 */ { 2, { .instr = {"LD   ","IYH,IYH",NULL,NULL,NULL} } },
+  /* 0x65 */ { 2, { .instr = {"LD   ","IYH,IYL",NULL,NULL,NULL} } },
+  /* 0x66 */ { 3, { .instr = {"LD   ","H,(IY+","d",")",NULL} } },
+  /* 0x67 */ { 2, { .instr = {"LD   ","IYH,A",NULL,NULL,NULL} } },
+  /* 0x68 */ { 2, { .instr = {"LD   ","IYL,B",NULL,NULL,NULL} } },
+  /* 0x69 */ { 2, { .instr = {"LD   ","IYL,C",NULL,NULL,NULL} } },
+  /* 0x6A */ { 2, { .instr = {"LD   ","IYL,D",NULL,NULL,NULL} } },
+  /* 0x6B */ { 2, { .instr = {"LD   ","IYL,E",NULL,NULL,NULL} } },
+  /* 0x6C */ { 2, { .instr = {"LD   ","IYL,IYH",NULL,NULL,NULL} } },
+  /* 0x6D */ { 2, { .instr = {"LD   ","IYL,IYL",NULL,NULL,NULL} } },
+  /* 0x6E */ { 3, { .instr = {"LD   ","L,(IY+","d",")",NULL} } },
+  /* 0x6F */ { 2, { .instr = {"LD   ","IYL,A",NULL,NULL,NULL} } },
+  /* 0x70 */ { 3, { .instr = {"LD   ","(IY+","d","),B",NULL} } },
+  /* 0x71 */ { 3, { .instr = {"LD   ","(IY+","d","),C",NULL} } },
+  /* 0x72 */ { 3, { .instr = {"LD   ","(IY+","d","),D",NULL} } },
+  /* 0x73 */ { 3, { .instr = {"LD   ","(IY+","d","),E",NULL} } },
+  /* 0x74 */ { 3, { .instr = {"LD   ","(IY+","d","),H",NULL} } },
+  /* 0x75 */ { 3, { .instr = {"LD   ","(IY+","d","),L",NULL} } },
+  /* 0x76 */ { 2, { .instr = {"HALT ",NULL,NULL,NULL,NULL} } },
+  /* 0x77 */ { 3, { .instr = {"LD   ","(IY+","d","),A",NULL} } },
+  /* 0x78 */ { 2, { .instr = {"LD   ","A,B",NULL,NULL,NULL} } },
+  /* 0x79 */ { 2, { .instr = {"LD   ","A,C",NULL,NULL,NULL} } },
+  /* 0x7A */ { 2, { .instr = {"LD   ","A,D",NULL,NULL,NULL} } },
+  /* 0x7B */ { 2, { .instr = {"LD   ","A,E",NULL,NULL,NULL} } },
+  /* 0x7C */ { 2, { .instr = {"LD   ","A,IYH",NULL,NULL,NULL} } },
+  /* 0x7D */ { 2, { .instr = {"LD   ","A,IYL",NULL,NULL,NULL} } },
+  /* 0x7E */ { 3, { .instr = {"LD   ","A,(IY+","d",")",NULL} } },
+  /* 0x7F */ { 2, { .instr = {"LD   ","A,A",NULL,NULL,NULL} } },
+  /* 0x80 */ { 2, { .instr = {"ADD  ","A,B",NULL,NULL,NULL} } },
+  /* 0x81 */ { 2, { .instr = {"ADD  ","A,C",NULL,NULL,NULL} } },
+  /* 0x82 */ { 2, { .instr = {"ADD  ","A,D",NULL,NULL,NULL} } },
+  /* 0x83 */ { 2, { .instr = {"ADD  ","A,E",NULL,NULL,NULL} } },
+  /* 0x84 */ { 2, { .instr = {"ADD  ","A,IYH",NULL,NULL,NULL} } },
+  /* 0x85 */ { 2, { .instr = {"ADD  ","A,IYL",NULL,NULL,NULL} } },
+  /* 0x86 */ { 3, { .instr = {"ADD  ","A,(IY+","d",")",NULL} } },
+  /* 0x87 */ { 2, { .instr = {"ADD  ","A,A",NULL,NULL,NULL} } },
+  /* 0x88 */ { 2, { .instr = {"ADC  ","A,B",NULL,NULL,NULL} } },
+  /* 0x89 */ { 2, { .instr = {"ADC  ","A,C",NULL,NULL,NULL} } },
+  /* 0x8A */ { 2, { .instr = {"ADC  ","A,D",NULL,NULL,NULL} } },
+  /* 0x8B */ { 2, { .instr = {"ADC  ","A,E",NULL,NULL,NULL} } },
+  /* 0x8C */ { 2, { .instr = {"ADC  ","A,IYH",NULL,NULL,NULL} } },
+  /* 0x8D */ { 2, { .instr = {"ADC  ","A,IYL",NULL,NULL,NULL} } },
+  /* 0x8E */ { 3, { .instr = {"ADC  ","A,(IY+","d",")",NULL} } },
+  /* 0x8F */ { 2, { .instr = {"ADC  ","A,A",NULL,NULL,NULL} } },
+  /* 0x90 */ { 2, { .instr = {"SUB  ","B",NULL,NULL,NULL} } },
+  /* 0x91 */ { 2, { .instr = {"SUB  ","C",NULL,NULL,NULL} } },
+  /* 0x92 */ { 2, { .instr = {"SUB  ","D",NULL,NULL,NULL} } },
+  /* 0x93 */ { 2, { .instr = {"SUB  ","E",NULL,NULL,NULL} } },
+  /* 0x94 */ { 2, { .instr = {"SUB  ","IYH",NULL,NULL,NULL} } },
+  /* 0x95 */ { 2, { .instr = {"SUB  ","IYL",NULL,NULL,NULL} } },
+  /* 0x96 */ { 3, { .instr = {"SUB  ","(IY+","d",")",NULL} } },
+  /* 0x97 */ { 2, { .instr = {"SUB  ","A",NULL,NULL,NULL} } },
+  /* 0x98 */ { 2, { .instr = {"SBC  ","A,B",NULL,NULL,NULL} } },
+  /* 0x99 */ { 2, { .instr = {"SBC  ","A,C",NULL,NULL,NULL} } },
+  /* 0x9A */ { 2, { .instr = {"SBC  ","A,D",NULL,NULL,NULL} } },
+  /* 0x9B */ { 2, { .instr = {"SBC  ","A,E",NULL,NULL,NULL} } },
+  /* 0x9C */ { 2, { .instr = {"SBC  ","A,IYH",NULL,NULL,NULL} } },
+  /* 0x9D */ { 2, { .instr = {"SBC  ","A,IYL",NULL,NULL,NULL} } },
+  /* 0x9E */ { 3, { .instr = {"SBC  ","A,(IY+","d",")",NULL} } },
+  /* 0x9F */ { 2, { .instr = {"SBC  ","A,A",NULL,NULL,NULL} } },
+  /* 0xA0 */ { 2, { .instr = {"AND  ","B",NULL,NULL,NULL} } },
+  /* 0xA1 */ { 2, { .instr = {"AND  ","C",NULL,NULL,NULL} } },
+  /* 0xA2 */ { 2, { .instr = {"AND  ","D",NULL,NULL,NULL} } },
+  /* 0xA3 */ { 2, { .instr = {"AND  ","E",NULL,NULL,NULL} } },
+  /* 0xA4 */ { 2, { .instr = {"AND  ","IYH",NULL,NULL,NULL} } },
+  /* 0xA5 */ { 2, { .instr = {"AND  ","IYL",NULL,NULL,NULL} } },
+  /* 0xA6 */ { 3, { .instr = {"AND  ","(IY+","d",")",NULL} } },
+  /* 0xA7 */ { 2, { .instr = {"AND  ","A",NULL,NULL,NULL} } },
+  /* 0xA8 */ { 2, { .instr = {"XOR  ","B",NULL,NULL,NULL} } },
+  /* 0xA9 */ { 2, { .instr = {"XOR  ","C",NULL,NULL,NULL} } },
+  /* 0xAA */ { 2, { .instr = {"XOR  ","D",NULL,NULL,NULL} } },
+  /* 0xAB */ { 2, { .instr = {"XOR  ","E",NULL,NULL,NULL} } },
+  /* 0xAC */ { 2, { .instr = {"XOR  ","IYH",NULL,NULL,NULL} } },
+  /* 0xAD */ { 2, { .instr = {"XOR  ","IYL",NULL,NULL,NULL} } },
+  /* 0xAE */ { 3, { .instr = {"XOR  ","(IY+","d",")",NULL} } },
+  /* 0xAF */ { 2, { .instr = {"XOR  ","A",NULL,NULL,NULL} } },
+  /* 0xB0 */ { 2, { .instr = {"OR   ","B",NULL,NULL,NULL} } },
+  /* 0xB1 */ { 2, { .instr = {"OR   ","C",NULL,NULL,NULL} } },
+  /* 0xB2 */ { 2, { .instr = {"OR   ","D",NULL,NULL,NULL} } },
+  /* 0xB3 */ { 2, { .instr = {"OR   ","E",NULL,NULL,NULL} } },
+  /* 0xB4 */ { 2, { .instr = {"OR   ","IYH",NULL,NULL,NULL} } },
+  /* 0xB5 */ { 2, { .instr = {"OR   ","IYL",NULL,NULL,NULL} } },
+  /* 0xB6 */ { 3, { .instr = {"OR   ","(IY+","d",")",NULL} } },
+  /* 0xB7 */ { 2, { .instr = {"OR   ","A",NULL,NULL,NULL} } },
+  /* 0xB8 */ { 2, { .instr = {"CP   ","B",NULL,NULL,NULL} } },
+  /* 0xB9 */ { 2, { .instr = {"CP   ","C",NULL,NULL,NULL} } },
+  /* 0xBA */ { 2, { .instr = {"CP   ","D",NULL,NULL,NULL} } },
+  /* 0xBB */ { 2, { .instr = {"CP   ","E",NULL,NULL,NULL} } },
+  /* 0xBC */ { 2, { .instr = {"CP   ","IYH",NULL,NULL,NULL} } },
+  /* 0xBD */ { 2, { .instr = {"CP   ","IYL",NULL,NULL,NULL} } },
+  /* 0xBE */ { 3, { .instr = {"CP   ","(IY+","d",")",NULL} } },
+  /* 0xBF */ { 2, { .instr = {"CP   ","A",NULL,NULL,NULL} } },
+  /* 0xC0 */ { 2, { .instr = {"RET  ","NZ",NULL,NULL,NULL} } },
+  /* 0xC1 */ { 2, { .instr = {"POP  ","BC",NULL,NULL,NULL} } },
+  /* 0xC2 */ { 4, { .instr = {"JP   ","NZ,","nn",NULL,NULL} } },
+  /* 0xC3 */ { 4, { .instr = {"JP   ","nn",NULL,NULL,NULL} } },
+  /* 0xC4 */ { 4, { .instr = {"CALL ","NZ,","nn",NULL,NULL} } },
+  /* 0xC5 */ { 2, { .instr = {"PUSH ","BC",NULL,NULL,NULL} } },
+  /* 0xC6 */ { 3, { .instr = {"ADD  ","A,","n",NULL,NULL} } },
+  /* 0xC7 */ { 2, { .instr = {"RST  ","$00",NULL,NULL,NULL} } },
+  /* 0xC8 */ { 2, { .instr = {"RET  ","Z",NULL,NULL,NULL} } },
+  /* 0xC9 */ { 2, { .instr = {"RET  ",NULL,NULL,NULL,NULL} } },
+  /* 0xCA */ { 4, { .instr = {"JP   ","Z,","nn",NULL,NULL} } },
+  /* 0xCB */ { 0, { .table = tableFDCB } },
+  /* 0xCC */ { 4, { .instr = {"CALL ","Z,","nn",NULL,NULL} } },
+  /* 0xCD */ { 4, { .instr = {"CALL ","nn",NULL,NULL,NULL} } },
+  /* 0xCE */ { 3, { .instr = {"ADC  ","A,","n",NULL,NULL} } },
+  /* 0xCF */ { 2, { .instr = {"RST  ","$08",NULL,NULL,NULL} } },
+  /* 0xD0 */ { 2, { .instr = {"RET  ","NC",NULL,NULL,NULL} } },
+  /* 0xD1 */ { 2, { .instr = {"POP  ","DE",NULL,NULL,NULL} } },
+  /* 0xD2 */ { 4, { .instr = {"JP   ","NC,","nn",NULL,NULL} } },
+  /* 0xD3 */ { 3, { .instr = {"OUT  ","(","n","),A",NULL} } },
+  /* 0xD4 */ { 4, { .instr = {"CALL ","NC,","nn",NULL,NULL} } },
+  /* 0xD5 */ { 2, { .instr = {"PUSH ","DE",NULL,NULL,NULL} } },
+  /* 0xD6 */ { 3, { .instr = {"SUB  ","n",NULL,NULL,NULL} } },
+  /* 0xD7 */ { 2, { .instr = {"RST  ","$10",NULL,NULL,NULL} } },
+  /* 0xD8 */ { 2, { .instr = {"RET  ","C",NULL,NULL,NULL} } },
+  /* 0xD9 */ { 2, { .instr = {"EXX  ",NULL,NULL,NULL,NULL} } },
+  /* 0xDA */ { 4, { .instr = {"JP   ","C,","nn",NULL,NULL} } },
+  /* 0xDB */ { 3, { .instr = {"IN   ","A,(","n",")",NULL} } },
+  /* 0xDC */ { 4, { .instr = {"CALL ","C,","nn",NULL,NULL} } },
+  /* 0xDD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xDE */ { 3, { .instr = {"SBC  ","A,","n",NULL,NULL} } },
+  /* 0xDF */ { 2, { .instr = {"RST  ","$18",NULL,NULL,NULL} } },
+  /* 0xE0 */ { 2, { .instr = {"RET  ","PO",NULL,NULL,NULL} } },
+  /* 0xE1 */ { 2, { .instr = {"POP  ","IY",NULL,NULL,NULL} } },
+  /* 0xE2 */ { 4, { .instr = {"JP   ","PO,","nn",NULL,NULL} } },
+  /* 0xE3 */ { 2, { .instr = {"EX   ","(SP),IY",NULL,NULL,NULL} } },
+  /* 0xE4 */ { 4, { .instr = {"CALL ","PO,","nn",NULL,NULL} } },
+  /* 0xE5 */ { 2, { .instr = {"PUSH ","IY",NULL,NULL,NULL} } },
+  /* 0xE6 */ { 3, { .instr = {"AND  ","n",NULL,NULL,NULL} } },
+  /* 0xE7 */ { 2, { .instr = {"RST  ","$20",NULL,NULL,NULL} } },
+  /* 0xE8 */ { 2, { .instr = {"RET  ","PE",NULL,NULL,NULL} } },
+  /* 0xE9 */ { 2, { .instr = {"JP   ","(IY)",NULL,NULL,NULL} } },
+  /* 0xEA */ { 4, { .instr = {"JP   ","PE,","nn",NULL,NULL} } },
+  /* 0xEB */ { 2, { .instr = {"EX   ","DE,HL",NULL,NULL,NULL} } },
+  /* 0xEC */ { 4, { .instr = {"CALL ","PE,","nn",NULL,NULL} } },
+  /* 0xED */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xEE */ { 3, { .instr = {"XOR  ","n",NULL,NULL,NULL} } },
+  /* 0xEF */ { 2, { .instr = {"RST  ","$28",NULL,NULL,NULL} } },
+  /* 0xF0 */ { 2, { .instr = {"RET  ","P",NULL,NULL,NULL} } },
+  /* 0xF1 */ { 2, { .instr = {"POP  ","AF",NULL,NULL,NULL} } },
+  /* 0xF2 */ { 4, { .instr = {"JP   ","P,","nn",NULL,NULL} } },
+  /* 0xF3 */ { 2, { .instr = {"DI   ",NULL,NULL,NULL,NULL} } },
+  /* 0xF4 */ { 4, { .instr = {"CALL ","P,","nn",NULL,NULL} } },
+  /* 0xF5 */ { 2, { .instr = {"PUSH ","AF",NULL,NULL,NULL} } },
+  /* 0xF6 */ { 3, { .instr = {"OR   ","n",NULL,NULL,NULL} } },
+  /* 0xF7 */ { 2, { .instr = {"RST  ","$30",NULL,NULL,NULL} } },
+  /* 0xF8 */ { 2, { .instr = {"RET  ","M",NULL,NULL,NULL} } },
+  /* 0xF9 */ { 2, { .instr = {"LD   ","SP,IY",NULL,NULL,NULL} } },
+  /* 0xFA */ { 4, { .instr = {"JP   ","M,","nn",NULL,NULL} } },
+  /* 0xFB */ { 2, { .instr = {"EI   ",NULL,NULL,NULL,NULL} } },
+  /* 0xFC */ { 4, { .instr = {"CALL ","M,","nn",NULL,NULL} } },
+  /* 0xFD */ { 1, { .instr = {"?", NULL, NULL, NULL, NULL} } },
+  /* 0xFE */ { 3, { .instr = {"CP   ","n",NULL,NULL,NULL} } },
+  /* 0xFF */ { 2, { .instr = {"RST  ","$38",NULL,NULL,NULL} } },
+};
+
+static table_entry_t table[256] = {
+  /* 0x00 */ { 1, { .instr = {"NOP  ",NULL,NULL,NULL,NULL} } },
+  /* 0x01 */ { 3, { .instr = {"LD   ","BC,","nn",NULL,NULL} } },
+  /* 0x02 */ { 1, { .instr = {"LD   ","(BC),A",NULL,NULL,NULL} } },
+  /* 0x03 */ { 1, { .instr = {"INC  ","BC",NULL,NULL,NULL} } },
+  /* 0x04 */ { 1, { .instr = {"INC  ","B",NULL,NULL,NULL} } },
+  /* 0x05 */ { 1, { .instr = {"DEC  ","B",NULL,NULL,NULL} } },
+  /* 0x06 */ { 2, { .instr = {"LD   ","B,","n",NULL,NULL} } },
+  /* 0x07 */ { 1, { .instr = {"RLCA ",NULL,NULL,NULL,NULL} } },
+  /* 0x08 */ { 1, { .instr = {"EX   ","AF,AF'",NULL,NULL,NULL} } },
+  /* 0x09 */ { 1, { .instr = {"ADD  ","HL,BC",NULL,NULL,NULL} } },
+  /* 0x0A */ { 1, { .instr = {"LD   ","A,(BC)",NULL,NULL,NULL} } },
+  /* 0x0B */ { 1, { .instr = {"DEC  ","BC",NULL,NULL,NULL} } },
+  /* 0x0C */ { 1, { .instr = {"INC  ","C",NULL,NULL,NULL} } },
+  /* 0x0D */ { 1, { .instr = {"DEC  ","C",NULL,NULL,NULL} } },
+  /* 0x0E */ { 2, { .instr = {"LD   ","C,","n",NULL,NULL} } },
+  /* 0x0F */ { 1, { .instr = {"RRCA ",NULL,NULL,NULL,NULL} } },
+  /* 0x10 */ { 2, { .instr = {"DJNZ ","e",NULL,NULL,NULL} } },
+  /* 0x11 */ { 3, { .instr = {"LD   ","DE,","nn",NULL,NULL} } },
+  /* 0x12 */ { 1, { .instr = {"LD   ","(DE),A",NULL,NULL,NULL} } },
+  /* 0x13 */ { 1, { .instr = {"INC  ","DE",NULL,NULL,NULL} } },
+  /* 0x14 */ { 1, { .instr = {"INC  ","D",NULL,NULL,NULL} } },
+  /* 0x15 */ { 1, { .instr = {"DEC  ","D",NULL,NULL,NULL} } },
+  /* 0x16 */ { 2, { .instr = {"LD   ","D,","n",NULL,NULL} } },
+  /* 0x17 */ { 1, { .instr = {"RLA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x18 */ { 2, { .instr = {"JR   ","e",NULL,NULL,NULL} } },
+  /* 0x19 */ { 1, { .instr = {"ADD  ","HL,DE",NULL,NULL,NULL} } },
+  /* 0x1A */ { 1, { .instr = {"LD   ","A,(DE)",NULL,NULL,NULL} } },
+  /* 0x1B */ { 1, { .instr = {"DEC  ","DE",NULL,NULL,NULL} } },
+  /* 0x1C */ { 1, { .instr = {"INC  ","E",NULL,NULL,NULL} } },
+  /* 0x1D */ { 1, { .instr = {"DEC  ","E",NULL,NULL,NULL} } },
+  /* 0x1E */ { 2, { .instr = {"LD   ","E,","n",NULL,NULL} } },
+  /* 0x1F */ { 1, { .instr = {"RRA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x20 */ { 2, { .instr = {"JR   ","NZ,","e",NULL,NULL} } },
+  /* 0x21 */ { 3, { .instr = {"LD   ","HL,","nn",NULL,NULL} } },
+  /* 0x22 */ { 3, { .instr = {"LD   ","(","nn","),HL",NULL} } },
+  /* 0x23 */ { 1, { .instr = {"INC  ","HL",NULL,NULL,NULL} } },
+  /* 0x24 */ { 1, { .instr = {"INC  ","H",NULL,NULL,NULL} } },
+  /* 0x25 */ { 1, { .instr = {"DEC  ","H",NULL,NULL,NULL} } },
+  /* 0x26 */ { 2, { .instr = {"LD   ","H,","n",NULL,NULL} } },
+  /* 0x27 */ { 1, { .instr = {"DAA  ",NULL,NULL,NULL,NULL} } },
+  /* 0x28 */ { 2, { .instr = {"JR   ","Z,","e",NULL,NULL} } },
+  /* 0x29 */ { 1, { .instr = {"ADD  ","HL,HL",NULL,NULL,NULL} } },
+  /* 0x2A */ { 3, { .instr = {"LD   ","HL,(","nn",")",NULL} } },
+  /* 0x2B */ { 1, { .instr = {"DEC  ","HL",NULL,NULL,NULL} } },
+  /* 0x2C */ { 1, { .instr = {"INC  ","L",NULL,NULL,NULL} } },
+  /* 0x2D */ { 1, { .instr = {"DEC  ","L",NULL,NULL,NULL} } },
+  /* 0x2E */ { 2, { .instr = {"LD   ","L,","n",NULL,NULL} } },
+  /* 0x2F */ { 1, { .instr = {"CPL  ",NULL,NULL,NULL,NULL} } },
+  /* 0x30 */ { 2, { .instr = {"JR   ","NC,","e",NULL,NULL} } },
+  /* 0x31 */ { 3, { .instr = {"LD   ","SP,","nn",NULL,NULL} } },
+  /* 0x32 */ { 3, { .instr = {"LD   ","(","nn","),A",NULL} } },
+  /* 0x33 */ { 1, { .instr = {"INC  ","SP",NULL,NULL,NULL} } },
+  /* 0x34 */ { 1, { .instr = {"INC  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x35 */ { 1, { .instr = {"DEC  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x36 */ { 2, { .instr = {"LD   ","(HL),","n",NULL,NULL} } },
+  /* 0x37 */ { 1, { .instr = {"SCF  ",NULL,NULL,NULL,NULL} } },
+  /* 0x38 */ { 2, { .instr = {"JR   ","C,","e",NULL,NULL} } },
+  /* 0x39 */ { 1, { .instr = {"ADD  ","HL,SP",NULL,NULL,NULL} } },
+  /* 0x3A */ { 3, { .instr = {"LD   ","A,(","nn",")",NULL} } },
+  /* 0x3B */ { 1, { .instr = {"DEC  ","SP",NULL,NULL,NULL} } },
+  /* 0x3C */ { 1, { .instr = {"INC  ","A",NULL,NULL,NULL} } },
+  /* 0x3D */ { 1, { .instr = {"DEC  ","A",NULL,NULL,NULL} } },
+  /* 0x3E */ { 2, { .instr = {"LD   ","A,","n",NULL,NULL} } },
+  /* 0x3F */ { 1, { .instr = {"CCF  ",NULL,NULL,NULL,NULL} } },
+  /* 0x40 */ { 1, { .instr = {"LD   ","B,B",NULL,NULL,NULL} } },
+  /* 0x41 */ { 1, { .instr = {"LD   ","B,C",NULL,NULL,NULL} } },
+  /* 0x42 */ { 1, { .instr = {"LD   ","B,D",NULL,NULL,NULL} } },
+  /* 0x43 */ { 1, { .instr = {"LD   ","B,E",NULL,NULL,NULL} } },
+  /* 0x44 */ { 1, { .instr = {"LD   ","B,H",NULL,NULL,NULL} } },
+  /* 0x45 */ { 1, { .instr = {"LD   ","B,L",NULL,NULL,NULL} } },
+  /* 0x46 */ { 1, { .instr = {"LD   ","B,(HL)",NULL,NULL,NULL} } },
+  /* 0x47 */ { 1, { .instr = {"LD   ","B,A",NULL,NULL,NULL} } },
+  /* 0x48 */ { 1, { .instr = {"LD   ","C,B",NULL,NULL,NULL} } },
+  /* 0x49 */ { 1, { .instr = {"LD   ","C,C",NULL,NULL,NULL} } },
+  /* 0x4A */ { 1, { .instr = {"LD   ","C,D",NULL,NULL,NULL} } },
+  /* 0x4B */ { 1, { .instr = {"LD   ","C,E",NULL,NULL,NULL} } },
+  /* 0x4C */ { 1, { .instr = {"LD   ","C,H",NULL,NULL,NULL} } },
+  /* 0x4D */ { 1, { .instr = {"LD   ","C,L",NULL,NULL,NULL} } },
+  /* 0x4E */ { 1, { .instr = {"LD   ","C,(HL)",NULL,NULL,NULL} } },
+  /* 0x4F */ { 1, { .instr = {"LD   ","C,A",NULL,NULL,NULL} } },
+  /* 0x50 */ { 1, { .instr = {"LD   ","D,B",NULL,NULL,NULL} } },
+  /* 0x51 */ { 1, { .instr = {"LD   ","D,C",NULL,NULL,NULL} } },
+  /* 0x52 */ { 1, { .instr = {"LD   ","D,D",NULL,NULL,NULL} } },
+  /* 0x53 */ { 1, { .instr = {"LD   ","D,E",NULL,NULL,NULL} } },
+  /* 0x54 */ { 1, { .instr = {"LD   ","D,H",NULL,NULL,NULL} } },
+  /* 0x55 */ { 1, { .instr = {"LD   ","D,L",NULL,NULL,NULL} } },
+  /* 0x56 */ { 1, { .instr = {"LD   ","D,(HL)",NULL,NULL,NULL} } },
+  /* 0x57 */ { 1, { .instr = {"LD   ","D,A",NULL,NULL,NULL} } },
+  /* 0x58 */ { 1, { .instr = {"LD   ","E,B",NULL,NULL,NULL} } },
+  /* 0x59 */ { 1, { .instr = {"LD   ","E,C",NULL,NULL,NULL} } },
+  /* 0x5A */ { 1, { .instr = {"LD   ","E,D",NULL,NULL,NULL} } },
+  /* 0x5B */ { 1, { .instr = {"LD   ","E,E",NULL,NULL,NULL} } },
+  /* 0x5C */ { 1, { .instr = {"LD   ","E,H",NULL,NULL,NULL} } },
+  /* 0x5D */ { 1, { .instr = {"LD   ","E,L",NULL,NULL,NULL} } },
+  /* 0x5E */ { 1, { .instr = {"LD   ","E,(HL)",NULL,NULL,NULL} } },
+  /* 0x5F */ { 1, { .instr = {"LD   ","E,A",NULL,NULL,NULL} } },
+  /* 0x60 */ { 1, { .instr = {"LD   ","H,B",NULL,NULL,NULL} } },
+  /* 0x61 */ { 1, { .instr = {"LD   ","H,C",NULL,NULL,NULL} } },
+  /* 0x62 */ { 1, { .instr = {"LD   ","H,D",NULL,NULL,NULL} } },
+  /* 0x63 */ { 1, { .instr = {"LD   ","H,E",NULL,NULL,NULL} } },
+  /* 0x64 */ { 1, { .instr = {"LD   ","H,H",NULL,NULL,NULL} } },
+  /* 0x65 */ { 1, { .instr = {"LD   ","H,L",NULL,NULL,NULL} } },
+  /* 0x66 */ { 1, { .instr = {"LD   ","H,(HL)",NULL,NULL,NULL} } },
+  /* 0x67 */ { 1, { .instr = {"LD   ","H,A",NULL,NULL,NULL} } },
+  /* 0x68 */ { 1, { .instr = {"LD   ","L,B",NULL,NULL,NULL} } },
+  /* 0x69 */ { 1, { .instr = {"LD   ","L,C",NULL,NULL,NULL} } },
+  /* 0x6A */ { 1, { .instr = {"LD   ","L,D",NULL,NULL,NULL} } },
+  /* 0x6B */ { 1, { .instr = {"LD   ","L,E",NULL,NULL,NULL} } },
+  /* 0x6C */ { 1, { .instr = {"LD   ","L,H",NULL,NULL,NULL} } },
+  /* 0x6D */ { 1, { .instr = {"LD   ","L,L",NULL,NULL,NULL} } },
+  /* 0x6E */ { 1, { .instr = {"LD   ","L,(HL)",NULL,NULL,NULL} } },
+  /* 0x6F */ { 1, { .instr = {"LD   ","L,A",NULL,NULL,NULL} } },
+  /* 0x70 */ { 1, { .instr = {"LD   ","(HL),B",NULL,NULL,NULL} } },
+  /* 0x71 */ { 1, { .instr = {"LD   ","(HL),C",NULL,NULL,NULL} } },
+  /* 0x72 */ { 1, { .instr = {"LD   ","(HL),D",NULL,NULL,NULL} } },
+  /* 0x73 */ { 1, { .instr = {"LD   ","(HL),E",NULL,NULL,NULL} } },
+  /* 0x74 */ { 1, { .instr = {"LD   ","(HL),H",NULL,NULL,NULL} } },
+  /* 0x75 */ { 1, { .instr = {"LD   ","(HL),L",NULL,NULL,NULL} } },
+  /* 0x76 */ { 1, { .instr = {"HALT ",NULL,NULL,NULL,NULL} } },
+  /* 0x77 */ { 1, { .instr = {"LD   ","(HL),A",NULL,NULL,NULL} } },
+  /* 0x78 */ { 1, { .instr = {"LD   ","A,B",NULL,NULL,NULL} } },
+  /* 0x79 */ { 1, { .instr = {"LD   ","A,C",NULL,NULL,NULL} } },
+  /* 0x7A */ { 1, { .instr = {"LD   ","A,D",NULL,NULL,NULL} } },
+  /* 0x7B */ { 1, { .instr = {"LD   ","A,E",NULL,NULL,NULL} } },
+  /* 0x7C */ { 1, { .instr = {"LD   ","A,H",NULL,NULL,NULL} } },
+  /* 0x7D */ { 1, { .instr = {"LD   ","A,L",NULL,NULL,NULL} } },
+  /* 0x7E */ { 1, { .instr = {"LD   ","A,(HL)",NULL,NULL,NULL} } },
+  /* 0x7F */ { 1, { .instr = {"LD   ","A,A",NULL,NULL,NULL} } },
+  /* 0x80 */ { 1, { .instr = {"ADD  ","A,B",NULL,NULL,NULL} } },
+  /* 0x81 */ { 1, { .instr = {"ADD  ","A,C",NULL,NULL,NULL} } },
+  /* 0x82 */ { 1, { .instr = {"ADD  ","A,D",NULL,NULL,NULL} } },
+  /* 0x83 */ { 1, { .instr = {"ADD  ","A,E",NULL,NULL,NULL} } },
+  /* 0x84 */ { 1, { .instr = {"ADD  ","A,H",NULL,NULL,NULL} } },
+  /* 0x85 */ { 1, { .instr = {"ADD  ","A,L",NULL,NULL,NULL} } },
+  /* 0x86 */ { 1, { .instr = {"ADD  ","A,(HL)",NULL,NULL,NULL} } },
+  /* 0x87 */ { 1, { .instr = {"ADD  ","A,A",NULL,NULL,NULL} } },
+  /* 0x88 */ { 1, { .instr = {"ADC  ","A,B",NULL,NULL,NULL} } },
+  /* 0x89 */ { 1, { .instr = {"ADC  ","A,C",NULL,NULL,NULL} } },
+  /* 0x8A */ { 1, { .instr = {"ADC  ","A,D",NULL,NULL,NULL} } },
+  /* 0x8B */ { 1, { .instr = {"ADC  ","A,E",NULL,NULL,NULL} } },
+  /* 0x8C */ { 1, { .instr = {"ADC  ","A,H",NULL,NULL,NULL} } },
+  /* 0x8D */ { 1, { .instr = {"ADC  ","A,L",NULL,NULL,NULL} } },
+  /* 0x8E */ { 1, { .instr = {"ADC  ","A,(HL)",NULL,NULL,NULL} } },
+  /* 0x8F */ { 1, { .instr = {"ADC  ","A,A",NULL,NULL,NULL} } },
+  /* 0x90 */ { 1, { .instr = {"SUB  ","B",NULL,NULL,NULL} } },
+  /* 0x91 */ { 1, { .instr = {"SUB  ","C",NULL,NULL,NULL} } },
+  /* 0x92 */ { 1, { .instr = {"SUB  ","D",NULL,NULL,NULL} } },
+  /* 0x93 */ { 1, { .instr = {"SUB  ","E",NULL,NULL,NULL} } },
+  /* 0x94 */ { 1, { .instr = {"SUB  ","H",NULL,NULL,NULL} } },
+  /* 0x95 */ { 1, { .instr = {"SUB  ","L",NULL,NULL,NULL} } },
+  /* 0x96 */ { 1, { .instr = {"SUB  ","(HL)",NULL,NULL,NULL} } },
+  /* 0x97 */ { 1, { .instr = {"SUB  ","A",NULL,NULL,NULL} } },
+  /* 0x98 */ { 1, { .instr = {"SBC  ","A,B",NULL,NULL,NULL} } },
+  /* 0x99 */ { 1, { .instr = {"SBC  ","A,C",NULL,NULL,NULL} } },
+  /* 0x9A */ { 1, { .instr = {"SBC  ","A,D",NULL,NULL,NULL} } },
+  /* 0x9B */ { 1, { .instr = {"SBC  ","A,E",NULL,NULL,NULL} } },
+  /* 0x9C */ { 1, { .instr = {"SBC  ","A,H",NULL,NULL,NULL} } },
+  /* 0x9D */ { 1, { .instr = {"SBC  ","A,L",NULL,NULL,NULL} } },
+  /* 0x9E */ { 1, { .instr = {"SBC  ","A,(HL)",NULL,NULL,NULL} } },
+  /* 0x9F */ { 1, { .instr = {"SBC  ","A,A",NULL,NULL,NULL} } },
+  /* 0xA0 */ { 1, { .instr = {"AND  ","B",NULL,NULL,NULL} } },
+  /* 0xA1 */ { 1, { .instr = {"AND  ","C",NULL,NULL,NULL} } },
+  /* 0xA2 */ { 1, { .instr = {"AND  ","D",NULL,NULL,NULL} } },
+  /* 0xA3 */ { 1, { .instr = {"AND  ","E",NULL,NULL,NULL} } },
+  /* 0xA4 */ { 1, { .instr = {"AND  ","H",NULL,NULL,NULL} } },
+  /* 0xA5 */ { 1, { .instr = {"AND  ","L",NULL,NULL,NULL} } },
+  /* 0xA6 */ { 1, { .instr = {"AND  ","(HL)",NULL,NULL,NULL} } },
+  /* 0xA7 */ { 1, { .instr = {"AND  ","A",NULL,NULL,NULL} } },
+  /* 0xA8 */ { 1, { .instr = {"XOR  ","B",NULL,NULL,NULL} } },
+  /* 0xA9 */ { 1, { .instr = {"XOR  ","C",NULL,NULL,NULL} } },
+  /* 0xAA */ { 1, { .instr = {"XOR  ","D",NULL,NULL,NULL} } },
+  /* 0xAB */ { 1, { .instr = {"XOR  ","E",NULL,NULL,NULL} } },
+  /* 0xAC */ { 1, { .instr = {"XOR  ","H",NULL,NULL,NULL} } },
+  /* 0xAD */ { 1, { .instr = {"XOR  ","L",NULL,NULL,NULL} } },
+  /* 0xAE */ { 1, { .instr = {"XOR  ","(HL)",NULL,NULL,NULL} } },
+  /* 0xAF */ { 1, { .instr = {"XOR  ","A",NULL,NULL,NULL} } },
+  /* 0xB0 */ { 1, { .instr = {"OR   ","B",NULL,NULL,NULL} } },
+  /* 0xB1 */ { 1, { .instr = {"OR   ","C",NULL,NULL,NULL} } },
+  /* 0xB2 */ { 1, { .instr = {"OR   ","D",NULL,NULL,NULL} } },
+  /* 0xB3 */ { 1, { .instr = {"OR   ","E",NULL,NULL,NULL} } },
+  /* 0xB4 */ { 1, { .instr = {"OR   ","H",NULL,NULL,NULL} } },
+  /* 0xB5 */ { 1, { .instr = {"OR   ","L",NULL,NULL,NULL} } },
+  /* 0xB6 */ { 1, { .instr = {"OR   ","(HL)",NULL,NULL,NULL} } },
+  /* 0xB7 */ { 1, { .instr = {"OR   ","A",NULL,NULL,NULL} } },
+  /* 0xB8 */ { 1, { .instr = {"CP   ","B",NULL,NULL,NULL} } },
+  /* 0xB9 */ { 1, { .instr = {"CP   ","C",NULL,NULL,NULL} } },
+  /* 0xBA */ { 1, { .instr = {"CP   ","D",NULL,NULL,NULL} } },
+  /* 0xBB */ { 1, { .instr = {"CP   ","E",NULL,NULL,NULL} } },
+  /* 0xBC */ { 1, { .instr = {"CP   ","H",NULL,NULL,NULL} } },
+  /* 0xBD */ { 1, { .instr = {"CP   ","L",NULL,NULL,NULL} } },
+  /* 0xBE */ { 1, { .instr = {"CP   ","(HL)",NULL,NULL,NULL} } },
+  /* 0xBF */ { 1, { .instr = {"CP   ","A",NULL,NULL,NULL} } },
+  /* 0xC0 */ { 1, { .instr = {"RET  ","NZ",NULL,NULL,NULL} } },
+  /* 0xC1 */ { 1, { .instr = {"POP  ","BC",NULL,NULL,NULL} } },
+  /* 0xC2 */ { 3, { .instr = {"JP   ","NZ,","nn",NULL,NULL} } },
+  /* 0xC3 */ { 3, { .instr = {"JP   ","nn",NULL,NULL,NULL} } },
+  /* 0xC4 */ { 3, { .instr = {"CALL ","NZ,","nn",NULL,NULL} } },
+  /* 0xC5 */ { 1, { .instr = {"PUSH ","BC",NULL,NULL,NULL} } },
+  /* 0xC6 */ { 2, { .instr = {"ADD  ","A,","n",NULL,NULL} } },
+  /* 0xC7 */ { 1, { .instr = {"RST  ","$00",NULL,NULL,NULL} } },
+  /* 0xC8 */ { 1, { .instr = {"RET  ","Z",NULL,NULL,NULL} } },
+  /* 0xC9 */ { 1, { .instr = {"RET  ",NULL,NULL,NULL,NULL} } },
+  /* 0xCA */ { 3, { .instr = {"JP   ","Z,","nn",NULL,NULL} } },
+  /* 0xCB */ { 0, { .table = tableCB } },
+  /* 0xCC */ { 3, { .instr = {"CALL ","Z,","nn",NULL,NULL} } },
+  /* 0xCD */ { 3, { .instr = {"CALL ","nn",NULL,NULL,NULL} } },
+  /* 0xCE */ { 2, { .instr = {"ADC  ","A,","n",NULL,NULL} } },
+  /* 0xCF */ { 1, { .instr = {"RST  ","$08",NULL,NULL,NULL} } },
+  /* 0xD0 */ { 1, { .instr = {"RET  ","NC",NULL,NULL,NULL} } },
+  /* 0xD1 */ { 1, { .instr = {"POP  ","DE",NULL,NULL,NULL} } },
+  /* 0xD2 */ { 3, { .instr = {"JP   ","NC,","nn",NULL,NULL} } },
+  /* 0xD3 */ { 2, { .instr = {"OUT  ","(","n","),A",NULL} } },
+  /* 0xD4 */ { 3, { .instr = {"CALL ","NC,","nn",NULL,NULL} } },
+  /* 0xD5 */ { 1, { .instr = {"PUSH ","DE",NULL,NULL,NULL} } },
+  /* 0xD6 */ { 2, { .instr = {"SUB  ","n",NULL,NULL,NULL} } },
+  /* 0xD7 */ { 1, { .instr = {"RST  ","$10",NULL,NULL,NULL} } },
+  /* 0xD8 */ { 1, { .instr = {"RET  ","C",NULL,NULL,NULL} } },
+  /* 0xD9 */ { 1, { .instr = {"EXX  ",NULL,NULL,NULL,NULL} } },
+  /* 0xDA */ { 3, { .instr = {"JP   ","C,","nn",NULL,NULL} } },
+  /* 0xDB */ { 2, { .instr = {"IN   ","A,(","n",")",NULL} } },
+  /* 0xDC */ { 3, { .instr = {"CALL ","C,","nn",NULL,NULL} } },
+  /* 0xDD */ { 0, { .table = tableDD } },
+  /* 0xDE */ { 2, { .instr = {"SBC  ","A,","n",NULL,NULL} } },
+  /* 0xDF */ { 1, { .instr = {"RST  ","$18",NULL,NULL,NULL} } },
+  /* 0xE0 */ { 1, { .instr = {"RET  ","PO",NULL,NULL,NULL} } },
+  /* 0xE1 */ { 1, { .instr = {"POP  ","HL",NULL,NULL,NULL} } },
+  /* 0xE2 */ { 3, { .instr = {"JP   ","PO,","nn",NULL,NULL} } },
+  /* 0xE3 */ { 1, { .instr = {"EX   ","(SP),HL",NULL,NULL,NULL} } },
+  /* 0xE4 */ { 3, { .instr = {"CALL ","PO,","nn",NULL,NULL} } },
+  /* 0xE5 */ { 1, { .instr = {"PUSH ","HL",NULL,NULL,NULL} } },
+  /* 0xE6 */ { 2, { .instr = {"AND  ","n",NULL,NULL,NULL} } },
+  /* 0xE7 */ { 1, { .instr = {"RST  ","$20",NULL,NULL,NULL} } },
+  /* 0xE8 */ { 1, { .instr = {"RET  ","PE",NULL,NULL,NULL} } },
+  /* 0xE9 */ { 1, { .instr = {"JP   ","(HL)",NULL,NULL,NULL} } },
+  /* 0xEA */ { 3, { .instr = {"JP   ","PE,","nn",NULL,NULL} } },
+  /* 0xEB */ { 1, { .instr = {"EX   ","DE,HL",NULL,NULL,NULL} } },
+  /* 0xEC */ { 3, { .instr = {"CALL ","PE,","nn",NULL,NULL} } },
+  /* 0xED */ { 0, { .table = tableED } },
+  /* 0xEE */ { 2, { .instr = {"XOR  ","n",NULL,NULL,NULL} } },
+  /* 0xEF */ { 1, { .instr = {"RST  ","$28",NULL,NULL,NULL} } },
+  /* 0xF0 */ { 1, { .instr = {"RET  ","P",NULL,NULL,NULL} } },
+  /* 0xF1 */ { 1, { .instr = {"POP  ","AF",NULL,NULL,NULL} } },
+  /* 0xF2 */ { 3, { .instr = {"JP   ","P,","nn",NULL,NULL} } },
+  /* 0xF3 */ { 1, { .instr = {"DI   ",NULL,NULL,NULL,NULL} } },
+  /* 0xF4 */ { 3, { .instr = {"CALL ","P,","nn",NULL,NULL} } },
+  /* 0xF5 */ { 1, { .instr = {"PUSH ","AF",NULL,NULL,NULL} } },
+  /* 0xF6 */ { 2, { .instr = {"OR   ","n",NULL,NULL,NULL} } },
+  /* 0xF7 */ { 1, { .instr = {"RST  ","$30",NULL,NULL,NULL} } },
+  /* 0xF8 */ { 1, { .instr = {"RET  ","M",NULL,NULL,NULL} } },
+  /* 0xF9 */ { 1, { .instr = {"LD   ","SP,HL",NULL,NULL,NULL} } },
+  /* 0xFA */ { 3, { .instr = {"JP   ","M,","nn",NULL,NULL} } },
+  /* 0xFB */ { 1, { .instr = {"EI   ",NULL,NULL,NULL,NULL} } },
+  /* 0xFC */ { 3, { .instr = {"CALL ","M,","nn",NULL,NULL} } },
+  /* 0xFD */ { 0, { .table = tableFD } },
+  /* 0xFE */ { 2, { .instr = {"CP   ","n",NULL,NULL,NULL} } },
+  /* 0xFF */ { 1, { .instr = {"RST  ","$38",NULL,NULL,NULL} } },
+};
+
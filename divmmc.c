@@ -5,6 +5,7 @@
 #include "keyboard.h"
 #include "log.h"
 #include "memory.h"
+#include "rewind.h"
 #include "rom.h"
 #include "utils.h"
 
@@ -61,7 +62,15 @@ typedef struct divmmc_t {
 } divmmc_t;
 
 
-static divmmc_t self;
+static MACHINE_LOCAL divmmc_t self;
+
+
+/**
+ * One bit per address at which an opcode fetch can currently change the
+ * automap state, so that all other fetches skip it. Derived from the state
+ * above, hence kept out of it.
+ */
+static MACHINE_LOCAL u8_t divmmc_automap_candidates[0x10000 / 8];
 
 
 inline
@@ -83,9 +92,13 @@ int divmmc_init(u8_t* sram) {
   memset(&self, 0, sizeof(self));
   self.sram = sram;
 
+  memory_automap_candidates_set(divmmc_automap_candidates);
+
   divmmc_reset(E_RESET_HARD);
   divmmc_refresh_ptrs();
 
+  rewind_register(&self, sizeof(self), divmmc_automap_candidates_refresh);
+
   return 0;
 }
 
@@ -117,6 +130,8 @@ void divmmc_reset(reset_t reset) {
     divmmc_refresh_ptrs();
     memory_refresh_accessors(0, 2);
   }
+
+  divmmc_automap_candidates_refresh();
 }
 
 
@@ -144,6 +159,16 @@ void divmmc_ram_write(u16_t address, u8_t value) {
 }
 
 
+u32_t divmmc_rom_sram_offset(u16_t address) {
+  return (self.rom - self.sram) + address;
+}
+
+
+u32_t divmmc_ram_sram_offset(u16_t address) {
+  return (self.ram - self.sram) + address;
+}
+
+
 u8_t divmmc_control_read(u16_t address) {
   return self.value;
 }
@@ -167,6 +192,7 @@ int divmmc_is_automap_enabled(void) {
 
 void divmmc_automap_enable(int enable) {
   self.is_automap_enabled = enable;
+  divmmc_automap_candidates_refresh();
 }
 
 
@@ -207,6 +233,7 @@ void divmmc_automap_on_fetch_enable(u16_t address, int enable) {
   const u16_t addr = map(address);
   if (addr != E_DIVMMC_ADDR_NONE) {
     self.automap[addr].enable = enable;
+    divmmc_automap_candidates_refresh();
   }
 }
 
@@ -215,6 +242,7 @@ void divmmc_automap_on_fetch_always(u16_t address, int always) {
   const u16_t addr = map(address);
   if (addr >= E_DIVMMC_ADDR_0000 && addr <= E_DIVMMC_ADDR_0038) {
     self.automap[addr].always = always;
+    divmmc_automap_candidates_refresh();
   }
 }
 
@@ -227,6 +255,61 @@ void divmmc_automap_on_fetch_instant(u16_t address, int instant) {
 }
 
 
+/**
+ * Whether an opcode fetch from an automap address can ever change the
+ * automap state, given what does not change from one fetch to the next.
+ * The NMI key and whether the fetch is instant are left to the fetch.
+ */
+static int divmmc_is_automap_candidate(divmmc_addr_t addr) {
+  const int is_48k_basic = (rom_selected() == E_ROM_48K_BASIC);
+
+  if (!self.is_automap_enabled || !self.automap[addr].enable) {
+    return 0;
+  }
+
+  switch (addr) {
+    case E_DIVMMC_ADDR_0000:
+    case E_DIVMMC_ADDR_0008:
+    case E_DIVMMC_ADDR_0010:
+    case E_DIVMMC_ADDR_0018:
+    case E_DIVMMC_ADDR_0020:
+    case E_DIVMMC_ADDR_0028:
+    case E_DIVMMC_ADDR_0030:
+    case E_DIVMMC_ADDR_0038:
+      return self.automap[addr].always || is_48k_basic;
+
+    case E_DIVMMC_ADDR_04C6:
+    case E_DIVMMC_ADDR_04D7:
+    case E_DIVMMC_ADDR_0562:
+    case E_DIVMMC_ADDR_056A:
+    case E_DIVMMC_ADDR_3DXX:
+      return is_48k_basic;
+
+    default:
+      return 1;
+  }
+}
+
+
+/**
+ * Rebuilds the automap candidates, which must follow every change to the
+ * automap settings and to the selected ROM.
+ */
+void divmmc_automap_candidates_refresh(void) {
+  u32_t address;
+
+  memset(divmmc_automap_candidates, 0, sizeof(divmmc_automap_candidates));
+
+  /* Automap addresses all lie in the bottom 16K. */
+  for (address = 0x0000; address < 0x4000; address++) {
+    const divmmc_addr_t addr = map(address);
+    if (addr != E_DIVMMC_ADDR_NONE && divmmc_is_automap_candidate(addr)) {
+      divmmc_automap_candidates[address / 8] |= 1 << (address & 7);
+    }
+  }
+}
+
+
 void divmmc_automap(u16_t address, int instant) {
   if (!self.is_automap_enabled) {
     return;
@@ -1,3 +1,4 @@
+#include <string.h>
 #include <strings.h>
 #include "clock.h"
 #include "defs.h"
@@ -5,6 +6,7 @@
 #include "io.h"
 #include "log.h"
 #include "memory.h"
+#include "rewind.h"
 
 
 /**
@@ -12,8 +14,8 @@
  */
 
 
-#define NO_GROUP  0xFF
-#define N_GROUPS  7
+#define NO_GROUP   0xFF
+#define N_GROUPS   7
 
 
 typedef enum dma_cmd_t {
@@ -64,6 +66,7 @@ typedef struct dma_t {
   u8_t       match_byte;
   u8_t       zxn_prescalar;
   int        is_enabled;
+  int        is_stepped;  /* Whether the CPU drives transfers, as opposed to a clock event. */
   u16_t      n_bytes_transferred;
   u16_t      n_blocks_transferred;
   dma_mode_t mode;
@@ -83,7 +86,26 @@ typedef struct dma_t {
 } dma_t;
 
 
-static dma_t dma;
+static MACHINE_LOCAL dma_t dma;
+
+
+/**
+ * Prescaled transfers in burst and continuous mode are paced by a clock
+ * event, so that the CPU need not poll for them. Everything else is driven
+ * by the CPU between instructions.
+ */
+static void dma_schedule(void) {
+  const int is_prescaled = dma.is_enabled && dma.zxn_prescalar != 0 && (dma.mode == E_MODE_BURST || dma.mode == E_MODE_CONTINUOUS);
+  const u64_t now        = clock_ticks();
+
+  dma.is_stepped = dma.is_enabled && (!is_prescaled || dma.mode == E_MODE_CONTINUOUS);
+
+  if (is_prescaled) {
+    clock_event_schedule(E_CLOCK_EVENT_DMA, (dma.next_transfer_ticks > now) ? dma.next_transfer_ticks : now);
+  } else {
+    clock_event_cancel(E_CLOCK_EVENT_DMA);
+  }
+}
 
 
 int dma_init(u8_t* sram) {
@@ -93,6 +115,8 @@ int dma_init(u8_t* sram) {
 
   dma_reset(E_RESET_HARD);
 
+  rewind_register(&dma, sizeof(dma), NULL);
+
   return 0;
 }
 
@@ -108,6 +132,8 @@ void dma_reset(reset_t reset) {
   dma.zxn_prescalar       = 0;
   dma.do_restart          = 0;
   dma.next_transfer_ticks = 0;
+
+  dma_schedule();
 }
 
 
@@ -303,6 +329,7 @@ static void dma_group_2_write(u8_t value, int is_first_write) {
     } else if (dma.b_variable_timing & 0x20) {
       dma.zxn_prescalar      = value;
       dma.b_variable_timing &= ~0x20;
+      dma_schedule();
     }
   }
 
@@ -333,6 +360,7 @@ static void dma_group_3_write(u8_t value, int is_first_write) {
 static void dma_group_4_write(u8_t value, int is_first_write) {
   if (is_first_write) {
     dma.mode = (value & 0x60) >> 5;
+    dma_schedule();
   } else {
     if (dma.group_value[4] & 0x04) {
       dma.b_starting_address &= 0xFF00;
@@ -413,6 +441,8 @@ static void dma_group_6_write(u8_t value, int is_first_write) {
     if (value != E_DMA_CMD_READ_MASK_FOLLOWS) {
       dma.group = NO_GROUP;
     }
+
+    dma_schedule();
   } else {
     dma.read_mask = value & 0x7F;
     dma.group     = NO_GROUP;
@@ -527,31 +557,140 @@ static void transfer_one_byte(void) {
 }
 
 
-inline
-static void dma_run(void) {
+/**
+ * Transfers a run of bytes between plain RAM in one go, up to the first page
+ * boundary of either side. Returns the number of bytes transferred, or zero
+ * when the byte-by-byte path has to be taken.
+ */
+static u32_t dma_transfer_run(void) {
+  u8_t*  src;
+  u8_t*  dst;
+  u8_t*  src_lo;
+  u8_t*  dst_lo;
+  u32_t  n;
+
+  if (dma.is_src_io || dma.is_dst_io || dma.zxn_prescalar != 0) {
+    return 0;
+  }
+
+  src = memory_host_pointer(dma.src_address, 0);
+  dst = memory_host_pointer(dma.dst_address, 1);
+  if (src == NULL || dst == NULL) {
+    return 0;
+  }
+
+  n = dma.block_length - dma.n_bytes_transferred;
+  if (n > memory_page_run_length(dma.src_address, dma.src_address_delta)) {
+    n = memory_page_run_length(dma.src_address, dma.src_address_delta);
+  }
+  if (n > memory_page_run_length(dma.dst_address, dma.dst_address_delta)) {
+    n = memory_page_run_length(dma.dst_address, dma.dst_address_delta);
+  }
+
+  /* Lowest host addresses touched on either side. */
+  src_lo = (dma.src_address_delta < 0) ? src - (n - 1) : src;
+  dst_lo = (dma.dst_address_delta < 0) ? dst - (n - 1) : dst;
+
+  if (src_lo + (dma.src_address_delta ? n : 1) <= dst_lo || dst_lo + (dma.dst_address_delta ? n : 1) <= src_lo) {
+    if (dma.dst_address_delta == 0) {
+      /* Only the last byte sticks. */
+      *dst = src[(int) (n - 1) * dma.src_address_delta];
+    } else if (dma.src_address_delta == 0) {
+      memset(dst_lo, *src, n);
+    } else if (dma.src_address_delta == dma.dst_address_delta) {
+      memcpy(dst_lo, src_lo, n);
+    } else {
+      for (u32_t i = 0; i < n; i++) {
+        *dst = *src;
+        src += dma.src_address_delta;
+        dst += dma.dst_address_delta;
+      }
+    }
+  } else {
+    /* Overlapping, so keep the byte order, e.g. for fills that copy forward. */
+    for (u32_t i = 0; i < n; i++) {
+      *dst = *src;
+      src += dma.src_address_delta;
+      dst += dma.dst_address_delta;
+    }
+  }
+
+  dma.src_address         += dma.src_address_delta * (int) n;
+  dma.dst_address         += dma.dst_address_delta * (int) n;
+  dma.n_bytes_transferred += n;
+
+  clock_run(n * (dma.src_cycle_length + dma.dst_cycle_length));
+
+  return n;
+}
+
+
+static void dma_block_end(void) {
+  if (dma.n_bytes_transferred == dma.block_length) {
+    if (dma.do_restart) {
+      block_reload();
+      dma.n_blocks_transferred++;
+      dma.n_bytes_transferred = 0;
+    } else {
+      dma.is_enabled = 0;
+      dma_schedule();
+    }
+  }
+}
+
+
+/**
+ * Prescaled continuous mode keeps the CPU off the bus until the block is
+ * done. The transfers themselves happen in the clock event, so let the
+ * clock run up to the last one in as few steps as possible.
+ */
+static void dma_stall(void) {
+  const u16_t n_blocks_transferred = dma.n_blocks_transferred;
+
+  while (dma.is_stepped && dma.zxn_prescalar != 0 && dma.n_blocks_transferred == n_blocks_transferred) {
+    const u64_t now  = clock_ticks();
+    const u64_t next = (dma.next_transfer_ticks > now) ? dma.next_transfer_ticks : now;
+
+    clock_wait_28mhz_ticks(next - now + (u64_t) (u16_t) (dma.block_length - dma.n_bytes_transferred - 1) * dma.zxn_prescalar * 32);
+  }
+}
+
+
+void dma_clock_event(void) {
   u64_t now;
 
-  if (!dma.is_enabled) {
+  transfer_one_byte();
+  dma_block_end();
+
+  if (dma.is_enabled) {
+    /* Leave the CPU at least a tick when transfers cannot keep up. */
+    now = clock_ticks();
+    clock_event_schedule(E_CLOCK_EVENT_DMA, (dma.next_transfer_ticks > now) ? dma.next_transfer_ticks : now + 1);
+  }
+}
+
+
+inline
+static void dma_run(void) {
+  if (!dma.is_stepped) {
     return;
   }
 
   switch (dma.mode) {
     case E_MODE_BURST:
-      if (dma.zxn_prescalar != 0 && clock_ticks() < dma.next_transfer_ticks) {
-        return;
-      }
       transfer_one_byte();
       break;
 
     case E_MODE_CONTINUOUS:
+      if (dma.zxn_prescalar != 0) {
+        dma_stall();
+        return;
+      }
       while (dma.n_bytes_transferred < dma.block_length) {
-        transfer_one_byte();
-        if (dma.zxn_prescalar != 0) {
-          now = clock_ticks();
-          if (dma.next_transfer_ticks > now) {
-            clock_run_28mhz_ticks(dma.next_transfer_ticks - now);
-          }
+        if (dma_transfer_run() > 0) {
+          continue;
         }
+        transfer_one_byte();
       }
       break;
 
@@ -560,13 +699,5 @@ static void dma_run(void) {
       return;
   }
 
-  if (dma.n_bytes_transferred == dma.block_length) {
-    if (dma.do_restart) {
-      block_reload();
-      dma.n_blocks_transferred++;
-      dma.n_bytes_transferred = 0;
-    } else {
-      dma.is_enabled = 0;
-    }
-  }
+  dma_block_end();
 }
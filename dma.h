@@ -10,6 +10,7 @@ void dma_finit(void);
 void dma_reset(reset_t reset);
 void dma_write(u16_t address, u8_t value);
 u8_t dma_read(u16_t address);
+void dma_clock_event(void);
 
 
 #endif  /* __DMA_H */
@@ -12,8 +12,14 @@
 #define MAX_AT_PREFIX_LENGTH    20
 #define MAX_PACKET_LENGTH     2048
 
-#define TX_SIZE  MAX_PACKET_LENGTH
-#define RX_SIZE  MAX_PACKET_LENGTH
+#define MAX_LINKS                5
+#define MAX_IPD_HEADER_LENGTH   16  /* "+IPD,<id>,<length>:" */
+#define POLL_TIMEOUT_MS         20
+
+#define TX_SIZE         MAX_PACKET_LENGTH
+#define RX_SIZE         (4 * MAX_PACKET_LENGTH)
+#define RESPONSES_SIZE  (2 * MAX_PACKET_LENGTH)
+#define PREFIX_SIZE     2
 
 #define CR       '\r'
 #define LF       '\n'
@@ -28,11 +34,25 @@ static void idle_tx(void);
 static void send_tx(void);
 
 
+/**
+ * A connection. The emulation thread opens the socket and hands it to the
+ * network thread, which is the only one to touch the socket set and which
+ * also closes the socket once the emulation thread is done with it.
+ */
+typedef struct link_t {
+  TCPsocket socket;   /* Open, as seen by the emulation thread. */
+  TCPsocket closing;  /* To be closed by the network thread. */
+  TCPsocket polled;   /* In the socket set, network thread only. */
+  int       is_eof;   /* Peer closed the connection. */
+} link_t;
+
+
 typedef struct esp_t {
   buffer_t     tx;
-  buffer_t     rx;
+  buffer_t     rx;         /* From the network thread. */
+  buffer_t     responses;  /* From the emulation thread. */
+  size_t       rx_remaining;
   u8_t*        rx_temp;
-  size_t       rx_temp_index;
   tx_handler_t tx_handler;
 
   u32_t        baudrate;
@@ -41,38 +61,31 @@ typedef struct esp_t {
   int          use_odd_parity;
   int          use_two_stop_bits;
   int          do_echo;
+  int          is_multiplexed;
 
   SDLNet_SocketSet socket_set;
 
-  TCPsocket    socket;
-  SDL_mutex*   socket_mutex;
-  SDL_cond*    socket_changed;
+  link_t       links[MAX_LINKS];
+  SDL_mutex*   links_mutex;
+  SDL_cond*    links_changed;
 
+  int          send_link;
   size_t       length;
   SDL_Thread*  rx_thread;
   int          do_finit;
 } esp_t;
 
 
-static esp_t self;
-
-
-#define HEADER       "+IPD,0000:"
-#define HEADER_SIZE  10
+static MACHINE_LOCAL esp_t self;
 
 
+/**
+ * Responses to AT-commands. Only the emulation thread writes these, and it
+ * cannot wait for itself to read them.
+ */
 static void respond_n(const u8_t* response, size_t length) {
-  size_t i;
-
-  for (i = 0; (i < length) && !self.do_finit; i++) {
-    SDL_LockMutex(self.rx.mutex);
-    while (self.rx.n_elements == self.rx.size && !self.do_finit) {
-      SDL_CondWaitTimeout(self.rx.element_removed, self.rx.mutex, 1000);
-    }
-    if (!self.do_finit) {
-      buffer_write(&self.rx, response[i]);
-    }
-    SDL_UnlockMutex(self.rx.mutex);
+  if (!buffer_write_n(&self.responses, length, response)) {
+    log_wrn("esp: dropped response of %lu bytes\n", length);
   }
 }
 
@@ -92,65 +105,145 @@ static void error(void) {
 }
 
 
-static void copy_to_rx(size_t n) {
-  /* Patch size. */
-  snprintf((char *) &self.rx_temp[5], 4 + 1, "%04lu", n);
-  self.rx_temp[HEADER_SIZE - 1] = ':';
+static int format_closed(const esp_t* esp, char* response, size_t size, int id) {
+  return esp->is_multiplexed
+    ? snprintf(response, size, "%d,CLOSED" CRLF, id)
+    : snprintf(response, size, "CLOSED" CRLF);
+}
+
+
+static void respond_closed(int id) {
+  char response[16 + 1];
 
-  /* Copy data to rx buffer. */
-  respond_n(self.rx_temp, HEADER_SIZE + n);
+  format_closed(&self, response, sizeof(response), id);
+  respond(response);
 }
 
 
-static int rx_thread(void *ptr) {
-  TCPsocket socket;
-  size_t    i;
+/**
+ * Hands a message from the network thread to the emulation thread, waiting
+ * for room if need be. It is prefixed with its length, for which the two
+ * bytes in front of the message are overwritten, so that esp_rx_read knows
+ * where it may slip in responses.
+ */
+static void deliver(esp_t* esp, u8_t* message, size_t length) {
+  u8_t* const prefixed = message - PREFIX_SIZE;
 
-  /* Prepend the header. */
-  snprintf((char *) self.rx_temp, HEADER_SIZE, "%s", HEADER);
+  prefixed[0] = length & 0xFF;
+  prefixed[1] = length >> 8;
 
-  while (!self.do_finit) {
+  while (!buffer_write_n(&esp->rx, PREFIX_SIZE + length, prefixed) && !esp->do_finit) {
+    (void) buffer_wait_free(&esp->rx, PREFIX_SIZE + length, 1000);
+  }
+}
+
+
+/**
+ * Brings the socket set in line with the links, and closes the sockets the
+ * emulation thread is done with. Must be called with the links mutex held.
+ * Returns the number of sockets to poll.
+ */
+static int links_sync(esp_t* esp) {
+  int n_polled = 0;
+  int is_reaped = 0;
+  int id;
+
+  for (id = 0; id < MAX_LINKS; id++) {
+    link_t* link = &esp->links[id];
+
+    if (link->closing != NULL) {
+      if (link->polled == link->closing) {
+        SDLNet_TCP_DelSocket(esp->socket_set, link->polled);
+        link->polled = NULL;
+      }
+      SDLNet_TCP_Close(link->closing);
+      link->closing = NULL;
+      is_reaped     = 1;
+    }
+
+    if (link->socket != NULL && link->polled == NULL && !link->is_eof) {
+      SDLNet_TCP_AddSocket(esp->socket_set, link->socket);
+      link->polled = link->socket;
+    }
+
+    if (link->polled != NULL) {
+      n_polled++;
+    }
+  }
+
+  if (is_reaped) {
+    SDL_CondBroadcast(esp->links_changed);
+  }
+
+  return n_polled;
+}
+
+
+/**
+ * Hands whatever the socket has available to the UART in one go, prefixed
+ * with the header the ESP uses for received data.
+ */
+static void link_receive(esp_t* esp, int id) {
+  link_t*     link = &esp->links[id];
+  u8_t* const data = &esp->rx_temp[PREFIX_SIZE + MAX_IPD_HEADER_LENGTH];
+  char        header[MAX_IPD_HEADER_LENGTH + 1];
+  int         header_length;
+  int         n;
+
+  n = SDLNet_TCP_Recv(link->polled, data, MAX_PACKET_LENGTH);
+  if (n <= 0) {
+    /* Peer closed the connection, stop polling it. */
+    SDL_LockMutex(esp->links_mutex);
+    SDLNet_TCP_DelSocket(esp->socket_set, link->polled);
+    link->polled = NULL;
+    link->is_eof = 1;
+    SDL_UnlockMutex(esp->links_mutex);
+
+    n = format_closed(esp, (char *) data, MAX_PACKET_LENGTH, id);
+    deliver(esp, data, n);
+    return;
+  }
+
+  if (esp->is_multiplexed) {
+    header_length = snprintf(header, sizeof(header), "+IPD,%d,%04d:", id, n);
+  } else {
+    header_length = snprintf(header, sizeof(header), "+IPD,%04d:", n);
+  }
+
+  memcpy(data - header_length, header, header_length);
+  deliver(esp, data - header_length, header_length + n);
+}
+
+
+static int rx_thread(void *ptr) {
+  esp_t* esp = ptr;
+  int n_polled;
+  int id;
+
+  while (!esp->do_finit) {
 
     /* Wait until we have a socket. */
-    SDL_LockMutex(self.socket_mutex);
-    while (self.socket == NULL && !self.do_finit) {
-      SDL_CondWaitTimeout(self.socket_changed, self.socket_mutex, 1000);
+    SDL_LockMutex(esp->links_mutex);
+    n_polled = links_sync(esp);
+    if (n_polled == 0 && !esp->do_finit) {
+      SDL_CondWaitTimeout(esp->links_changed, esp->links_mutex, 1000);
+    }
+    SDL_UnlockMutex(esp->links_mutex);
+
+    if (n_polled == 0) {
+      continue;
     }
-    socket = self.socket;
-    SDL_UnlockMutex(self.socket_mutex);
-
-    i = HEADER_SIZE;
-
-    while (!self.do_finit) {
-      /* Wait until there is activity. */
-      const int result = SDLNet_CheckSockets(self.socket_set, 20);
-
-      if (result == 0) {
-        /* Timeout: copy to rx what we have. */
-        const size_t n = i - HEADER_SIZE;
-        if (n > 0) {
-          copy_to_rx(n);
-          i = HEADER_SIZE;
-        }
-      } else if (result == 1) {
-        /* Our socket should be ready. */
-        if (!SDLNet_SocketReady(socket)) {
-          break;
-        }
-
-        if (SDLNet_TCP_Recv(socket, &self.rx_temp[i], 1) != 1) {
-          break;
-        }
-        
-        if (++i == RX_SIZE) {
-          /* Buffer full: copy to rx what we have. */
-          const size_t n = i - HEADER_SIZE;
-          copy_to_rx(n);
-          i = HEADER_SIZE;
-        }
-      } else {
-        /* Error */
-        break;
+
+    /* Wait until there is activity. */
+    const int result = SDLNet_CheckSockets(esp->socket_set, POLL_TIMEOUT_MS);
+    if (result < 0) {
+      SDL_Delay(POLL_TIMEOUT_MS);
+      continue;
+    }
+
+    for (id = 0; id < MAX_LINKS; id++) {
+      if (esp->links[id].polled != NULL && SDLNet_SocketReady(esp->links[id].polled)) {
+        link_receive(esp, id);
       }
     }
   }
@@ -160,7 +253,7 @@ static int rx_thread(void *ptr) {
 
 
 int esp_init(void) {
-  self.socket   = NULL;
+  memset(self.links, 0, sizeof(self.links));
   self.do_finit = 0;
 
   if (buffer_init(&self.rx, RX_SIZE) != 0) {
@@ -169,29 +262,34 @@ int esp_init(void) {
 
   if (buffer_init(&self.tx, TX_SIZE) != 0) {
     goto exit_rx;
-  }   
+  }
 
-  self.socket_set = SDLNet_AllocSocketSet(1);
-  if (self.socket_set == NULL) {
+  if (buffer_init(&self.responses, RESPONSES_SIZE) != 0) {
     goto exit_tx;
   }
 
-  self.socket_changed = SDL_CreateCond();
-  if (self.socket_changed == NULL) {
+  self.socket_set = SDLNet_AllocSocketSet(MAX_LINKS);
+  if (self.socket_set == NULL) {
+    goto exit_responses;
+  }
+
+  self.links_changed = SDL_CreateCond();
+  if (self.links_changed == NULL) {
     goto exit_socket_set;
   }
-  
-  self.socket_mutex = SDL_CreateMutex();
-  if (self.socket_mutex == NULL) {
-    goto exit_socket_changed;
+
+  self.links_mutex = SDL_CreateMutex();
+  if (self.links_mutex == NULL) {
+    goto exit_links_changed;
   }
 
-  self.rx_temp = malloc(RX_SIZE + 1);
+  self.rx_temp = malloc(PREFIX_SIZE + MAX_IPD_HEADER_LENGTH + MAX_PACKET_LENGTH);
   if (self.rx_temp == NULL) {
-    goto exit_socket_mutex;
+    goto exit_links_mutex;
   }
-  
-  self.rx_thread = SDL_CreateThread(rx_thread, "rx_thread", NULL);
+
+  /* Handed the state, which may be thread-local, see defs.h. */
+  self.rx_thread = SDL_CreateThread(rx_thread, "rx_thread", &self);
   if (self.rx_thread == NULL) {
     goto exit_rx_temp;
   }
@@ -200,51 +298,103 @@ int esp_init(void) {
 
   return 0;
 
-exit_rx:
-  buffer_finit(&self.rx);
-exit_tx:
-  buffer_finit(&self.tx);
-exit_socket_set:
-  SDLNet_FreeSocketSet(self.socket_set);
-exit_socket_changed:
-  SDL_DestroyCond(self.socket_changed);
-exit_socket_mutex:
-  SDL_DestroyMutex(self.socket_mutex);
 exit_rx_temp:
   free(self.rx_temp);
+exit_links_mutex:
+  SDL_DestroyMutex(self.links_mutex);
+exit_links_changed:
+  SDL_DestroyCond(self.links_changed);
+exit_socket_set:
+  SDLNet_FreeSocketSet(self.socket_set);
+exit_responses:
+  buffer_finit(&self.responses);
+exit_tx:
+  buffer_finit(&self.tx);
+exit_rx:
+  buffer_finit(&self.rx);
 exit:
   log_err("esp: out of memory\n");
   return 1;
 }
 
 
-static void close_socket(void) {
-  SDL_LockMutex(self.socket_mutex);
+static int link_is_open(int id) {
+  int is_open;
+
+  SDL_LockMutex(self.links_mutex);
+  is_open = self.links[id].socket != NULL && !self.links[id].is_eof;
+  SDL_UnlockMutex(self.links_mutex);
+
+  return is_open;
+}
+
 
-  SDLNet_TCP_Close(self.socket);
-  SDLNet_TCP_DelSocket(self.socket_set, self.socket);
+static void link_close(int id) {
+  link_t* link = &self.links[id];
 
-  self.socket = NULL;
+  SDL_LockMutex(self.links_mutex);
 
-  SDL_CondSignal(self.socket_changed);
-  SDL_UnlockMutex(self.socket_mutex);
+  /* The network thread may be polling it, so leave closing to it. */
+  link->closing = link->socket;
+  link->socket  = NULL;
+
+  SDL_CondBroadcast(self.links_changed);
+  SDL_UnlockMutex(self.links_mutex);
 }
 
 
-void esp_finit(void) {
-  self.do_finit = 1;
+static int link_open(int id, IPaddress* ip) {
+  link_t*   link = &self.links[id];
+  TCPsocket socket;
 
-  if (self.socket) {
-    close_socket();
+  socket = SDLNet_TCP_Open(ip);
+  if (socket == NULL) {
+    return -1;
   }
 
+  SDL_LockMutex(self.links_mutex);
+
+  /* Wait for the network thread to be done with the previous socket. */
+  while (link->closing != NULL && !self.do_finit) {
+    SDL_CondWaitTimeout(self.links_changed, self.links_mutex, 1000);
+  }
+
+  link->socket = socket;
+  link->is_eof = 0;
+
+  SDL_CondBroadcast(self.links_changed);
+  SDL_UnlockMutex(self.links_mutex);
+
+  return 0;
+}
+
+
+void esp_finit(void) {
+  int id;
+
+  SDL_LockMutex(self.links_mutex);
+  self.do_finit = 1;
+  SDL_CondBroadcast(self.links_changed);
+  SDL_UnlockMutex(self.links_mutex);
+
   SDL_WaitThread(self.rx_thread, NULL);
 
+  /* Only we are left to close the sockets. */
+  for (id = 0; id < MAX_LINKS; id++) {
+    if (self.links[id].socket != NULL) {
+      SDLNet_TCP_Close(self.links[id].socket);
+    }
+    if (self.links[id].closing != NULL) {
+      SDLNet_TCP_Close(self.links[id].closing);
+    }
+  }
+
   buffer_finit(&self.rx);
   buffer_finit(&self.tx);
+  buffer_finit(&self.responses);
   SDLNet_FreeSocketSet(self.socket_set);
-  SDL_DestroyCond(self.socket_changed);
-  SDL_DestroyMutex(self.socket_mutex);
+  SDL_DestroyCond(self.links_changed);
+  SDL_DestroyMutex(self.links_mutex);
   free(self.rx_temp);
 }
 
@@ -269,6 +419,25 @@ static void skip_crlf(void) {
 }
 
 
+/**
+ * Reads the "<id>," that the multiplexed forms of commands start with.
+ */
+static int read_link_id(int* id) {
+  u8_t s[2];
+
+  if (buffer_read_n(&self.tx, sizeof(s), s) != sizeof(s)) {
+    return -1;
+  }
+
+  if (s[0] < '0' || s[0] >= '0' + MAX_LINKS || s[1] != ',') {
+    return -1;
+  }
+
+  *id = s[0] - '0';
+  return 0;
+}
+
+
 typedef void (*at_handler_t)(void);
 
 
@@ -306,33 +475,89 @@ static void at_uart_cur(void) {
     error();
     return;
   }
-  
+
   snprintf(response, sizeof(response), "+UART_CUR:%u,%d,%d,%d,0" CRLF,
            self.baudrate,
            self.bits_per_frame,
-           self.use_two_stop_bits ? 2 : 1,             
+           self.use_two_stop_bits ? 2 : 1,
            self.use_parity_check ? (self.use_odd_parity ? 1 : 2) : 0);
   respond(response);
   ok();
 }
 
 
+/**
+ * AT+CIPMUX?
+ * AT+CIPMUX=<mode>
+ */
+static void at_cipmux(void) {
+  char response[16 + 1];
+  u8_t s[2];
+  int  id;
+
+  if (!buffer_read_n(&self.tx, 1, s)) {
+    error();
+    return;
+  }
+
+  if (s[0] == '?') {
+    snprintf(response, sizeof(response), "+CIPMUX:%d" CRLF, self.is_multiplexed);
+    respond(response);
+    ok();
+    return;
+  }
+
+  if (s[0] != '=' || !buffer_read_n(&self.tx, 1, &s[1]) || (s[1] != '0' && s[1] != '1')) {
+    error();
+    return;
+  }
+
+  /* Cannot change modes with connections open. */
+  for (id = 0; id < MAX_LINKS; id++) {
+    if (link_is_open(id)) {
+      error();
+      return;
+    }
+  }
+
+  self.is_multiplexed = s[1] == '1';
+  ok();
+}
+
+
 /**
  * AT+CIPSTART="TCP","<host>",<port>[<keepalive>]
+ * AT+CIPSTART=<id>,"TCP","<host>",<port>[<keepalive>]
  */
 static void at_cipstart(void) {
   u8_t      host[80 + 1];
   u8_t      port[5 + 1];
-  u8_t      s[8];
+  u8_t      s[7];
   size_t    i;
+  int       id = 0;
   IPaddress ip;
 
+  if (!buffer_read_n(&self.tx, 1, s)) {
+    error();
+    return;
+  }
+
+  if (s[0] != '=') {
+    error();
+    return;
+  }
+
+  if (self.is_multiplexed && read_link_id(&id) != 0) {
+    error();
+    return;
+  }
+
   if (buffer_read_n(&self.tx, sizeof(s), s) != sizeof(s)) {
     error();
     return;
   }
 
-  if (strncmp((const char *) s, "=\"TCP\",\"", sizeof(s)) != 0) {
+  if (strncmp((const char *) s, "\"TCP\",\"", sizeof(s)) != 0) {
     error();
     return;
   }
@@ -369,28 +594,25 @@ static void at_cipstart(void) {
   }
   port[i] = 0;
 
-  if (self.socket) {
+  if (link_is_open(id)) {
     respond("ALREADY CONNECTED" CRLF);
     return;
   }
 
+  if (self.links[id].socket != NULL) {
+    /* Closed by the peer. */
+    link_close(id);
+  }
+
   if (SDLNet_ResolveHost(&ip, (const char *) host, atoi((const char *) port)) != 0) {
     error();
     return;
   }
 
-  SDL_LockMutex(self.socket_mutex);
-
-  self.socket = SDLNet_TCP_Open(&ip);
-  if (!self.socket) {
-    SDL_UnlockMutex(self.socket_mutex);
+  if (link_open(id, &ip) != 0) {
     error();
     return;
   }
-  SDLNet_TCP_AddSocket(self.socket_set, self.socket);
-
-  SDL_CondSignal(self.socket_changed);
-  SDL_UnlockMutex(self.socket_mutex);
 
   ok();
 }
@@ -398,11 +620,36 @@ static void at_cipstart(void) {
 
 /**
  * AT+CIPCLOSE
+ * AT+CIPCLOSE=<id>
  */
 static void at_cipclose(void) {
-  if (self.socket) {
-    close_socket();
-    respond("CLOSED" CRLF);
+  u8_t s[2];
+  int  id;
+
+  if (!self.is_multiplexed) {
+    if (self.links[0].socket != NULL) {
+      if (link_is_open(0)) {
+        respond_closed(0);
+      }
+      link_close(0);
+    }
+    ok();
+    return;
+  }
+
+  /* Id MAX_LINKS closes all of them. */
+  if (buffer_read_n(&self.tx, sizeof(s), s) != sizeof(s) || s[0] != '=' || s[1] < '0' || s[1] > '0' + MAX_LINKS) {
+    error();
+    return;
+  }
+
+  for (id = 0; id < MAX_LINKS; id++) {
+    if ((s[1] - '0' == id || s[1] - '0' == MAX_LINKS) && self.links[id].socket != NULL) {
+      if (link_is_open(id)) {
+        respond_closed(id);
+      }
+      link_close(id);
+    }
   }
 
   ok();
@@ -419,7 +666,7 @@ static void send_tx(void) {
 
   (void) buffer_read_n(&self.tx, self.length, NULL);
 
-  if (SDLNet_TCP_Send(self.socket, packet, self.length) < self.length) {
+  if (self.links[self.send_link].socket == NULL || SDLNet_TCP_Send(self.links[self.send_link].socket, packet, self.length) < self.length) {
     respond("SEND FAIL" CRLF);
   } else {
     respond("SEND OK" CRLF);
@@ -432,18 +679,25 @@ static void send_tx(void) {
 /**
  * AT+CIPSEND
  * AT+CIPSEND=<length>
+ * AT+CIPSEND=<id>,<length>
  */
 static void at_cipsend(void) {
   u8_t   length[4 + 1];  /* Max 2048. */
   u8_t   value;
   size_t i;
+  int    id = 0;
 
   (void) buffer_peek_n(&self.tx, 0, 1, &value);
   switch (value) {
     case '=':
       /* Normal transmission mode. */
       (void) buffer_read_n(&self.tx, 1, NULL);
- 
+
+      if (self.is_multiplexed && read_link_id(&id) != 0) {
+        error();
+        return;
+      }
+
       /* Read length. */
       memset(length, 0, sizeof(length));
       while (buffer_read_n(&self.tx, 1, &length[0]) && length[0] == '0');
@@ -458,6 +712,12 @@ static void at_cipsend(void) {
         error();
         return;
       }
+      if (!link_is_open(id)) {
+        respond("link is not valid" CRLF);
+        error();
+        return;
+      }
+      self.send_link = id;
       respond(">");
       break;
 
@@ -485,7 +745,7 @@ static void at(void) {
     { "E1",        at_echo_on  },
     { "+UART_CUR", at_uart_cur },
     { "+CIPCLOSE", at_cipclose },
-    { "+CIPMUX",   ok          },
+    { "+CIPMUX",   at_cipmux   },
     { "+CIPSTART", at_cipstart },
     { "+CIPSEND",  at_cipsend  },
     { "",          ok          }
@@ -519,25 +779,22 @@ static void at(void) {
 
 
 static void idle_tx(void) {
-  u8_t prefix[2] = { 0, 0 };
+  const size_t n_elements = buffer_used(&self.tx);
+  u8_t         prefix[2]  = { 0, 0 };
 
   /* Wait for carriage return. */
-  if (self.tx.n_elements < 2) {
+  if (n_elements < 2) {
     return;
   }
-  (void) buffer_peek_n(&self.tx, self.tx.n_elements - 2, 2, prefix);
+  (void) buffer_peek_n(&self.tx, n_elements - 2, 2, prefix);
   if (strncmp((const char *) prefix, CRLF, 2) != 0) {
     return;
   }
 
   /* Echo if required. */
   if (self.do_echo) {
-    size_t i;
-    for (i = 0; i < self.tx.n_elements; i++) {
-      u8_t value;
-      (void) buffer_peek_n(&self.tx, i, 1, &value);
-      (void) buffer_write(&self.rx, value);
-    }
+    u8_t echo[TX_SIZE];
+    respond_n(echo, buffer_peek_n(&self.tx, 0, n_elements, echo));
   }
 
   /* Must be AT-command. */
@@ -566,32 +823,56 @@ void esp_tx_write(u8_t value) {
 
 
 u8_t esp_tx_read(void) {
-  return (self.tx.n_elements == 0)                    << 4 /* Tx empty      */
-       | (self.rx.n_elements >= self.rx.size * 3 / 4) << 3 /* Rx near full  */
-       | (self.tx.n_elements == self.tx.size)         << 1 /* Tx full       */
-       | (self.rx.n_elements > 0);                         /* Rx not empty  */
+  const size_t tx_used       = buffer_used(&self.tx);
+  const size_t rx_used       = buffer_used(&self.rx);
+  const int    is_rx_pending = self.rx_remaining > 0 || rx_used > 0 || buffer_used(&self.responses) > 0;
+
+  return (tx_used == 0)                    << 4 /* Tx empty      */
+       | (rx_used >= self.rx.size * 3 / 4) << 3 /* Rx near full  */
+       | (tx_used == self.tx.size)         << 1 /* Tx full       */
+       | is_rx_pending;                         /* Rx not empty  */
 }
 
 
 u8_t esp_rx_read(void) {
   u8_t value;
+  u8_t prefix[PREFIX_SIZE];
 
+  if (self.rx_remaining == 0) {
+    /* In between messages from the network, responses go first. */
+    if (buffer_read_n(&self.responses, 1, &value)) {
+      return value;
+    }
+
+    if (buffer_read_n(&self.rx, PREFIX_SIZE, prefix) != PREFIX_SIZE) {
+      return 0x00;
+    }
+    self.rx_remaining = prefix[0] | prefix[1] << 8;
+  }
+
+  self.rx_remaining--;
   return buffer_read_n(&self.rx, 1, &value) ? value : 0x00;
 }
 
 
 void esp_reset(reset_t reset) {
-  self.tx.read_index = 0;
-  self.tx.n_elements = 0;
-  self.rx.read_index = 0;
-  self.rx.n_elements = 0;
+  int id;
+
+  /* Whole messages only, so this lands in between them. */
+  buffer_reset(&self.tx);
+  buffer_reset(&self.rx);
+  buffer_reset(&self.responses);
+  self.rx_remaining = 0;
 
   self.tx_handler = idle_tx;
 
-  self.do_echo = 1;
+  self.do_echo        = 1;
+  self.is_multiplexed = 0;
 
-  if (self.socket) {
-    close_socket();
+  for (id = 0; id < MAX_LINKS; id++) {
+    if (self.links[id].socket != NULL) {
+      link_close(id);
+    }
   }
 }
 
@@ -0,0 +1,585 @@
+#include <SDL2/SDL.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "cpu.h"
+#include "debug.h"
+#include "defs.h"
+#include "gdb.h"
+#include "log.h"
+#include "memory.h"
+
+
+/**
+ * See https://sourceware.org/gdb/current/onlinedocs/gdb.html/Remote-Protocol.html.
+ *
+ * Only a single client is served, and only from localhost. While the CPU
+ * runs, the connection is polled from the host sync. When stopped, the
+ * emulation thread blocks in gdb_stop() serving requests until GDB
+ * continues or detaches.
+ *
+ * SDL_net can only listen on all interfaces, hence plain sockets.
+ */
+
+
+#define MAX_PACKET_LENGTH  1024
+#define POLL_INTERVAL_MS   50
+
+#define SIGTRAP            5
+
+/* Order of registers in GDB's Z80 target, all 16-bit little-endian. */
+#define N_REGISTERS        13
+
+/* Where missing, SDLNet_Init() has SIGPIPE ignored. */
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL       0
+#endif
+
+
+typedef struct gdb_t {
+  int    server;
+  int    client;
+  char   packet[MAX_PACKET_LENGTH + 1];
+  size_t length;
+  int    is_in_packet;
+  int    n_checksum_digits;  /* Still to come after the '#'. */
+  int    is_break_requested;
+  int    is_running;
+  char   reply[MAX_PACKET_LENGTH + 4 + 1];
+} gdb_t;
+
+
+static MACHINE_LOCAL gdb_t self;
+
+
+int gdb_init(u16_t port) {
+  struct sockaddr_in address;
+  const int          yes = 1;
+
+  memset(&self, 0, sizeof(self));
+  self.server = -1;
+  self.client = -1;
+
+  if (port == 0) {
+    return 0;
+  }
+
+  self.server = socket(AF_INET, SOCK_STREAM, 0);
+  if (self.server < 0) {
+    log_err("gdb: socket: %s\n", strerror(errno));
+    goto exit;
+  }
+  (void) setsockopt(self.server, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+  memset(&address, 0, sizeof(address));
+  address.sin_family      = AF_INET;
+  address.sin_port        = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  if (bind(self.server, (struct sockaddr*) &address, sizeof(address)) != 0 || listen(self.server, 1) != 0) {
+    log_err("gdb: cannot listen on port %u: %s\n", port, strerror(errno));
+    goto exit_server;
+  }
+
+  log_wrn("gdb: listening on 127.0.0.1:%u\n", port);
+
+  return 0;
+
+exit_server:
+  close(self.server);
+  self.server = -1;
+exit:
+  return -1;
+}
+
+
+static void gdb_disconnect(void) {
+  close(self.client);
+
+  self.client             = -1;
+  self.is_in_packet       = 0;
+  self.n_checksum_digits  = 0;
+  self.is_break_requested = 0;
+  self.is_running         = 0;
+
+  log_wrn("gdb: client disconnected\n");
+}
+
+
+void gdb_finit(void) {
+  if (self.client >= 0) {
+    gdb_disconnect();
+  }
+  if (self.server >= 0) {
+    close(self.server);
+    self.server = -1;
+  }
+}
+
+
+int gdb_is_attached(void) {
+  return self.client >= 0;
+}
+
+
+static void gdb_accept(void) {
+  const int client = accept(self.server, NULL, NULL);
+
+  if (client < 0) {
+    return;
+  }
+
+  if (self.client >= 0) {
+    log_wrn("gdb: rejected connection\n");
+    close(client);
+    return;
+  }
+
+  self.client             = client;
+  self.length             = 0;
+  self.is_in_packet       = 0;
+  self.n_checksum_digits  = 0;
+  self.is_break_requested = 1;  /* GDB expects the target to be stopped. */
+
+  log_wrn("gdb: client connected\n");
+}
+
+
+static void gdb_send_raw(const char* data, size_t length) {
+  if (self.client >= 0 && send(self.client, data, length, MSG_NOSIGNAL) < (ssize_t) length) {
+    gdb_disconnect();
+  }
+}
+
+
+static void gdb_send(const char* payload) {
+  const size_t length   = strlen(payload);
+  u8_t         checksum = 0;
+
+  for (size_t i = 0; i < length; i++) {
+    checksum += payload[i];
+  }
+
+  snprintf(self.reply, sizeof(self.reply), "$%s#%02x", payload, checksum);
+  gdb_send_raw(self.reply, strlen(self.reply));
+}
+
+
+/**
+ * Waits up to a timeout for the server and the client, if any. Returns
+ * whether the client has something to read.
+ */
+static int gdb_poll(u32_t timeout_ms) {
+  struct pollfd fds[2];
+
+  fds[0].fd      = self.server;
+  fds[0].events  = POLLIN;
+  fds[0].revents = 0;
+  fds[1].fd      = self.client;
+  fds[1].events  = POLLIN;
+  fds[1].revents = 0;
+
+  if (poll(fds, (self.client >= 0) ? 2 : 1, (int) timeout_ms) <= 0) {
+    return 0;
+  }
+
+  if (fds[0].revents & POLLIN) {
+    gdb_accept();
+  }
+
+  return fds[1].fd >= 0 && (fds[1].revents & (POLLIN | POLLHUP | POLLERR));
+}
+
+
+/**
+ * Reads whatever is available and returns 1 as soon as a complete packet
+ * sits in self.packet. A packet may arrive over several calls, so the
+ * emulation never waits for the rest of it. An interrupt (Ctrl-C) only
+ * raises a flag.
+ */
+static int gdb_receive(u32_t timeout_ms) {
+  char c;
+
+  while (self.client >= 0) {
+    if (!gdb_poll(timeout_ms)) {
+      return 0;
+    }
+
+    if (recv(self.client, &c, 1, 0) != 1) {
+      gdb_disconnect();
+      return 0;
+    }
+
+    if (self.n_checksum_digits > 0) {
+      /* Trust TCP, but consume the checksum. */
+      if (--self.n_checksum_digits == 0) {
+        self.packet[self.length] = '\0';
+        gdb_send_raw("+", 1);
+        return 1;
+      }
+      continue;
+    }
+
+    if (!self.is_in_packet) {
+      if (c == '$') {
+        self.is_in_packet = 1;
+        self.length       = 0;
+      } else if (c == 0x03) {
+        self.is_break_requested = 1;
+      } else if (c == '-') {
+        gdb_send_raw(self.reply, strlen(self.reply));
+      }
+      continue;
+    }
+
+    if (c == '#') {
+      self.is_in_packet      = 0;
+      self.n_checksum_digits = 2;
+      continue;
+    }
+
+    if (self.length < MAX_PACKET_LENGTH) {
+      self.packet[self.length++] = c;
+    }
+  }
+
+  return 0;
+}
+
+
+/**
+ * Polls the connection from the host sync, returns non-zero when GDB wants
+ * the CPU to stop.
+ */
+int gdb_sync(void) {
+  if (self.server < 0) {
+    return 0;
+  }
+
+  if (self.client < 0) {
+    (void) gdb_poll(0);
+  } else {
+    /* In all-stop mode GDB sends nothing but interrupts while running. */
+    while (gdb_receive(0)) {
+    }
+  }
+
+  return self.is_break_requested;
+}
+
+
+static reg16_t* gdb_register(int n) {
+  cpu_t* cpu = cpu_get();
+
+  switch (n) {
+    case 0:  return &cpu->af;
+    case 1:  return &cpu->bc;
+    case 2:  return &cpu->de;
+    case 3:  return &cpu->hl;
+    case 4:  return &cpu->sp;
+    case 5:  return &cpu->pc;
+    case 6:  return &cpu->ix;
+    case 7:  return &cpu->iy;
+    case 8:  return &cpu->af_;
+    case 9:  return &cpu->bc_;
+    case 10: return &cpu->de_;
+    case 11: return &cpu->hl_;
+    case 12: return &cpu->ir;
+    default: return NULL;
+  }
+}
+
+
+static int gdb_hex_digit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+
+static int gdb_hex_byte(const char* s, u8_t* byte) {
+  const int hi = gdb_hex_digit(s[0]);
+  const int lo = (hi < 0) ? -1 : gdb_hex_digit(s[1]);
+
+  if (lo < 0) {
+    return -1;
+  }
+
+  *byte = hi << 4 | lo;
+  return 0;
+}
+
+
+static void gdb_read_registers(void) {
+  char payload[N_REGISTERS * 4 + 1];
+
+  for (int n = 0; n < N_REGISTERS; n++) {
+    const reg16_t* reg = gdb_register(n);
+    sprintf(&payload[n * 4], "%02x%02x", reg->b.l, reg->b.h);
+  }
+
+  gdb_send(payload);
+}
+
+
+static void gdb_write_registers(const char* hex) {
+  for (int n = 0; n < N_REGISTERS; n++) {
+    reg16_t* reg = gdb_register(n);
+    if (gdb_hex_byte(&hex[n * 4], &reg->b.l) != 0 || gdb_hex_byte(&hex[n * 4 + 2], &reg->b.h) != 0) {
+      gdb_send("E01");
+      return;
+    }
+  }
+
+  gdb_send("OK");
+}
+
+
+static void gdb_read_register(const char* args) {
+  const reg16_t* reg = gdb_register(strtoul(args, NULL, 16));
+  char           payload[4 + 1];
+
+  if (reg == NULL) {
+    gdb_send("E01");
+    return;
+  }
+
+  sprintf(payload, "%02x%02x", reg->b.l, reg->b.h);
+  gdb_send(payload);
+}
+
+
+static void gdb_write_register(const char* args) {
+  char*    value;
+  reg16_t* reg = gdb_register(strtoul(args, &value, 16));
+
+  if (reg == NULL || *value != '=' || gdb_hex_byte(&value[1], &reg->b.l) != 0 || gdb_hex_byte(&value[3], &reg->b.h) != 0) {
+    gdb_send("E01");
+    return;
+  }
+
+  gdb_send("OK");
+}
+
+
+static void gdb_read_memory(const char* args) {
+  char        payload[MAX_PACKET_LENGTH + 1];
+  char*       p;
+  const u32_t address = strtoul(args, &p, 16);
+  u32_t       length  = (*p == ',') ? strtoul(p + 1, NULL, 16) : 0;
+
+  if (length > MAX_PACKET_LENGTH / 2) {
+    length = MAX_PACKET_LENGTH / 2;
+  }
+
+  for (u32_t i = 0; i < length; i++) {
+    sprintf(&payload[i * 2], "%02x", memory_read(address + i));
+  }
+  payload[length * 2] = '\0';
+
+  gdb_send(payload);
+}
+
+
+static void gdb_write_memory(const char* args) {
+  char*       p;
+  char*       q;
+  const u32_t address = strtoul(args, &p, 16);
+  const u32_t length  = (*p == ',') ? strtoul(p + 1, &q, 16) : 0;
+  u8_t        byte;
+
+  if (*p != ',' || *q != ':' || strlen(q + 1) < length * 2) {
+    gdb_send("E01");
+    return;
+  }
+
+  for (u32_t i = 0; i < length; i++) {
+    if (gdb_hex_byte(&q[1 + i * 2], &byte) != 0) {
+      gdb_send("E01");
+      return;
+    }
+    memory_write(address + i, byte);
+  }
+
+  gdb_send("OK");
+}
+
+
+/**
+ * Z/z packets: type 0 and 1 are breakpoints, 2 to 4 write, read and access
+ * watchpoints.
+ */
+static void gdb_breakpoint(const char* args, int set) {
+  static const int modes[] = {
+    0,
+    0,
+    DEBUG_WATCH_WRITE,
+    DEBUG_WATCH_READ,
+    DEBUG_WATCH_READ | DEBUG_WATCH_WRITE
+  };
+  char*       p;
+  const u32_t type    = strtoul(args, &p, 16);
+  const u32_t address = (*p == ',') ? strtoul(p + 1, &p, 16) : 0;
+  const u32_t length  = (*p == ',') ? strtoul(p + 1, NULL, 16) : 1;
+
+  if (type > 4) {
+    gdb_send("");
+    return;
+  }
+
+  if (type < 2) {
+    debug_breakpoint_set(address, set);
+  } else if (debug_watchpoint_set(E_DEBUG_WATCH_MEMORY, address, length, modes[type], set) != 0) {
+    gdb_send("E01");
+    return;
+  }
+
+  gdb_send("OK");
+}
+
+
+/**
+ * Resumes at the address given with a 'c' or 's' packet, if any. Returns -1
+ * after replying with an error when the address does not parse.
+ */
+static int gdb_resume_address(const char* args) {
+  char*       end;
+  const u32_t address = strtoul(args, &end, 16);
+
+  if (*args == '\0') {
+    return 0;
+  }
+
+  if (*end != '\0' || address > 0xFFFF) {
+    gdb_send("E01");
+    return -1;
+  }
+
+  cpu_get()->pc.w = address;
+  return 0;
+}
+
+
+static void gdb_send_stop_reply(void) {
+  char payload[3 + 1];
+
+  sprintf(payload, "S%02x", SIGTRAP);
+  gdb_send(payload);
+}
+
+
+/**
+ * Serves GDB while the CPU is stopped. Returns once it continues or
+ * detaches, or -1 when the emulator should quit.
+ */
+int gdb_stop(void) {
+  if (self.is_running) {
+    gdb_send_stop_reply();
+  }
+
+  self.is_running         = 0;
+  self.is_break_requested = 0;
+
+  while (self.client >= 0) {
+    if (SDL_QuitRequested()) {
+      return -1;
+    }
+
+    if (!gdb_receive(POLL_INTERVAL_MS)) {
+      continue;
+    }
+
+    switch (self.packet[0]) {
+      case '?':
+        gdb_send_stop_reply();
+        break;
+
+      case 'g':
+        gdb_read_registers();
+        break;
+
+      case 'G':
+        gdb_write_registers(&self.packet[1]);
+        break;
+
+      case 'p':
+        gdb_read_register(&self.packet[1]);
+        break;
+
+      case 'P':
+        gdb_write_register(&self.packet[1]);
+        break;
+
+      case 'm':
+        gdb_read_memory(&self.packet[1]);
+        break;
+
+      case 'M':
+        gdb_write_memory(&self.packet[1]);
+        break;
+
+      case 'Z':
+      case 'z':
+        gdb_breakpoint(&self.packet[1], self.packet[0] == 'Z');
+        break;
+
+      case 's':
+        if (gdb_resume_address(&self.packet[1]) != 0) {
+          break;
+        }
+        debug_watch_hit_clear();
+        (void) cpu_step();
+        gdb_send_stop_reply();
+        break;
+
+      case 'c':
+        if (gdb_resume_address(&self.packet[1]) != 0) {
+          break;
+        }
+        /* Our own reads while stopped may have hit a watchpoint. */
+        debug_watch_hit_clear();
+        self.is_running = 1;
+        return 0;
+
+      case 'D':
+        gdb_send("OK");
+        gdb_disconnect();
+        break;
+
+      case 'k':
+        gdb_disconnect();
+        break;
+
+      case 'H':
+        gdb_send("OK");
+        break;
+
+      case 'q':
+        if (strncmp(self.packet, "qSupported", 10) == 0) {
+          char payload[32];
+          sprintf(payload, "PacketSize=%x", MAX_PACKET_LENGTH);
+          gdb_send(payload);
+        } else if (strcmp(self.packet, "qAttached") == 0) {
+          gdb_send("1");
+        } else {
+          gdb_send("");
+        }
+        break;
+
+      default:
+        gdb_send("");
+        break;
+    }
+  }
+
+  debug_watch_hit_clear();
+
+  return 0;
+}
@@ -0,0 +1,15 @@
+#ifndef __GDB_H
+#define __GDB_H
+
+
+#include "defs.h"
+
+
+int  gdb_init(u16_t port);
+void gdb_finit(void);
+int  gdb_is_attached(void);
+int  gdb_sync(void);
+int  gdb_stop(void);
+
+
+#endif  /* __GDB_H */
@@ -2,6 +2,7 @@
 #include "defs.h"
 #include "i2c.h"
 #include "log.h"
+#include "rewind.h"
 #include "rtc.h"
 
 
@@ -41,12 +42,15 @@ typedef struct i2c_t {
 } i2c_t;
 
 
-static i2c_t self;
+static MACHINE_LOCAL i2c_t self;
 
 
 int i2c_init(void) {
   memset(&self, 0, sizeof(self));
   i2c_reset(E_RESET_HARD);
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
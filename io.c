@@ -5,6 +5,7 @@
 #include "dma.h"
 #include "nextreg.h"
 #include "dac.h"
+#include "debug.h"
 #include "defs.h"
 #include "i2c.h"
 #include "io.h"
@@ -14,6 +15,7 @@
 #include "mf.h"
 #include "mouse.h"
 #include "paging.h"
+#include "rewind.h"
 #include "spi.h"
 #include "sprites.h"
 #include "uart.h"
@@ -55,21 +57,37 @@ typedef enum io_func_t {
 } io_func_t;
 
 
+typedef u8_t (*io_reader_t)(u16_t address);
+typedef void (*io_writer_t)(u16_t address, u8_t value);
+
+
 typedef struct io_t {
+  io_reader_t     readers[0x10000];
+  io_writer_t     writers[0x10000];
+  io_reader_t     trap_readers[2];  /* $2FFD and $3FFD. */
+  io_writer_t     trap_writer;      /* $3FFD. */
   int             is_enabled[E_IO_FUNC_LAST - E_IO_FUNC_FIRST + 1];
   u8_t            decoding_enables[4];
   io_trap_cause_t io_trap_cause;
   u8_t            io_trap_byte_written;
   u8_t            mf_port_enable;
   u8_t            mf_port_disable;
+  int             is_watched;
 } io_t;
 
 
-static io_t self;
+static MACHINE_LOCAL io_t self;
+
+
+static void io_decode(void);
 
 
 int io_init(void) {
   io_reset(E_RESET_HARD);
+
+  /* The decoding tables are rebuilt rather than saved. */
+  rewind_register(&self.trap_readers, offsetof(io_t, is_watched) - offsetof(io_t, trap_readers), io_decode);
+
   return 0;
 }
 
@@ -89,6 +107,8 @@ void io_reset(reset_t reset) {
   self.io_trap_byte_written = 0x00;
   self.mf_port_enable       = 0x3F;
   self.mf_port_disable      = 0xBF;
+
+  io_decode();
 }
 
 
@@ -96,86 +116,174 @@ void io_finit(void) {
 }
 
 
-static u8_t read_internal(u16_t address) {
+/**
+ * Adapters so that every port handler has the same signature and can live
+ * in the decoding tables.
+ */
+static u8_t io_floating_bus_read(u16_t address) {
+  return ula_floating_bus_read();
+}
+
+
+static u8_t io_layer2_access_read(u16_t address) {
+  return layer2_access_read();
+}
+
+
+static u8_t io_uart_tx_read(u16_t address) {
+  return uart_tx_read();
+}
+
+
+static u8_t io_uart_rx_read(u16_t address) {
+  return uart_rx_read();
+}
+
+
+static u8_t io_uart_select_read(u16_t address) {
+  return uart_select_read();
+}
+
+
+static u8_t io_uart_frame_read(u16_t address) {
+  return uart_frame_read();
+}
+
+
+static u8_t io_paging_plus_3_read(u16_t address) {
+  return paging_spectrum_plus_3_paging_read();
+}
+
+
+static u8_t io_paging_128k_read(u16_t address) {
+  return paging_spectrum_128k_paging_read();
+}
+
+
+static u8_t io_paging_next_bank_read(u16_t address) {
+  return paging_spectrum_next_bank_extension_read();
+}
+
+
+static u8_t io_mouse_x_read(u16_t address) {
+  return mouse_read_x();
+}
+
+
+static u8_t io_mouse_y_read(u16_t address) {
+  return mouse_read_y();
+}
+
+
+static u8_t io_mouse_buttons_read(u16_t address) {
+  return mouse_read_buttons();
+}
+
+
+static u8_t io_ay_register_read(u16_t address) {
+  return ay_register_read();
+}
+
+
+static u8_t io_kempston_1_read(u16_t address) {
+  return joystick_kempston_read(E_JOYSTICK_LEFT);
+}
+
+
+static u8_t io_kempston_2_read(u16_t address) {
+  return joystick_kempston_read(E_JOYSTICK_RIGHT);
+}
+
+
+static u8_t io_trap_read(u16_t address) {
+  if (mf_is_active() || divmmc_is_active()) {
+    return self.trap_readers[address == 0x3FFD](address);
+  }
+
+  self.io_trap_cause = address == 0x2FFD ? E_IO_TRAP_CAUSE_PORT_2FFD_READ : E_IO_TRAP_CAUSE_PORT_3FFD_READ;
+  cpu_nmi(CPU_NMI_MF_VIA_IO_TRAP);
+  return 0xFF;
+}
+
+
+static io_reader_t io_reader_decode(u16_t address, int is_trapping) {
   if ((address & 0x0001) == 0x0000) {
-    return ula_read(address);
+    return ula_read;
   }
 
   switch (address) {
     case 0x113B:
       return self.is_enabled[E_IO_FUNC_I2C]
-        ? i2c_sda_read(address)
-        : ula_floating_bus_read();
+        ? i2c_sda_read
+        : io_floating_bus_read;
 
     case 0x123B:
       return self.is_enabled[E_IO_FUNC_LAYER_2]
-        ? layer2_access_read()
-        : ula_floating_bus_read();
+        ? io_layer2_access_read
+        : io_floating_bus_read;
 
     case 0x133B:
       return self.is_enabled[E_IO_FUNC_UART]
-        ? uart_tx_read()
-        : ula_floating_bus_read();
+        ? io_uart_tx_read
+        : io_floating_bus_read;
 
     case 0x143B:
       return self.is_enabled[E_IO_FUNC_UART]
-        ? uart_rx_read()
-        : ula_floating_bus_read();
+        ? io_uart_rx_read
+        : io_floating_bus_read;
 
     case 0x153B:
       return self.is_enabled[E_IO_FUNC_UART]
-        ? uart_select_read()
-        : ula_floating_bus_read();
+        ? io_uart_select_read
+        : io_floating_bus_read;
 
     case 0x163B:
       return self.is_enabled[E_IO_FUNC_UART]
-        ? uart_frame_read()
-        : ula_floating_bus_read();
+        ? io_uart_frame_read
+        : io_floating_bus_read;
 
     case 0x1FFD:
       return self.is_enabled[E_IO_FUNC_PAGING_PLUS_3]
-        ? paging_spectrum_plus_3_paging_read()
-        : ula_floating_bus_read();
+        ? io_paging_plus_3_read
+        : io_floating_bus_read;
 
     case 0x243B:
-      return nextreg_select_read(address);
+      return nextreg_select_read;
 
     case 0x253B:
-      return nextreg_data_read(address);
+      return nextreg_data_read;
 
     case 0x2FFD:
     case 0x3FFD:
-      if (self.is_enabled[E_IO_FUNC_TRAPS] && !mf_is_active() && !divmmc_is_active()) {
-        self.io_trap_cause = address == 0x2FFD ? E_IO_TRAP_CAUSE_PORT_2FFD_READ : E_IO_TRAP_CAUSE_PORT_3FFD_READ;
-        cpu_nmi(CPU_NMI_MF_VIA_IO_TRAP);
-        return 0xFF;
+      if (is_trapping) {
+        return io_trap_read;
       }
       break;
 
     case 0x7FFD:
       return self.is_enabled[E_IO_FUNC_PAGING_128K]
-        ? paging_spectrum_128k_paging_read()
-        : ula_floating_bus_read();
+        ? io_paging_128k_read
+        : io_floating_bus_read;
 
     case 0xDFFD:
       return self.is_enabled[E_IO_FUNC_PAGING_NEXT_BANK]
-        ? paging_spectrum_next_bank_extension_read()
-        : ula_floating_bus_read();
+        ? io_paging_next_bank_read
+        : io_floating_bus_read;
 
     case 0xFBDF:
       return self.is_enabled[E_IO_FUNC_MOUSE]
-        ? mouse_read_x()
-        : ula_floating_bus_read();
+        ? io_mouse_x_read
+        : io_floating_bus_read;
 
     case 0xFFDF:
       return self.is_enabled[E_IO_FUNC_MOUSE]
-        ? mouse_read_y()
-        : ula_floating_bus_read();
+        ? io_mouse_y_read
+        : io_floating_bus_read;
 
     case 0xFADF:
       return self.is_enabled[E_IO_FUNC_MOUSE]
-        ? mouse_read_buttons()
-        : ula_floating_bus_read();
+        ? io_mouse_buttons_read
+        : io_floating_bus_read;
 
     default:
       break;
@@ -183,68 +291,68 @@ static u8_t read_internal(u16_t address) {
 
   if ((address & 0xC007) == 0xC005) {
     return self.is_enabled[E_IO_FUNC_AY]
-      ? ay_register_read()
-      : ula_floating_bus_read();
+      ? io_ay_register_read
+      : io_floating_bus_read;
   }
 
   if ((address & 0x00FF) == self.mf_port_enable) {
     return self.is_enabled[E_IO_FUNC_MF]
-      ? mf_enable_read(address)
-      : ula_floating_bus_read();
+      ? mf_enable_read
+      : io_floating_bus_read;
   }
 
   if ((address & 0x00FF) == self.mf_port_disable) {
     return self.is_enabled[E_IO_FUNC_MF]
-      ? mf_disable_read(address)
-      : ula_floating_bus_read();
+      ? mf_disable_read
+      : io_floating_bus_read;
   }
 
   switch (address & 0x00FF) {
     case 0x0B:
       return self.is_enabled[E_IO_FUNC_DMA_Z80]
-        ? dma_read(address)
-        : ula_floating_bus_read();
+        ? dma_read
+        : io_floating_bus_read;
 
     case 0x1F:
       return self.is_enabled[E_IO_FUNC_KEMPSTON_1]
-        ? joystick_kempston_read(E_JOYSTICK_LEFT)
-        : ula_floating_bus_read();
+        ? io_kempston_1_read
+        : io_floating_bus_read;
 
     case 0x37:
       return self.is_enabled[E_IO_FUNC_KEMPSTON_2]
-        ? joystick_kempston_read(E_JOYSTICK_RIGHT)
-        : ula_floating_bus_read();
+        ? io_kempston_2_read
+        : io_floating_bus_read;
 
     case 0x6B:
       return self.is_enabled[E_IO_FUNC_DMA_ZXN]
-        ? dma_read(address)
-        : ula_floating_bus_read();
+        ? dma_read
+        : io_floating_bus_read;
 
     case 0xE3:
       return self.is_enabled[E_IO_FUNC_DIVMMC]
-        ? divmmc_control_read(address)
-        : ula_floating_bus_read();
+        ? divmmc_control_read
+        : io_floating_bus_read;
 
     case 0xE7:
       return self.is_enabled[E_IO_FUNC_SPI]
-        ? spi_cs_read(address)
-        : ula_floating_bus_read();
+        ? spi_cs_read
+        : io_floating_bus_read;
 
     case 0xEB:
       return self.is_enabled[E_IO_FUNC_SPI]
-        ? spi_data_read(address)
-        : ula_floating_bus_read();
+        ? spi_data_read
+        : io_floating_bus_read;
 
     case 0xFF:
       return self.is_enabled[E_IO_FUNC_TIMEX]
-        ? ula_timex_read(address)
-        : ula_floating_bus_read();
+        ? ula_timex_read
+        : io_floating_bus_read;
 
     default:
       break;
   }
 
-  return ula_floating_bus_read();
+  return io_floating_bus_read;
 }
 
 
@@ -274,12 +382,12 @@ u8_t io_read(u16_t address) {
 
       /* T3 */
       ula_contend();
-      result = read_internal(address);
+      result = self.readers[address](address);
       clock_run(1);
     } else {
       /* Tw T3 */
       clock_run(1);
-      result = read_internal(address);
+      result = self.readers[address](address);
       clock_run(1);
     }
   } else if (A0) {
@@ -287,7 +395,7 @@ u8_t io_read(u16_t address) {
     clock_run(3);
 
     /* T3 */
-    result = read_internal(address);
+    result = self.readers[address](address);
     clock_run(1);
   } else {
     /* T1 */
@@ -298,103 +406,179 @@ u8_t io_read(u16_t address) {
     clock_run(2);
 
     /* T3 */
-    result = read_internal(address);
+    result = self.readers[address](address);
     clock_run(1);
   }
 
+  if (self.is_watched) {
+    debug_watch_access(E_DEBUG_WATCH_PORT, address, result, 0);
+  }
+
   return result;
 }
 
 
-static void write_internal(u16_t address, u8_t value) {
-  if ((address & 0x0001) == 0x0000) {
-    ula_write(address, value);
+static void io_ignore_write(u16_t address, u8_t value) {
+}
+
+
+static void io_layer2_access_write(u16_t address, u8_t value) {
+  layer2_access_write(value);
+}
+
+
+static void io_uart_tx_write(u16_t address, u8_t value) {
+  uart_tx_write(value);
+}
+
+
+static void io_uart_rx_write(u16_t address, u8_t value) {
+  uart_rx_write(value);
+}
+
+
+static void io_uart_select_write(u16_t address, u8_t value) {
+  uart_select_write(value);
+}
+
+
+static void io_uart_frame_write(u16_t address, u8_t value) {
+  uart_frame_write(value);
+}
+
+
+static void io_paging_plus_3_write(u16_t address, u8_t value) {
+  paging_spectrum_plus_3_paging_write(value);
+}
+
+
+static void io_paging_128k_write(u16_t address, u8_t value) {
+  paging_spectrum_128k_paging_write(value);
+}
+
+
+static void io_paging_next_bank_write(u16_t address, u8_t value) {
+  paging_spectrum_next_bank_extension_write(value);
+}
+
+
+static void io_sprites_slot_write(u16_t address, u8_t value) {
+  sprites_slot_set(value);
+}
+
+
+static void io_sprites_attribute_write(u16_t address, u8_t value) {
+  sprites_next_attribute_set(value);
+}
+
+
+static void io_sprites_pattern_write(u16_t address, u8_t value) {
+  sprites_next_pattern_set(value);
+}
+
+
+static void io_ay_register_select_write(u16_t address, u8_t value) {
+  ay_register_select(value);
+}
+
+
+static void io_ay_register_write(u16_t address, u8_t value) {
+  ay_register_write(value);
+}
+
+
+static void io_dac_a_write(u16_t address, u8_t value) {
+  dac_write(DAC_A, value);
+}
+
+
+static void io_dac_b_write(u16_t address, u8_t value) {
+  dac_write(DAC_B, value);
+}
+
+
+static void io_dac_c_write(u16_t address, u8_t value) {
+  dac_write(DAC_C, value);
+}
+
+
+static void io_dac_d_write(u16_t address, u8_t value) {
+  dac_write(DAC_D, value);
+}
+
+
+static void io_dac_a_d_write(u16_t address, u8_t value) {
+  dac_write(DAC_A | DAC_D, value);
+}
+
+
+static void io_dac_b_c_write(u16_t address, u8_t value) {
+  dac_write(DAC_B | DAC_C, value);
+}
+
+
+static void io_trap_write(u16_t address, u8_t value) {
+  if (mf_is_active() || divmmc_is_active()) {
+    self.trap_writer(address, value);
     return;
   }
 
+  self.io_trap_cause        = E_IO_TRAP_CAUSE_PORT_3FFD_WRITE;
+  self.io_trap_byte_written = value;
+  cpu_nmi(CPU_NMI_MF_VIA_IO_TRAP);
+}
+
+
+static io_writer_t io_writer_decode(u16_t address, int is_trapping) {
+  if ((address & 0x0001) == 0x0000) {
+    return ula_write;
+  }
+
   switch (address) {
     case 0x103B:
-      if (self.is_enabled[E_IO_FUNC_I2C]) {
-        i2c_scl_write(address, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_I2C] ? i2c_scl_write : io_ignore_write;
 
     case 0x113B:
-      if (self.is_enabled[E_IO_FUNC_I2C]) {
-        i2c_sda_write(address, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_I2C] ? i2c_sda_write : io_ignore_write;
 
     case 0x123B:
-      if (self.is_enabled[E_IO_FUNC_LAYER_2]) {
-        layer2_access_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_LAYER_2] ? io_layer2_access_write : io_ignore_write;
 
     case 0x133B:
-      if (self.is_enabled[E_IO_FUNC_UART]) {
-        uart_tx_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_UART] ? io_uart_tx_write : io_ignore_write;
 
     case 0x143B:
-      if (self.is_enabled[E_IO_FUNC_UART]) {
-        uart_rx_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_UART] ? io_uart_rx_write : io_ignore_write;
 
     case 0x153B:
-      if (self.is_enabled[E_IO_FUNC_UART]) {
-        uart_select_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_UART] ? io_uart_select_write : io_ignore_write;
 
     case 0x163B:
-      if (self.is_enabled[E_IO_FUNC_UART]) {
-        uart_frame_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_UART] ? io_uart_frame_write : io_ignore_write;
 
     case 0x1FFD:
-      if (self.is_enabled[E_IO_FUNC_PAGING_PLUS_3]) {
-        paging_spectrum_plus_3_paging_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_PAGING_PLUS_3] ? io_paging_plus_3_write : io_ignore_write;
 
     case 0x243B:
-      nextreg_select_write(address, value);
-      return;
+      return nextreg_select_write;
 
     case 0x253B:
-      nextreg_data_write(address, value);
-      return;
+      return nextreg_data_write;
 
     case 0x3FFD:
-      if (self.is_enabled[E_IO_FUNC_TRAPS] && !mf_is_active() && !divmmc_is_active()) {
-        self.io_trap_cause        = E_IO_TRAP_CAUSE_PORT_3FFD_WRITE;
-        self.io_trap_byte_written = value;
-        cpu_nmi(CPU_NMI_MF_VIA_IO_TRAP);
-        return;
+      if (is_trapping) {
+        return io_trap_write;
       }
       break;
 
     case 0x303B:
-      if (self.is_enabled[E_IO_FUNC_SPRITES]) {
-        sprites_slot_set(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_SPRITES] ? io_sprites_slot_write : io_ignore_write;
 
     case 0x7FFD:
-      if (self.is_enabled[E_IO_FUNC_PAGING_128K]) {
-        paging_spectrum_128k_paging_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_PAGING_128K] ? io_paging_128k_write : io_ignore_write;
 
     case 0xDFFD:
-      if (self.is_enabled[E_IO_FUNC_PAGING_NEXT_BANK]) {
-        paging_spectrum_next_bank_extension_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_PAGING_NEXT_BANK] ? io_paging_next_bank_write : io_ignore_write;
 
     default:
       break;
@@ -402,28 +586,20 @@ static void write_internal(u16_t address, u8_t value) {
 
   if (self.is_enabled[E_IO_FUNC_MF]) {
     if ((address & 0x00FF) == self.mf_port_enable) {
-      mf_enable_write(address, value);
-      return;
+      return mf_enable_write;
     }
 
     if (address == self.mf_port_disable) {
-      mf_disable_write(address, value);
-      return;
+      return mf_disable_write;
     }
   }
 
   switch (address & 0xC007) {
     case 0xC005:  /* 0xFFFD */
-      if (self.is_enabled[E_IO_FUNC_AY]) {
-        ay_register_select(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_AY] ? io_ay_register_select_write : io_ignore_write;
 
     case 0x8005:  /* 0xBFFD */
-      if (self.is_enabled[E_IO_FUNC_AY]) {
-        ay_register_write(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_AY] ? io_ay_register_write : io_ignore_write;
 
     default:
       break;
@@ -431,128 +607,94 @@ static void write_internal(u16_t address, u8_t value) {
 
   switch (address & 0x00FF) {
     case 0x0B:
-      if (self.is_enabled[E_IO_FUNC_DMA_Z80]) {
-        dma_write(address, value);
-      }
-      break;
+      return self.is_enabled[E_IO_FUNC_DMA_Z80] ? dma_write : io_ignore_write;
 
     case 0x6B:
-      if (self.is_enabled[E_IO_FUNC_DMA_ZXN]) {
-        dma_write(address, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DMA_ZXN] ? dma_write : io_ignore_write;
 
     case 0xE3:
-      if (self.is_enabled[E_IO_FUNC_DIVMMC]) {
-        divmmc_control_write(address, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DIVMMC] ? divmmc_control_write : io_ignore_write;
 
     case 0xE7:
-      if (self.is_enabled[E_IO_FUNC_SPI]) {
-        spi_cs_write(address, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_SPI] ? spi_cs_write : io_ignore_write;
 
     case 0xEB:
-      if (self.is_enabled[E_IO_FUNC_SPI]) {
-        spi_data_write(address, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_SPI] ? spi_data_write : io_ignore_write;
 
     case 0xFF:
-      if (self.is_enabled[E_IO_FUNC_TIMEX]) {
-        ula_timex_write(address, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_TIMEX] ? ula_timex_write : io_ignore_write;
 
     case 0x0F:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1] ||
-          self.is_enabled[E_IO_FUNC_DAC_STEREO_COVOX]) {
-        dac_write(DAC_B, value);
-      }
-      return;
+      return (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1] ||
+              self.is_enabled[E_IO_FUNC_DAC_STEREO_COVOX]) ? io_dac_b_write : io_ignore_write;
 
     case 0x1F:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1]) {
-        dac_write(DAC_A, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1] ? io_dac_a_write : io_ignore_write;
 
     case 0x3F:
-      if (self.is_enabled[E_IO_FUNC_DAC_STEREO_PROFI_COVOX]) {
-        dac_write(DAC_A, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DAC_STEREO_PROFI_COVOX] ? io_dac_a_write : io_ignore_write;
 
     case 0x4F:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1] ||
-          self.is_enabled[E_IO_FUNC_DAC_STEREO_COVOX]) {
-        dac_write(DAC_C, value);
-      }
-      return;
+      return (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1] ||
+              self.is_enabled[E_IO_FUNC_DAC_STEREO_COVOX]) ? io_dac_c_write : io_ignore_write;
 
     case 0x5F:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1] ||
-          self.is_enabled[E_IO_FUNC_DAC_STEREO_PROFI_COVOX]) {
-        dac_write(DAC_D, value);
-      }
-      return;
+      return (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_1] ||
+              self.is_enabled[E_IO_FUNC_DAC_STEREO_PROFI_COVOX]) ? io_dac_d_write : io_ignore_write;
 
     case 0xB3:
-      if (self.is_enabled[E_IO_FUNC_DAC_MONO_GS_COVOX]) {
-        dac_write(DAC_B | DAC_C, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DAC_MONO_GS_COVOX] ? io_dac_b_c_write : io_ignore_write;
 
     case 0xDF:
-      if (self.is_enabled[E_IO_FUNC_DAC_MONO_SPECDRUM]) {
-        dac_write(DAC_A | DAC_D, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DAC_MONO_SPECDRUM] ? io_dac_a_d_write : io_ignore_write;
 
     case 0xF1:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2]) {
-        dac_write(DAC_A, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2] ? io_dac_a_write : io_ignore_write;
 
     case 0xF3:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2]) {
-        dac_write(DAC_B, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2] ? io_dac_b_write : io_ignore_write;
 
     case 0xF9:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2]) {
-        dac_write(DAC_C, value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2] ? io_dac_c_write : io_ignore_write;
 
     case 0xFB:
-      if (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2] ||
-          self.is_enabled[E_IO_FUNC_DAC_MONO_PENTAGON_ATM]) {
-        dac_write(DAC_A | DAC_D, value);
-      }
-      return;
+      return (self.is_enabled[E_IO_FUNC_DAC_SOUNDRIVE_MODE_2] ||
+              self.is_enabled[E_IO_FUNC_DAC_MONO_PENTAGON_ATM]) ? io_dac_a_d_write : io_ignore_write;
 
     case 0x57:
-      if (self.is_enabled[E_IO_FUNC_SPRITES]) {
-        sprites_next_attribute_set(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_SPRITES] ? io_sprites_attribute_write : io_ignore_write;
 
     case 0x5B:
-      if (self.is_enabled[E_IO_FUNC_SPRITES]) {
-        sprites_next_pattern_set(value);
-      }
-      return;
+      return self.is_enabled[E_IO_FUNC_SPRITES] ? io_sprites_pattern_write : io_ignore_write;
 
     default:
       break;
   }
+
+  return io_ignore_write;
 }
 
+
+/**
+ * Resolves every port to its handler up front, so that an access is a single
+ * indexed call. Needs to be redone whenever the decoding changes.
+ */
+static void io_decode(void) {
+  const int is_trapping = self.is_enabled[E_IO_FUNC_TRAPS];
+  u32_t     address;
+
+  for (address = 0x0000; address <= 0xFFFF; address++) {
+    self.readers[address] = io_reader_decode(address, is_trapping);
+    self.writers[address] = io_writer_decode(address, is_trapping);
+  }
+
+  /* Where trapped ports go while the Multiface or divMMC is active. */
+  self.trap_readers[0] = io_reader_decode(0x2FFD, 0);
+  self.trap_readers[1] = io_reader_decode(0x3FFD, 0);
+  self.trap_writer     = io_writer_decode(0x3FFD, 0);
+}
+
+
 /**
  * Four cycles: T1 T2 Tw T3.  T2 is contended, write takes place at T2.
  */
@@ -562,6 +704,10 @@ void io_write(u16_t address, u8_t value) {
   const u8_t high_byte = address >> 8;
   const u8_t A0        = address & 1;
 
+  if (self.is_watched) {
+    debug_watch_access(E_DEBUG_WATCH_PORT, address, value, 1);
+  }
+
   if (high_byte >= 0x40 && high_byte <= 0x7F) {
     /* T1 */
     ula_contend();
@@ -569,7 +715,7 @@ void io_write(u16_t address, u8_t value) {
 
     /* T2 */
     ula_contend();
-    write_internal(address, value);
+    self.writers[address](address, value);
     clock_run(1);
 
     if (A0) {
@@ -588,7 +734,7 @@ void io_write(u16_t address, u8_t value) {
   } else if (A0) {
     /* T1 */
     clock_run(1);
-    write_internal(address, value);
+    self.writers[address](address, value);
 
     /* T2 Tw T3 */
     clock_run(3);
@@ -598,7 +744,7 @@ void io_write(u16_t address, u8_t value) {
 
     /* T2 */
     ula_contend();
-    write_internal(address, value);
+    self.writers[address](address, value);
     clock_run(1);
  
     /* Tw T3 */
@@ -607,6 +753,48 @@ void io_write(u16_t address, u8_t value) {
 }
 
 
+/**
+ * Whether block I/O instructions can access a port in a batch, bypassing the
+ * usual timing: the access is neither contended nor watched, and the port
+ * merely streams data, as the sprite and SD card ports do.
+ */
+int io_is_batchable(u16_t address, int is_write) {
+  const u8_t high_byte = address >> 8;
+
+  if (self.is_watched) {
+    return 0;
+  }
+
+  if (high_byte >= 0x40 && high_byte <= 0x7F && ula_contention_get() && clock_cpu_speed_get() == E_CPU_SPEED_3MHZ) {
+    return 0;
+  }
+
+  if (is_write) {
+    return self.writers[address] == io_sprites_attribute_write
+        || self.writers[address] == io_sprites_pattern_write
+        || self.writers[address] == spi_data_write;
+  }
+
+  return self.readers[address] == spi_data_read;
+}
+
+
+/**
+ * Reads a batchable port, leaving the timing to the caller.
+ */
+u8_t io_batch_read(u16_t address) {
+  return self.readers[address](address);
+}
+
+
+/**
+ * Writes a batchable port, leaving the timing to the caller.
+ */
+void io_batch_write(u16_t address, u8_t value) {
+  self.writers[address](address, value);
+}
+
+
 void io_decoding_write(u8_t index, u8_t value) {
   switch (index) {
     case 0:
@@ -662,12 +850,15 @@ void io_decoding_write(u8_t index, u8_t value) {
     }
 #endif
   }
+
+  io_decode();
 }
 
 
 void io_traps_enable(int enable) {
   log_wrn("io: traps %s\n", enable ? "enabled" : "disabled");
   self.is_enabled[E_IO_FUNC_TRAPS] = enable;
+  io_decode();
 }
 
 
@@ -695,4 +886,10 @@ u8_t io_trap_byte_written(void) {
 void io_mf_ports_set(u8_t enable, u8_t disable) {
   self.mf_port_enable  = enable;
   self.mf_port_disable = disable;
+  io_decode();
+}
+
+
+void io_watch_enable(int enable) {
+  self.is_watched = enable;
 }
\ No newline at end of file
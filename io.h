@@ -19,6 +19,9 @@ void            io_finit(void);
 void            io_reset(reset_t reset);
 u8_t            io_read(u16_t address);
 void            io_write(u16_t address, u8_t value);
+int             io_is_batchable(u16_t address, int is_write);
+u8_t            io_batch_read(u16_t address);
+void            io_batch_write(u16_t address, u8_t value);
 void            io_decoding_write(u8_t index, u8_t value);
 void            io_traps_enable(int enable);
 int             io_are_traps_enabled(void);
@@ -26,6 +29,7 @@ void            io_trap_clear();
 io_trap_cause_t io_trap_cause(void);
 u8_t            io_trap_byte_written(void);
 void            io_mf_ports_set(u8_t enable, u8_t disable);
+void            io_watch_enable(int enable);
 
 
 #endif  /* __IO_H */
@@ -26,7 +26,7 @@ typedef struct self_t {
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 int joystick_init(SDL_GameController* controller_left, SDL_GameController* controller_right) {
@@ -98,3 +98,36 @@ void joystick_type_set(joystick_t n, joystick_type_t type) {
   self.entity[n].type = type;
 }
 
+
+
+/**
+ * Packs the buttons that are pressed, for recording and replaying them.
+ */
+u16_t joystick_buttons_get(joystick_t n) {
+  const entity_t* entity = &self.entity[n];
+
+  return (entity->is_pressed_up    << 0)
+       | (entity->is_pressed_down  << 1)
+       | (entity->is_pressed_left  << 2)
+       | (entity->is_pressed_right << 3)
+       | (entity->is_pressed_a     << 4)
+       | (entity->is_pressed_b     << 5)
+       | (entity->is_pressed_x     << 6)
+       | (entity->is_pressed_y     << 7)
+       | (entity->is_pressed_start << 8);
+}
+
+
+void joystick_buttons_set(joystick_t n, u16_t buttons) {
+  entity_t* entity = &self.entity[n];
+
+  entity->is_pressed_up    = (buttons >> 0) & 1;
+  entity->is_pressed_down  = (buttons >> 1) & 1;
+  entity->is_pressed_left  = (buttons >> 2) & 1;
+  entity->is_pressed_right = (buttons >> 3) & 1;
+  entity->is_pressed_a     = (buttons >> 4) & 1;
+  entity->is_pressed_b     = (buttons >> 5) & 1;
+  entity->is_pressed_x     = (buttons >> 6) & 1;
+  entity->is_pressed_y     = (buttons >> 7) & 1;
+  entity->is_pressed_start = (buttons >> 8) & 1;
+}
@@ -30,6 +30,8 @@ joystick_type_t joystick_type_get(joystick_t n);
 void            joystick_type_set(joystick_t n, joystick_type_t type);
 u8_t            joystick_kempston_read(joystick_t n);
 void            joystick_refresh(void);
+u16_t           joystick_buttons_get(joystick_t n);
+void            joystick_buttons_set(joystick_t n, u16_t buttons);
 
 
 #endif  /* __JOYSTICK_H */
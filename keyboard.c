@@ -38,15 +38,20 @@ const static SDL_Scancode scancodes[N_KEYS] = {
 };
 
 
+#define N_SPECIAL_KEYS  (E_KEYBOARD_SPECIAL_KEY_SCANDOUBLER - E_KEYBOARD_SPECIAL_KEY_CPU_SPEED + 1)
+
+
 typedef struct self_t {
   const u8_t*      state;
   layout_t         layout;
   layout_handler_t layout_handler;
   int              pressed[N_KEYS];
+  u8_t             reads[256];  /* Port value per half-row selection. */
+  int              is_special_pressed[N_SPECIAL_KEYS];
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 static void layout_handler_spectrum(void);
@@ -57,6 +62,9 @@ int keyboard_init(void) {
   self.layout         = E_LAYOUT_SPECTRUM;
   self.layout_handler = layout_handler_spectrum;
   self.state          = SDL_GetKeyboardState(NULL);
+
+  keyboard_sync();
+
   return 0;
 }
 
@@ -65,13 +73,27 @@ void keyboard_finit(void) {
 }
 
 
+/**
+ * Makes the keyboard read a copy of the host state, indexed by scancode.
+ */
+void keyboard_state_set(const u8_t* state) {
+  self.state = state;
+  keyboard_sync();
+}
+
+
+const u8_t* keyboard_state_get(void) {
+  return self.state;
+}
+
+
 void keyboard_toggle_layout(void) {
   self.layout         = E_LAYOUT_HOST - self.layout;
   self.layout_handler = (self.layout == E_LAYOUT_SPECTRUM) ? layout_handler_spectrum : layout_handler_host;
 }
 
 
-int keyboard_is_special_key_pressed(keyboard_special_key_t key) {
+static int keyboard_special_key_scan(keyboard_special_key_t key) {
   switch (key) {
     case E_KEYBOARD_SPECIAL_KEY_CPU_SPEED:
       return self.state[SDL_SCANCODE_F8] ? 1 : 0;
@@ -321,19 +343,8 @@ static void layout_handler_host(void) {
 }
 
 
-/**
- *      Left half row    Right half row
- * ------------------    ------------------------
- *          1 2 3 4 5    6 7 8 9            0
- *          Q W E R T    Y U I O            P
- *          A S D F G    H J K L            ENTER
- * CAPS_SHIFT Z X C V    B N M SYMBOL_SHIFT SPACE
- */
-u8_t keyboard_read(u16_t address) {
-  const u8_t half_row = ~(address >> 8);
-  u8_t       pressed  = ~0x1F;  /* No key pressed. */
-
-  self.layout_handler();
+static u8_t keyboard_half_rows_scan(u8_t half_row) {
+  u8_t pressed = ~0x1F;  /* No key pressed. */
 
   if (half_row & ~0xFE) pressed |= HALF_ROW_L(E_KEY_CAPS_SHIFT, E_KEY_Z, E_KEY_X, E_KEY_C,            E_KEY_V    );  /* ~11111110 */
   if (half_row & ~0xFD) pressed |= HALF_ROW_L(E_KEY_A,          E_KEY_S, E_KEY_D, E_KEY_F,            E_KEY_G    );  /* ~11111101 */
@@ -346,3 +357,42 @@ u8_t keyboard_read(u16_t address) {
 
   return ~pressed;
 }
+
+
+/**
+ * Takes a snapshot of the keys, which the emulation sees until the next one.
+ * Called on every host sync, after the host or replayed input has been
+ * refreshed, such that port reads are mere lookups.
+ */
+void keyboard_sync(void) {
+  keyboard_special_key_t key;
+  int                    address_high;
+
+  self.layout_handler();
+
+  for (address_high = 0; address_high < 256; address_high++) {
+    self.reads[address_high] = keyboard_half_rows_scan(~address_high);
+  }
+
+  for (key = E_KEYBOARD_SPECIAL_KEY_CPU_SPEED; key <= E_KEYBOARD_SPECIAL_KEY_SCANDOUBLER; key++) {
+    self.is_special_pressed[key] = keyboard_special_key_scan(key);
+  }
+}
+
+
+int keyboard_is_special_key_pressed(keyboard_special_key_t key) {
+  return self.is_special_pressed[key];
+}
+
+
+/**
+ *      Left half row    Right half row
+ * ------------------    ------------------------
+ *          1 2 3 4 5    6 7 8 9            0
+ *          Q W E R T    Y U I O            P
+ *          A S D F G    H J K L            ENTER
+ * CAPS_SHIFT Z X C V    B N M SYMBOL_SHIFT SPACE
+ */
+u8_t keyboard_read(u16_t address) {
+  return self.reads[address >> 8];
+}
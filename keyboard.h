@@ -16,11 +16,14 @@ typedef enum {
 } keyboard_special_key_t;
 
 
-int  keyboard_init(void);
-void keyboard_finit();
-u8_t keyboard_read(u16_t address);
-int  keyboard_is_special_key_pressed(keyboard_special_key_t key);
-void keyboard_toggle_layout(void);
+int         keyboard_init(void);
+void        keyboard_finit();
+u8_t        keyboard_read(u16_t address);
+void        keyboard_sync(void);
+int         keyboard_is_special_key_pressed(keyboard_special_key_t key);
+void        keyboard_toggle_layout(void);
+void        keyboard_state_set(const u8_t* state);
+const u8_t* keyboard_state_get(void);
 
 
 #endif  /* __KEYBOARD_H */
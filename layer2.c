@@ -4,6 +4,7 @@
 #include "log.h"
 #include "memory.h"
 #include "palette.h"
+#include "rewind.h"
 
 
 typedef enum resolution_t {
@@ -45,7 +46,7 @@ typedef struct layer2_t {
 } layer2_t;
 
 
-static layer2_t layer2;
+static VIDEO_LOCAL layer2_t layer2;
 
 
 int layer2_init(u8_t* sram) {
@@ -55,6 +56,8 @@ int layer2_init(u8_t* sram) {
 
   layer2_reset(E_RESET_HARD);
 
+  rewind_register(&layer2, sizeof(layer2), NULL);
+
   return 0;
 }
 
@@ -95,9 +98,15 @@ u8_t layer2_access_read(void) {
 
 
 void layer2_access_write(u8_t value) {
+  slu_log(E_SLU_OP_LAYER2_ACCESS_WRITE, value);
+
   if (value & 0x10)
   {
     layer2.bank_offset = value & 0x07;
+
+    if (!slu_is_replica) {
+      memory_remapped(0, 6);
+    }
   }
   else
   {
@@ -107,12 +116,16 @@ void layer2_access_write(u8_t value) {
     layer2.is_visible    = value & 0x02;
     layer2.is_writable   = value & 0x01;
 
-    memory_refresh_accessors(0, 6);
+    if (!slu_is_replica) {
+      memory_refresh_accessors(0, 6);
+    }
   }
 }
 
 
 void layer2_control_write(u8_t value) {
+  slu_log(E_SLU_OP_LAYER2_CONTROL_WRITE, value);
+
   layer2.resolution     = (value & 0x30) >> 4;
   layer2.palette_offset = value & 0x0F;
 }
@@ -124,8 +137,14 @@ u8_t layer2_active_bank_read(void) {
 
 
 void layer2_active_bank_write(u8_t bank) {
+  slu_log(E_SLU_OP_LAYER2_ACTIVE_BANK_WRITE, bank);
+
   if (bank != layer2.active_bank) {
     layer2.active_bank = bank;
+
+    if (!slu_is_replica) {
+      memory_remapped(0, 6);
+    }
   }
 }
 
@@ -138,6 +157,8 @@ u8_t layer2_shadow_bank_read(void) {
 void layer2_shadow_bank_write(u8_t bank) {
   if (bank != layer2.shadow_bank) {
     layer2.shadow_bank = bank;
+
+    memory_remapped(0, 6);
   }
 }
 
@@ -284,12 +305,21 @@ void layer2_write(u16_t address, u8_t value) {
 }
 
 
+u32_t layer2_sram_offset(u16_t address) {
+  return MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM + layer2_translate(address);
+}
+
+
 void layer2_palette_set(int use_second) {
+  slu_log(E_SLU_OP_LAYER2_PALETTE_SET, use_second);
+
   layer2.palette = use_second ? E_PALETTE_LAYER2_SECOND : E_PALETTE_LAYER2_FIRST;
 }
 
 
 void layer2_clip_set(u8_t x1, u8_t x2, u8_t y1, u8_t y2) {
+  slu_log4(E_SLU_OP_LAYER2_CLIP_SET, x1, x2, y1, y2);
+
   layer2.clip_x1 = x1;
   layer2.clip_x2 = x2;
   layer2.clip_y1 = y1;
@@ -298,20 +328,28 @@ void layer2_clip_set(u8_t x1, u8_t x2, u8_t y1, u8_t y2) {
 
 
 void layer2_offset_x_msb_write(u8_t value) {
+  slu_log(E_SLU_OP_LAYER2_OFFSET_X_MSB_WRITE, value);
+
   layer2.offset_x = (value << 8) | (layer2.offset_x & 0x00FF);
 }
 
 
 void layer2_offset_x_lsb_write(u8_t value) {
+  slu_log(E_SLU_OP_LAYER2_OFFSET_X_LSB_WRITE, value);
+
   layer2.offset_x = (layer2.offset_x & 0xFF00) | value;
 }
 
 
 void layer2_offset_y_write(u8_t value) {
+  slu_log(E_SLU_OP_LAYER2_OFFSET_Y_WRITE, value);
+
   layer2.offset_y = value;
 }
 
 
 void layer2_enable(int enable) {
+  slu_log(E_SLU_OP_LAYER2_ENABLE, enable);
+
   layer2.is_visible = enable;
 }
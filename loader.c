@@ -0,0 +1,694 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "cpu.h"
+#include "defs.h"
+#include "io.h"
+#include "loader.h"
+#include "log.h"
+#include "memory.h"
+#include "nextreg.h"
+#include "slu.h"
+#include "utils.h"
+
+
+/**
+ * Loads programs straight into memory, rather than booting NextZXOS from
+ * the SD card and picking them in the browser:
+ *
+ * - .nex: https://wiki.specnext.dev/NEX_file_format
+ * - .sna: 48K and 128K snapshots
+ * - .z80: versions 1 to 3, for 48K, 128K, +3 and Pentagon machines
+ *
+ * The machine is hard reset and leaves config mode right away. Nobody then
+ * copies the ROMs into SRAM, so they are read from LOADER_ROM_FILENAME: the
+ * 128K editor, syntax checker, +3DOS and 48K BASIC, 16K each.
+ */
+
+
+#define LOADER_ROM_FILENAME  "enNextZX.rom"
+#define LOADER_ROM_SIZE      (64 * 1024)
+#define LOADER_BANK_SIZE     (16 * 1024)
+#define LOADER_N_BANKS       ((MEMORY_SRAM_SIZE - MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM) / LOADER_BANK_SIZE)
+
+#define SNA_HEADER_SIZE      27
+#define SNA_48K_SIZE         (SNA_HEADER_SIZE + 3 * LOADER_BANK_SIZE)
+#define SNA_128K_SIZE        (SNA_48K_SIZE + 4 + 5 * LOADER_BANK_SIZE)
+
+#define Z80_HEADER_SIZE      30
+
+#define NEX_HEADER_SIZE      512
+#define NEX_PALETTE_SIZE     512
+#define NEX_COPPER_SIZE      2048
+
+#define NEX_SCREEN_LAYER2    0x01
+#define NEX_SCREEN_ULA       0x02
+#define NEX_SCREEN_LO_RES    0x04
+#define NEX_SCREEN_HI_RES    0x08
+#define NEX_SCREEN_HI_COLOUR 0x10
+#define NEX_SCREEN_FLAGS_2   0x40
+#define NEX_SCREEN_NO_PALETTE 0x80
+
+#define NEX_SCREEN_2_LAYER2_320X256  1
+#define NEX_SCREEN_2_LAYER2_640X256  2
+
+
+/**
+ * Bytes of a file yet to be consumed.
+ */
+typedef struct loader_data_t {
+  const u8_t* p;
+  size_t      n;
+} loader_data_t;
+
+
+typedef int (*loader_format_t)(loader_data_t* data);
+
+
+static u16_t loader_word(const u8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+
+static u8_t* loader_bank(u8_t bank) {
+  return &memory_sram()[MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM + bank * LOADER_BANK_SIZE];
+}
+
+
+/**
+ * Consumes n bytes, returning where they are or NULL when the file is too
+ * short.
+ */
+static const u8_t* loader_take(loader_data_t* data, size_t n) {
+  const u8_t* p = data->p;
+
+  if (n > data->n) {
+    log_err("loader: file is truncated\n");
+    return NULL;
+  }
+
+  data->p += n;
+  data->n -= n;
+
+  return p;
+}
+
+
+static int loader_bank_take(loader_data_t* data, u8_t bank) {
+  const u8_t* p = loader_take(data, LOADER_BANK_SIZE);
+
+  if (p == NULL) {
+    return -1;
+  }
+
+  memcpy(loader_bank(bank), p, LOADER_BANK_SIZE);
+
+  /* A render thread cannot follow what goes straight into SRAM. */
+  slu_resync();
+
+  return 0;
+}
+
+
+/**
+ * Hard resets into the given machine, with the ROMs in place.
+ */
+static void loader_prepare(machine_type_t machine) {
+  nextreg_write_internal(E_NEXTREG_REGISTER_RESET, 0x02);
+
+  /* Let the CPU act on the reset request. */
+  (void) cpu_step();
+
+  if (utils_load_rom(LOADER_ROM_FILENAME, LOADER_ROM_SIZE, &memory_sram()[MEMORY_RAM_OFFSET_ZX_SPECTRUM_ROM]) != 0) {
+    log_wrn("loader: continuing without ROMs\n");
+  }
+
+  /* Leave config mode, which also disables the boot ROM. */
+  nextreg_write_internal(E_NEXTREG_REGISTER_MACHINE_TYPE, 0x80 | (machine << 4) | machine);
+}
+
+
+/**
+ * Plays back a snapshot's AY registers and selected register.
+ */
+static void loader_ay_set(const u8_t* registers, u8_t selected) {
+  u8_t i;
+
+  for (i = 0; i < 16; i++) {
+    io_write(0xFFFD, i);
+    io_write(0xBFFD, registers[i]);
+  }
+  io_write(0xFFFD, selected);
+}
+
+
+/**
+ * https://worldofspectrum.org/faq/reference/formats.htm
+ */
+static int loader_sna(loader_data_t* data) {
+  const int   is_128k = data->n != SNA_48K_SIZE;
+  const u8_t* header;
+  const u8_t* p;
+  cpu_t*      cpu;
+  u32_t       offset;
+  u8_t        port_7ffd = 0;
+  u8_t        bank;
+
+  if (data->n != SNA_48K_SIZE && data->n != SNA_128K_SIZE && data->n != SNA_128K_SIZE + LOADER_BANK_SIZE) {
+    log_err("loader: not a 48K or 128K snapshot\n");
+    return -1;
+  }
+
+  header = loader_take(data, SNA_HEADER_SIZE);
+  if (is_128k) {
+    port_7ffd = data->p[3 * LOADER_BANK_SIZE + 2];
+  }
+
+  loader_prepare(is_128k ? E_MACHINE_TYPE_ZX_128K_PLUS2 : E_MACHINE_TYPE_ZX_48K);
+
+  (void) loader_bank_take(data, 5);
+  (void) loader_bank_take(data, 2);
+  (void) loader_bank_take(data, is_128k ? port_7ffd & 7 : 0);
+
+  cpu = cpu_get();
+
+  if (is_128k) {
+    p = loader_take(data, 4);
+    cpu->pc.w = loader_word(p);
+
+    /* The other banks follow in order, each one once. */
+    for (bank = 0; bank < 8; bank++) {
+      if (bank != 2 && bank != 5 && bank != (port_7ffd & 7) && loader_bank_take(data, bank) != 0) {
+        return -1;
+      }
+    }
+
+    io_write(0x7FFD, port_7ffd);
+  }
+
+  cpu->ir.b.h  = header[0];
+  cpu->hl_.w   = loader_word(&header[1]);
+  cpu->de_.w   = loader_word(&header[3]);
+  cpu->bc_.w   = loader_word(&header[5]);
+  cpu->af_.w   = loader_word(&header[7]);
+  cpu->hl.w    = loader_word(&header[9]);
+  cpu->de.w    = loader_word(&header[11]);
+  cpu->bc.w    = loader_word(&header[13]);
+  cpu->iy.w    = loader_word(&header[15]);
+  cpu->ix.w    = loader_word(&header[17]);
+  cpu->iff1    = (header[19] & 0x04) ? 1 : 0;
+  cpu->iff2    = cpu->iff1;
+  cpu->ir.b.l  = header[20];
+  cpu->af.w    = loader_word(&header[21]);
+  cpu->sp.w    = loader_word(&header[23]);
+  cpu->im      = header[25] & 3;
+
+  io_write(0x00FE, header[26] & 7);
+
+  if (!is_128k) {
+    /* A 48K snapshot is taken as if in an interrupt, return from it. */
+    if (memory_sram_offset(cpu->sp.w, &offset) == 0) {
+      cpu->pc.b.l = memory_sram()[offset];
+    }
+    if (memory_sram_offset(cpu->sp.w + 1, &offset) == 0) {
+      cpu->pc.b.h = memory_sram()[offset];
+    }
+    cpu->sp.w += 2;
+  }
+
+  return 0;
+}
+
+
+/**
+ * Expands runs of ED ED <count> <value> until the output is full, returning
+ * whether it was.
+ */
+static int loader_z80_unpack(const u8_t* src, size_t n_src, u8_t* dst, size_t n_dst) {
+  size_t i = 0;
+  size_t j = 0;
+  u8_t   n;
+
+  while (i < n_src && j < n_dst) {
+    if (i + 3 < n_src && src[i] == 0xED && src[i + 1] == 0xED) {
+      for (n = src[i + 2]; n > 0 && j < n_dst; n--) {
+        dst[j++] = src[i + 3];
+      }
+      i += 4;
+    } else {
+      dst[j++] = src[i++];
+    }
+  }
+
+  return j == n_dst ? 0 : -1;
+}
+
+
+/**
+ * Maps a version 2 or 3 hardware mode to a machine, returning -1 for
+ * hardware not emulated.
+ */
+static int loader_z80_machine(u8_t hardware, int is_version_2) {
+  switch (hardware) {
+    case 0:
+    case 1:
+      return E_MACHINE_TYPE_ZX_48K;
+
+    case 3:
+      return is_version_2 ? E_MACHINE_TYPE_ZX_128K_PLUS2 : E_MACHINE_TYPE_ZX_48K;
+
+    case 4:
+    case 5:
+    case 6:
+    case 12:
+      return E_MACHINE_TYPE_ZX_128K_PLUS2;
+
+    case 7:
+    case 8:
+    case 13:
+      return E_MACHINE_TYPE_ZX_PLUS2A_PLUS2B_PLUS3;
+
+    case 9:
+      return E_MACHINE_TYPE_PENTAGON;
+
+    default:
+      return -1;
+  }
+}
+
+
+/**
+ * https://worldofspectrum.org/faq/reference/z80format.htm
+ */
+static int loader_z80(loader_data_t* data) {
+  const u8_t* header;
+  const u8_t* extra  = NULL;
+  const u8_t* p;
+  cpu_t*      cpu;
+  u16_t       pc;
+  u16_t       n_extra;
+  u16_t       length;
+  u8_t        flags;
+  int         machine = E_MACHINE_TYPE_ZX_48K;
+  int         bank;
+
+  header = loader_take(data, Z80_HEADER_SIZE);
+  if (header == NULL) {
+    return -1;
+  }
+
+  /* Early snapshots have no room for the bit that is always one now. */
+  flags = (header[12] == 0xFF) ? 0x01 : header[12];
+  pc    = loader_word(&header[6]);
+
+  if (pc == 0) {
+    p = loader_take(data, 2);
+    if (p == NULL) {
+      return -1;
+    }
+    n_extra = loader_word(p);
+
+    extra = loader_take(data, n_extra);
+    if (extra == NULL || n_extra < 23) {
+      return -1;
+    }
+
+    pc      = loader_word(&extra[0]);
+    machine = loader_z80_machine(extra[2], n_extra == 23);
+    if (machine < 0) {
+      log_err("loader: unsupported hardware mode %u\n", extra[2]);
+      return -1;
+    }
+  }
+
+  loader_prepare(machine);
+
+  if (extra == NULL) {
+    /* Version 1 holds 48K, compressed or not. */
+    u8_t* ram = malloc(3 * LOADER_BANK_SIZE);
+    if (ram == NULL) {
+      log_err("loader: out of memory\n");
+      return -1;
+    }
+
+    if (flags & 0x20) {
+      if (loader_z80_unpack(data->p, data->n, ram, 3 * LOADER_BANK_SIZE) != 0) {
+        log_err("loader: file is truncated\n");
+        free(ram);
+        return -1;
+      }
+    } else if (data->n >= 3 * LOADER_BANK_SIZE) {
+      memcpy(ram, data->p, 3 * LOADER_BANK_SIZE);
+    } else {
+      log_err("loader: file is truncated\n");
+      free(ram);
+      return -1;
+    }
+
+    memcpy(loader_bank(5), &ram[0 * LOADER_BANK_SIZE], LOADER_BANK_SIZE);
+    memcpy(loader_bank(2), &ram[1 * LOADER_BANK_SIZE], LOADER_BANK_SIZE);
+    memcpy(loader_bank(0), &ram[2 * LOADER_BANK_SIZE], LOADER_BANK_SIZE);
+    free(ram);
+
+    slu_resync();
+  } else {
+    /* Later versions hold 16K pages, each with its length and number. */
+    while (data->n > 0) {
+      p = loader_take(data, 3);
+      if (p == NULL) {
+        return -1;
+      }
+      length = loader_word(p);
+
+      if (machine == E_MACHINE_TYPE_ZX_48K) {
+        bank = (p[2] == 4) ? 2 : (p[2] == 5) ? 0 : (p[2] == 8) ? 5 : -1;
+      } else {
+        bank = (p[2] >= 3 && p[2] <= 10) ? p[2] - 3 : -1;
+      }
+
+      if (length == 0xFFFF) {
+        length = LOADER_BANK_SIZE;
+        if (data->n < length) {
+          log_err("loader: file is truncated\n");
+          return -1;
+        }
+        if (bank >= 0) {
+          memcpy(loader_bank(bank), data->p, length);
+        }
+      } else if (bank >= 0 && loader_z80_unpack(data->p, length < data->n ? length : data->n, loader_bank(bank), LOADER_BANK_SIZE) != 0) {
+        log_err("loader: file is truncated\n");
+        return -1;
+      }
+
+      slu_resync();
+
+      if (bank < 0) {
+        log_wrn("loader: ignoring page %u\n", p[2]);
+      }
+
+      if (loader_take(data, length) == NULL) {
+        return -1;
+      }
+    }
+
+    if (machine != E_MACHINE_TYPE_ZX_48K) {
+      io_write(0x7FFD, extra[3]);
+      if (machine == E_MACHINE_TYPE_ZX_PLUS2A_PLUS2B_PLUS3 && n_extra >= 55) {
+        io_write(0x1FFD, extra[54]);
+      }
+      loader_ay_set(&extra[7], extra[6]);
+    }
+  }
+
+  cpu          = cpu_get();
+  cpu->af.b.h  = header[0];
+  cpu->af.b.l  = header[1];
+  cpu->bc.w    = loader_word(&header[2]);
+  cpu->hl.w    = loader_word(&header[4]);
+  cpu->pc.w    = pc;
+  cpu->sp.w    = loader_word(&header[8]);
+  cpu->ir.b.h  = header[10];
+  cpu->ir.b.l  = (header[11] & 0x7F) | ((flags & 0x01) << 7);
+  cpu->de.w    = loader_word(&header[13]);
+  cpu->bc_.w   = loader_word(&header[15]);
+  cpu->de_.w   = loader_word(&header[17]);
+  cpu->hl_.w   = loader_word(&header[19]);
+  cpu->af_.b.h = header[21];
+  cpu->af_.b.l = header[22];
+  cpu->iy.w    = loader_word(&header[23]);
+  cpu->ix.w    = loader_word(&header[25]);
+  cpu->iff1    = header[27] ? 1 : 0;
+  cpu->iff2    = header[28] ? 1 : 0;
+  cpu->im      = header[29] & 3;
+
+  io_write(0x00FE, (flags >> 1) & 7);
+
+  return 0;
+}
+
+
+static void loader_nex_palette(const u8_t* palette, u8_t control) {
+  int i;
+
+  nextreg_write_internal(E_NEXTREG_REGISTER_PALETTE_CONTROL, control);
+  nextreg_write_internal(E_NEXTREG_REGISTER_PALETTE_INDEX, 0);
+
+  for (i = 0; i < NEX_PALETTE_SIZE; i++) {
+    nextreg_write_internal(E_NEXTREG_REGISTER_PALETTE_VALUE_9BITS, palette[i]);
+  }
+}
+
+
+/**
+ * Copies a Layer 2 screen into the banks Layer 2 shows.
+ */
+static int loader_nex_layer2(loader_data_t* data, size_t size) {
+  const u8_t* p = loader_take(data, size);
+  u8_t        bank;
+
+  if (p == NULL) {
+    return -1;
+  }
+
+  (void) nextreg_read_internal(E_NEXTREG_REGISTER_LAYER2_ACTIVE_RAM_BANK, &bank);
+  memcpy(loader_bank(bank), p, size);
+  slu_resync();
+
+  /* Visible. */
+  io_write(0x123B, 0x02);
+
+  return 0;
+}
+
+
+/**
+ * Copies a screen split over the two halves of bank 5, as LoRes and the
+ * Timex modes have it.
+ */
+static int loader_nex_split(loader_data_t* data) {
+  const u8_t* p = loader_take(data, 2 * 6144);
+
+  if (p == NULL) {
+    return -1;
+  }
+
+  memcpy(&loader_bank(5)[0x0000], &p[0],    6144);
+  memcpy(&loader_bank(5)[0x2000], &p[6144], 6144);
+  slu_resync();
+
+  return 0;
+}
+
+
+/**
+ * Without NextZXOS there is no open file to hand over, hence programs that
+ * load more from their own file will not find it.
+ */
+static int loader_nex(loader_data_t* data) {
+  const u8_t* header;
+  const u8_t* p;
+  cpu_t*      cpu;
+  u8_t        screens;
+  u8_t        screens_2 = 0;
+  u8_t        value;
+  int         has_copper;
+  int         i;
+
+  header = loader_take(data, NEX_HEADER_SIZE);
+  if (header == NULL || memcmp(header, "Next", 4) != 0) {
+    log_err("loader: not a NEX file\n");
+    return -1;
+  }
+
+  screens    = header[10];
+  has_copper = memcmp(&header[4], "V1.2", 4) >= 0 && header[153];
+  if (screens & NEX_SCREEN_FLAGS_2) {
+    screens_2 = header[152];
+    if (screens_2 != NEX_SCREEN_2_LAYER2_320X256 && screens_2 != NEX_SCREEN_2_LAYER2_640X256) {
+      log_err("loader: unsupported loading screen %u\n", screens_2);
+      return -1;
+    }
+  }
+
+  loader_prepare(E_MACHINE_TYPE_ZX_128K_PLUS2);
+
+  if (!(screens & NEX_SCREEN_NO_PALETTE) && ((screens & (NEX_SCREEN_LAYER2 | NEX_SCREEN_LO_RES)) || screens_2)) {
+    p = loader_take(data, NEX_PALETTE_SIZE);
+    if (p == NULL) {
+      return -1;
+    }
+
+    /* LoRes uses the ULA palette. */
+    loader_nex_palette(p, ((screens & NEX_SCREEN_LO_RES) && !(screens & NEX_SCREEN_LAYER2) && !screens_2) ? 0x00 : 0x10);
+  }
+
+  if ((screens & NEX_SCREEN_LAYER2) && loader_nex_layer2(data, 3 * LOADER_BANK_SIZE) != 0) {
+    return -1;
+  }
+
+  if (screens & NEX_SCREEN_ULA) {
+    p = loader_take(data, 6912);
+    if (p == NULL) {
+      return -1;
+    }
+    memcpy(loader_bank(5), p, 6912);
+    slu_resync();
+  }
+
+  if (screens & NEX_SCREEN_LO_RES) {
+    if (loader_nex_split(data) != 0) {
+      return -1;
+    }
+    (void) nextreg_read_internal(E_NEXTREG_REGISTER_SPRITE_LAYERS_SYSTEM, &value);
+    nextreg_write_internal(E_NEXTREG_REGISTER_SPRITE_LAYERS_SYSTEM, value | 0x80);
+  }
+
+  if (screens & NEX_SCREEN_HI_RES) {
+    if (loader_nex_split(data) != 0) {
+      return -1;
+    }
+    io_write(0x00FF, 0x06 | (header[138] & 0x38));
+  }
+
+  if (screens & NEX_SCREEN_HI_COLOUR) {
+    if (loader_nex_split(data) != 0) {
+      return -1;
+    }
+    io_write(0x00FF, 0x02);
+  }
+
+  if (screens_2) {
+    if (loader_nex_layer2(data, 5 * LOADER_BANK_SIZE) != 0) {
+      return -1;
+    }
+    nextreg_write_internal(E_NEXTREG_REGISTER_LAYER2_CONTROL, (screens_2 == NEX_SCREEN_2_LAYER2_320X256 ? 0x10 : 0x20) | (header[138] & 0x0F));
+  }
+
+  if (has_copper) {
+    p = loader_take(data, NEX_COPPER_SIZE);
+    if (p == NULL) {
+      return -1;
+    }
+
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_CONTROL, 0x00);
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_ADDRESS, 0x00);
+    for (i = 0; i < NEX_COPPER_SIZE; i++) {
+      nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_DATA_8BIT, p[i]);
+    }
+    nextreg_write_internal(E_NEXTREG_REGISTER_COPPER_CONTROL, 0xC0);
+  }
+
+  /* Banks 5, 2, 0, 1, 3, 4, 6, 7, 8 and so on, when present. */
+  for (i = 0; i < LOADER_N_BANKS; i++) {
+    const u8_t bank = (i == 0) ? 5 : (i == 1) ? 2 : (i <= 3) ? i - 2 : (i == 4) ? 3 : (i == 5) ? 4 : i;
+
+    if (header[18 + bank] && loader_bank_take(data, bank) != 0) {
+      return -1;
+    }
+  }
+
+  /* The 48K BASIC ROM, with the entry bank at $C000. */
+  io_write(0x7FFD, 0x10 | (header[139] & 7));
+  nextreg_write_internal(E_NEXTREG_REGISTER_MMU_SLOT6_CONTROL, header[139] * 2);
+  nextreg_write_internal(E_NEXTREG_REGISTER_MMU_SLOT7_CONTROL, header[139] * 2 + 1);
+
+  io_write(0x00FE, header[11] & 7);
+
+  if (loader_word(&header[140]) != 0) {
+    log_wrn("loader: no file handle to pass without NextZXOS\n");
+  }
+
+  cpu       = cpu_get();
+  cpu->sp.w = loader_word(&header[12]);
+  cpu->pc.w = loader_word(&header[14]);
+  cpu->iff1 = 0;
+  cpu->iff2 = 0;
+  cpu->im   = 1;
+
+  return 0;
+}
+
+
+static u8_t* loader_read(const char* filename, size_t* size) {
+  FILE* fp;
+  u8_t* buffer;
+  long  n;
+
+  fp = fopen(filename, "rb");
+  if (fp == NULL) {
+    log_err("loader: error opening %s\n", filename);
+    goto exit;
+  }
+
+  /* Streams have no size to tell. */
+  if (fseek(fp, 0L, SEEK_END) != 0 || (n = ftell(fp)) < 0 || fseek(fp, 0L, SEEK_SET) != 0) {
+    log_err("loader: error seeking in %s\n", filename);
+    goto exit_file;
+  }
+
+  buffer = malloc(n > 0 ? n : 1);
+  if (buffer == NULL) {
+    log_err("loader: out of memory\n");
+    goto exit_file;
+  }
+
+  if (n > 0 && fread(buffer, n, 1, fp) != 1) {
+    log_err("loader: error reading %s\n", filename);
+    goto exit_buffer;
+  }
+
+  fclose(fp);
+
+  *size = n;
+  return buffer;
+
+exit_buffer:
+  free(buffer);
+exit_file:
+  fclose(fp);
+exit:
+  return NULL;
+}
+
+
+/**
+ * Loads a program by the extension of its file name and prepares the CPU
+ * to run it, which must happen between instructions.
+ */
+int loader_load(const char* filename) {
+  const char*     extension = strrchr(filename, '.');
+  loader_format_t format;
+  loader_data_t   data;
+  u8_t*           buffer;
+  size_t          size;
+  int             result;
+
+  if (extension != NULL && strcasecmp(extension, ".nex") == 0) {
+    format = loader_nex;
+  } else if (extension != NULL && strcasecmp(extension, ".sna") == 0) {
+    format = loader_sna;
+  } else if (extension != NULL && strcasecmp(extension, ".z80") == 0) {
+    format = loader_z80;
+  } else {
+    log_err("loader: unknown file type of %s\n", filename);
+    return -1;
+  }
+
+  buffer = loader_read(filename, &size);
+  if (buffer == NULL) {
+    return -1;
+  }
+
+  data.p = buffer;
+  data.n = size;
+  result = format(&data);
+
+  free(buffer);
+
+  if (result == 0) {
+    cpu_get()->is_halted = 0;
+  }
+
+  return result;
+}
@@ -0,0 +1,8 @@
+#ifndef __LOADER_H
+#define __LOADER_H
+
+
+int loader_load(const char* filename);
+
+
+#endif  /* __LOADER_H */
@@ -0,0 +1,340 @@
+#include <SDL2/SDL.h>
+#include "altrom.h"
+#include "audio.h"
+#include "ay.h"
+#include "bootrom.h"
+#include "clock.h"
+#include "config.h"
+#include "copper.h"
+#include "cpu.h"
+#include "dac.h"
+#include "debug.h"
+#include "defs.h"
+#include "divmmc.h"
+#include "dma.h"
+#include "esp.h"
+#include "gdb.h"
+#include "i2c.h"
+#include "io.h"
+#include "joystick.h"
+#include "keyboard.h"
+#include "layer2.h"
+#include "log.h"
+#include "machine.h"
+#include "memory.h"
+#include "mf.h"
+#include "mmu.h"
+#include "mouse.h"
+#include "nextreg.h"
+#include "paging.h"
+#include "palette.h"
+#include "replay.h"
+#include "rewind.h"
+#include "rom.h"
+#include "rtc.h"
+#include "sdcard.h"
+#include "slu.h"
+#include "spi.h"
+#include "sprites.h"
+#include "stats.h"
+#include "tilemap.h"
+#include "uart.h"
+#include "ula.h"
+#include "utils.h"
+
+
+/**
+ * Brings up all modules that make up a Next, in dependency order, and takes
+ * them down again. Shared by the emulator and the embedding library, which
+ * supply the host side: the audio device, the texture frames are presented
+ * on, if any, and the game controllers.
+ */
+
+
+int machine_init(SDL_AudioDeviceID audio_device, SDL_Renderer* renderer, SDL_Texture* texture, SDL_GameController* controller_left, SDL_GameController* controller_right, u16_t gdb_port) {
+  u8_t* sram;
+
+  if (stats_init() != 0) {
+    goto exit;
+  }
+
+  if (rewind_init() != 0) {
+    goto exit_stats;
+  }
+
+  if (audio_init(audio_device) != 0) {
+    goto exit_rewind;
+  }
+
+  if (ay_init() != 0) {
+    goto exit_audio;
+  }
+
+  if (joystick_init(controller_left, controller_right) != 0) {
+    goto exit_ay;
+  }
+
+  if (utils_init() != 0) {
+    goto exit_joystick;
+  }
+
+  if (rtc_init() != 0) {
+    goto exit_utils;
+  }
+
+  if (i2c_init() != 0) {
+    goto exit_rtc;
+  }
+
+  if (sdcard_init() != 0) {
+    goto exit_i2c;
+  }
+
+  if (spi_init() != 0) {
+    goto exit_sdcard;
+  }
+
+  if (esp_init() != 0) {
+    goto exit_spi;
+  }
+
+  if (uart_init() != 0) {
+    goto exit_esp;
+  }
+
+  if (palette_init() != 0) {
+    goto exit_uart;
+  }
+
+  if (nextreg_init() != 0) {
+    goto exit_palette;
+  }
+
+  if (io_init() != 0) {
+    goto exit_nextreg;
+  }
+
+  if (dac_init() != 0) {
+    goto exit_io;
+  }
+
+  if (memory_init() != 0) {
+    goto exit_dac;
+  }
+
+  sram = memory_sram();
+
+  if (dma_init(sram) != 0) {
+    goto exit_memory;
+  }
+
+  if (bootrom_init(sram) != 0) {
+    goto exit_dma;
+  }
+
+  if (config_init(sram) != 0) {
+    goto exit_bootrom;
+  }
+
+  if (altrom_init(sram) != 0) {
+    goto exit_config;
+  }
+
+  if (rom_init(sram) != 0) {
+    goto exit_altrom;
+  }
+
+  if (mmu_init(sram) != 0) {
+    goto exit_rom;
+  }
+
+  if (paging_init() != 0) {
+    goto exit_mmu;
+  }
+
+  if (divmmc_init(sram) != 0) {
+    goto exit_paging;
+  }
+
+  if (mf_init(sram) != 0) {
+    goto exit_divmmc;
+  }
+
+  if (clock_init() != 0) {
+    goto exit_mf;
+  }
+
+  if (keyboard_init() != 0) {
+    goto exit_clock;
+  }
+
+  if (mouse_init() != 0) {
+    goto exit_keyboard;
+  }
+
+  if (replay_init() != 0) {
+    goto exit_mouse;
+  }
+
+  if (ula_init(sram) != 0) {
+    goto exit_replay;
+  }
+
+  if (layer2_init(sram) != 0) {
+    goto exit_ula;
+  }
+
+  if (tilemap_init(sram) != 0) {
+    goto exit_layer2;
+  }
+
+  if (sprites_init() != 0) {
+    goto exit_tilemap;
+  }
+
+  if (slu_init(renderer, texture) != 0) {
+    goto exit_sprites;
+  }
+
+  if (copper_init() != 0) {
+    goto exit_slu;
+  }
+
+  if (cpu_init() != 0) {
+    goto exit_copper;
+  }
+
+  if (debug_init() != 0) {
+    goto exit_cpu;
+  }
+
+  if (gdb_init(gdb_port) != 0) {
+    goto exit_debug;
+  }
+
+  memory_refresh_accessors(0, 8);
+
+  return 0;
+
+exit_debug:
+  debug_finit();
+exit_cpu:
+  cpu_finit();
+exit_copper:
+  copper_finit();
+exit_slu:
+  slu_finit();
+exit_sprites:
+  sprites_finit();
+exit_tilemap:
+  tilemap_finit();
+exit_layer2:
+  layer2_finit();
+exit_ula:
+  ula_finit();
+exit_replay:
+  replay_finit();
+exit_mouse:
+  mouse_finit();
+exit_keyboard:
+  keyboard_finit();
+exit_clock:
+  clock_finit();
+exit_mf:
+  mf_finit();
+exit_divmmc:
+  divmmc_finit();
+exit_paging:
+  paging_finit();
+exit_mmu:
+  mmu_finit();
+exit_rom:
+  rom_finit();
+exit_altrom:
+  altrom_finit();
+exit_config:
+  config_finit();
+exit_bootrom:
+  bootrom_finit();
+exit_dma:
+  dma_finit();
+exit_memory:
+  memory_finit();
+exit_dac:
+  dac_finit();
+exit_io:
+  io_finit();
+exit_nextreg:
+  nextreg_finit();
+exit_palette:
+  palette_finit();
+exit_uart:
+  uart_finit();
+exit_esp:
+  esp_finit();
+exit_spi:
+  spi_finit();
+exit_sdcard:
+  sdcard_finit();
+exit_i2c:
+  i2c_finit();
+exit_rtc:
+  rtc_finit();
+exit_utils:
+  utils_finit();
+exit_joystick:
+  joystick_finit();
+exit_ay:
+  ay_finit();
+exit_audio:
+  audio_finit();
+exit_rewind:
+  rewind_finit();
+exit_stats:
+  stats_finit();
+exit:
+  return -1;
+}
+
+
+void machine_finit(void) {
+  gdb_finit();
+  debug_finit();
+  cpu_finit();
+  copper_finit();
+  slu_finit();
+  sprites_finit();
+  tilemap_finit();
+  layer2_finit();
+  ula_finit();
+  replay_finit();
+  mouse_finit();
+  keyboard_finit();
+  clock_finit();
+  mf_finit();
+  divmmc_finit();
+  paging_finit();
+  mmu_finit();
+  rom_finit();
+  altrom_finit();
+  config_finit();
+  bootrom_finit();
+  dma_finit();
+  memory_finit();
+  dac_finit();
+  io_finit();
+  nextreg_finit();
+  palette_finit();
+  uart_finit();
+  esp_finit();
+  spi_finit();
+  sdcard_finit();
+  i2c_finit();
+  rtc_finit();
+  utils_finit();
+  joystick_finit();
+  ay_finit();
+  audio_finit();
+  rewind_finit();
+  stats_finit();
+}
@@ -0,0 +1,13 @@
+#ifndef __MACHINE_H
+#define __MACHINE_H
+
+
+#include <SDL2/SDL.h>
+#include "defs.h"
+
+
+int  machine_init(SDL_AudioDeviceID audio_device, SDL_Renderer* renderer, SDL_Texture* texture, SDL_GameController* controller_left, SDL_GameController* controller_right, u16_t gdb_port);
+void machine_finit(void);
+
+
+#endif  /* __MACHINE_H */
@@ -3,6 +3,7 @@
 #include "altrom.h"
 #include "audio.h"
 #include "ay.h"
+#include "bench.h"
 #include "bootrom.h"
 #include "clock.h"
 #include "config.h"
@@ -10,6 +11,7 @@
 #include "cpu.h"
 #include "dac.h"
 #include "debug.h"
+#include "gdb.h"
 #include "dma.h"
 #include "defs.h"
 #include "divmmc.h"
@@ -19,7 +21,9 @@
 #include "joystick.h"
 #include "keyboard.h"
 #include "layer2.h"
+#include "loader.h"
 #include "log.h"
+#include "machine.h"
 #include "memory.h"
 #include "mf.h"
 #include "mmu.h"
@@ -28,11 +32,14 @@
 #include "sprites.h"
 #include "paging.h"
 #include "palette.h"
+#include "replay.h"
+#include "rewind.h"
 #include "rom.h"
 #include "rtc.h"
 #include "sdcard.h"
 #include "slu.h"
 #include "spi.h"
+#include "stats.h"
 #include "tilemap.h"
 #include "uart.h"
 #include "ula.h"
@@ -48,6 +55,8 @@ typedef enum main_task_t {
   E_MAIN_TASK_RESET_HARD,
   E_MAIN_TASK_RESET_SOFT,
   E_MAIN_TASK_DEBUG,
+  E_MAIN_TASK_GDB,
+  E_MAIN_TASK_SNAPSHOT,
   E_MAIN_TASK_QUIT
 } main_task_t;
 
@@ -61,19 +70,22 @@ typedef struct self_t {
   SDL_GameController* controller_right;
   const u8_t*         keyboard_state;
   int                 is_windowed;
+  int                 is_headless;
   int                 is_function_key_down;
   main_task_t         task;
   int                 is_60hz;
   cpu_speed_t         speed;
   machine_type_t      machine;
   timing_t            timing;
+  int                 speed_percent;
+  int                 fps;
 } self_t;
 
 
 static self_t self;
 
 
-static int main_init(void) {
+static int main_init(int is_headless, u16_t gdb_port) {
   SDL_DisplayMode mode = {
     .format       = MAIN_PIXELFORMAT,
     .w            = FULLSCREEN_MIN_WIDTH,
@@ -83,15 +95,22 @@ static int main_init(void) {
 
   SDL_AudioSpec want;
   SDL_AudioSpec have;
-  u8_t*         sram;
   int           i;
 
   memset(&self, 0, sizeof(self));
 
+  self.is_headless = is_headless;
+
   if (log_init() != 0) {
     goto exit;
   }
 
+  if (self.is_headless) {
+    /* Allow running without a display or sound card, unless told otherwise. */
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    setenv("SDL_AUDIODRIVER", "dummy", 0);
+  }
+
   if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_GAMECONTROLLER) < 0) {
     log_err("SDL_Init: %s\n", SDL_GetError());
     goto exit_log;
@@ -132,7 +151,7 @@ static int main_init(void) {
     goto exit_sdl;
   }
 
-  self.renderer = SDL_CreateRenderer(self.window, -1, SDL_RENDERER_ACCELERATED);
+  self.renderer = SDL_CreateRenderer(self.window, -1, self.is_headless ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED);
   if (self.renderer == NULL) {
     log_err("main: SDL_CreateRenderer error: %s\n", SDL_GetError());
     goto exit_sdl;
@@ -191,150 +210,10 @@ static int main_init(void) {
     goto exit_sdl;
   }
 
-  if (audio_init(self.audio_device) != 0) {
+  if (machine_init(self.audio_device, self.renderer, self.texture, self.controller_left, self.controller_right, gdb_port) != 0) {
     goto exit_sdlnet;
   }
 
-  if (ay_init() != 0) {
-    goto exit_audio;
-  }
-
-  if (joystick_init(self.controller_left, self.controller_right) != 0) {
-    goto exit_ay;
-  }
-
-  if (utils_init() != 0) {
-    goto exit_joystick;
-  }
-
-  if (rtc_init() != 0) {
-    goto exit_utils;
-  }
-
-  if (i2c_init() != 0) {
-    goto exit_rtc;
-  }
-
-  if (sdcard_init() != 0) {
-    goto exit_i2c;
-  }
-
-  if (spi_init() != 0) {
-    goto exit_sdcard;
-  }
-
-  if (esp_init() != 0) {
-    goto exit_spi;
-  }
-
-  if (uart_init() != 0) {
-    goto exit_esp;
-  }
-
-  if (palette_init() != 0) {
-    goto exit_uart;
-  }
-
-  if (nextreg_init() != 0) {
-    goto exit_palette;
-  }
-
-  if (io_init() != 0) {
-    goto exit_nextreg;
-  }
-
-  if (dac_init() != 0) {
-    goto exit_io;
-  }
-
-  if (memory_init() != 0) {
-    goto exit_dac;
-  }
-
-  sram = memory_sram();
-
-  if (dma_init(sram) != 0) {
-    goto exit_memory;
-  }
-
-  if (bootrom_init(sram) != 0) {
-    goto exit_dma;
-  }
-
-  if (config_init(sram) != 0) {
-    goto exit_bootrom;
-  }
-
-  if (altrom_init(sram) != 0) {
-    goto exit_config;
-  }
-
-  if (rom_init(sram) != 0) {
-    goto exit_altrom;
-  }
-
-  if (mmu_init(sram) != 0) {
-    goto exit_rom;
-  }
-
-  if (paging_init() != 0) {
-    goto exit_mmu;
-  }
-
-  if (divmmc_init(sram) != 0) {
-    goto exit_paging;
-  }
-
-  if (mf_init(sram) != 0) {
-    goto exit_divmmc;
-  }
-
-  if (clock_init() != 0) {
-    goto exit_mf;
-  }
-
-  if (keyboard_init() != 0) {
-    goto exit_clock;
-  }
-
-  if (mouse_init() != 0) {
-    goto exit_keyboard;
-  }
-
-  if (ula_init(sram) != 0) {
-    goto exit_mouse;
-  }
-
-  if (layer2_init(sram) != 0) {
-    goto exit_ula;
-  }
-
-  if (tilemap_init(sram) != 0) {
-    goto exit_layer2;
-  }
-
-  if (sprites_init() != 0) {
-    goto exit_tilemap;
-  }
-
-  if (slu_init(self.renderer, self.texture) != 0) {
-    goto exit_sprites;
-  }
-
-  if (copper_init() != 0) {
-    goto exit_slu;
-  }
-
-  if (cpu_init() != 0) {
-    goto exit_copper;
-  }
-
-  if (debug_init() != 0) {
-    goto exit_cpu;
-  }
-
-  memory_refresh_accessors(0, 8);
-
   self.is_60hz = ula_60hz_get();
   self.machine = ula_timing_get();
   self.speed   = clock_cpu_speed_get();
@@ -342,74 +221,6 @@ static int main_init(void) {
 
   return 0;
 
-exit_cpu:
-  cpu_finit();
-exit_copper:
-  copper_finit();
-exit_slu:
-  slu_finit();
-exit_sprites:
-  sprites_finit();
-exit_tilemap:
-  tilemap_finit();
-exit_layer2:
-  layer2_finit();
-exit_ula:
-  ula_finit();
-exit_mouse:
-  mouse_finit();
-exit_keyboard:
-  keyboard_finit();
-exit_clock:
-  clock_finit();
-exit_mf:
-  mf_finit();
-exit_divmmc:
-  divmmc_finit();
-exit_paging:
-  paging_finit();
-exit_mmu:
-  mmu_finit();
-exit_rom:
-  rom_finit();
-exit_altrom:
-  altrom_finit();
-exit_config:
-  config_finit();
-exit_bootrom:
-  bootrom_finit();
-exit_dma:
-  dma_finit();
-exit_memory:
-  memory_finit();
-exit_dac:
-  dac_finit();
-exit_io:
-  io_finit();
-exit_nextreg:
-  nextreg_finit();
-exit_palette:
-  palette_finit();
-exit_uart:
-  uart_finit();
-exit_esp:
-  esp_finit();
-exit_spi:
-  spi_finit();
-exit_sdcard:
-  sdcard_finit();
-exit_i2c:
-  i2c_finit();
-exit_rtc:
-  rtc_finit();
-exit_utils:
-  utils_finit();
-exit_joystick:
-  joystick_finit();
-exit_ay:
-  ay_finit();
-exit_audio:
-  audio_finit();
 exit_sdlnet:
   SDLNet_Quit();
 exit_sdl:
@@ -562,7 +373,7 @@ static void main_eventloop(void) {
 
   while (self.task != E_MAIN_TASK_QUIT) {
     if (cpu_run((int *) &self.task)) {
-      if (debug_enter()) {
+      if (gdb_is_attached() ? gdb_stop() : debug_enter()) {
         self.task = E_MAIN_TASK_QUIT;
       }
     }
@@ -572,6 +383,11 @@ static void main_eventloop(void) {
       self.task = E_MAIN_TASK_NONE;
     } else if (self.task == E_MAIN_TASK_DEBUG) {
       self.task = debug_enter() ? E_MAIN_TASK_QUIT : E_MAIN_TASK_NONE;
+    } else if (self.task == E_MAIN_TASK_GDB) {
+      self.task = gdb_stop() ? E_MAIN_TASK_QUIT : E_MAIN_TASK_NONE;
+    } else if (self.task == E_MAIN_TASK_SNAPSHOT) {
+      rewind_snapshot();
+      self.task = E_MAIN_TASK_NONE;
     }
   }
 
@@ -580,41 +396,7 @@ static void main_eventloop(void) {
 
 
 static void main_finit(void) {
-  debug_finit();
-  cpu_finit();
-  copper_finit();
-  slu_finit();
-  sprites_finit();
-  tilemap_finit();
-  layer2_finit();
-  ula_finit();
-  mouse_finit();
-  keyboard_finit();
-  clock_finit();
-  mf_finit();
-  divmmc_finit();
-  paging_finit();
-  mmu_finit();
-  rom_finit();
-  altrom_finit();
-  config_finit();
-  bootrom_finit();
-  dma_finit();
-  memory_finit();
-  dac_finit();
-  io_finit();
-  nextreg_finit();
-  palette_finit();
-  uart_finit();
-  esp_finit();
-  spi_finit();
-  sdcard_finit();
-  i2c_finit();
-  rtc_finit();
-  utils_finit();
-  joystick_finit();
-  ay_finit();
-  audio_finit();
+  machine_finit();
   SDLNet_Quit();
   if (self.controller_left) {
     SDL_GameControllerClose(self.controller_left);
@@ -636,29 +418,135 @@ u32_t main_next_host_sync_get(u32_t freq_28mhz) {
 }
 
 
+/**
+ * Snapshots have to wait for the instruction in flight to complete.
+ */
+void main_frame_completed(void) {
+  if (rewind_is_enabled() && self.task == E_MAIN_TASK_NONE) {
+    self.task = E_MAIN_TASK_SNAPSHOT;
+  }
+}
+
+
 void main_sync(void) {
   /* Perform these housekeeping tasks in downtime. */
-  joystick_refresh();
-  mouse_refresh();
-  main_handle_function_keys();
+  if (!replay_is_replaying()) {
+    joystick_refresh();
+    mouse_refresh();
+  }
+
+  if (gdb_sync() && self.task == E_MAIN_TASK_NONE) {
+    self.task = E_MAIN_TASK_GDB;
+  }
 
   if (SDL_QuitRequested()) {
     self.task = E_MAIN_TASK_QUIT;
   }
 
-  audio_sync();
+  /* Record or replay input, now that the host events have been pumped. */
+  if (replay_sync()) {
+    self.task = E_MAIN_TASK_QUIT;
+  }
+
+  /* The emulation sees the keys as they are now until the next sync. */
+  keyboard_sync();
+  main_handle_function_keys();
+
+  /* Headless runs are not paced by the audio device. */
+  if (!self.is_headless) {
+    audio_sync();
+  }
+
+  if (replay_is_deterministic()) {
+    audio_flush();
+  }
 }
 
 
 int main(int argc, char* argv[]) {
-  if (main_init() != 0) {
+  int           is_uart_unlimited = 0;
+  int           is_rewind         = 0;
+  int           is_render_thread  = 0;
+  replay_mode_t replay_mode       = E_REPLAY_MODE_OFF;
+  const char*   replay_filename   = NULL;
+  const char*   load_filename     = NULL;
+  int           is_bench;
+  int           gdb_port;
+  int           result = 0;
+
+  /* Leading options, the remaining ones select what to run. */
+  while (argc > 1) {
+    if (strcmp(argv[1], "--uart-unlimited") == 0) {
+      is_uart_unlimited = 1;
+    } else if (strcmp(argv[1], "--rewind") == 0) {
+      is_rewind = 1;
+    } else if (strcmp(argv[1], "--render-thread") == 0) {
+      is_render_thread = 1;
+    } else if (strcmp(argv[1], "--deterministic") == 0) {
+      replay_mode = E_REPLAY_MODE_DETERMINISTIC;
+    } else if (argc > 2 && strcmp(argv[1], "--record") == 0) {
+      replay_mode     = E_REPLAY_MODE_RECORD;
+      replay_filename = argv[2];
+      argc--;
+      argv++;
+    } else if (argc > 2 && strcmp(argv[1], "--replay") == 0) {
+      replay_mode     = E_REPLAY_MODE_REPLAY;
+      replay_filename = argv[2];
+      argc--;
+      argv++;
+    } else if (argc > 2 && strcmp(argv[1], "--load") == 0) {
+      load_filename = argv[2];
+      argc--;
+      argv++;
+    } else {
+      break;
+    }
+    argc--;
+    argv++;
+  }
+
+  is_bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+  gdb_port = (argc > 2 && strcmp(argv[1], "--gdb") == 0) ? atoi(argv[2]) : 0;
+
+  if (main_init(is_bench, gdb_port) != 0) {
+    return 1;
+  }
+
+  /* ESP bytes move as fast as the Z80 reads and writes them. */
+  uart_unlimited_set(is_uart_unlimited);
+
+  if (replay_mode != E_REPLAY_MODE_OFF) {
+    if (replay_start(replay_mode, replay_filename) != 0) {
+      main_finit();
+      return 1;
+    }
+    self.keyboard_state = keyboard_state_get();
+  }
+
+  if (is_rewind) {
+    (void) rewind_enable(1);
+  }
+
+  /* Run a program without booting from the SD card. */
+  if (load_filename != NULL && loader_load(load_filename) != 0) {
+    main_finit();
     return 1;
   }
 
-  main_eventloop();
+  /* Render frames while the next one is emulated. */
+  if (is_render_thread && slu_pipeline_start() != 0) {
+    log_wrn("main: rendering frames without a render thread\n");
+  }
+
+  if (is_bench) {
+    result = bench_run(argc - 2, &argv[2]) != 0;
+  } else {
+    main_eventloop();
+  }
+
   main_finit();
 
-  return 0;
+  return result;
 }
 
 
@@ -673,10 +561,10 @@ static void main_update_title(void) {
     "VGA", "VGA1", "VGA2", "VGA3", "VGA4", "VGA5", "VGA6", "HDMI"
   };
 
-  char title[40];
+  char title[64];
   int  n = 0;
 
-  (void) snprintf(&title[n], sizeof(title), "zxnxt - %sMHz %s %dHz %s", mhz[self.speed], machines[self.machine], self.is_60hz ? 60 : 50, timings[self.timing]);
+  (void) snprintf(&title[n], sizeof(title), "zxnxt - %sMHz %s %dHz %s - %d%% %dfps", mhz[self.speed], machines[self.machine], self.is_60hz ? 60 : 50, timings[self.timing], self.speed_percent, self.fps);
                 
   SDL_SetWindowTitle(self.window, title);
 }
@@ -712,3 +600,12 @@ void main_show_cpu_speed(cpu_speed_t speed) {
     main_update_title();
   }
 }
+
+
+void main_show_stats(int speed_percent, int fps) {
+  if (self.speed_percent != speed_percent || self.fps != fps) {
+    self.speed_percent = speed_percent;
+    self.fps           = fps;
+    main_update_title();
+  }
+}
@@ -1,6 +1,8 @@
+#include <string.h>
 #include "altrom.h"
 #include "bootrom.h"
 #include "config.h"
+#include "debug.h"
 #include "defs.h"
 #include "divmmc.h"
 #include "layer2.h"
@@ -9,6 +11,7 @@
 #include "mmu.h"
 #include "memory.h"
 #include "rom.h"
+#include "slu.h"
 #include "ula.h"
 #include "utils.h"
 
@@ -22,23 +25,39 @@
 
 #define ADDRESS_SPACE_SIZE  0x10000
 #define ADDRESS_PAGE_SIZE   0x2000
+#define N_SRAM_PAGES        (MEMORY_SRAM_SIZE / MEMORY_SRAM_PAGE_SIZE)
+
+/* Seeds the xorshift generator that fills SRAM on power on. */
+#define MEMORY_SRAM_SEED    0x2A5F1E3D
 
 
 typedef u8_t (*reader_t)(u16_t address);
 typedef void (*writer_t)(u16_t address, u8_t value);
+typedef u32_t (*translator_t)(u16_t address);
 
 
 typedef struct memory_t {
-  u8_t*    sram;
-  reader_t readers[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
-  writer_t writers[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
+  u8_t*        sram;
+  reader_t     readers[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];          /* Decoded or trapping. */
+  writer_t     writers[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
+  reader_t     decoded_readers[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
+  writer_t     decoded_writers[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
+  translator_t translators[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];      /* Follows the decoded readers. */
+  translator_t write_translators[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
+  int          trap_reads[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
+  int          trap_writes[ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE];
+  int          is_tracking_dirty;
+  int          is_logging_video;                                        /* For the render thread, see slu.c. */
+  u8_t         is_dirty[N_SRAM_PAGES];
+  const u8_t*  automap_candidates;                                      /* Bit per address, owned by the divMMC. */
 } memory_t;
 
 
-static memory_t self;
+static MACHINE_LOCAL memory_t self;
 
 
 int memory_init(void) {
+  u32_t  seed = MEMORY_SRAM_SEED;
   size_t i;
 
   self.sram = malloc(MEMORY_SRAM_SIZE);
@@ -47,8 +66,12 @@ int memory_init(void) {
     return -1;
   }
 
+  /* Random, yet identical on every run and every host. */
   for (i = 0; i < MEMORY_SRAM_SIZE; i++) {
-    self.sram[i] = rand() % 256;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    self.sram[i] = seed & 0xFF;
   }
 
   return 0;
@@ -157,28 +180,51 @@ void memory_contend(u16_t address) {
 
 
 static const struct {
-  reader_t    reader;
-  writer_t    writer;
-  const char* description;
+  reader_t     reader;
+  writer_t     writer;
+  translator_t translator;  /* NULL when not backed by SRAM. */
+  const char*  description;
 } descriptions[] = {
-  { altrom_read,     altrom_write,     "alt ROM"    },
-  { bootrom_read,    bootrom_write,    "boot ROM"   },
-  { config_read,     config_write,     "config"     },
-  { divmmc_ram_read, divmmc_ram_write, "divMMC RAM" },
-  { divmmc_rom_read, divmmc_rom_write, "divMMC ROM" },
-  { layer2_read,     layer2_write,     "layer 2"    },
-  { mf_ram_read,     mf_ram_write,     "MF RAM"     },
-  { mf_rom_read,     mf_rom_write,     "MF ROM"     },
-  { mmu_read,        mmu_write,        "MMU"        },
-  { rom_read,        rom_write,        "ROM"        },
+  { altrom_read,     altrom_write,     altrom_sram_offset,     "alt ROM"    },
+  { bootrom_read,    bootrom_write,    NULL,                   "boot ROM"   },
+  { config_read,     config_write,     config_sram_offset,     "config"     },
+  { divmmc_ram_read, divmmc_ram_write, divmmc_ram_sram_offset, "divMMC RAM" },
+  { divmmc_rom_read, divmmc_rom_write, divmmc_rom_sram_offset, "divMMC ROM" },
+  { layer2_read,     layer2_write,     layer2_sram_offset,     "layer 2"    },
+  { mf_ram_read,     mf_ram_write,     mf_ram_sram_offset,     "MF RAM"     },
+  { mf_rom_read,     mf_rom_write,     mf_rom_sram_offset,     "MF ROM"     },
+  { mmu_read,        mmu_write,        mmu_sram_offset,        "MMU"        },
+  { rom_read,        rom_write,        rom_sram_offset,        "ROM"        },
 };
 
 
+static translator_t pick_translator(reader_t reader) {
+  for (size_t i = 0; i < sizeof(descriptions) / sizeof(*descriptions); i++) {
+    if (reader == descriptions[i].reader) {
+      return descriptions[i].translator;
+    }
+  }
+
+  return NULL;
+}
+
+
+static translator_t pick_write_translator(writer_t writer) {
+  for (size_t i = 0; i < sizeof(descriptions) / sizeof(*descriptions); i++) {
+    if (writer == descriptions[i].writer) {
+      return descriptions[i].translator;
+    }
+  }
+
+  return NULL;
+}
+
+
 void memory_describe_accessor(int page, const char** reader, const char** writer) {
   if (reader != NULL) {
     *reader = "?";
     for (size_t i = 0; i < sizeof(descriptions) / sizeof(*descriptions); i++) {
-      if (self.readers[page] == descriptions[i].reader) {
+      if (self.decoded_readers[page] == descriptions[i].reader) {
         *reader = descriptions[i].description;
         break;
       }
@@ -188,7 +234,7 @@ void memory_describe_accessor(int page, const char** reader, const char** writer
   if (writer != NULL) {
     *writer = "?";
     for (size_t i = 0; i < sizeof(descriptions) / sizeof(*descriptions); i++) {
-      if (self.writers[page] == descriptions[i].writer) {
+      if (self.decoded_writers[page] == descriptions[i].writer) {
         *writer = descriptions[i].description;
         break;
       }
@@ -197,13 +243,169 @@ void memory_describe_accessor(int page, const char** reader, const char** writer
 }
 
 
+/**
+ * Trapping accessors report every access to the debugger, for watchpoints.
+ */
+static u8_t memory_trap_read(u16_t address) {
+  const u8_t page  = address / ADDRESS_PAGE_SIZE;
+  const u8_t value = self.decoded_readers[page](address);
+
+  debug_watch_access(E_DEBUG_WATCH_MEMORY, address, value, 0);
+
+  return value;
+}
+
+
+/**
+ * Marks the SRAM page behind a logical page as dirty. Every mapping keeps
+ * 8K pages intact, hence one address tells for the whole logical page.
+ */
+static void memory_mark_dirty(u16_t address) {
+  const u8_t page = address / ADDRESS_PAGE_SIZE;
+
+  if (self.write_translators[page] != NULL) {
+    self.is_dirty[self.write_translators[page](address) / MEMORY_SRAM_PAGE_SIZE] = 1;
+  }
+}
+
+
+/**
+ * Hands what a write leaves in video RAM to the render thread, which keeps
+ * a copy of its own.
+ */
+static void memory_logged_write(u16_t address, u8_t value) {
+  const u8_t  page   = address / ADDRESS_PAGE_SIZE;
+  const u32_t offset = self.write_translators[page](address);
+
+  self.decoded_writers[page](address, value);
+
+  if (offset >= MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM) {
+    slu_sram_written(offset, self.sram[offset]);
+  }
+}
+
+
+/**
+ * The writer a logical page settles on, once nothing needs to see its next
+ * write.
+ */
+static writer_t memory_settled_writer(int page) {
+  return (self.is_logging_video && self.write_translators[page] != NULL) ? memory_logged_write : self.decoded_writers[page];
+}
+
+
+static void memory_trap_write(u16_t address, u8_t value) {
+  const u8_t page = address / ADDRESS_PAGE_SIZE;
+
+  debug_watch_access(E_DEBUG_WATCH_MEMORY, address, value, 1);
+
+  if (self.is_tracking_dirty) {
+    memory_mark_dirty(address);
+  }
+
+  memory_settled_writer(page)(address, value);
+}
+
+
+/**
+ * Catches the first write to a logical page after it was mapped or after
+ * the dirty pages were last taken, then gets out of the way.
+ */
+static void memory_dirty_write(u16_t address, u8_t value) {
+  const u8_t page = address / ADDRESS_PAGE_SIZE;
+
+  memory_mark_dirty(address);
+  self.writers[page] = memory_settled_writer(page);
+
+  self.writers[page](address, value);
+}
+
+
 void memory_refresh_accessors(int page, int n_pages) {
   int i;
 
   for (i = page; i < page + n_pages; i++) {
-    self.readers[i] = pick_reader(i);
-    self.writers[i] = pick_writer(i);
+    self.decoded_readers[i]   = pick_reader(i);
+    self.decoded_writers[i]   = pick_writer(i);
+    self.translators[i]       = pick_translator(self.decoded_readers[i]);
+    self.write_translators[i] = pick_write_translator(self.decoded_writers[i]);
+    self.readers[i]           = self.trap_reads[i]  ? memory_trap_read  : self.decoded_readers[i];
+    self.writers[i]           = self.trap_writes[i] ? memory_trap_write : self.is_tracking_dirty ? memory_dirty_write : memory_settled_writer(i);
+  }
+}
+
+
+/**
+ * Tells that what a logical page maps to has changed, without changing who
+ * accesses it. Writes to the new SRAM page must be tracked afresh.
+ */
+void memory_remapped(int page, int n_pages) {
+  if (self.is_tracking_dirty) {
+    memory_refresh_accessors(page, n_pages);
+  }
+}
+
+
+void memory_dirty_tracking_enable(int enable) {
+  self.is_tracking_dirty = enable;
+  memset(self.is_dirty, 0, sizeof(self.is_dirty));
+
+  memory_refresh_accessors(0, ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE);
+}
+
+
+/**
+ * Has every write to SRAM the video may show logged for the render thread.
+ */
+void memory_video_logging_enable(int enable) {
+  self.is_logging_video = enable;
+
+  memory_refresh_accessors(0, ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE);
+}
+
+
+/**
+ * Lists the SRAM pages written to since the previous call, and starts
+ * tracking afresh. Returns the number of pages.
+ */
+int memory_dirty_pages_take(u8_t pages[MEMORY_SRAM_SIZE / MEMORY_SRAM_PAGE_SIZE]) {
+  int n = 0;
+  int i;
+
+  for (i = 0; i < N_SRAM_PAGES; i++) {
+    if (self.is_dirty[i]) {
+      self.is_dirty[i] = 0;
+      pages[n++]       = i;
+    }
+  }
+
+  memory_refresh_accessors(0, ADDRESS_SPACE_SIZE / ADDRESS_PAGE_SIZE);
+
+  return n;
+}
+
+
+void memory_trap_set(int page, int trap_reads, int trap_writes) {
+  self.trap_reads[page]  = trap_reads;
+  self.trap_writes[page] = trap_writes;
+
+  memory_refresh_accessors(page, 1);
+}
+
+
+/**
+ * Translates a logical address to the SRAM offset it currently reads from.
+ * Returns -1 when that is not SRAM, such as the boot ROM.
+ */
+int memory_sram_offset(u16_t address, u32_t* offset) {
+  const u8_t page = address / ADDRESS_PAGE_SIZE;
+
+  if (self.translators[page] == NULL) {
+    return -1;
   }
+
+  *offset = self.translators[page](address);
+  return 0;
 }
 
 
@@ -217,6 +419,11 @@ u8_t memory_read_opcode(u16_t address) {
   const u8_t page = address / ADDRESS_PAGE_SIZE;
   u8_t       byte;
 
+  if ((self.automap_candidates[address / 8] & (1 << (address & 7))) == 0) {
+    /* Cannot change the divMMC automap state. */
+    return self.readers[page](address);
+  }
+
   divmmc_automap(address, 1);
 
   byte = self.readers[page](address);
@@ -227,12 +434,84 @@ u8_t memory_read_opcode(u16_t address) {
 }
 
 
+/**
+ * Set by the divMMC, such that opcode fetches need not ask it whether they
+ * change its automap state.
+ */
+void memory_automap_candidates_set(const u8_t* candidates) {
+  self.automap_candidates = candidates;
+}
+
+
 void memory_write(u16_t address, u8_t value) {
   const u8_t page = address / ADDRESS_PAGE_SIZE;
   self.writers[page](address, value);
 }
 
 
+/**
+ * Number of bytes from an address to the end of its 8K page, in the direction
+ * the address moves. Host pointers stay valid for that many bytes.
+ */
+u32_t memory_page_run_length(u16_t address, int delta) {
+  switch (delta) {
+    case +1:
+      return ADDRESS_PAGE_SIZE - (address & (ADDRESS_PAGE_SIZE - 1));
+
+    case -1:
+      return (address & (ADDRESS_PAGE_SIZE - 1)) + 1;
+
+    default:
+      return 0x10000;
+  }
+}
+
+
+/**
+ * Returns where a plain RAM address lives in host memory, so bulk transfers
+ * can bypass the accessors. NULL when the access is not that simple: ROM,
+ * divMMC, multiface, watchpoints, banks subject to contention, or writes
+ * the render thread must hear of.
+ */
+u8_t* memory_host_pointer(u16_t address, int is_write) {
+  const u8_t     page      = address / ADDRESS_PAGE_SIZE;
+  const writer_t writer    = (self.writers[page] == memory_dirty_write) ? self.decoded_writers[page] : self.writers[page];
+  const int      is_mmu    = is_write ? (writer == mmu_write)    : (self.readers[page] == mmu_read);
+  const int      is_layer2 = is_write ? (writer == layer2_write) : (self.readers[page] == layer2_read);
+
+  if (is_write && self.is_logging_video) {
+    return NULL;
+  }
+
+  if (is_write && self.is_tracking_dirty && (is_mmu || is_layer2)) {
+    memory_mark_dirty(address);
+  }
+
+  if (is_mmu) {
+    if (ula_bank_may_contend(mmu_page_get(page) / 2)) {
+      return NULL;
+    }
+    return &self.sram[mmu_sram_offset(address)];
+  }
+
+  if (is_layer2) {
+    return &self.sram[layer2_sram_offset(address)];
+  }
+
+  return NULL;
+}
+
+
+/**
+ * Whether reading an address can currently be delayed by contention.
+ */
+int memory_may_contend(u16_t address) {
+  const u8_t page = address / ADDRESS_PAGE_SIZE;
+
+  return self.decoded_readers[page] == mmu_read && ula_bank_may_contend(mmu_page_get(page) / 2);
+}
+
+
 u8_t* memory_sram(void) {
   return self.sram;
 }
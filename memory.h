@@ -6,6 +6,7 @@
 
 
 #define MEMORY_SRAM_SIZE                    (2 * 1024 * 1024)
+#define MEMORY_SRAM_PAGE_SIZE               0x2000
 
 #define MEMORY_RAM_OFFSET_ZX_SPECTRUM_ROM   0x00000
 #define MEMORY_RAM_OFFSET_DIVMMC_ROM        0x10000
@@ -24,8 +25,18 @@ u8_t  memory_read_opcode(u16_t address);
 void  memory_write(u16_t address, u8_t value);
 void  memory_contend(u16_t address);
 u8_t* memory_sram(void);
+u8_t* memory_host_pointer(u16_t address, int is_write);
+u32_t memory_page_run_length(u16_t address, int delta);
+int   memory_may_contend(u16_t address);
 void  memory_describe_accessor(int page, const char** reader, const char** writer);
 void  memory_refresh_accessors(int page, int n_pages);
+void  memory_remapped(int page, int n_pages);
+int   memory_sram_offset(u16_t address, u32_t* offset);
+void  memory_trap_set(int page, int trap_reads, int trap_writes);
+void  memory_dirty_tracking_enable(int enable);
+void  memory_video_logging_enable(int enable);
+int   memory_dirty_pages_take(u8_t pages[MEMORY_SRAM_SIZE / MEMORY_SRAM_PAGE_SIZE]);
+void  memory_automap_candidates_set(const u8_t* candidates);
 
 
 #endif  /* __MEMORY_H */
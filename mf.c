@@ -5,6 +5,7 @@
 #include "memory.h"
 #include "mf.h"
 #include "paging.h"
+#include "rewind.h"
 
 
 /**
@@ -23,13 +24,16 @@ typedef struct self_t {
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 int mf_init(u8_t* sram) {
   memset(&self, 0, sizeof(self));
   self.sram = sram;
   mf_reset(E_RESET_HARD);
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -130,6 +134,16 @@ void mf_ram_write(u16_t address, u8_t value) {
 }
 
 
+u32_t mf_rom_sram_offset(u16_t address) {
+  return MEMORY_RAM_OFFSET_MF_ROM + address;
+}
+
+
+u32_t mf_ram_sram_offset(u16_t address) {
+  return MEMORY_RAM_OFFSET_MF_RAM + address - 0x2000;
+}
+
+
 void mf_type_set(mf_type_t type) {
   self.type = type;
 
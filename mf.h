@@ -29,6 +29,8 @@ u8_t      mf_rom_read(u16_t address);
 void      mf_rom_write(u16_t address, u8_t value);
 u8_t      mf_ram_read(u16_t address);
 void      mf_ram_write(u16_t address, u8_t value);
+u32_t     mf_rom_sram_offset(u16_t address);
+u32_t     mf_ram_sram_offset(u16_t address);
 
 
 #endif  /* __MF_H */
@@ -2,6 +2,7 @@
 #include "log.h"
 #include "memory.h"
 #include "mmu.h"
+#include "rewind.h"
 #include "ula.h"
 
 
@@ -12,10 +13,11 @@
 typedef struct mmu_t {
   u8_t* ram;
   u8_t  pages[N_SLOTS];
+  u8_t  contended_banks;  /* Bit per bank 0-7, zero when nothing is contended. */
 } mmu_t;
 
 
-static mmu_t self;
+static MACHINE_LOCAL mmu_t self;
 
 
 int mmu_init(u8_t* sram) {
@@ -23,6 +25,8 @@ int mmu_init(u8_t* sram) {
 
   mmu_reset(E_RESET_HARD);
 
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -57,6 +61,8 @@ void mmu_page_set(u8_t slot, u8_t page) {
 
     if (slot < 2 && was_rom != is_rom) {
       memory_refresh_accessors(slot, 1);
+    } else {
+      memory_remapped(slot, 1);
     }
   }
 }
@@ -79,12 +85,23 @@ void mmu_contend(u16_t address) {
 }
 
 
+/**
+ * Set by the ULA, such that accesses need not ask it whether they are
+ * contended.
+ */
+void mmu_contended_banks_set(u8_t banks) {
+  self.contended_banks = banks;
+}
+
+
 static u32_t mmu_translate(u16_t address) {
   const u8_t  slot   = address / PAGE_SIZE;
   const u16_t offset = address & (PAGE_SIZE - 1);
   const u8_t  bank   = self.pages[slot] / 2;
 
-  ula_contend_bank(bank);
+  if (bank < 8 && (self.contended_banks & (1 << bank))) {
+    ula_contend_memory();
+  }
 
   return self.pages[slot] * PAGE_SIZE + offset;
 }
@@ -98,3 +115,14 @@ u8_t mmu_read(u16_t address) {
 void mmu_write(u16_t address, u8_t value) {
   self.ram[mmu_translate(address)] = value;
 }
+
+
+/**
+ * Like mmu_translate(), but without the contention side effect.
+ */
+u32_t mmu_sram_offset(u16_t address) {
+  const u8_t  slot   = address / PAGE_SIZE;
+  const u16_t offset = address & (PAGE_SIZE - 1);
+
+  return MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM + self.pages[slot] * PAGE_SIZE + offset;
+}
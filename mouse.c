@@ -11,7 +11,7 @@ typedef struct mouse_t {
 } mouse_t;
 
 
-static mouse_t self;
+static MACHINE_LOCAL mouse_t self;
 
 
 int mouse_init(void) {
@@ -62,3 +62,10 @@ void mouse_toggle(void) {
 
   self.is_captured = (SDL_GetRelativeMouseMode() == SDL_TRUE);
 }
+
+
+void mouse_set(u8_t x, u8_t y, u8_t buttons) {
+  self.x       = x;
+  self.y       = y;
+  self.buttons = buttons;
+}
@@ -12,6 +12,7 @@ u8_t mouse_read_y(void);
 u8_t mouse_read_buttons(void);
 void mouse_refresh(void);
 void mouse_toggle(void);
+void mouse_set(u8_t x, u8_t y, u8_t buttons);
 
 
 #endif  /* __MOUSE_H */
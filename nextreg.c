@@ -7,6 +7,7 @@
 #include "copper.h"
 #include "cpu.h"
 #include "dac.h"
+#include "debug.h"
 #include "defs.h"
 #include "divmmc.h"
 #include "dma.h"
@@ -22,6 +23,7 @@
 #include "nextreg.h"
 #include "palette.h"
 #include "paging.h"
+#include "rewind.h"
 #include "slu.h"
 #include "sprites.h"
 #include "tilemap.h"
@@ -205,13 +207,33 @@ typedef struct nextreg_t {
   u8_t                     nmi_return_address_lsb;
   u8_t                     nmi_return_address_msb;
   u8_t                     user_register_0;
+  int                      is_watched;
 } nextreg_t;
 
 
-static nextreg_t self;
+static MACHINE_LOCAL nextreg_t self;
 
 
-static void nextreg_cpu_speed_write(u8_t value);
+typedef u8_t (*nextreg_read_t)(u8_t reg);
+typedef void (*nextreg_write_t)(u8_t reg, u8_t value);
+
+
+typedef struct nextreg_handler_t {
+  nextreg_read_t  read;   /* NULL if reads are not implemented. */
+  nextreg_write_t write;  /* NULL if writes are not implemented. */
+} nextreg_handler_t;
+
+
+/* Kept apart from the registers, which a hard reset clears. */
+typedef struct nextreg_dispatch_t {
+  nextreg_handler_t handlers[256];
+} nextreg_dispatch_t;
+
+
+static MACHINE_LOCAL nextreg_dispatch_t dispatch;
+
+
+static void nextreg_handlers_init(void);
 
 
 static const char* nextreg_description(u8_t reg) {
@@ -229,8 +251,12 @@ void nextreg_reset(reset_t reset) {
   log_wrn("nextreg: %s reset\n", reset == E_RESET_SOFT ? "soft" : "hard");
 
   if (reset == E_RESET_HARD) {
+    /* Watchpoints belong to the debugger, not the machine. */
+    const int is_watched = self.is_watched;
+
     memset(&self, 0, sizeof(self));
 
+    self.is_watched                      = is_watched;
     self.is_hard_reset                   = 1;
     self.altrom_soft_reset_during_writes = 1;
     self.is_hotkey_nmi_multiface_enabled = 0;
@@ -279,11 +305,19 @@ void nextreg_reset(reset_t reset) {
 
   nextreg_write_internal(E_NEXTREG_REGISTER_CPU_SPEED, E_CPU_SPEED_3MHZ);
   nextreg_write_internal(E_NEXTREG_REGISTER_TILEMAP_CONTROL, 0x00);
+
+  /* A render thread cannot follow the resets above. */
+  slu_resync();
 }
 
 
 int nextreg_init(void) {
+  nextreg_handlers_init();
   nextreg_reset(E_RESET_HARD);
+
+  /* Watching is up to the debugger. */
+  rewind_register(&self, offsetof(nextreg_t, is_watched), NULL);
+
   return 0;
 }
 
@@ -302,7 +336,7 @@ u8_t nextreg_select_read(u16_t address) {
 }
 
 
-static u8_t nextreg_reset_read(void) {
+static u8_t nextreg_reset_read(u8_t reg) {
   u8_t result = self.is_hard_reset ? 0x02 : 0x01;
   int  nmi_active = cpu_nmi_active();
 
@@ -320,7 +354,7 @@ static u8_t nextreg_reset_read(void) {
 }
 
 
-static void nextreg_reset_write(u8_t value) {
+static void nextreg_reset_write(u8_t reg, u8_t value) {
   log_wrn("nextreg: write reset state $%02X\n", value);
 
   if (value & 0x03) {
@@ -350,13 +384,13 @@ static void nextreg_reset_write(u8_t value) {
 }
 
 
-static void nextreg_config_mapping_write(u8_t value) {
+static void nextreg_config_mapping_write(u8_t reg, u8_t value) {
   /* Only bits 4:0 are specified, but FPGA uses bits 6:0. */
   config_set_rom_ram_bank(value & 0x7F);
 }
 
 
-static u8_t nextreg_machine_type_read(void) {
+static u8_t nextreg_machine_type_read(u8_t reg) {
   u8_t result = self.palette_index_9bit_is_first_write ? 0x00 : 0x80;
 
   switch (ula_timing_get()) {
@@ -399,7 +433,7 @@ static u8_t nextreg_machine_type_read(void) {
 }
 
 
-static void nextreg_machine_type_write(u8_t value) {
+static void nextreg_machine_type_write(u8_t reg, u8_t value) {
   if (value & 0x80) {
     const u8_t machine_type = (value >> 4) & 0x03;
     if (machine_type <= E_MACHINE_TYPE_PENTAGON) {
@@ -429,13 +463,13 @@ static void nextreg_machine_type_write(u8_t value) {
 }
 
 
-static u8_t nextreg_core_boot_read(void) {
+static u8_t nextreg_core_boot_read(u8_t reg) {
   return keyboard_is_special_key_pressed(E_KEYBOARD_SPECIAL_KEY_DRIVE) << 1
        | keyboard_is_special_key_pressed(E_KEYBOARD_SPECIAL_KEY_NMI);
 }
 
 
-static u8_t nextreg_peripheral_1_setting_read(void) {
+static u8_t nextreg_peripheral_1_setting_read(u8_t reg) {
   const u8_t j1 = joystick_type_get(E_JOYSTICK_LEFT);
   const u8_t j2 = joystick_type_get(E_JOYSTICK_RIGHT);
 
@@ -447,21 +481,21 @@ static u8_t nextreg_peripheral_1_setting_read(void) {
 }
 
 
-static void nextreg_peripheral_1_setting_write(u8_t value) {
+static void nextreg_peripheral_1_setting_write(u8_t reg, u8_t value) {
   joystick_type_set(E_JOYSTICK_LEFT, (((value & 0x08) >> 1) | (value & 0xC0) >> 6));
   joystick_type_set(E_JOYSTICK_RIGHT, (((value & 0x02) << 1) | (value & 0x30) >> 4));
   ula_60hz_set(value & 0x04);
 }
 
 
-static u8_t nextreg_peripheral_2_setting_read(void) {
+static u8_t nextreg_peripheral_2_setting_read(u8_t reg) {
   return self.is_hotkey_cpu_speed_enabled     << 7
        | self.is_hotkey_nmi_divmmc_enabled    << 4
        | self.is_hotkey_nmi_multiface_enabled << 3;
 }
 
 
-static void nextreg_peripheral_2_setting_write(u8_t value) {
+static void nextreg_peripheral_2_setting_write(u8_t reg, u8_t value) {
   self.is_hotkey_cpu_speed_enabled     = (value & 0x80) >> 7;
   self.is_hotkey_nmi_divmmc_enabled    = (value & 0x10) >> 4;
   self.is_hotkey_nmi_multiface_enabled = (value & 0x08) >> 3;
@@ -469,7 +503,7 @@ static void nextreg_peripheral_2_setting_write(u8_t value) {
 }
 
 
-static u8_t nextreg_peripheral_3_setting_read(void) {
+static u8_t nextreg_peripheral_3_setting_read(u8_t reg) {
   return !paging_spectrum_128k_paging_is_locked() << 7
        | !ula_contention_get() << 6
        | (ay_stereo_acb_get() != 0) << 5
@@ -477,7 +511,7 @@ static u8_t nextreg_peripheral_3_setting_read(void) {
 }
 
 
-static void nextreg_peripheral_3_setting_write(u8_t value) {
+static void nextreg_peripheral_3_setting_write(u8_t reg, u8_t value) {
   if (value & 0x80) {
     paging_spectrum_128k_paging_unlock();
   }
@@ -490,7 +524,7 @@ static void nextreg_peripheral_3_setting_write(u8_t value) {
 }
 
 
-static u8_t nextreg_peripheral_4_setting_read(void) {
+static u8_t nextreg_peripheral_4_setting_read(u8_t reg) {
   return (ay_mono_enable_get(2) != 0) << 7
        | (ay_mono_enable_get(1) != 0) << 6
        | (ay_mono_enable_get(0) != 0) << 5
@@ -498,7 +532,7 @@ static u8_t nextreg_peripheral_4_setting_read(void) {
 }
 
 
-static void nextreg_peripheral_4_setting_write(u8_t value) {
+static void nextreg_peripheral_4_setting_write(u8_t reg, u8_t value) {
   ay_mono_enable_set(2, value & 0x80);
   ay_mono_enable_set(1, value & 0x40);
   ay_mono_enable_set(0, value & 0x20);
@@ -511,13 +545,13 @@ static void nextreg_peripheral_4_setting_write(u8_t value) {
 }
 
 
-static u8_t nextreg_peripheral_5_setting_read(void) {
+static u8_t nextreg_peripheral_5_setting_read(u8_t reg) {
   /* TODO Return other bits. */
   return (mf_type_get() << 5) | (divmmc_is_automap_enabled() ? 0x10 : 0x00);
 }
 
 
-static void nextreg_peripheral_5_setting_write(u8_t value) {
+static void nextreg_peripheral_5_setting_write(u8_t reg, u8_t value) {
   if (config_is_active()) {
     mf_type_set((value & 0xC0) >> 5);
   }
@@ -526,19 +560,19 @@ static void nextreg_peripheral_5_setting_write(u8_t value) {
 }
 
 
-static u8_t nextreg_cpu_speed_read(void) {
+static u8_t nextreg_cpu_speed_read(u8_t reg) {
   const u8_t speed = clock_cpu_speed_get();
 
   return speed << 4 | speed;
 }
 
 
-static void nextreg_cpu_speed_write(u8_t value) {
+static void nextreg_cpu_speed_write(u8_t reg, u8_t value) {
   clock_cpu_speed_set(value & 0x03);
 }
 
 
-static void nextreg_spectrum_memory_mapping_write(u8_t value) {
+static void nextreg_spectrum_memory_mapping_write(u8_t reg, u8_t value) {
   const int change_bank = value & 0x08;
   const int paging_mode = value & 0x04;
   
@@ -555,7 +589,7 @@ static void nextreg_spectrum_memory_mapping_write(u8_t value) {
 }
 
 
-static void nextreg_alternate_rom_write(u8_t value) {
+static void nextreg_alternate_rom_write(u8_t reg, u8_t value) {
   const int  enable        = value & 0x80;
   const int  during_writes = value & 0x40;
   const u8_t rom           = (value & 0x30) >> 4;
@@ -569,7 +603,7 @@ static void nextreg_alternate_rom_write(u8_t value) {
 }
 
 
-static void nextreg_clip_window_ula_write(u8_t value) {
+static void nextreg_clip_window_ula_write(u8_t reg, u8_t value) {
   self.ula_clip.values[self.ula_clip.index] = value;
 
   if (++self.ula_clip.index == 4) {
@@ -579,7 +613,7 @@ static void nextreg_clip_window_ula_write(u8_t value) {
 }
 
 
-static void nextreg_clip_window_tilemap_write(u8_t value) {
+static void nextreg_clip_window_tilemap_write(u8_t reg, u8_t value) {
   self.tilemap_clip.values[self.tilemap_clip.index] = value;
 
   if (++self.tilemap_clip.index == 4) {
@@ -589,7 +623,7 @@ static void nextreg_clip_window_tilemap_write(u8_t value) {
 }
 
 
-static void nextreg_clip_window_sprites_write(u8_t value) {
+static void nextreg_clip_window_sprites_write(u8_t reg, u8_t value) {
   self.sprites_clip.values[self.sprites_clip.index] = value;
 
   if (++self.sprites_clip.index == 4) {
@@ -599,7 +633,7 @@ static void nextreg_clip_window_sprites_write(u8_t value) {
 }
 
 
-static void nextreg_clip_window_layer2_write(u8_t value) {
+static void nextreg_clip_window_layer2_write(u8_t reg, u8_t value) {
   self.layer2_clip.values[self.layer2_clip.index] = value;
 
   if (++self.layer2_clip.index == 4) {
@@ -609,7 +643,7 @@ static void nextreg_clip_window_layer2_write(u8_t value) {
 }
 
 
-static u8_t nextreg_clip_window_control_read(void) {
+static u8_t nextreg_clip_window_control_read(u8_t reg) {
   return self.tilemap_clip.index << 6
        | self.ula_clip.index     << 4
        | self.sprites_clip.index << 2
@@ -617,7 +651,7 @@ static u8_t nextreg_clip_window_control_read(void) {
 }
 
 
-static void nextreg_clip_window_control_write(u8_t value) {
+static void nextreg_clip_window_control_write(u8_t reg, u8_t value) {
   if (value & 0x08) self.tilemap_clip.index = 0;
   if (value & 0x04) self.ula_clip.index     = 0;
   if (value & 0x02) self.sprites_clip.index = 0;
@@ -625,7 +659,7 @@ static void nextreg_clip_window_control_write(u8_t value) {
 }
 
 
-static u8_t nextreg_palette_control_read(void) {
+static u8_t nextreg_palette_control_read(u8_t reg) {
   return self.palette_disable_auto_increment << 7
        | self.palette_selected               << 4
        | self.is_palette_sprites_second      << 3
@@ -635,7 +669,7 @@ static u8_t nextreg_palette_control_read(void) {
 }
 
 
-static void nextreg_palette_control_write(u8_t value) {
+static void nextreg_palette_control_write(u8_t reg, u8_t value) {
   self.palette_disable_auto_increment = value >> 7;
   self.palette_selected               = (value & 0x70) >> 4;
   self.is_palette_sprites_second      = (value & 0x08) >> 3;
@@ -652,18 +686,18 @@ static void nextreg_palette_control_write(u8_t value) {
 }
 
 
-static void nextreg_palette_index_write(u8_t value) {
+static void nextreg_palette_index_write(u8_t reg, u8_t value) {
   self.palette_index                     = value;
   self.palette_index_9bit_is_first_write = 1;
 }
 
 
-static u8_t nextreg_palette_value_8bits_read(void) {
+static u8_t nextreg_palette_value_8bits_read(u8_t reg) {
   return palette_read(self.palette_selected, self.palette_index)->rgb8;
 }
 
 
-static void nextreg_palette_value_8bits_write(u8_t value) {
+static void nextreg_palette_value_8bits_write(u8_t reg, u8_t value) {
   palette_write_rgb8(self.palette_selected, self.palette_index, value);
   self.palette_index_9bit_is_first_write = 1;
   if (!self.palette_disable_auto_increment) {
@@ -672,13 +706,13 @@ static void nextreg_palette_value_8bits_write(u8_t value) {
 }
 
 
-static u8_t nextreg_palette_value_9bits_read(void) {
+static u8_t nextreg_palette_value_9bits_read(u8_t reg) {
   const palette_entry_t* entry = palette_read(self.palette_selected, self.palette_index);
   return (entry->is_layer2_priority << 7) | (entry->rgb9 & 1);
 }
 
 
-static void nextreg_palette_value_9bits_write(u8_t value) {
+static void nextreg_palette_value_9bits_write(u8_t reg, u8_t value) {
   if (self.palette_index_9bit_is_first_write) {
     palette_write_rgb8(self.palette_selected, self.palette_index, value);
   } else {
@@ -692,7 +726,7 @@ static void nextreg_palette_value_9bits_write(u8_t value) {
 }
 
 
-static u8_t nextreg_sprite_layers_system_read(void) {
+static u8_t nextreg_sprite_layers_system_read(u8_t reg) {
   return \
     (ula_lo_res_enable_get()                   ? 0x80 : 0x00) |
     (slu_layer_priority_get() << 2)                           |
@@ -703,7 +737,7 @@ static u8_t nextreg_sprite_layers_system_read(void) {
 }
 
 
-static void nextreg_sprite_layers_system_write(u8_t value) {
+static void nextreg_sprite_layers_system_write(u8_t reg, u8_t value) {
   ula_lo_res_enable_set(value & 0x80);
   slu_layer_priority_set((value & 0x1C) >> 2);
   sprites_priority_set(value & 0x40);
@@ -713,621 +747,615 @@ static void nextreg_sprite_layers_system_write(u8_t value) {
 }
 
 
-static u8_t nextreg_interrupt_control_read(void) {
+static u8_t nextreg_interrupt_control_read(u8_t reg) {
   /* TODO Implement other bits of this register. */
   return cpu_stackless_nmi_enabled() ? 0x08 : 0x00;
 }
 
 
-static void nextreg_interrupt_control_write(u8_t value) {
+static void nextreg_interrupt_control_write(u8_t reg, u8_t value) {
   cpu_stackless_nmi_enable(value & 0x08);
   /* TODO Implement other bits of this register. */
 }
 
 
-static u8_t nextreg_int_en_0_read(void) {
+static u8_t nextreg_int_en_0_read(u8_t reg) {
   /* TODO Implement other bits of this register. */
   return ula_irq_enable_get() ? 0x01 : 0x00;
 }
 
 
-static void nextreg_int_en_0_write(u8_t value) {
+static void nextreg_int_en_0_write(u8_t reg, u8_t value) {
   slu_line_interrupt_enable_set(value & 0x02);
   ula_irq_enable_set(value & 0x01);
 }
 
 
- void nextreg_data_write(u16_t address, u8_t value) {
-  if (!nextreg_write_internal(self.selected_register, value)) {
-    log_wrn("nextreg: unimplemented write of $%02X to register $%02X (%s) from PC=$%04X\n", value, self.selected_register, nextreg_description(self.selected_register), cpu_pc_get());
+static void nextreg_video_timing_write(u8_t reg, u8_t value) {
+  if (config_is_active()) {
+    clock_timing_write(value);
   }
 }
 
 
-int nextreg_write_internal(u8_t reg, u8_t value) {
-  /* Always remember the last value written. */
-  self.registers[reg] = value;
+static u8_t nextreg_video_timing_read(u8_t reg) {
+  return clock_timing_read();
+}
 
-  switch (reg) {
-    case E_NEXTREG_REGISTER_CONFIG_MAPPING:
-      nextreg_config_mapping_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_RESET:
-      nextreg_reset_write(value);
-      break;
+static void nextreg_layer2_active_ram_bank_write(u8_t reg, u8_t value) {
+  layer2_active_bank_write(value);
+}
 
-    case E_NEXTREG_REGISTER_MACHINE_TYPE:
-      nextreg_machine_type_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_1_SETTING:
-      nextreg_peripheral_1_setting_write(value);
-      break;
+static u8_t nextreg_layer2_active_ram_bank_read(u8_t reg) {
+  return layer2_active_bank_read();
+}
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_2_SETTING:
-      nextreg_peripheral_2_setting_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_3_SETTING:
-      nextreg_peripheral_3_setting_write(value);
-      break;
+static void nextreg_layer2_shadow_ram_bank_write(u8_t reg, u8_t value) {
+  layer2_shadow_bank_write(value);
+}
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_4_SETTING:
-      nextreg_peripheral_4_setting_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_5_SETTING:
-      nextreg_peripheral_5_setting_write(value);
-      break;
+static u8_t nextreg_layer2_shadow_ram_bank_read(u8_t reg) {
+  return layer2_shadow_bank_read();
+}
 
-    case E_NEXTREG_REGISTER_CPU_SPEED:
-      nextreg_cpu_speed_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_VIDEO_TIMING:
-      if (config_is_active()) {
-        clock_timing_write(value);
-      }
-      break;
+static void nextreg_layer2_control_write(u8_t reg, u8_t value) {
+  layer2_control_write(value);
+}
 
-    case E_NEXTREG_REGISTER_LAYER2_ACTIVE_RAM_BANK:
-      layer2_active_bank_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_LAYER2_SHADOW_RAM_BANK:
-      layer2_shadow_bank_write(value);
-      break;
+static u8_t nextreg_clip_window_ula_read(u8_t reg) {
+  return self.ula_clip.values[self.ula_clip.index];
+}
 
-    case E_NEXTREG_REGISTER_LAYER2_CONTROL:
-      layer2_control_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_SPRITE_LAYERS_SYSTEM:
-      nextreg_sprite_layers_system_write(value);
-      break;
+static u8_t nextreg_clip_window_tilemap_read(u8_t reg) {
+  return self.tilemap_clip.values[self.tilemap_clip.index];
+}
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_ULA:
-      nextreg_clip_window_ula_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_TILEMAP:
-      nextreg_clip_window_tilemap_write(value);
-      break;
+static u8_t nextreg_clip_window_sprites_read(u8_t reg) {
+  return self.sprites_clip.values[self.sprites_clip.index];
+}
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_SPRITES:
-      nextreg_clip_window_sprites_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_LAYER2:
-      nextreg_clip_window_layer2_write(value);
-      break;
+static u8_t nextreg_clip_window_layer2_read(u8_t reg) {
+  return self.layer2_clip.values[self.layer2_clip.index];
+}
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_CONTROL:
-      nextreg_clip_window_control_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_PALETTE_INDEX:
-      nextreg_palette_index_write(value);
-      break;
+static u8_t nextreg_palette_index_read(u8_t reg) {
+  return self.palette_index;
+}
 
-    case E_NEXTREG_REGISTER_PALETTE_CONTROL:
-      nextreg_palette_control_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_PALETTE_VALUE_8BITS:
-      nextreg_palette_value_8bits_write(value);
-      break;
+static void nextreg_global_transparency_colour_write(u8_t reg, u8_t value) {
+  slu_transparent_set(value);
+}
 
-    case E_NEXTREG_REGISTER_PALETTE_VALUE_9BITS:
-      nextreg_palette_value_9bits_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_GLOBAL_TRANSPARENCY_COLOUR:
-      slu_transparent_set(value);
-      break;
+static u8_t nextreg_global_transparency_colour_read(u8_t reg) {
+  return slu_transparent_get()->rgb8;
+}
 
-    case E_NEXTREG_REGISTER_FALLBACK_COLOUR:
-      slu_transparency_fallback_colour_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_MMU_SLOT0_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT1_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT2_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT3_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT4_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT5_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT6_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT7_CONTROL:
-      mmu_page_set(reg - E_NEXTREG_REGISTER_MMU_SLOT0_CONTROL, value);
-      break;
+static void nextreg_fallback_colour_write(u8_t reg, u8_t value) {
+  slu_transparency_fallback_colour_write(value);
+}
 
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_0:
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_1:
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_2:
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_3:
-      io_decoding_write(reg - E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_0, value);
-      break;
 
-    case E_NEXTREG_REGISTER_EXTERNAL_PORT_DECODING_0:
-    case E_NEXTREG_REGISTER_EXTERNAL_PORT_DECODING_1:
-    case E_NEXTREG_REGISTER_EXTERNAL_PORT_DECODING_2:
-    case E_NEXTREG_REGISTER_EXTERNAL_PORT_DECODING_3:
-      /* Ignored. */
-      break;
+static void nextreg_mmu_slot_control_write(u8_t reg, u8_t value) {
+  mmu_page_set(reg - E_NEXTREG_REGISTER_MMU_SLOT0_CONTROL, value);
+}
 
-    case E_NEXTREG_REGISTER_EXPANSION_BUS_ENABLE:
-    case E_NEXTREG_REGISTER_EXPANSION_BUS_CONTROL:
-      /* Ignored. */
-      break;
 
-    case E_NEXTREG_REGISTER_USER_0:
-      self.user_register_0 = value;
-      break;
-  
-    case E_NEXTREG_REGISTER_ALTERNATE_ROM:
-      nextreg_alternate_rom_write(value);
-      break;
+static u8_t nextreg_mmu_slot_control_read(u8_t reg) {
+  return mmu_page_get(reg - E_NEXTREG_REGISTER_MMU_SLOT0_CONTROL);
+}
 
-    case E_NEXTREG_REGISTER_SPECTRUM_MEMORY_MAPPING:
-      nextreg_spectrum_memory_mapping_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_TILEMAP_CONTROL:
-      tilemap_tilemap_control_write(value);
-      break;
+static void nextreg_internal_port_decoding_write(u8_t reg, u8_t value) {
+  io_decoding_write(reg - E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_0, value);
+}
 
-    case E_NEXTREG_REGISTER_TILEMAP_DEFAULT_TILEMAP_ATTRIBUTE:
-      tilemap_default_tilemap_attribute_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_TILEMAP_TILEMAP_BASE_ADDRESS:
-      tilemap_tilemap_base_address_write(value);
-      break;
+static void nextreg_user_0_write(u8_t reg, u8_t value) {
+  self.user_register_0 = value;
+}
 
-    case E_NEXTREG_REGISTER_TILEMAP_TILE_DEFINITIONS_BASE_ADDRESS:
-      tilemap_tilemap_tile_definitions_address_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_TILEMAP_TRANSPARENCY_INDEX:
-      tilemap_transparency_index_write(value);
-      break;
+static u8_t nextreg_user_0_read(u8_t reg) {
+  return self.user_register_0;
+}
 
-    case E_NEXTREG_REGISTER_SPRITES_TRANSPARENCY_INDEX:
-      sprites_transparency_index_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_ULA_CONTROL:
-      slu_ula_control_write(value);
-      break;
+static void nextreg_tilemap_control_write(u8_t reg, u8_t value) {
+  tilemap_tilemap_control_write(value);
+}
 
-    case E_NEXTREG_REGISTER_DISPLAY_CONTROL_1:
-      layer2_enable(value >> 7);
-      /* TODO: other bits in this register. */
-      break;
 
-    case E_NEXTREG_REGISTER_TILEMAP_X_SCROLL_MSB:
-      tilemap_offset_x_msb_write(value);
-      break;
+static void nextreg_tilemap_default_tilemap_attribute_write(u8_t reg, u8_t value) {
+  tilemap_default_tilemap_attribute_write(value);
+}
 
-    case E_NEXTREG_REGISTER_TILEMAP_X_SCROLL_LSB:
-      tilemap_offset_x_lsb_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_TILEMAP_Y_SCROLL:
-      tilemap_offset_y_write(value);
-      break;
+static void nextreg_tilemap_tilemap_base_address_write(u8_t reg, u8_t value) {
+  tilemap_tilemap_base_address_write(value);
+}
 
-    case E_NEXTREG_REGISTER_LAYER2_X_SCROLL_MSB:
-      layer2_offset_x_msb_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_LAYER2_X_SCROLL_LSB:
-      layer2_offset_x_lsb_write(value);
-      break;
+static void nextreg_tilemap_tile_definitions_base_address_write(u8_t reg, u8_t value) {
+  tilemap_tilemap_tile_definitions_address_write(value);
+}
 
-    case E_NEXTREG_REGISTER_LAYER2_Y_SCROLL:
-      layer2_offset_y_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_LO_RES_X_SCROLL:
-      ula_lo_res_offset_x_write(value);
-      break;
+static void nextreg_tilemap_transparency_index_write(u8_t reg, u8_t value) {
+  tilemap_transparency_index_write(value);
+}
 
-    case E_NEXTREG_REGISTER_LO_RES_Y_SCROLL:
-      ula_lo_res_offset_y_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_ULANEXT_ATTRIBUTE_BYTE_FORMAT:
-      ula_attribute_byte_format_write(value);
-      break;
+static void nextreg_sprites_transparency_index_write(u8_t reg, u8_t value) {
+  sprites_transparency_index_write(value);
+}
 
-    case E_NEXTREG_REGISTER_SPRITE_NUMBER:
-      if (self.is_sprites_lockstepped) {
-        sprites_slot_set(value);
-      } else {
-        self.sprite_number = value & 0x7F;
-      }
-      break;
 
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_1:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_2:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_3:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_4:
-    {
-      const u8_t sprite_number = self.is_sprites_lockstepped ? sprites_slot_get() : self.sprite_number;
-      sprites_attribute_set(sprite_number, reg - E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0, value);
-    }
-    break;
-
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0_POST_INCREMENT:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_1_POST_INCREMENT:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_2_POST_INCREMENT:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_3_POST_INCREMENT:
-    case E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_4_POST_INCREMENT:
-    {
-      const u8_t sprite_number = self.is_sprites_lockstepped ? sprites_slot_get() : self.sprite_number;
-      sprites_attribute_set(sprite_number, reg - E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0_POST_INCREMENT, value);
-      if (self.is_sprites_lockstepped) {
-        sprites_slot_set(sprite_number + 1);
-      } else {
-        self.sprite_number = (self.sprite_number + 1) & 0x7F;
-      }
-    }
-    break;
+static void nextreg_ula_control_write(u8_t reg, u8_t value) {
+  slu_ula_control_write(value);
+}
 
-    case E_NEXTREG_REGISTER_COPPER_DATA_8BIT:
-      copper_data_8bit_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_COPPER_ADDRESS:
-      copper_address_write(value);
-      break;
+static void nextreg_display_control_1_write(u8_t reg, u8_t value) {
+  layer2_enable(value >> 7);
+  /* TODO: other bits in this register. */
+}
 
-    case E_NEXTREG_REGISTER_COPPER_CONTROL:
-      copper_control_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_COPPER_DATA_16BIT:
-      copper_data_16bit_write(value);
-      break;
+static void nextreg_tilemap_x_scroll_msb_write(u8_t reg, u8_t value) {
+  tilemap_offset_x_msb_write(value);
+}
 
-    case E_NEXTREG_REGISTER_LINE_INTERRUPT_CONTROL:
-      slu_line_interrupt_control_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_LINE_INTERRUPT_VALUE_LSB:
-      slu_line_interrupt_value_lsb_write(value);
-      break;
+static void nextreg_tilemap_x_scroll_lsb_write(u8_t reg, u8_t value) {
+  tilemap_offset_x_lsb_write(value);
+}
 
-    case E_NEXTREG_REGISTER_ULA_X_SCROLL:
-      ula_offset_x_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_ULA_Y_SCROLL:
-      ula_offset_y_write(value);
-      break;
+static void nextreg_tilemap_y_scroll_write(u8_t reg, u8_t value) {
+  tilemap_offset_y_write(value);
+}
 
-    case E_NEXTREG_REGISTER_PS2_KEYMAP_ADDRESS_MSB:
-    case E_NEXTREG_REGISTER_PS2_KEYMAP_ADDRESS_LSB:
-    case E_NEXTREG_REGISTER_PS2_KEYMAP_DATA_MSB:
-    case E_NEXTREG_REGISTER_PS2_KEYMAP_DATA_LSB:
-      /* Ignored. */
-      break;
-      
-    case E_NEXTREG_REGISTER_DAC_B_MIRROR:
-      dac_write(DAC_B, value);
-      break;
 
-    case E_NEXTREG_REGISTER_DAC_A_D_MIRROR:
-      dac_write(DAC_A | DAC_D, value);
-      break;
+static void nextreg_layer2_x_scroll_msb_write(u8_t reg, u8_t value) {
+  layer2_offset_x_msb_write(value);
+}
 
-     case E_NEXTREG_REGISTER_DAC_C_MIRROR:
-      dac_write(DAC_C, value);
-      break;
 
-    case E_NEXTREG_REGISTER_INTERRUPT_CONTROL:
-      nextreg_interrupt_control_write(value);
-      break;
+static void nextreg_layer2_x_scroll_lsb_write(u8_t reg, u8_t value) {
+  layer2_offset_x_lsb_write(value);
+}
 
-    case E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_LSB:
-      self.nmi_return_address_lsb = value;
-      break;
 
-    case E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_MSB:
-      self.nmi_return_address_msb = value;
-      break;
+static void nextreg_layer2_y_scroll_write(u8_t reg, u8_t value) {
+  layer2_offset_y_write(value);
+}
 
-    case E_NEXTREG_REGISTER_INT_EN_0:
-      nextreg_int_en_0_write(value);
-      break;
 
-    case E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_0:
-      divmmc_automap_on_fetch_enable(0x0038, value & 0x80);
-      divmmc_automap_on_fetch_enable(0x0030, value & 0x40);
-      divmmc_automap_on_fetch_enable(0x0028, value & 0x20);
-      divmmc_automap_on_fetch_enable(0x0020, value & 0x10);
-      divmmc_automap_on_fetch_enable(0x0018, value & 0x08);
-      divmmc_automap_on_fetch_enable(0x0010, value & 0x04);
-      divmmc_automap_on_fetch_enable(0x0008, value & 0x02);
-      divmmc_automap_on_fetch_enable(0x0000, value & 0x01);
-      break;
+static void nextreg_lo_res_x_scroll_write(u8_t reg, u8_t value) {
+  ula_lo_res_offset_x_write(value);
+}
 
-    case E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_0_VALID:
-      divmmc_automap_on_fetch_always(0x0038, value & 0x80);
-      divmmc_automap_on_fetch_always(0x0030, value & 0x40);
-      divmmc_automap_on_fetch_always(0x0028, value & 0x20);
-      divmmc_automap_on_fetch_always(0x0020, value & 0x10);
-      divmmc_automap_on_fetch_always(0x0018, value & 0x08);
-      divmmc_automap_on_fetch_always(0x0010, value & 0x04);
-      divmmc_automap_on_fetch_always(0x0008, value & 0x02);
-      divmmc_automap_on_fetch_always(0x0000, value & 0x01);
-      break;
 
-    case E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_0_TIMING:
-      divmmc_automap_on_fetch_instant(0x0038, value & 0x80);
-      divmmc_automap_on_fetch_instant(0x0030, value & 0x40);
-      divmmc_automap_on_fetch_instant(0x0028, value & 0x20);
-      divmmc_automap_on_fetch_instant(0x0020, value & 0x10);
-      divmmc_automap_on_fetch_instant(0x0018, value & 0x08);
-      divmmc_automap_on_fetch_instant(0x0010, value & 0x04);
-      divmmc_automap_on_fetch_instant(0x0008, value & 0x02);
-      divmmc_automap_on_fetch_instant(0x0000, value & 0x01);
-      break;
+static void nextreg_lo_res_y_scroll_write(u8_t reg, u8_t value) {
+  ula_lo_res_offset_y_write(value);
+}
 
-    case E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_1:
-      divmmc_automap_on_fetch_enable(0x3D00, value & 0x80);
-      divmmc_automap_on_fetch_enable(0x1FF8, value & 0x40);
-      divmmc_automap_on_fetch_enable(0x056A, value & 0x20);
-      divmmc_automap_on_fetch_enable(0x04D7, value & 0x10);
-      divmmc_automap_on_fetch_enable(0x0562, value & 0x08);
-      divmmc_automap_on_fetch_enable(0x04C6, value & 0x04);
-      divmmc_automap_on_fetch_enable(0x0066, value & 0x03);
-      break;
 
-    case E_NEXTREG_REGISTER_IO_TRAPS:
-      io_traps_enable(value & 0x01);
-      break;
+static void nextreg_ulanext_attribute_byte_format_write(u8_t reg, u8_t value) {
+  ula_attribute_byte_format_write(value);
+}
+
+
+static u8_t nextreg_ulanext_attribute_byte_format_read(u8_t reg) {
+  return ula_attribute_byte_format_read();
+}
 
-    default:
-      return 0;
+
+static void nextreg_sprite_number_write(u8_t reg, u8_t value) {
+  if (self.is_sprites_lockstepped) {
+    sprites_slot_set(value);
+  } else {
+    self.sprite_number = value & 0x7F;
   }
+}
 
-  return 1;
+
+static void nextreg_sprite_attribute_write(u8_t reg, u8_t value) {
+  const u8_t sprite_number = self.is_sprites_lockstepped ? sprites_slot_get() : self.sprite_number;
+
+  sprites_attribute_set(sprite_number, reg - E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0, value);
 }
 
 
-u8_t nextreg_data_read(u16_t address) {
-  u8_t value = 0;
-  
-  if (!nextreg_read_internal(self.selected_register, &value)) {
-    log_wrn("nextreg: unimplemented read from register $%02X (%s)\n", self.selected_register, nextreg_description(self.selected_register));
+static void nextreg_sprite_attribute_post_increment_write(u8_t reg, u8_t value) {
+  const u8_t sprite_number = self.is_sprites_lockstepped ? sprites_slot_get() : self.sprite_number;
+
+  sprites_attribute_set(sprite_number, reg - E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0_POST_INCREMENT, value);
+  if (self.is_sprites_lockstepped) {
+    sprites_slot_set(sprite_number + 1);
+  } else {
+    self.sprite_number = (self.sprite_number + 1) & 0x7F;
   }
-  return value;
 }
 
 
-int nextreg_read_internal(u8_t reg, u8_t* value) {
-  /* By default, return the last value written. */
-  *value = self.registers[reg];
+static void nextreg_copper_data_8bit_write(u8_t reg, u8_t value) {
+  copper_data_8bit_write(value);
+}
 
-  switch (reg) {
-    case E_NEXTREG_REGISTER_MACHINE_ID:
-      *value = MACHINE_ID;
-      break;
 
-    case E_NEXTREG_REGISTER_RESET:
-      *value = nextreg_reset_read();
-      break;
+static void nextreg_copper_address_write(u8_t reg, u8_t value) {
+  copper_address_write(value);
+}
 
-    case E_NEXTREG_REGISTER_MACHINE_TYPE:
-      *value = nextreg_machine_type_read();
-      break;
 
-    case E_NEXTREG_REGISTER_CORE_VERSION:
-      *value = CORE_VERSION_MAJOR << 4 | CORE_VERSION_MINOR;
-      break;
+static void nextreg_copper_control_write(u8_t reg, u8_t value) {
+  copper_control_write(value);
+}
 
-    case E_NEXTREG_REGISTER_CORE_VERSION_SUB_MINOR:
-      *value = CORE_VERSION_SUB_MINOR;
-      break;
 
-    case E_NEXTREG_REGISTER_BOARD_ID:
-      *value = BOARD_ID;
-      break;
+static void nextreg_copper_data_16bit_write(u8_t reg, u8_t value) {
+  copper_data_16bit_write(value);
+}
 
-    case E_NEXTREG_REGISTER_CORE_BOOT:
-      *value = nextreg_core_boot_read();
-      break;
 
-    case E_NEXTREG_REGISTER_CPU_SPEED:
-      *value = nextreg_cpu_speed_read();
-      break;
+static u8_t nextreg_active_video_line_msb_read(u8_t reg) {
+  return (slu_active_video_line_get() >> 8) & 0x01;
+}
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_1_SETTING:
-      *value = nextreg_peripheral_1_setting_read();
-      break;
-      
-    case E_NEXTREG_REGISTER_PERIPHERAL_2_SETTING:
-      *value = nextreg_peripheral_2_setting_read();
-      break;
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_3_SETTING:
-      *value = nextreg_peripheral_3_setting_read();
-      break;
+static u8_t nextreg_active_video_line_lsb_read(u8_t reg) {
+  return slu_active_video_line_get() & 0xFF;
+}
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_4_SETTING:
-      *value = nextreg_peripheral_4_setting_read();
-      break;
 
-    case E_NEXTREG_REGISTER_PERIPHERAL_5_SETTING:
-      *value = nextreg_peripheral_5_setting_read();
-      break;
+static void nextreg_line_interrupt_control_write(u8_t reg, u8_t value) {
+  slu_line_interrupt_control_write(value);
+}
 
-    case E_NEXTREG_REGISTER_VIDEO_TIMING:
-      *value = clock_timing_read();
-      break;
 
-    case E_NEXTREG_REGISTER_LAYER2_ACTIVE_RAM_BANK:
-      *value = layer2_active_bank_read();
-      break;
+static u8_t nextreg_line_interrupt_control_read(u8_t reg) {
+  return slu_line_interrupt_control_read();
+}
 
-    case E_NEXTREG_REGISTER_LAYER2_SHADOW_RAM_BANK:
-      *value = layer2_shadow_bank_read();
-      break;
 
-    case E_NEXTREG_REGISTER_SPRITE_LAYERS_SYSTEM:
-      *value = nextreg_sprite_layers_system_read();
-      break;
+static void nextreg_line_interrupt_value_lsb_write(u8_t reg, u8_t value) {
+  slu_line_interrupt_value_lsb_write(value);
+}
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_ULA:
-      *value = self.ula_clip.values[self.ula_clip.index];
-      break;
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_TILEMAP:
-      *value = self.tilemap_clip.values[self.tilemap_clip.index];
-      break;
+static u8_t nextreg_line_interrupt_value_lsb_read(u8_t reg) {
+  return slu_line_interrupt_value_lsb_read();
+}
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_SPRITES:
-      *value = self.sprites_clip.values[self.sprites_clip.index];
-      break;
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_LAYER2:
-      *value = self.layer2_clip.values[self.layer2_clip.index];
-      break;
+static void nextreg_ula_x_scroll_write(u8_t reg, u8_t value) {
+  ula_offset_x_write(value);
+}
 
-    case E_NEXTREG_REGISTER_CLIP_WINDOW_CONTROL:
-      *value = nextreg_clip_window_control_read();
-      break;
 
-    case E_NEXTREG_REGISTER_PALETTE_INDEX:
-      *value = self.palette_index;
-      break;
+static u8_t nextreg_ula_x_scroll_read(u8_t reg) {
+  return ula_offset_x_read();
+}
 
-    case E_NEXTREG_REGISTER_PALETTE_CONTROL:
-      *value = nextreg_palette_control_read();
-      break;
 
-    case E_NEXTREG_REGISTER_PALETTE_VALUE_8BITS:
-      *value = nextreg_palette_value_8bits_read();
-      break;
+static void nextreg_ula_y_scroll_write(u8_t reg, u8_t value) {
+  ula_offset_y_write(value);
+}
 
-    case E_NEXTREG_REGISTER_PALETTE_VALUE_9BITS:
-      *value = nextreg_palette_value_9bits_read();
-      break;
 
-    case E_NEXTREG_REGISTER_GLOBAL_TRANSPARENCY_COLOUR:
-      *value = slu_transparent_get()->rgb8;
-      break;
+static u8_t nextreg_ula_y_scroll_read(u8_t reg) {
+  return ula_offset_y_read();
+}
 
-    case E_NEXTREG_REGISTER_ULANEXT_ATTRIBUTE_BYTE_FORMAT:
-      *value = ula_attribute_byte_format_read();
-      break;
 
-    case E_NEXTREG_REGISTER_MMU_SLOT0_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT1_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT2_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT3_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT4_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT5_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT6_CONTROL:
-    case E_NEXTREG_REGISTER_MMU_SLOT7_CONTROL:
-      *value = mmu_page_get(self.selected_register - E_NEXTREG_REGISTER_MMU_SLOT0_CONTROL);
-      break;
+static void nextreg_dac_b_mirror_write(u8_t reg, u8_t value) {
+  dac_write(DAC_B, value);
+}
 
-    case E_NEXTREG_REGISTER_USER_0:
-      *value = self.user_register_0;
-      break;
-  
-    case E_NEXTREG_REGISTER_ACTIVE_VIDEO_LINE_MSB:
-      *value = (slu_active_video_line_get() >> 8) & 0x01;
-      break;
 
-    case E_NEXTREG_REGISTER_ACTIVE_VIDEO_LINE_LSB:
-      *value = slu_active_video_line_get() & 0xFF;
-      break;
+static void nextreg_dac_a_d_mirror_write(u8_t reg, u8_t value) {
+  dac_write(DAC_A | DAC_D, value);
+}
 
-    case E_NEXTREG_REGISTER_LINE_INTERRUPT_CONTROL:
-      *value = slu_line_interrupt_control_read();
-      break;
 
-    case E_NEXTREG_REGISTER_LINE_INTERRUPT_VALUE_LSB:
-      *value = slu_line_interrupt_value_lsb_read();
-      break;
+static void nextreg_dac_c_mirror_write(u8_t reg, u8_t value) {
+  dac_write(DAC_C, value);
+}
 
-    case E_NEXTREG_REGISTER_ULA_X_SCROLL:
-      *value = ula_offset_x_read();
-      break;
 
-    case E_NEXTREG_REGISTER_ULA_Y_SCROLL:
-      *value = ula_offset_y_read();
-      break;
+static void nextreg_nmi_return_address_lsb_write(u8_t reg, u8_t value) {
+  self.nmi_return_address_lsb = value;
+}
 
-    case E_NEXTREG_REGISTER_IO_TRAPS:
-      *value = io_are_traps_enabled() ? 0x01 : 0x00;
-      break;
 
-    case E_NEXTREG_REGISTER_IO_TRAP_WRITE:
-      *value = io_trap_byte_written();
-      break;
+static u8_t nextreg_nmi_return_address_lsb_read(u8_t reg) {
+  return self.nmi_return_address_lsb;
+}
 
-    case E_NEXTREG_REGISTER_IO_TRAP_CAUSE:
-      *value = (u8_t) io_trap_cause();
-      break;
 
-    case E_NEXTREG_REGISTER_INTERRUPT_CONTROL:
-      *value = nextreg_interrupt_control_read();
-      break;
+static void nextreg_nmi_return_address_msb_write(u8_t reg, u8_t value) {
+  self.nmi_return_address_msb = value;
+}
 
-    case E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_LSB:
-      *value = self.nmi_return_address_lsb;
-      break;
 
-    case E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_MSB:
-      *value = self.nmi_return_address_msb;
-      break;
+static u8_t nextreg_nmi_return_address_msb_read(u8_t reg) {
+  return self.nmi_return_address_msb;
+}
 
-    case E_NEXTREG_REGISTER_INT_EN_0:
-      *value = nextreg_int_en_0_read();
-      break;
 
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_0:
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_1:
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_2:
-    case E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_3:
-    case E_NEXTREG_REGISTER_TILEMAP_CONTROL:
-    case E_NEXTREG_REGISTER_FALLBACK_COLOUR:
-      /* Cached value is ok, don't issue a warning. */
-      break;
+static void nextreg_divmmc_entry_points_0_write(u8_t reg, u8_t value) {
+  divmmc_automap_on_fetch_enable(0x0038, value & 0x80);
+  divmmc_automap_on_fetch_enable(0x0030, value & 0x40);
+  divmmc_automap_on_fetch_enable(0x0028, value & 0x20);
+  divmmc_automap_on_fetch_enable(0x0020, value & 0x10);
+  divmmc_automap_on_fetch_enable(0x0018, value & 0x08);
+  divmmc_automap_on_fetch_enable(0x0010, value & 0x04);
+  divmmc_automap_on_fetch_enable(0x0008, value & 0x02);
+  divmmc_automap_on_fetch_enable(0x0000, value & 0x01);
+}
+
+
+static void nextreg_divmmc_entry_points_0_valid_write(u8_t reg, u8_t value) {
+  divmmc_automap_on_fetch_always(0x0038, value & 0x80);
+  divmmc_automap_on_fetch_always(0x0030, value & 0x40);
+  divmmc_automap_on_fetch_always(0x0028, value & 0x20);
+  divmmc_automap_on_fetch_always(0x0020, value & 0x10);
+  divmmc_automap_on_fetch_always(0x0018, value & 0x08);
+  divmmc_automap_on_fetch_always(0x0010, value & 0x04);
+  divmmc_automap_on_fetch_always(0x0008, value & 0x02);
+  divmmc_automap_on_fetch_always(0x0000, value & 0x01);
+}
+
+
+static void nextreg_divmmc_entry_points_0_timing_write(u8_t reg, u8_t value) {
+  divmmc_automap_on_fetch_instant(0x0038, value & 0x80);
+  divmmc_automap_on_fetch_instant(0x0030, value & 0x40);
+  divmmc_automap_on_fetch_instant(0x0028, value & 0x20);
+  divmmc_automap_on_fetch_instant(0x0020, value & 0x10);
+  divmmc_automap_on_fetch_instant(0x0018, value & 0x08);
+  divmmc_automap_on_fetch_instant(0x0010, value & 0x04);
+  divmmc_automap_on_fetch_instant(0x0008, value & 0x02);
+  divmmc_automap_on_fetch_instant(0x0000, value & 0x01);
+}
+
+
+static void nextreg_divmmc_entry_points_1_write(u8_t reg, u8_t value) {
+  divmmc_automap_on_fetch_enable(0x3D00, value & 0x80);
+  divmmc_automap_on_fetch_enable(0x1FF8, value & 0x40);
+  divmmc_automap_on_fetch_enable(0x056A, value & 0x20);
+  divmmc_automap_on_fetch_enable(0x04D7, value & 0x10);
+  divmmc_automap_on_fetch_enable(0x0562, value & 0x08);
+  divmmc_automap_on_fetch_enable(0x04C6, value & 0x04);
+  divmmc_automap_on_fetch_enable(0x0066, value & 0x03);
+}
+
 
-    default:
-      /* Might be an unimplemented read, issue a warning. */
-      return 0;
+static void nextreg_io_traps_write(u8_t reg, u8_t value) {
+  io_traps_enable(value & 0x01);
+}
+
+
+static u8_t nextreg_io_traps_read(u8_t reg) {
+  return io_are_traps_enabled() ? 0x01 : 0x00;
+}
+
+
+static u8_t nextreg_io_trap_write_read(u8_t reg) {
+  return io_trap_byte_written();
+}
+
+
+static u8_t nextreg_io_trap_cause_read(u8_t reg) {
+  return (u8_t) io_trap_cause();
+}
+
+
+static u8_t nextreg_machine_id_read(u8_t reg) {
+  return MACHINE_ID;
+}
+
+
+static u8_t nextreg_core_version_read(u8_t reg) {
+  return CORE_VERSION_MAJOR << 4 | CORE_VERSION_MINOR;
+}
+
+
+static u8_t nextreg_core_version_sub_minor_read(u8_t reg) {
+  return CORE_VERSION_SUB_MINOR;
+}
+
+
+static u8_t nextreg_board_id_read(u8_t reg) {
+  return BOARD_ID;
+}
+
+
+/* Registers whose last written value is what reads return. */
+static u8_t nextreg_cached_read(u8_t reg) {
+  return self.registers[reg];
+}
+
+
+/* Registers that are accepted but have no effect. */
+static void nextreg_ignored_write(u8_t reg, u8_t value) {
+}
+
+
+static void nextreg_handler_set(u8_t reg, nextreg_read_t read, nextreg_write_t write) {
+  dispatch.handlers[reg].read  = read;
+  dispatch.handlers[reg].write = write;
+}
+
+
+static void nextreg_handler_range_set(u8_t first, u8_t last, nextreg_read_t read, nextreg_write_t write) {
+  for (int reg = first; reg <= last; reg++) {
+    nextreg_handler_set(reg, read, write);
+  }
+}
+
+
+static void nextreg_handlers_init(void) {
+  memset(&dispatch, 0, sizeof(dispatch));
+
+  nextreg_handler_set(E_NEXTREG_REGISTER_MACHINE_ID,                            nextreg_machine_id_read,                    NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CORE_VERSION,                          nextreg_core_version_read,                  NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_RESET,                                 nextreg_reset_read,                         nextreg_reset_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_MACHINE_TYPE,                          nextreg_machine_type_read,                  nextreg_machine_type_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CONFIG_MAPPING,                        NULL,                                       nextreg_config_mapping_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PERIPHERAL_1_SETTING,                  nextreg_peripheral_1_setting_read,          nextreg_peripheral_1_setting_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PERIPHERAL_2_SETTING,                  nextreg_peripheral_2_setting_read,          nextreg_peripheral_2_setting_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CPU_SPEED,                             nextreg_cpu_speed_read,                     nextreg_cpu_speed_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PERIPHERAL_3_SETTING,                  nextreg_peripheral_3_setting_read,          nextreg_peripheral_3_setting_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PERIPHERAL_4_SETTING,                  nextreg_peripheral_4_setting_read,          nextreg_peripheral_4_setting_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PERIPHERAL_5_SETTING,                  nextreg_peripheral_5_setting_read,          nextreg_peripheral_5_setting_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CORE_VERSION_SUB_MINOR,                nextreg_core_version_sub_minor_read,        NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_BOARD_ID,                              nextreg_board_id_read,                      NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CORE_BOOT,                             nextreg_core_boot_read,                     NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_VIDEO_TIMING,                          nextreg_video_timing_read,                  nextreg_video_timing_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LAYER2_ACTIVE_RAM_BANK,                nextreg_layer2_active_ram_bank_read,        nextreg_layer2_active_ram_bank_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LAYER2_SHADOW_RAM_BANK,                nextreg_layer2_shadow_ram_bank_read,        nextreg_layer2_shadow_ram_bank_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_GLOBAL_TRANSPARENCY_COLOUR,            nextreg_global_transparency_colour_read,    nextreg_global_transparency_colour_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_SPRITE_LAYERS_SYSTEM,                  nextreg_sprite_layers_system_read,          nextreg_sprite_layers_system_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LAYER2_X_SCROLL_LSB,                   NULL,                                       nextreg_layer2_x_scroll_lsb_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LAYER2_Y_SCROLL,                       NULL,                                       nextreg_layer2_y_scroll_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CLIP_WINDOW_LAYER2,                    nextreg_clip_window_layer2_read,            nextreg_clip_window_layer2_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CLIP_WINDOW_SPRITES,                   nextreg_clip_window_sprites_read,           nextreg_clip_window_sprites_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CLIP_WINDOW_ULA,                       nextreg_clip_window_ula_read,               nextreg_clip_window_ula_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CLIP_WINDOW_TILEMAP,                   nextreg_clip_window_tilemap_read,           nextreg_clip_window_tilemap_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_CLIP_WINDOW_CONTROL,                   nextreg_clip_window_control_read,           nextreg_clip_window_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_ACTIVE_VIDEO_LINE_MSB,                 nextreg_active_video_line_msb_read,         NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_ACTIVE_VIDEO_LINE_LSB,                 nextreg_active_video_line_lsb_read,         NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_ULA_X_SCROLL,                          nextreg_ula_x_scroll_read,                  nextreg_ula_x_scroll_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_ULA_Y_SCROLL,                          nextreg_ula_y_scroll_read,                  nextreg_ula_y_scroll_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LO_RES_X_SCROLL,                       NULL,                                       nextreg_lo_res_x_scroll_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LO_RES_Y_SCROLL,                       NULL,                                       nextreg_lo_res_y_scroll_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_SPRITE_NUMBER,                         NULL,                                       nextreg_sprite_number_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LAYER2_X_SCROLL_MSB,                   NULL,                                       nextreg_layer2_x_scroll_msb_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_X_SCROLL_MSB,                  NULL,                                       nextreg_tilemap_x_scroll_msb_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_X_SCROLL_LSB,                  NULL,                                       nextreg_tilemap_x_scroll_lsb_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_Y_SCROLL,                      NULL,                                       nextreg_tilemap_y_scroll_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PALETTE_INDEX,                         nextreg_palette_index_read,                 nextreg_palette_index_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PALETTE_VALUE_8BITS,                   nextreg_palette_value_8bits_read,           nextreg_palette_value_8bits_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_ULANEXT_ATTRIBUTE_BYTE_FORMAT,         nextreg_ulanext_attribute_byte_format_read, nextreg_ulanext_attribute_byte_format_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DAC_B_MIRROR,                          NULL,                                       nextreg_dac_b_mirror_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DAC_A_D_MIRROR,                        NULL,                                       nextreg_dac_a_d_mirror_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DAC_C_MIRROR,                          NULL,                                       nextreg_dac_c_mirror_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PALETTE_CONTROL,                       nextreg_palette_control_read,               nextreg_palette_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_FALLBACK_COLOUR,                       nextreg_cached_read,                        nextreg_fallback_colour_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_SPRITES_TRANSPARENCY_INDEX,            NULL,                                       nextreg_sprites_transparency_index_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PALETTE_VALUE_9BITS,                   nextreg_palette_value_9bits_read,           nextreg_palette_value_9bits_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_SPECTRUM_MEMORY_MAPPING,               NULL,                                       nextreg_spectrum_memory_mapping_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_ALTERNATE_ROM,                         NULL,                                       nextreg_alternate_rom_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DISPLAY_CONTROL_1,                     NULL,                                       nextreg_display_control_1_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LAYER2_CONTROL,                        NULL,                                       nextreg_layer2_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_CONTROL,                       nextreg_cached_read,                        nextreg_tilemap_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_DEFAULT_TILEMAP_ATTRIBUTE,     NULL,                                       nextreg_tilemap_default_tilemap_attribute_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_TILEMAP_BASE_ADDRESS,          NULL,                                       nextreg_tilemap_tilemap_base_address_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_TILE_DEFINITIONS_BASE_ADDRESS, NULL,                                       nextreg_tilemap_tile_definitions_base_address_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_TILEMAP_TRANSPARENCY_INDEX,            NULL,                                       nextreg_tilemap_transparency_index_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_COPPER_DATA_8BIT,                      NULL,                                       nextreg_copper_data_8bit_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_COPPER_ADDRESS,                        NULL,                                       nextreg_copper_address_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_COPPER_CONTROL,                        NULL,                                       nextreg_copper_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_COPPER_DATA_16BIT,                     NULL,                                       nextreg_copper_data_16bit_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_ULA_CONTROL,                           NULL,                                       nextreg_ula_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LINE_INTERRUPT_CONTROL,                nextreg_line_interrupt_control_read,        nextreg_line_interrupt_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_LINE_INTERRUPT_VALUE_LSB,              nextreg_line_interrupt_value_lsb_read,      nextreg_line_interrupt_value_lsb_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_USER_0,                                nextreg_user_0_read,                        nextreg_user_0_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_INTERRUPT_CONTROL,                     nextreg_interrupt_control_read,             nextreg_interrupt_control_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_LSB,                nextreg_nmi_return_address_lsb_read,        nextreg_nmi_return_address_lsb_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_MSB,                nextreg_nmi_return_address_msb_read,        nextreg_nmi_return_address_msb_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_INT_EN_0,                              nextreg_int_en_0_read,                      nextreg_int_en_0_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_0,                 NULL,                                       nextreg_divmmc_entry_points_0_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_0_VALID,           NULL,                                       nextreg_divmmc_entry_points_0_valid_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_0_TIMING,          NULL,                                       nextreg_divmmc_entry_points_0_timing_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_DIVMMC_ENTRY_POINTS_1,                 NULL,                                       nextreg_divmmc_entry_points_1_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_IO_TRAPS,                              nextreg_io_traps_read,                      nextreg_io_traps_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_IO_TRAP_WRITE,                         nextreg_io_trap_write_read,                 NULL);
+  nextreg_handler_set(E_NEXTREG_REGISTER_IO_TRAP_CAUSE,                         nextreg_io_trap_cause_read,                 NULL);
+
+  nextreg_handler_range_set(E_NEXTREG_REGISTER_MMU_SLOT0_CONTROL,                 E_NEXTREG_REGISTER_MMU_SLOT7_CONTROL,                 nextreg_mmu_slot_control_read, nextreg_mmu_slot_control_write);
+  nextreg_handler_range_set(E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_0,          E_NEXTREG_REGISTER_INTERNAL_PORT_DECODING_3,          nextreg_cached_read,           nextreg_internal_port_decoding_write);
+  nextreg_handler_range_set(E_NEXTREG_REGISTER_EXTERNAL_PORT_DECODING_0,          E_NEXTREG_REGISTER_EXTERNAL_PORT_DECODING_3,          NULL,                          nextreg_ignored_write);
+  nextreg_handler_range_set(E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0,                E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_4,                NULL,                          nextreg_sprite_attribute_write);
+  nextreg_handler_range_set(E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_0_POST_INCREMENT, E_NEXTREG_REGISTER_SPRITE_ATTRIBUTE_4_POST_INCREMENT, NULL,                          nextreg_sprite_attribute_post_increment_write);
+
+  nextreg_handler_set(E_NEXTREG_REGISTER_EXPANSION_BUS_ENABLE,                  NULL,                                       nextreg_ignored_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_EXPANSION_BUS_CONTROL,                 NULL,                                       nextreg_ignored_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PS2_KEYMAP_ADDRESS_MSB,                NULL,                                       nextreg_ignored_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PS2_KEYMAP_ADDRESS_LSB,                NULL,                                       nextreg_ignored_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PS2_KEYMAP_DATA_MSB,                   NULL,                                       nextreg_ignored_write);
+  nextreg_handler_set(E_NEXTREG_REGISTER_PS2_KEYMAP_DATA_LSB,                   NULL,                                       nextreg_ignored_write);
+}
+
+
+void nextreg_data_write(u16_t address, u8_t value) {
+  if (!nextreg_write_internal(self.selected_register, value)) {
+    log_wrn("nextreg: unimplemented write of $%02X to register $%02X (%s) from PC=$%04X\n", value, self.selected_register, nextreg_description(self.selected_register), cpu_pc_get());
   }
+}
+
+
+int nextreg_write_internal(u8_t reg, u8_t value) {
+  const nextreg_handler_t* handler = &dispatch.handlers[reg];
+
+  if (self.is_watched) {
+    debug_watch_access(E_DEBUG_WATCH_NEXTREG, reg, value, 1);
+  }
+
+  /* Always remember the last value written. */
+  self.registers[reg] = value;
+
+  if (handler->write == NULL) {
+    return 0;
+  }
+
+  handler->write(reg, value);
 
   return 1;
 }
 
 
+u8_t nextreg_data_read(u16_t address) {
+  u8_t value = 0;
+
+  if (!nextreg_read_internal(self.selected_register, &value)) {
+    log_wrn("nextreg: unimplemented read from register $%02X (%s)\n", self.selected_register, nextreg_description(self.selected_register));
+  }
+  if (self.is_watched) {
+    debug_watch_access(E_DEBUG_WATCH_NEXTREG, self.selected_register, value, 0);
+  }
+  return value;
+}
+
+
+int nextreg_read_internal(u8_t reg, u8_t* value) {
+  const nextreg_handler_t* handler = &dispatch.handlers[reg];
+
+  if (handler->read == NULL) {
+    /* Might be an unimplemented read, return the last value written. */
+    *value = self.registers[reg];
+    return 0;
+  }
+
+  *value = handler->read(reg);
+  return 1;
+}
+
+
+void nextreg_watch_enable(int enable) {
+  self.is_watched = enable;
+}
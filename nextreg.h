@@ -146,6 +146,7 @@ u8_t nextreg_select_read(u16_t address);
 int  nextreg_write_internal(u8_t reg, u8_t value);
 int  nextreg_read_internal(u8_t reg, u8_t* value);
 void nextreg_reset(reset_t reset);
+void nextreg_watch_enable(int enable);
 
 
 #endif  /* __NEXTREG_H */
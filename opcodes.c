@@ -0,0 +1,1698 @@
+
+inline
+static void execute_CB(void) {
+  const u8_t opcode = memory_read(PC++); T(4);
+  switch (opcode) {
+    case 0x00: /* RLC B          */ { const u8_t carry = B >> 7; B = B << 1 | carry; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x01: /* RLC C          */ { const u8_t carry = C >> 7; C = C << 1 | carry; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x02: /* RLC D          */ { const u8_t carry = D >> 7; D = D << 1 | carry; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x03: /* RLC E          */ { const u8_t carry = E >> 7; E = E << 1 | carry; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x04: /* RLC H          */ { const u8_t carry = H >> 7; H = H << 1 | carry; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x05: /* RLC L          */ { const u8_t carry = L >> 7; L = L << 1 | carry; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x06: /* RLC (HL)       */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | carry; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x07: /* RLC A          */ { const u8_t carry = A >> 7; A = A << 1 | carry; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x08: /* RRC B          */ { const u8_t carry = B & 0x01; B = B >> 1 | carry << 7; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x09: /* RRC C          */ { const u8_t carry = C & 0x01; C = C >> 1 | carry << 7; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x0A: /* RRC D          */ { const u8_t carry = D & 0x01; D = D >> 1 | carry << 7; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x0B: /* RRC E          */ { const u8_t carry = E & 0x01; E = E >> 1 | carry << 7; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x0C: /* RRC H          */ { const u8_t carry = H & 0x01; H = H >> 1 | carry << 7; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x0D: /* RRC L          */ { const u8_t carry = L & 0x01; L = L >> 1 | carry << 7; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x0E: /* RRC (HL)       */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = TMP >> 1 | carry << 7; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x0F: /* RRC A          */ { const u8_t carry = A & 0x01; A = A >> 1 | carry << 7; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x10: /* RL B           */ { const u8_t carry = B >> 7; B = B << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x11: /* RL C           */ { const u8_t carry = C >> 7; C = C << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x12: /* RL D           */ { const u8_t carry = D >> 7; D = D << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x13: /* RL E           */ { const u8_t carry = E >> 7; E = E << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x14: /* RL H           */ { const u8_t carry = H >> 7; H = H << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x15: /* RL L           */ { const u8_t carry = L >> 7; L = L << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x16: /* RL (HL)        */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x17: /* RL A           */ { const u8_t carry = A >> 7; A = A << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x18: /* RR B           */ { const u8_t carry = B & 0x01; B = B >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x19: /* RR C           */ { const u8_t carry = C & 0x01; C = C >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x1A: /* RR D           */ { const u8_t carry = D & 0x01; D = D >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x1B: /* RR E           */ { const u8_t carry = E & 0x01; E = E >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x1C: /* RR H           */ { const u8_t carry = H & 0x01; H = H >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x1D: /* RR L           */ { const u8_t carry = L & 0x01; L = L >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x1E: /* RR (HL)        */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = TMP >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x1F: /* RR A           */ { const u8_t carry = A & 0x01; A = A >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x20: /* SLA B          */ { const u8_t carry = B >> 7; B <<= 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x21: /* SLA C          */ { const u8_t carry = C >> 7; C <<= 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x22: /* SLA D          */ { const u8_t carry = D >> 7; D <<= 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x23: /* SLA E          */ { const u8_t carry = E >> 7; E <<= 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x24: /* SLA H          */ { const u8_t carry = H >> 7; H <<= 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x25: /* SLA L          */ { const u8_t carry = L >> 7; L <<= 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x26: /* SLA (HL)       */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP <<= 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x27: /* SLA A          */ { const u8_t carry = A >> 7; A <<= 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x28: /* SRA B          */ { const u8_t carry = B & 0x01; B = (B & 0x80) | B >> 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x29: /* SRA C          */ { const u8_t carry = C & 0x01; C = (C & 0x80) | C >> 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x2A: /* SRA D          */ { const u8_t carry = D & 0x01; D = (D & 0x80) | D >> 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x2B: /* SRA E          */ { const u8_t carry = E & 0x01; E = (E & 0x80) | E >> 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x2C: /* SRA H          */ { const u8_t carry = H & 0x01; H = (H & 0x80) | H >> 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x2D: /* SRA L          */ { const u8_t carry = L & 0x01; L = (L & 0x80) | L >> 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x2E: /* SRA (HL)       */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = (TMP & 0x80) | TMP >> 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x2F: /* SRA A          */ { const u8_t carry = A & 0x01; A = (A & 0x80) | A >> 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x30: /* SLL B          */ { const u8_t carry = B >> 7; B = B << 1 | 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x31: /* SLL C          */ { const u8_t carry = C >> 7; C = C << 1 | 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x32: /* SLL D          */ { const u8_t carry = D >> 7; D = D << 1 | 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x33: /* SLL E          */ { const u8_t carry = E >> 7; E = E << 1 | 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x34: /* SLL H          */ { const u8_t carry = H >> 7; H = H << 1 | 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x35: /* SLL L          */ { const u8_t carry = L >> 7; L = L << 1 | 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x36: /* SLL (HL)       */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x37: /* SLL A          */ { const u8_t carry = A >> 7; A = A << 1 | 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x38: /* SRL B          */ { const u8_t carry = B & 0x01; B >>= 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x39: /* SRL C          */ { const u8_t carry = C & 0x01; C >>= 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x3A: /* SRL D          */ { const u8_t carry = D & 0x01; D >>= 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x3B: /* SRL E          */ { const u8_t carry = E & 0x01; E >>= 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x3C: /* SRL H          */ { const u8_t carry = H & 0x01; H >>= 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x3D: /* SRL L          */ { const u8_t carry = L & 0x01; L >>= 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x3E: /* SRL (HL)       */ { u8_t carry; WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP >>= 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x3F: /* SRL A          */ { const u8_t carry = A & 0x01; A >>= 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x40: /* BIT 0,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x41: /* BIT 0,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x42: /* BIT 0,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x43: /* BIT 0,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x44: /* BIT 0,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x45: /* BIT 0,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x46: /* BIT 0,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x47: /* BIT 0,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x48: /* BIT 1,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x49: /* BIT 1,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4A: /* BIT 1,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4B: /* BIT 1,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4C: /* BIT 1,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4D: /* BIT 1,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4E: /* BIT 1,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4F: /* BIT 1,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x50: /* BIT 2,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x51: /* BIT 2,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x52: /* BIT 2,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x53: /* BIT 2,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x54: /* BIT 2,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x55: /* BIT 2,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x56: /* BIT 2,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x57: /* BIT 2,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x58: /* BIT 3,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x59: /* BIT 3,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5A: /* BIT 3,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5B: /* BIT 3,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5C: /* BIT 3,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5D: /* BIT 3,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5E: /* BIT 3,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5F: /* BIT 3,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x60: /* BIT 4,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x61: /* BIT 4,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x62: /* BIT 4,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x63: /* BIT 4,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x64: /* BIT 4,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x65: /* BIT 4,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x66: /* BIT 4,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x67: /* BIT 4,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x68: /* BIT 5,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x69: /* BIT 5,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6A: /* BIT 5,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6B: /* BIT 5,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6C: /* BIT 5,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6D: /* BIT 5,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6E: /* BIT 5,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6F: /* BIT 5,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x70: /* BIT 6,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x71: /* BIT 6,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x72: /* BIT 6,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x73: /* BIT 6,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x74: /* BIT 6,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x75: /* BIT 6,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x76: /* BIT 6,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x77: /* BIT 6,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x78: /* BIT 7,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x79: /* BIT 7,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7A: /* BIT 7,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7B: /* BIT 7,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7C: /* BIT 7,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7D: /* BIT 7,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7E: /* BIT 7,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7F: /* BIT 7,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x80: /* RES 0,B        */ { B &= ~(1 << 0); } break;
+    case 0x81: /* RES 0,C        */ { C &= ~(1 << 0); } break;
+    case 0x82: /* RES 0,D        */ { D &= ~(1 << 0); } break;
+    case 0x83: /* RES 0,E        */ { E &= ~(1 << 0); } break;
+    case 0x84: /* RES 0,H        */ { H &= ~(1 << 0); } break;
+    case 0x85: /* RES 0,L        */ { L &= ~(1 << 0); } break;
+    case 0x86: /* RES 0,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 0)); T(3); } break;
+    case 0x87: /* RES 0,A        */ { A &= ~(1 << 0); } break;
+    case 0x88: /* RES 1,B        */ { B &= ~(1 << 1); } break;
+    case 0x89: /* RES 1,C        */ { C &= ~(1 << 1); } break;
+    case 0x8A: /* RES 1,D        */ { D &= ~(1 << 1); } break;
+    case 0x8B: /* RES 1,E        */ { E &= ~(1 << 1); } break;
+    case 0x8C: /* RES 1,H        */ { H &= ~(1 << 1); } break;
+    case 0x8D: /* RES 1,L        */ { L &= ~(1 << 1); } break;
+    case 0x8E: /* RES 1,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 1)); T(3); } break;
+    case 0x8F: /* RES 1,A        */ { A &= ~(1 << 1); } break;
+    case 0x90: /* RES 2,B        */ { B &= ~(1 << 2); } break;
+    case 0x91: /* RES 2,C        */ { C &= ~(1 << 2); } break;
+    case 0x92: /* RES 2,D        */ { D &= ~(1 << 2); } break;
+    case 0x93: /* RES 2,E        */ { E &= ~(1 << 2); } break;
+    case 0x94: /* RES 2,H        */ { H &= ~(1 << 2); } break;
+    case 0x95: /* RES 2,L        */ { L &= ~(1 << 2); } break;
+    case 0x96: /* RES 2,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 2)); T(3); } break;
+    case 0x97: /* RES 2,A        */ { A &= ~(1 << 2); } break;
+    case 0x98: /* RES 3,B        */ { B &= ~(1 << 3); } break;
+    case 0x99: /* RES 3,C        */ { C &= ~(1 << 3); } break;
+    case 0x9A: /* RES 3,D        */ { D &= ~(1 << 3); } break;
+    case 0x9B: /* RES 3,E        */ { E &= ~(1 << 3); } break;
+    case 0x9C: /* RES 3,H        */ { H &= ~(1 << 3); } break;
+    case 0x9D: /* RES 3,L        */ { L &= ~(1 << 3); } break;
+    case 0x9E: /* RES 3,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 3)); T(3); } break;
+    case 0x9F: /* RES 3,A        */ { A &= ~(1 << 3); } break;
+    case 0xA0: /* RES 4,B        */ { B &= ~(1 << 4); } break;
+    case 0xA1: /* RES 4,C        */ { C &= ~(1 << 4); } break;
+    case 0xA2: /* RES 4,D        */ { D &= ~(1 << 4); } break;
+    case 0xA3: /* RES 4,E        */ { E &= ~(1 << 4); } break;
+    case 0xA4: /* RES 4,H        */ { H &= ~(1 << 4); } break;
+    case 0xA5: /* RES 4,L        */ { L &= ~(1 << 4); } break;
+    case 0xA6: /* RES 4,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 4)); T(3); } break;
+    case 0xA7: /* RES 4,A        */ { A &= ~(1 << 4); } break;
+    case 0xA8: /* RES 5,B        */ { B &= ~(1 << 5); } break;
+    case 0xA9: /* RES 5,C        */ { C &= ~(1 << 5); } break;
+    case 0xAA: /* RES 5,D        */ { D &= ~(1 << 5); } break;
+    case 0xAB: /* RES 5,E        */ { E &= ~(1 << 5); } break;
+    case 0xAC: /* RES 5,H        */ { H &= ~(1 << 5); } break;
+    case 0xAD: /* RES 5,L        */ { L &= ~(1 << 5); } break;
+    case 0xAE: /* RES 5,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 5)); T(3); } break;
+    case 0xAF: /* RES 5,A        */ { A &= ~(1 << 5); } break;
+    case 0xB0: /* RES 6,B        */ { B &= ~(1 << 6); } break;
+    case 0xB1: /* RES 6,C        */ { C &= ~(1 << 6); } break;
+    case 0xB2: /* RES 6,D        */ { D &= ~(1 << 6); } break;
+    case 0xB3: /* RES 6,E        */ { E &= ~(1 << 6); } break;
+    case 0xB4: /* RES 6,H        */ { H &= ~(1 << 6); } break;
+    case 0xB5: /* RES 6,L        */ { L &= ~(1 << 6); } break;
+    case 0xB6: /* RES 6,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 6)); T(3); } break;
+    case 0xB7: /* RES 6,A        */ { A &= ~(1 << 6); } break;
+    case 0xB8: /* RES 7,B        */ { B &= ~(1 << 7); } break;
+    case 0xB9: /* RES 7,C        */ { C &= ~(1 << 7); } break;
+    case 0xBA: /* RES 7,D        */ { D &= ~(1 << 7); } break;
+    case 0xBB: /* RES 7,E        */ { E &= ~(1 << 7); } break;
+    case 0xBC: /* RES 7,H        */ { H &= ~(1 << 7); } break;
+    case 0xBD: /* RES 7,L        */ { L &= ~(1 << 7); } break;
+    case 0xBE: /* RES 7,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 7)); T(3); } break;
+    case 0xBF: /* RES 7,A        */ { A &= ~(1 << 7); } break;
+    case 0xC0: /* SET 0,B        */ { B |= 1 << 0; } break;
+    case 0xC1: /* SET 0,C        */ { C |= 1 << 0; } break;
+    case 0xC2: /* SET 0,D        */ { D |= 1 << 0; } break;
+    case 0xC3: /* SET 0,E        */ { E |= 1 << 0; } break;
+    case 0xC4: /* SET 0,H        */ { H |= 1 << 0; } break;
+    case 0xC5: /* SET 0,L        */ { L |= 1 << 0; } break;
+    case 0xC6: /* SET 0,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 0); T(3); } break;
+    case 0xC7: /* SET 0,A        */ { A |= 1 << 0; } break;
+    case 0xC8: /* SET 1,B        */ { B |= 1 << 1; } break;
+    case 0xC9: /* SET 1,C        */ { C |= 1 << 1; } break;
+    case 0xCA: /* SET 1,D        */ { D |= 1 << 1; } break;
+    case 0xCB: /* SET 1,E        */ { E |= 1 << 1; } break;
+    case 0xCC: /* SET 1,H        */ { H |= 1 << 1; } break;
+    case 0xCD: /* SET 1,L        */ { L |= 1 << 1; } break;
+    case 0xCE: /* SET 1,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 1); T(3); } break;
+    case 0xCF: /* SET 1,A        */ { A |= 1 << 1; } break;
+    case 0xD0: /* SET 2,B        */ { B |= 1 << 2; } break;
+    case 0xD1: /* SET 2,C        */ { C |= 1 << 2; } break;
+    case 0xD2: /* SET 2,D        */ { D |= 1 << 2; } break;
+    case 0xD3: /* SET 2,E        */ { E |= 1 << 2; } break;
+    case 0xD4: /* SET 2,H        */ { H |= 1 << 2; } break;
+    case 0xD5: /* SET 2,L        */ { L |= 1 << 2; } break;
+    case 0xD6: /* SET 2,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 2); T(3); } break;
+    case 0xD7: /* SET 2,A        */ { A |= 1 << 2; } break;
+    case 0xD8: /* SET 3,B        */ { B |= 1 << 3; } break;
+    case 0xD9: /* SET 3,C        */ { C |= 1 << 3; } break;
+    case 0xDA: /* SET 3,D        */ { D |= 1 << 3; } break;
+    case 0xDB: /* SET 3,E        */ { E |= 1 << 3; } break;
+    case 0xDC: /* SET 3,H        */ { H |= 1 << 3; } break;
+    case 0xDD: /* SET 3,L        */ { L |= 1 << 3; } break;
+    case 0xDE: /* SET 3,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 3); T(3); } break;
+    case 0xDF: /* SET 3,A        */ { A |= 1 << 3; } break;
+    case 0xE0: /* SET 4,B        */ { B |= 1 << 4; } break;
+    case 0xE1: /* SET 4,C        */ { C |= 1 << 4; } break;
+    case 0xE2: /* SET 4,D        */ { D |= 1 << 4; } break;
+    case 0xE3: /* SET 4,E        */ { E |= 1 << 4; } break;
+    case 0xE4: /* SET 4,H        */ { H |= 1 << 4; } break;
+    case 0xE5: /* SET 4,L        */ { L |= 1 << 4; } break;
+    case 0xE6: /* SET 4,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 4); T(3); } break;
+    case 0xE7: /* SET 4,A        */ { A |= 1 << 4; } break;
+    case 0xE8: /* SET 5,B        */ { B |= 1 << 5; } break;
+    case 0xE9: /* SET 5,C        */ { C |= 1 << 5; } break;
+    case 0xEA: /* SET 5,D        */ { D |= 1 << 5; } break;
+    case 0xEB: /* SET 5,E        */ { E |= 1 << 5; } break;
+    case 0xEC: /* SET 5,H        */ { H |= 1 << 5; } break;
+    case 0xED: /* SET 5,L        */ { L |= 1 << 5; } break;
+    case 0xEE: /* SET 5,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 5); T(3); } break;
+    case 0xEF: /* SET 5,A        */ { A |= 1 << 5; } break;
+    case 0xF0: /* SET 6,B        */ { B |= 1 << 6; } break;
+    case 0xF1: /* SET 6,C        */ { C |= 1 << 6; } break;
+    case 0xF2: /* SET 6,D        */ { D |= 1 << 6; } break;
+    case 0xF3: /* SET 6,E        */ { E |= 1 << 6; } break;
+    case 0xF4: /* SET 6,H        */ { H |= 1 << 6; } break;
+    case 0xF5: /* SET 6,L        */ { L |= 1 << 6; } break;
+    case 0xF6: /* SET 6,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 6); T(3); } break;
+    case 0xF7: /* SET 6,A        */ { A |= 1 << 6; } break;
+    case 0xF8: /* SET 7,B        */ { B |= 1 << 7; } break;
+    case 0xF9: /* SET 7,C        */ { C |= 1 << 7; } break;
+    case 0xFA: /* SET 7,D        */ { D |= 1 << 7; } break;
+    case 0xFB: /* SET 7,E        */ { E |= 1 << 7; } break;
+    case 0xFC: /* SET 7,H        */ { H |= 1 << 7; } break;
+    case 0xFD: /* SET 7,L        */ { L |= 1 << 7; } break;
+    case 0xFE: /* SET 7,(HL)     */ { WZ = HL; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 7); T(3); } break;
+    case 0xFF: /* SET 7,A        */ { A |= 1 << 7; } break;
+    default:
+      log_wrn("cpu: opcode CB%02X at PC=$%04X not implemented\n", opcode, PC - 1);
+      break;
+  }
+}
+
+inline
+static void execute_DDCB(void) {
+  TMP = memory_read(PC++); T(3);  /* displacement */
+  const u8_t opcode = memory_read(PC); T(3);
+  memory_contend(PC); T(1);
+  memory_contend(PC); T(1);
+  PC++;
+  switch (opcode) {
+    case 0x00: /* RLC B          */ { const u8_t carry = B >> 7; B = B << 1 | carry; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x01: /* RLC C          */ { const u8_t carry = C >> 7; C = C << 1 | carry; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x02: /* RLC D          */ { const u8_t carry = D >> 7; D = D << 1 | carry; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x03: /* RLC E          */ { const u8_t carry = E >> 7; E = E << 1 | carry; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x04: /* RLC H          */ { const u8_t carry = H >> 7; H = H << 1 | carry; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x05: /* RLC L          */ { const u8_t carry = L >> 7; L = L << 1 | carry; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x06: /* RLC (IX+d)     */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | carry; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x07: /* RLC A          */ { const u8_t carry = A >> 7; A = A << 1 | carry; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x08: /* RRC B          */ { const u8_t carry = B & 0x01; B = B >> 1 | carry << 7; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x09: /* RRC C          */ { const u8_t carry = C & 0x01; C = C >> 1 | carry << 7; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x0A: /* RRC D          */ { const u8_t carry = D & 0x01; D = D >> 1 | carry << 7; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x0B: /* RRC E          */ { const u8_t carry = E & 0x01; E = E >> 1 | carry << 7; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x0C: /* RRC H          */ { const u8_t carry = H & 0x01; H = H >> 1 | carry << 7; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x0D: /* RRC L          */ { const u8_t carry = L & 0x01; L = L >> 1 | carry << 7; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x0E: /* RRC (IX+d)     */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = TMP >> 1 | carry << 7; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x0F: /* RRC A          */ { const u8_t carry = A & 0x01; A = A >> 1 | carry << 7; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x10: /* RL B           */ { const u8_t carry = B >> 7; B = B << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x11: /* RL C           */ { const u8_t carry = C >> 7; C = C << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x12: /* RL D           */ { const u8_t carry = D >> 7; D = D << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x13: /* RL E           */ { const u8_t carry = E >> 7; E = E << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x14: /* RL H           */ { const u8_t carry = H >> 7; H = H << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x15: /* RL L           */ { const u8_t carry = L >> 7; L = L << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x16: /* RL (IX+d)      */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x17: /* RL A           */ { const u8_t carry = A >> 7; A = A << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x18: /* RR B           */ { const u8_t carry = B & 0x01; B = B >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x19: /* RR C           */ { const u8_t carry = C & 0x01; C = C >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x1A: /* RR D           */ { const u8_t carry = D & 0x01; D = D >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x1B: /* RR E           */ { const u8_t carry = E & 0x01; E = E >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x1C: /* RR H           */ { const u8_t carry = H & 0x01; H = H >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x1D: /* RR L           */ { const u8_t carry = L & 0x01; L = L >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x1E: /* RR (IX+d)      */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = TMP >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x1F: /* RR A           */ { const u8_t carry = A & 0x01; A = A >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x20: /* SLA B          */ { const u8_t carry = B >> 7; B <<= 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x21: /* SLA C          */ { const u8_t carry = C >> 7; C <<= 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x22: /* SLA D          */ { const u8_t carry = D >> 7; D <<= 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x23: /* SLA E          */ { const u8_t carry = E >> 7; E <<= 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x24: /* SLA H          */ { const u8_t carry = H >> 7; H <<= 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x25: /* SLA L          */ { const u8_t carry = L >> 7; L <<= 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x26: /* SLA (IX+d)     */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP <<= 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x27: /* SLA A          */ { const u8_t carry = A >> 7; A <<= 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x28: /* SRA B          */ { const u8_t carry = B & 0x01; B = (B & 0x80) | B >> 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x29: /* SRA C          */ { const u8_t carry = C & 0x01; C = (C & 0x80) | C >> 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x2A: /* SRA D          */ { const u8_t carry = D & 0x01; D = (D & 0x80) | D >> 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x2B: /* SRA E          */ { const u8_t carry = E & 0x01; E = (E & 0x80) | E >> 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x2C: /* SRA H          */ { const u8_t carry = H & 0x01; H = (H & 0x80) | H >> 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x2D: /* SRA L          */ { const u8_t carry = L & 0x01; L = (L & 0x80) | L >> 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x2E: /* SRA (IX+d)     */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = (TMP & 0x80) | TMP >> 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x2F: /* SRA A          */ { const u8_t carry = A & 0x01; A = (A & 0x80) | A >> 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x30: /* SLL B          */ { const u8_t carry = B >> 7; B = B << 1 | 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x31: /* SLL C          */ { const u8_t carry = C >> 7; C = C << 1 | 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x32: /* SLL D          */ { const u8_t carry = D >> 7; D = D << 1 | 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x33: /* SLL E          */ { const u8_t carry = E >> 7; E = E << 1 | 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x34: /* SLL H          */ { const u8_t carry = H >> 7; H = H << 1 | 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x35: /* SLL L          */ { const u8_t carry = L >> 7; L = L << 1 | 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x36: /* SLL (IX+d)     */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x37: /* SLL A          */ { const u8_t carry = A >> 7; A = A << 1 | 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x38: /* SRL B          */ { const u8_t carry = B & 0x01; B >>= 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x39: /* SRL C          */ { const u8_t carry = C & 0x01; C >>= 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x3A: /* SRL D          */ { const u8_t carry = D & 0x01; D >>= 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x3B: /* SRL E          */ { const u8_t carry = E & 0x01; E >>= 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x3C: /* SRL H          */ { const u8_t carry = H & 0x01; H >>= 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x3D: /* SRL L          */ { const u8_t carry = L & 0x01; L >>= 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x3E: /* SRL (IX+d)     */ { u8_t carry; WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP >>= 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x3F: /* SRL A          */ { const u8_t carry = A & 0x01; A >>= 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x40: /* BIT 0,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x41: /* BIT 0,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x42: /* BIT 0,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x43: /* BIT 0,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x44: /* BIT 0,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x45: /* BIT 0,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x46: /* BIT 0,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x47: /* BIT 0,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x48: /* BIT 1,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x49: /* BIT 1,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4A: /* BIT 1,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4B: /* BIT 1,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4C: /* BIT 1,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4D: /* BIT 1,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4E: /* BIT 1,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4F: /* BIT 1,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x50: /* BIT 2,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x51: /* BIT 2,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x52: /* BIT 2,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x53: /* BIT 2,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x54: /* BIT 2,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x55: /* BIT 2,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x56: /* BIT 2,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x57: /* BIT 2,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x58: /* BIT 3,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x59: /* BIT 3,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5A: /* BIT 3,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5B: /* BIT 3,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5C: /* BIT 3,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5D: /* BIT 3,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5E: /* BIT 3,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5F: /* BIT 3,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x60: /* BIT 4,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x61: /* BIT 4,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x62: /* BIT 4,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x63: /* BIT 4,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x64: /* BIT 4,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x65: /* BIT 4,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x66: /* BIT 4,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x67: /* BIT 4,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x68: /* BIT 5,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x69: /* BIT 5,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6A: /* BIT 5,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6B: /* BIT 5,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6C: /* BIT 5,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6D: /* BIT 5,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6E: /* BIT 5,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6F: /* BIT 5,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x70: /* BIT 6,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x71: /* BIT 6,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x72: /* BIT 6,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x73: /* BIT 6,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x74: /* BIT 6,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x75: /* BIT 6,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x76: /* BIT 6,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x77: /* BIT 6,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x78: /* BIT 7,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x79: /* BIT 7,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7A: /* BIT 7,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7B: /* BIT 7,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7C: /* BIT 7,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7D: /* BIT 7,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7E: /* BIT 7,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7F: /* BIT 7,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x80: /* RES 0,B        */ { B &= ~(1 << 0); } break;
+    case 0x81: /* RES 0,C        */ { C &= ~(1 << 0); } break;
+    case 0x82: /* RES 0,D        */ { D &= ~(1 << 0); } break;
+    case 0x83: /* RES 0,E        */ { E &= ~(1 << 0); } break;
+    case 0x84: /* RES 0,H        */ { H &= ~(1 << 0); } break;
+    case 0x85: /* RES 0,L        */ { L &= ~(1 << 0); } break;
+    case 0x86: /* RES 0,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 0)); T(3); } break;
+    case 0x87: /* RES 0,A        */ { A &= ~(1 << 0); } break;
+    case 0x88: /* RES 1,B        */ { B &= ~(1 << 1); } break;
+    case 0x89: /* RES 1,C        */ { C &= ~(1 << 1); } break;
+    case 0x8A: /* RES 1,D        */ { D &= ~(1 << 1); } break;
+    case 0x8B: /* RES 1,E        */ { E &= ~(1 << 1); } break;
+    case 0x8C: /* RES 1,H        */ { H &= ~(1 << 1); } break;
+    case 0x8D: /* RES 1,L        */ { L &= ~(1 << 1); } break;
+    case 0x8E: /* RES 1,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 1)); T(3); } break;
+    case 0x8F: /* RES 1,A        */ { A &= ~(1 << 1); } break;
+    case 0x90: /* RES 2,B        */ { B &= ~(1 << 2); } break;
+    case 0x91: /* RES 2,C        */ { C &= ~(1 << 2); } break;
+    case 0x92: /* RES 2,D        */ { D &= ~(1 << 2); } break;
+    case 0x93: /* RES 2,E        */ { E &= ~(1 << 2); } break;
+    case 0x94: /* RES 2,H        */ { H &= ~(1 << 2); } break;
+    case 0x95: /* RES 2,L        */ { L &= ~(1 << 2); } break;
+    case 0x96: /* RES 2,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 2)); T(3); } break;
+    case 0x97: /* RES 2,A        */ { A &= ~(1 << 2); } break;
+    case 0x98: /* RES 3,B        */ { B &= ~(1 << 3); } break;
+    case 0x99: /* RES 3,C        */ { C &= ~(1 << 3); } break;
+    case 0x9A: /* RES 3,D        */ { D &= ~(1 << 3); } break;
+    case 0x9B: /* RES 3,E        */ { E &= ~(1 << 3); } break;
+    case 0x9C: /* RES 3,H        */ { H &= ~(1 << 3); } break;
+    case 0x9D: /* RES 3,L        */ { L &= ~(1 << 3); } break;
+    case 0x9E: /* RES 3,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 3)); T(3); } break;
+    case 0x9F: /* RES 3,A        */ { A &= ~(1 << 3); } break;
+    case 0xA0: /* RES 4,B        */ { B &= ~(1 << 4); } break;
+    case 0xA1: /* RES 4,C        */ { C &= ~(1 << 4); } break;
+    case 0xA2: /* RES 4,D        */ { D &= ~(1 << 4); } break;
+    case 0xA3: /* RES 4,E        */ { E &= ~(1 << 4); } break;
+    case 0xA4: /* RES 4,H        */ { H &= ~(1 << 4); } break;
+    case 0xA5: /* RES 4,L        */ { L &= ~(1 << 4); } break;
+    case 0xA6: /* RES 4,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 4)); T(3); } break;
+    case 0xA7: /* RES 4,A        */ { A &= ~(1 << 4); } break;
+    case 0xA8: /* RES 5,B        */ { B &= ~(1 << 5); } break;
+    case 0xA9: /* RES 5,C        */ { C &= ~(1 << 5); } break;
+    case 0xAA: /* RES 5,D        */ { D &= ~(1 << 5); } break;
+    case 0xAB: /* RES 5,E        */ { E &= ~(1 << 5); } break;
+    case 0xAC: /* RES 5,H        */ { H &= ~(1 << 5); } break;
+    case 0xAD: /* RES 5,L        */ { L &= ~(1 << 5); } break;
+    case 0xAE: /* RES 5,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 5)); T(3); } break;
+    case 0xAF: /* RES 5,A        */ { A &= ~(1 << 5); } break;
+    case 0xB0: /* RES 6,B        */ { B &= ~(1 << 6); } break;
+    case 0xB1: /* RES 6,C        */ { C &= ~(1 << 6); } break;
+    case 0xB2: /* RES 6,D        */ { D &= ~(1 << 6); } break;
+    case 0xB3: /* RES 6,E        */ { E &= ~(1 << 6); } break;
+    case 0xB4: /* RES 6,H        */ { H &= ~(1 << 6); } break;
+    case 0xB5: /* RES 6,L        */ { L &= ~(1 << 6); } break;
+    case 0xB6: /* RES 6,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 6)); T(3); } break;
+    case 0xB7: /* RES 6,A        */ { A &= ~(1 << 6); } break;
+    case 0xB8: /* RES 7,B        */ { B &= ~(1 << 7); } break;
+    case 0xB9: /* RES 7,C        */ { C &= ~(1 << 7); } break;
+    case 0xBA: /* RES 7,D        */ { D &= ~(1 << 7); } break;
+    case 0xBB: /* RES 7,E        */ { E &= ~(1 << 7); } break;
+    case 0xBC: /* RES 7,H        */ { H &= ~(1 << 7); } break;
+    case 0xBD: /* RES 7,L        */ { L &= ~(1 << 7); } break;
+    case 0xBE: /* RES 7,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 7)); T(3); } break;
+    case 0xBF: /* RES 7,A        */ { A &= ~(1 << 7); } break;
+    case 0xC0: /* SET 0,B        */ { B |= 1 << 0; } break;
+    case 0xC1: /* SET 0,C        */ { C |= 1 << 0; } break;
+    case 0xC2: /* SET 0,D        */ { D |= 1 << 0; } break;
+    case 0xC3: /* SET 0,E        */ { E |= 1 << 0; } break;
+    case 0xC4: /* SET 0,H        */ { H |= 1 << 0; } break;
+    case 0xC5: /* SET 0,L        */ { L |= 1 << 0; } break;
+    case 0xC6: /* SET 0,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 0); T(3); } break;
+    case 0xC7: /* SET 0,A        */ { A |= 1 << 0; } break;
+    case 0xC8: /* SET 1,B        */ { B |= 1 << 1; } break;
+    case 0xC9: /* SET 1,C        */ { C |= 1 << 1; } break;
+    case 0xCA: /* SET 1,D        */ { D |= 1 << 1; } break;
+    case 0xCB: /* SET 1,E        */ { E |= 1 << 1; } break;
+    case 0xCC: /* SET 1,H        */ { H |= 1 << 1; } break;
+    case 0xCD: /* SET 1,L        */ { L |= 1 << 1; } break;
+    case 0xCE: /* SET 1,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 1); T(3); } break;
+    case 0xCF: /* SET 1,A        */ { A |= 1 << 1; } break;
+    case 0xD0: /* SET 2,B        */ { B |= 1 << 2; } break;
+    case 0xD1: /* SET 2,C        */ { C |= 1 << 2; } break;
+    case 0xD2: /* SET 2,D        */ { D |= 1 << 2; } break;
+    case 0xD3: /* SET 2,E        */ { E |= 1 << 2; } break;
+    case 0xD4: /* SET 2,H        */ { H |= 1 << 2; } break;
+    case 0xD5: /* SET 2,L        */ { L |= 1 << 2; } break;
+    case 0xD6: /* SET 2,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 2); T(3); } break;
+    case 0xD7: /* SET 2,A        */ { A |= 1 << 2; } break;
+    case 0xD8: /* SET 3,B        */ { B |= 1 << 3; } break;
+    case 0xD9: /* SET 3,C        */ { C |= 1 << 3; } break;
+    case 0xDA: /* SET 3,D        */ { D |= 1 << 3; } break;
+    case 0xDB: /* SET 3,E        */ { E |= 1 << 3; } break;
+    case 0xDC: /* SET 3,H        */ { H |= 1 << 3; } break;
+    case 0xDD: /* SET 3,L        */ { L |= 1 << 3; } break;
+    case 0xDE: /* SET 3,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 3); T(3); } break;
+    case 0xDF: /* SET 3,A        */ { A |= 1 << 3; } break;
+    case 0xE0: /* SET 4,B        */ { B |= 1 << 4; } break;
+    case 0xE1: /* SET 4,C        */ { C |= 1 << 4; } break;
+    case 0xE2: /* SET 4,D        */ { D |= 1 << 4; } break;
+    case 0xE3: /* SET 4,E        */ { E |= 1 << 4; } break;
+    case 0xE4: /* SET 4,H        */ { H |= 1 << 4; } break;
+    case 0xE5: /* SET 4,L        */ { L |= 1 << 4; } break;
+    case 0xE6: /* SET 4,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 4); T(3); } break;
+    case 0xE7: /* SET 4,A        */ { A |= 1 << 4; } break;
+    case 0xE8: /* SET 5,B        */ { B |= 1 << 5; } break;
+    case 0xE9: /* SET 5,C        */ { C |= 1 << 5; } break;
+    case 0xEA: /* SET 5,D        */ { D |= 1 << 5; } break;
+    case 0xEB: /* SET 5,E        */ { E |= 1 << 5; } break;
+    case 0xEC: /* SET 5,H        */ { H |= 1 << 5; } break;
+    case 0xED: /* SET 5,L        */ { L |= 1 << 5; } break;
+    case 0xEE: /* SET 5,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 5); T(3); } break;
+    case 0xEF: /* SET 5,A        */ { A |= 1 << 5; } break;
+    case 0xF0: /* SET 6,B        */ { B |= 1 << 6; } break;
+    case 0xF1: /* SET 6,C        */ { C |= 1 << 6; } break;
+    case 0xF2: /* SET 6,D        */ { D |= 1 << 6; } break;
+    case 0xF3: /* SET 6,E        */ { E |= 1 << 6; } break;
+    case 0xF4: /* SET 6,H        */ { H |= 1 << 6; } break;
+    case 0xF5: /* SET 6,L        */ { L |= 1 << 6; } break;
+    case 0xF6: /* SET 6,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 6); T(3); } break;
+    case 0xF7: /* SET 6,A        */ { A |= 1 << 6; } break;
+    case 0xF8: /* SET 7,B        */ { B |= 1 << 7; } break;
+    case 0xF9: /* SET 7,C        */ { C |= 1 << 7; } break;
+    case 0xFA: /* SET 7,D        */ { D |= 1 << 7; } break;
+    case 0xFB: /* SET 7,E        */ { E |= 1 << 7; } break;
+    case 0xFC: /* SET 7,H        */ { H |= 1 << 7; } break;
+    case 0xFD: /* SET 7,L        */ { L |= 1 << 7; } break;
+    case 0xFE: /* SET 7,(IX+d)   */ { WZ = IX + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 7); T(3); } break;
+    case 0xFF: /* SET 7,A        */ { A |= 1 << 7; } break;
+    default:
+      log_wrn("cpu: opcode DDCB%02X at PC=$%04X not implemented\n", opcode, PC - 1);
+      break;
+  }
+}
+
+inline
+static void execute_DD(void) {
+  const u8_t opcode = memory_read(PC++); T(4);
+  switch (opcode) {
+    case 0x00: /* NOP            */ {  } break;
+    case 0x01: /* LD BC,nn       */ { C = memory_read(PC++); T(3); B = memory_read(PC++); T(3); } break;
+    case 0x02: /* LD (BC),A      */ { WZ = BC; memory_write(WZ, A); T(3); } break;
+    case 0x03: /* INC BC         */ { BC++; T(2); } break;
+    case 0x04: /* INC B          */ { B++; F = SZ53(B) | HF_ADD(B - 1, 1, B) | (B == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x05: /* DEC B          */ { B--; F = SZ53(B) | HF_SUB(B + 1, 1, B) | (B == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x06: /* LD B,n         */ { B = memory_read(PC++); T(3); } break;
+    case 0x07: /* RLCA           */ { const u8_t carry = A >> 7; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= carry << CF_SHIFT; A <<= 1; A |= carry; } break;
+    case 0x08: /* EX AF,AF'      */ { const u16_t tmp = AF; AF = AF_; AF_ = tmp; } break;
+    case 0x09: /* ADD IX,BC      */ { const u16_t prev = IX; const u8_t carry = IX > 0xFFFF - BC; IX += BC; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, BC >> 8, IX >> 8) | carry; T(7); } break;
+    case 0x0A: /* LD A,(BC)      */ { WZ = BC; A = memory_read(WZ); T(3); } break;
+    case 0x0B: /* DEC BC         */ { BC--; T(2); } break;
+    case 0x0C: /* INC C          */ { C++; F = SZ53(C) | HF_ADD(C - 1, 1, C) | (C == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x0D: /* DEC C          */ { C--; F = SZ53(C) | HF_SUB(C + 1, 1, C) | (C == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x0E: /* LD C,n         */ { C = memory_read(PC++); T(3); } break;
+    case 0x0F: /* RRCA           */ { const u8_t carry = A & 0x01; F &= ~(NF_MASK | HF_MASK | CF_MASK); F |= carry << CF_SHIFT; A >>= 1; A |= carry << 7; } break;
+    case 0x10: /* DJNZ e         */ { T(1); Z = memory_read(PC); T(3); if (--B) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x11: /* LD DE,nn       */ { E = memory_read(PC++); T(3); D = memory_read(PC++); T(3); } break;
+    case 0x12: /* LD (DE),A      */ { WZ = DE; memory_write(WZ, A); T(3); } break;
+    case 0x13: /* INC DE         */ { DE++; T(2); } break;
+    case 0x14: /* INC D          */ { D++; F = SZ53(D) | HF_ADD(D - 1, 1, D) | (D == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x15: /* DEC D          */ { D--; F = SZ53(D) | HF_SUB(D + 1, 1, D) | (D == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x16: /* LD D,n         */ { D = memory_read(PC++); T(3); } break;
+    case 0x17: /* RLA            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= (A & 0x80) >> 7 << CF_SHIFT; A <<= 1; A |= carry; } break;
+    case 0x18: /* JR e           */ { Z = memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; PC++; } break;
+    case 0x19: /* ADD IX,DE      */ { const u16_t prev = IX; const u8_t carry = IX > 0xFFFF - DE; IX += DE; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, DE >> 8, IX >> 8) | carry; T(7); } break;
+    case 0x1A: /* LD A,(DE)      */ { WZ = DE; A = memory_read(WZ); T(3); } break;
+    case 0x1B: /* DEC DE         */ { DE--; T(2); } break;
+    case 0x1C: /* INC E          */ { E++; F = SZ53(E) | HF_ADD(E - 1, 1, E) | (E == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x1D: /* DEC E          */ { E--; F = SZ53(E) | HF_SUB(E + 1, 1, E) | (E == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x1E: /* LD E,n         */ { E = memory_read(PC++); T(3); } break;
+    case 0x1F: /* RRA            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= (A & 0x01) << CF_SHIFT; A >>= 1; A |= carry << 7; } break;
+    case 0x20: /* JR NZ,e        */ { Z = memory_read(PC); T(3); if (!ZF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x21: /* LD IX,nn       */ { IXL = memory_read(PC++); T(3); IXH = memory_read(PC++); T(3); } break;
+    case 0x22: /* LD (nn),IX     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, IXL); T(3); memory_write(WZ + 1, IXH); T(3); } break;
+    case 0x23: /* INC IX         */ { IX++; T(2); } break;
+    case 0x24: /* INC IXH        */ { IXH++; F = SZ53(IXH) | HF_ADD(IXH - 1, 1, IXH) | (IXH == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x25: /* DEC IXH        */ { IXH--; F = SZ53(IXH) | HF_SUB(IXH + 1, 1, IXH) | (IXH == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x26: /* LD IXH,n       */ { IXH = memory_read(PC++); T(3); } break;
+    case 0x27: /* DAA            */ { const u8_t a = A; u8_t correction = 0; if ((F & HF_MASK) || ((A & 0x0F) > 9)) correction += 0x06; if ((F & CF_MASK) || (A > 0x99)) correction += 0x60; if (F & NF_MASK) { A -= correction; } else { A += correction; } F &= NF_MASK | CF_MASK; F |= SZ53P(A) | (a > 0x99) << CF_SHIFT | ((a ^ A) & 0x10) >> 4 << HF_SHIFT; } break;
+    case 0x28: /* JR Z,e         */ { Z = memory_read(PC); T(3); if (ZF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x29: /* ADD IX,IX      */ { const u16_t prev = IX; const u8_t carry = IX > 0xFFFF - IX; IX += IX; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, IX >> 8, IX >> 8) | carry; T(7); } break;
+    case 0x2A: /* LD IX,(nn)     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); IXL = memory_read(WZ); T(3); IXH = memory_read(WZ + 1); T(3); } break;
+    case 0x2B: /* DEC IX         */ { IX--; T(2); } break;
+    case 0x2C: /* INC IXL        */ { IXL++; F = SZ53(IXL) | HF_ADD(IXL - 1, 1, IXL) | (IXL == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x2D: /* DEC IXL        */ { IXL--; F = SZ53(IXL) | HF_SUB(IXL + 1, 1, IXL) | (IXL == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x2E: /* LD IXL,n       */ { IXL = memory_read(PC++); T(3); } break;
+    case 0x2F: /* CPL            */ { A = ~A; F |= HF_MASK | NF_MASK; } break;
+    case 0x30: /* JR NC,e        */ { Z = memory_read(PC); T(3); if (!CF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x31: /* LD SP,nn       */ { P = memory_read(PC++); T(3); S = memory_read(PC++); T(3); } break;
+    case 0x32: /* LD (nn),A      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, A); T(3); } break;
+    case 0x33: /* INC SP         */ { SP++; T(2); } break;
+    case 0x34: /* INC (IX+d)     */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ) + 1; T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP); T(3); F = SZ53(TMP) | HF_ADD(TMP - 1, 1, TMP) | (TMP == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x35: /* DEC (IX+d)     */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ) - 1; T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP); T(3); F = SZ53(TMP) | HF_SUB(TMP + 1, 1, TMP) | (TMP == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x36: /* LD (IX+d),n    */ { WZ = IX + (s8_t) memory_read(PC); T(3); PC++; TMP = memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_write(WZ, TMP); T(3); PC++; } break;
+    case 0x37: /* SCF            */ { F &= ~(HF_MASK | NF_MASK); F |= CF_MASK; } break;
+    case 0x38: /* JR C,e         */ { Z = memory_read(PC); T(3); if (CF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x39: /* ADD IX,SP      */ { const u16_t prev = IX; const u8_t carry = IX > 0xFFFF - SP; IX += SP; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, SP >> 8, IX >> 8) | carry; T(7); } break;
+    case 0x3A: /* LD A,(nn)      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); A = memory_read(WZ); T(3); } break;
+    case 0x3B: /* DEC SP         */ { SP--; T(2); } break;
+    case 0x3C: /* INC A          */ { A++; F = SZ53(A) | HF_ADD(A - 1, 1, A) | (A == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x3D: /* DEC A          */ { A--; F = SZ53(A) | HF_SUB(A + 1, 1, A) | (A == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x3E: /* LD A,n         */ { A = memory_read(PC++); T(3); } break;
+    case 0x3F: /* CCF            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= carry << HF_SHIFT | (1 - carry) << CF_SHIFT; } break;
+    case 0x40: /* LD B,B         */ { B = B; } break;
+    case 0x41: /* LD B,C         */ { B = C; } break;
+    case 0x42: /* LD B,D         */ { B = D; } break;
+    case 0x43: /* LD B,E         */ { B = E; } break;
+    case 0x44: /* LD B,IXH       */ { B = IXH; } break;
+    case 0x45: /* LD B,IXL       */ { B = IXL; } break;
+    case 0x46: /* LD B,(IX+d)    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; B = memory_read(WZ); T(3); } break;
+    case 0x47: /* LD B,A         */ { B = A; } break;
+    case 0x48: /* LD C,B         */ { C = B; } break;
+    case 0x49: /* LD C,C         */ { C = C; } break;
+    case 0x4A: /* LD C,D         */ { C = D; } break;
+    case 0x4B: /* LD C,E         */ { C = E; } break;
+    case 0x4C: /* LD C,IXH       */ { C = IXH; } break;
+    case 0x4D: /* LD C,IXL       */ { C = IXL; } break;
+    case 0x4E: /* LD C,(IX+d)    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; C = memory_read(WZ); T(3); } break;
+    case 0x4F: /* LD C,A         */ { C = A; } break;
+    case 0x50: /* LD D,B         */ { D = B; } break;
+    case 0x51: /* LD D,C         */ { D = C; } break;
+    case 0x52: /* LD D,D         */ { D = D; } break;
+    case 0x53: /* LD D,E         */ { D = E; } break;
+    case 0x54: /* LD D,IXH       */ { D = IXH; } break;
+    case 0x55: /* LD D,IXL       */ { D = IXL; } break;
+    case 0x56: /* LD D,(IX+d)    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; D = memory_read(WZ); T(3); } break;
+    case 0x57: /* LD D,A         */ { D = A; } break;
+    case 0x58: /* LD E,B         */ { E = B; } break;
+    case 0x59: /* LD E,C         */ { E = C; } break;
+    case 0x5A: /* LD E,D         */ { E = D; } break;
+    case 0x5B: /* LD E,E         */ { E = E; } break;
+    case 0x5C: /* LD E,IXH       */ { E = IXH; } break;
+    case 0x5D: /* LD E,IXL       */ { E = IXL; } break;
+    case 0x5E: /* LD E,(IX+d)    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; E = memory_read(WZ); T(3); } break;
+    case 0x5F: /* LD E,A         */ { E = A; } break;
+    case 0x60: /* LD IXH,B       */ { IXH = B; } break;
+    case 0x61: /* LD IXH,C       */ { IXH = C; } break;
+    case 0x62: /* LD IXH,D       */ { IXH = D; } break;
+    case 0x63: /* LD IXH,E       */ { IXH = E; } break;
+    case 0x64: /* LD IXH,IXH     */ { IXH = IXH; } break;
+    case 0x65: /* LD IXH,IXL     */ { IXH = IXL; } break;
+    case 0x66: /* LD H,(IX+d)    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; H = memory_read(WZ); T(3); } break;
+    case 0x67: /* LD IXH,A       */ { IXH = A; } break;
+    case 0x68: /* LD IXL,B       */ { IXL = B; } break;
+    case 0x69: /* LD IXL,C       */ { IXL = C; } break;
+    case 0x6A: /* LD IXL,D       */ { IXL = D; } break;
+    case 0x6B: /* LD IXL,E       */ { IXL = E; } break;
+    case 0x6C: /* LD IXL,IXH     */ { IXL = IXH; } break;
+    case 0x6D: /* LD IXL,IXL     */ { IXL = IXL; } break;
+    case 0x6E: /* LD L,(IX+d)    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; L = memory_read(WZ); T(3); } break;
+    case 0x6F: /* LD IXL,A       */ { IXL = A; } break;
+    case 0x70: /* LD (IX+d),B    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, B); T(3); } break;
+    case 0x71: /* LD (IX+d),C    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, C); T(3); } break;
+    case 0x72: /* LD (IX+d),D    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, D); T(3); } break;
+    case 0x73: /* LD (IX+d),E    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, E); T(3); } break;
+    case 0x74: /* LD (IX+d),H    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, H); T(3); } break;
+    case 0x75: /* LD (IX+d),L    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, L); T(3); } break;
+    case 0x76: /* HALT           */ { if (!(self.requests & CPU_REQUEST_IRQ) || (IFF1 == 0)) { PC--; self.is_halted = 1; } } break;
+    case 0x77: /* LD (IX+d),A    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, A); T(3); } break;
+    case 0x78: /* LD A,B         */ { A = B; } break;
+    case 0x79: /* LD A,C         */ { A = C; } break;
+    case 0x7A: /* LD A,D         */ { A = D; } break;
+    case 0x7B: /* LD A,E         */ { A = E; } break;
+    case 0x7C: /* LD A,IXH       */ { A = IXH; } break;
+    case 0x7D: /* LD A,IXL       */ { A = IXL; } break;
+    case 0x7E: /* LD A,(IX+d)    */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A = memory_read(WZ); T(3); } break;
+    case 0x7F: /* LD A,A         */ { A = A; } break;
+    case 0x80: /* ADD A,B        */ { const u16_t result = A + B; F = SZ53(result & 0xFF) | HF_ADD(A, B, result) | VF_ADD(A, B, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x81: /* ADD A,C        */ { const u16_t result = A + C; F = SZ53(result & 0xFF) | HF_ADD(A, C, result) | VF_ADD(A, C, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x82: /* ADD A,D        */ { const u16_t result = A + D; F = SZ53(result & 0xFF) | HF_ADD(A, D, result) | VF_ADD(A, D, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x83: /* ADD A,E        */ { const u16_t result = A + E; F = SZ53(result & 0xFF) | HF_ADD(A, E, result) | VF_ADD(A, E, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x84: /* ADD A,IXH      */ { const u16_t result = A + IXH; F = SZ53(result & 0xFF) | HF_ADD(A, IXH, result) | VF_ADD(A, IXH, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x85: /* ADD A,IXL      */ { const u16_t result = A + IXL; F = SZ53(result & 0xFF) | HF_ADD(A, IXL, result) | VF_ADD(A, IXL, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x86: /* ADD A,(IX+d)   */ { u16_t result; WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A + TMP; F = SZ53(result & 0xFF) | HF_ADD(A, TMP, result) | VF_ADD(A, TMP, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x87: /* ADD A,A        */ { const u16_t result = A + A; F = SZ53(result & 0xFF) | HF_ADD(A, A, result) | VF_ADD(A, A, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x88: /* ADC A,B        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + B + carry; F = SZ53(result & 0xFF) | HF_ADD(A, B, result) | VF_ADD(A, B, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x89: /* ADC A,C        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + C + carry; F = SZ53(result & 0xFF) | HF_ADD(A, C, result) | VF_ADD(A, C, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8A: /* ADC A,D        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + D + carry; F = SZ53(result & 0xFF) | HF_ADD(A, D, result) | VF_ADD(A, D, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8B: /* ADC A,E        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + E + carry; F = SZ53(result & 0xFF) | HF_ADD(A, E, result) | VF_ADD(A, E, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8C: /* ADC A,IXH      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + IXH + carry; F = SZ53(result & 0xFF) | HF_ADD(A, IXH, result) | VF_ADD(A, IXH, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8D: /* ADC A,IXL      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + IXL + carry; F = SZ53(result & 0xFF) | HF_ADD(A, IXL, result) | VF_ADD(A, IXL, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8E: /* ADC A,(IX+d)   */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A + TMP + carry; F = SZ53(result & 0xFF) | HF_ADD(A, TMP, result) | VF_ADD(A, TMP, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8F: /* ADC A,A        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + A + carry; F = SZ53(result & 0xFF) | HF_ADD(A, A, result) | VF_ADD(A, A, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x90: /* SUB B          */ { const u16_t result = A - B; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x91: /* SUB C          */ { const u16_t result = A - C; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x92: /* SUB D          */ { const u16_t result = A - D; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x93: /* SUB E          */ { const u16_t result = A - E; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x94: /* SUB IXH        */ { const u16_t result = A - IXH; F = SZ53(result & 0xFF) | HF_SUB(A, IXH, result) | VF_SUB(A, IXH, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x95: /* SUB IXL        */ { const u16_t result = A - IXL; F = SZ53(result & 0xFF) | HF_SUB(A, IXL, result) | VF_SUB(A, IXL, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x96: /* SUB (IX+d)     */ { u16_t result; WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x97: /* SUB A          */ { const u16_t result = A - A; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x98: /* SBC A,B        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - B - carry; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x99: /* SBC A,C        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - C - carry; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9A: /* SBC A,D        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - D - carry; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9B: /* SBC A,E        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - E - carry; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9C: /* SBC A,IXH      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - IXH - carry; F = SZ53(result & 0xFF) | HF_SUB(A, IXH, result) | VF_SUB(A, IXH, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9D: /* SBC A,IXL      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - IXL - carry; F = SZ53(result & 0xFF) | HF_SUB(A, IXL, result) | VF_SUB(A, IXL, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9E: /* SBC A,(IX+d)   */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A - TMP - carry; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9F: /* SBC A,A        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - A - carry; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xA0: /* AND B          */ { A &= B; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA1: /* AND C          */ { A &= C; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA2: /* AND D          */ { A &= D; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA3: /* AND E          */ { A &= E; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA4: /* AND IXH        */ { A &= IXH; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA5: /* AND IXL        */ { A &= IXL; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA6: /* AND (IX+d)     */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A &= memory_read(WZ); T(3); F = SZ53P(A) | HF_MASK; } break;
+    case 0xA7: /* AND A          */ { A &= A; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA8: /* XOR B          */ { A ^= B; F = SZ53P(A) | 0; } break;
+    case 0xA9: /* XOR C          */ { A ^= C; F = SZ53P(A) | 0; } break;
+    case 0xAA: /* XOR D          */ { A ^= D; F = SZ53P(A) | 0; } break;
+    case 0xAB: /* XOR E          */ { A ^= E; F = SZ53P(A) | 0; } break;
+    case 0xAC: /* XOR IXH        */ { A ^= IXH; F = SZ53P(A) | 0; } break;
+    case 0xAD: /* XOR IXL        */ { A ^= IXL; F = SZ53P(A) | 0; } break;
+    case 0xAE: /* XOR (IX+d)     */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A ^= memory_read(WZ); T(3); F = SZ53P(A) | 0; } break;
+    case 0xAF: /* XOR A          */ { A ^= A; F = SZ53P(A) | 0; } break;
+    case 0xB0: /* OR B           */ { A |= B; F = SZ53P(A) | 0; } break;
+    case 0xB1: /* OR C           */ { A |= C; F = SZ53P(A) | 0; } break;
+    case 0xB2: /* OR D           */ { A |= D; F = SZ53P(A) | 0; } break;
+    case 0xB3: /* OR E           */ { A |= E; F = SZ53P(A) | 0; } break;
+    case 0xB4: /* OR IXH         */ { A |= IXH; F = SZ53P(A) | 0; } break;
+    case 0xB5: /* OR IXL         */ { A |= IXL; F = SZ53P(A) | 0; } break;
+    case 0xB6: /* OR (IX+d)      */ { WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A |= memory_read(WZ); T(3); F = SZ53P(A) | 0; } break;
+    case 0xB7: /* OR A           */ { A |= A; F = SZ53P(A) | 0; } break;
+    case 0xB8: /* CP B           */ { const u16_t result = A - B; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xB9: /* CP C           */ { const u16_t result = A - C; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBA: /* CP D           */ { const u16_t result = A - D; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBB: /* CP E           */ { const u16_t result = A - E; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBC: /* CP IXH         */ { const u16_t result = A - IXH; F = SZ53(result & 0xFF) | HF_SUB(A, IXH, result) | VF_SUB(A, IXH, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBD: /* CP IXL         */ { const u16_t result = A - IXL; F = SZ53(result & 0xFF) | HF_SUB(A, IXL, result) | VF_SUB(A, IXL, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBE: /* CP (IX+d)      */ { u16_t result; WZ = IX + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBF: /* CP A           */ { const u16_t result = A - A; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xC0: /* RET NZ         */ { T(1); if (!(F & ZF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xC1: /* POP BC         */ { C = memory_read(SP++); T(3); B = memory_read(SP++); T(3); } break;
+    case 0xC2: /* JP NZ,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & ZF_MASK)) { PC = WZ; } } break;
+    case 0xC3: /* JP nn          */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); PC = WZ; } break;
+    case 0xC4: /* CALL NZ,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & ZF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xC5: /* PUSH BC        */ { T(1); memory_write(--SP, B); T(3); memory_write(--SP, C); T(3); } break;
+    case 0xC6: /* ADD A,n        */ { const u8_t n = memory_read(PC++); T(3); const u16_t result = A + n; F = SZ53(result & 0xFF) | HF_ADD(A, n, result) | VF_ADD(A, n, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xC7: /* RST $00        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x00; } break;
+    case 0xC8: /* RET Z          */ { T(1); if (F & ZF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xC9: /* RET            */ { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } break;
+    case 0xCA: /* JP Z,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & ZF_MASK) { PC = WZ; } } break;
+    case 0xCB: execute_DDCB(); break;
+    case 0xCC: /* CALL Z,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & ZF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xCD: /* CALL nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } break;
+    case 0xCE: /* ADC A,n        */ { const u8_t n = memory_read(PC++); T(3); const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + n + carry; F = SZ53(result & 0xFF) | HF_ADD(A, n, result) | VF_ADD(A, n, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xCF: /* RST $08        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x08; } break;
+    case 0xD0: /* RET NC         */ { T(1); if (!(F & CF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xD1: /* POP DE         */ { E = memory_read(SP++); T(3); D = memory_read(SP++); T(3); } break;
+    case 0xD2: /* JP NC,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & CF_MASK)) { PC = WZ; } } break;
+    case 0xD3: /* OUT (n),A      */ { WZ = A << 8 | memory_read(PC++); T(3); io_write(WZ, A); } break;
+    case 0xD4: /* CALL NC,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & CF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xD5: /* PUSH DE        */ { T(1); memory_write(--SP, D); T(3); memory_write(--SP, E); T(3); } break;
+    case 0xD6: /* SUB n          */ { u16_t result; Z = memory_read(PC++); T(3); result = A - Z; F = SZ53(result & 0xFF) | HF_SUB(A, Z, result) | VF_SUB(A, Z, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xD7: /* RST $10        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x10; } break;
+    case 0xD8: /* RET C          */ { T(1); if (F & CF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xD9: /* EXX            */ { u16_t tmp; tmp = BC; BC = BC_; BC_ = tmp; tmp = DE; DE = DE_; DE_ = tmp; tmp = HL; HL = HL_; HL_ = tmp; } break;
+    case 0xDA: /* JP C,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & CF_MASK) { PC = WZ; } } break;
+    case 0xDB: /* IN A,(n)       */ { Z = memory_read(PC++); T(3); A = io_read(A << 8 | Z); } break;
+    case 0xDC: /* CALL C,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & CF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xDD: execute_DD(); break;
+    case 0xDE: /* SBC A,n        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; TMP = memory_read(PC++); T(3); result = A - TMP - carry; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xDF: /* RST $18        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x18; } break;
+    case 0xE0: /* RET PO         */ { T(1); if (!(F & PF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xE1: /* POP IX         */ { IXL = memory_read(SP++); T(3); IXH = memory_read(SP++); T(3); } break;
+    case 0xE2: /* JP PO,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & PF_MASK)) { PC = WZ; } } break;
+    case 0xE3: /* EX (SP),IX     */ { Z = memory_read(SP); T(3); W = memory_read(SP + 1); T(4); memory_write(SP, IXL); T(3); memory_write(SP + 1, IXH); T(3); memory_contend(SP + 1); T(1); memory_contend(SP + 1); T(1); IXH = W; IXL = Z; } break;
+    case 0xE4: /* CALL PO,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & PF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xE5: /* PUSH IX        */ { T(1); memory_write(--SP, IXH); T(3); memory_write(--SP, IXL); T(3); } break;
+    case 0xE6: /* AND n          */ { A &= memory_read(PC++); T(3); F = SZ53P(A) | HF_MASK; } break;
+    case 0xE7: /* RST $20        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x20; } break;
+    case 0xE8: /* RET PE         */ { T(1); if (F & PF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xE9: /* JP (IX)        */ { PC = IX; } break;
+    case 0xEA: /* JP PE,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & PF_MASK) { PC = WZ; } } break;
+    case 0xEB: /* EX DE,HL       */ { const u16_t tmp = DE; DE = HL; HL = tmp; } break;
+    case 0xEC: /* CALL PE,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & PF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xEE: /* XOR n          */ { A ^= memory_read(PC++); T(3); F = SZ53P(A) | 0; } break;
+    case 0xEF: /* RST $28        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x28; } break;
+    case 0xF0: /* RET P          */ { T(1); if (!(F & SF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xF1: /* POP AF         */ { F = memory_read(SP++); T(3); A = memory_read(SP++); T(3); } break;
+    case 0xF2: /* JP P,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & SF_MASK)) { PC = WZ; } } break;
+    case 0xF3: /* DI             */ { IFF1 = IFF2 = 0; } break;
+    case 0xF4: /* CALL P,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & SF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xF5: /* PUSH AF        */ { T(1); memory_write(--SP, A); T(3); memory_write(--SP, F); T(3); } break;
+    case 0xF6: /* OR n           */ { A |= memory_read(PC++); T(3); F = SZ53P(A) | 0; } break;
+    case 0xF7: /* RST $30        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x30; } break;
+    case 0xF8: /* RET M          */ { T(1); if (F & SF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xF9: /* LD SP,IX       */ { SP = IX; T(2); } break;
+    case 0xFA: /* JP M,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & SF_MASK) { PC = WZ; } } break;
+    case 0xFB: /* EI             */ { IFF1 = IFF2 = 1; self.irq_delay = 1; } break;
+    case 0xFC: /* CALL M,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & SF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xFE: /* CP n           */ { u16_t result; TMP = memory_read(PC++); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xFF: /* RST $38        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x38; } break;
+    default:
+      log_wrn("cpu: opcode DD%02X at PC=$%04X not implemented\n", opcode, PC - 1);
+      break;
+  }
+}
+
+inline
+static void execute_ED(void) {
+  const u8_t opcode = memory_read(PC++); T(4);
+  switch (opcode) {
+    case 0x23: /* SWAP           */ { A = A >> 4 | A << 4; } break;
+    case 0x24: /* MIRR A         */ { A = (A & 0x01) << 7 | (A & 0x02) << 5 | (A & 0x04) << 3 | (A & 0x08) << 1 | (A & 0x10) >> 1 | (A & 0x20) >> 3 | (A & 0x40) >> 5 | (A & 0x80) >> 7; } break;
+    case 0x27: /* TEST n         */ { TMP = A & memory_read(PC++); T(3); F = SZ53P(TMP) | HF_MASK; } break;
+    case 0x28: /* BSLA DE,B      */ { DE <<= B & 0x1F; } break;
+    case 0x29: /* BSRA DE,B      */ { DE = (s16_t) DE >> (B & 0x1F); } break;
+    case 0x2A: /* BSRL DE,B      */ { DE >>= B & 0x1F; } break;
+    case 0x2B: /* BSRF DE,B      */ { DE = ~((u16_t) ~DE >> (B & 0x1F)); } break;
+    case 0x2C: /* BRLC DE,B      */ { DE = (DE << (B & 0x0F)) | (DE >> (0x10 - (B & 0x0F))); } break;
+    case 0x30: /* MUL D,E        */ { DE = D * E; } break;
+    case 0x31: /* ADD HL,A       */ { HL += A; } break;
+    case 0x32: /* ADD DE,A       */ { DE += A; } break;
+    case 0x33: /* ADD BC,A       */ { BC += A; } break;
+    case 0x34: /* ADD HL,nn      */ { Z = memory_read(PC++); T(4); W = memory_read(PC++); T(4); HL += WZ; } break;
+    case 0x35: /* ADD DE,nn      */ { Z = memory_read(PC++); T(4); W = memory_read(PC++); T(4); DE += WZ; } break;
+    case 0x36: /* ADD BC,nn      */ { Z = memory_read(PC++); T(4); W = memory_read(PC++); T(4); BC += WZ; } break;
+    case 0x40: /* IN B,(C)       */ { B = io_read(BC); F = SZ53P(B) | (F & CF_MASK); } break;
+    case 0x41: /* OUT (C),B      */ { io_write(BC, B); } break;
+    case 0x42: /* SBC HL,BC      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL - BC - carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_SUB(H, B, result >> 8) | VF_SUB(H, B, result >> 8) | NF_MASK | (HL < BC + carry) << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x43: /* LD (nn),BC     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, C); T(3); memory_write(WZ + 1, B); T(3); } break;
+    case 0x44: /* NEG            */ { const u8_t prev = A; A = -A; F = SZ53(A) | HF_SUB(0, prev, A) | (prev == 0x80) << VF_SHIFT | NF_MASK | (prev != 0x00) << CF_SHIFT; } break;
+    case 0x45: /* RETN           */ { if (self.is_stackless_nmi_enabled) { (void) nextreg_read_internal(E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_LSB, &PCL); (void) nextreg_read_internal(E_NEXTREG_REGISTER_NMI_RETURN_ADDRESS_MSB, &PCH); SP += 2; } else { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } IFF1 = IFF2; if (mf_is_active()) { mf_deactivate(); } } break;
+    case 0x46: /* IM 0           */ { IM = 0; } break;
+    case 0x47: /* LD I,A         */ { T(1); I = A; } break;
+    case 0x48: /* IN C,(C)       */ { C = io_read(BC); F = SZ53P(C) | (F & CF_MASK); } break;
+    case 0x49: /* OUT (C),C      */ { io_write(BC, C); } break;
+    case 0x4A: /* ADC HL,BC      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL + BC + carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_ADD(H, B, result >> 8) | VF_ADD(H, B, result >> 8) | (result & 0x10000) >> 16 << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x4B: /* LD BC,(nn)     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); C = memory_read(WZ); T(3); B = memory_read(WZ + 1); T(3); } break;
+    case 0x4D: /* RETI           */ { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } break;
+    case 0x4F: /* LD R,A         */ { T(1); R = A; } break;
+    case 0x50: /* IN D,(C)       */ { D = io_read(BC); F = SZ53P(D) | (F & CF_MASK); } break;
+    case 0x51: /* OUT (C),D      */ { io_write(BC, D); } break;
+    case 0x52: /* SBC HL,DE      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL - DE - carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_SUB(H, D, result >> 8) | VF_SUB(H, D, result >> 8) | NF_MASK | (HL < DE + carry) << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x53: /* LD (nn),DE     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, E); T(3); memory_write(WZ + 1, D); T(3); } break;
+    case 0x56: /* IM 1           */ { IM = 1; } break;
+    case 0x57: /* LD A,I         */ { T(1); A = I; F = SZ53(A) | (IFF2 << PF_SHIFT) | (F & CF_MASK); } break;
+    case 0x58: /* IN E,(C)       */ { E = io_read(BC); F = SZ53P(E) | (F & CF_MASK); } break;
+    case 0x59: /* OUT (C),E      */ { io_write(BC, E); } break;
+    case 0x5A: /* ADC HL,DE      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL + DE + carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_ADD(H, D, result >> 8) | VF_ADD(H, D, result >> 8) | (result & 0x10000) >> 16 << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x5B: /* LD DE,(nn)     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); E = memory_read(WZ); T(3); D = memory_read(WZ + 1); T(3); } break;
+    case 0x5E: /* IM 2           */ { IM = 2; } break;
+    case 0x5F: /* LD A,R         */ { T(1); A = R; F = SZ53(A) | (IFF2 << VF_SHIFT) | (F & CF_MASK); } break;
+    case 0x60: /* IN H,(C)       */ { H = io_read(BC); F = SZ53P(H) | (F & CF_MASK); } break;
+    case 0x61: /* OUT (C),H      */ { io_write(BC, H); } break;
+    case 0x62: /* SBC HL,HL      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL - HL - carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_SUB(H, H, result >> 8) | VF_SUB(H, H, result >> 8) | NF_MASK | (HL < HL + carry) << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x67: /* RRD            */ { Z = memory_read(HL); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_write(HL, (A & 0x0F) << 4 | Z >> 4); T(3); A = (A & 0xF0) | (Z & 0x0F); F = SZ53P(A) | (F & CF_MASK); } break;
+    case 0x68: /* IN L,(C)       */ { L = io_read(BC); F = SZ53P(L) | (F & CF_MASK); } break;
+    case 0x69: /* OUT (C),L      */ { io_write(BC, L); } break;
+    case 0x6A: /* ADC HL,HL      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL + HL + carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_ADD(H, H, result >> 8) | VF_ADD(H, H, result >> 8) | (result & 0x10000) >> 16 << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x6F: /* RLD            */ { Z = memory_read(HL); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_write(HL, Z << 4 | (A & 0x0F)); T(3); A = (A & 0xF0) | Z >> 4; F = SZ53P(A) | (F & CF_MASK); } break;
+    case 0x70: /* IN (C)         */ { TMP = io_read(BC); F = SZ53P(TMP) | (F & CF_MASK); } break;
+    case 0x71: /* OUT (C),0      */ { io_write(BC, 0); } break;
+    case 0x72: /* SBC HL,SP      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL - SP - carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_SUB(H, S, result >> 8) | VF_SUB(H, S, result >> 8) | NF_MASK | (HL < SP + carry) << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x73: /* LD (nn),SP     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, P); T(3); memory_write(WZ + 1, S); T(3); } break;
+    case 0x78: /* IN A,(C)       */ { A = io_read(BC); F = SZ53P(A) | (F & CF_MASK); } break;
+    case 0x79: /* OUT (C),A      */ { io_write(BC, A); } break;
+    case 0x7A: /* ADC HL,SP      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u32_t result = HL + SP + carry; F = (result & 0x8000) >> 15 << SF_SHIFT | (result == 0) << ZF_SHIFT | (result & 0x20) | (result & 0x08) | HF_ADD(H, S, result >> 8) | VF_ADD(H, S, result >> 8) | (result & 0x10000) >> 16 << CF_SHIFT; HL = result & 0xFFFF; T(7); } break;
+    case 0x7B: /* LD SP,(nn)     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); P = memory_read(WZ); T(3); S = memory_read(WZ + 1); T(3); } break;
+    case 0x8A: /* PUSH mm        */ { W = memory_read(PC++); /* High byte first. */ Z = memory_read(PC++); /* Then low byte. */ memory_write(--SP, W); memory_write(--SP, Z); T(15); } break;
+    case 0x90: /* OTIB           */ { TMP = memory_read(HL++); T(4); io_write(BC, TMP); } break;
+    case 0x91: /* NREG reg,value */ { nextreg_write_internal(memory_read(PC++), memory_read(PC++)); T(8); } break;
+    case 0x92: /* NREG reg,A     */ { nextreg_write_internal(memory_read(PC++), A); T(4); } break;
+    case 0x93: /* PXDN           */ { if ((HL & 0x0700) != 0x0700) { HL += 256; } else if ((HL & 0xE0) != 0xE0) { HL = (HL & 0xF8FF) + 0x20; } else { HL = (HL & 0xF81F) + 0x0800; } } break;
+    case 0x94: /* PXAD           */ { HL = 0x4000 + ((D & 0xC0) << 5) + ((D & 0x07) << 8) + ((D & 0x38) << 2) + (E >> 3); } break;
+    case 0x95: /* STAE           */ { A = (unsigned char) 0x80 >> (E & 7); } break;
+    case 0x98: /* JP (C)         */ { PC = (PC & 0xC000) + (io_read(BC) << 6); T(1); /* io_read takes care of other 4 */ } break;
+    case 0xA0: /* LDI            */ { TMP = memory_read(HL); T(3); memory_write(DE, TMP); T(3); memory_contend(DE); T(1); memory_contend(DE); T(1); HL++; DE++; F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; } break;
+    case 0xA1: /* CPI            */ { u16_t result; Z = memory_read(HL); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); result = A - Z; --BC; F = SZ53(result & 0xFF) | HF_SUB(A, Z, result) | (BC != 0) << VF_SHIFT | NF_MASK | (F & CF_MASK); HL++; } break;
+    case 0xA2: /* INI            */ { T(1); Z = io_read(BC); memory_write(HL, Z); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); --B; F = SZ53P(B) | NF_MASK | (F & CF_MASK); HL++; } break;
+    case 0xA3: /* OUTI           */ { T(1); Z = memory_read(HL); T(3); --B; io_write(BC, Z); F = SZ53P(B) | NF_MASK | (F & CF_MASK); HL++; } break;
+    case 0xA4: /* LDIX           */ { TMP = memory_read(HL++); T(3); if (TMP != A) { memory_write(DE, TMP); T(5); } DE++; F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; } break;
+    case 0xA5: /* LDWS           */ { TMP = memory_read(HL); T(3); memory_write(DE, TMP); T(3); L++; D++; F = SZ53(D) | HF_ADD(D - 1, 1, D) | (D == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0xA8: /* LDD            */ { TMP = memory_read(HL); T(3); memory_write(DE, TMP); T(3); memory_contend(DE); T(1); memory_contend(DE); T(1); HL--; DE--; F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; } break;
+    case 0xA9: /* CPD            */ { u16_t result; Z = memory_read(HL); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); result = A - Z; --BC; F = SZ53(result & 0xFF) | HF_SUB(A, Z, result) | (BC != 0) << VF_SHIFT | NF_MASK | (F & CF_MASK); HL--; } break;
+    case 0xAA: /* IND            */ { T(1); Z = io_read(BC); memory_write(HL, Z); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); --B; F = SZ53P(B) | NF_MASK | (F & CF_MASK); HL--; } break;
+    case 0xAB: /* OUTD           */ { T(1); Z = memory_read(HL); T(3); --B; io_write(BC, Z); F = SZ53P(B) | NF_MASK | (F & CF_MASK); HL--; } break;
+    case 0xAC: /* LDDX           */ { TMP = memory_read(HL--); T(3); if (TMP != A) { memory_write(DE, TMP); T(5); } DE--; F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; } break;
+    case 0xB0: /* LDIR           */ { TMP = memory_read(HL); T(3); memory_write(DE, TMP); T(3); memory_contend(DE); T(1); memory_contend(DE); T(1); F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; if (BC) { memory_contend(DE); T(1); memory_contend(DE); T(1); memory_contend(DE); T(1); memory_contend(DE); T(1); memory_contend(DE); T(1); PC -= 2; } HL++; DE++; if (BC) { cpu_ldxr_batch(+1); } } break;
+    case 0xB1: /* CPIR           */ { u16_t result; Z = memory_read(HL); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); result = A - Z; --BC; if (!(BC == 0 || result == 0)) { memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); PC -= 2; } else { F = SZ53(result & 0xFF) | HF_SUB(A, Z, result) | (BC != 0) << VF_SHIFT | NF_MASK | (F & CF_MASK); } HL++; } break;
+    case 0xB2: /* INIR           */ { T(1); Z = io_read(BC); memory_write(HL, Z); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); if (--B) { memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); PC -= 2; } else { F |= ZF_MASK | NF_MASK; } HL++; if (B) { cpu_inxr_batch(+1); } } break;
+    case 0xB3: /* OTIR           */ { T(1); Z = memory_read(HL); T(3); --B; io_write(BC, Z); if (B) { memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); PC -= 2; } else { F |= ZF_MASK | NF_MASK; } HL++; if (B) { cpu_otxr_batch(+1); } } break;
+    case 0xB4: /* LIRX           */ { TMP = memory_read(HL++); T(3); if (TMP != A) { memory_write(DE, TMP); T(5); } DE++; F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; if (BC) { PC -= 2; T(5); cpu_lxrx_batch(+1); } } break;
+    case 0xB7: /* LDPIRX         */ { TMP = memory_read((HL & 0xFFF8) | (E & 0x07)); T(3); if (TMP != A) { memory_write(DE, TMP); T(5); } DE++; F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; if (BC) { PC -= 2; T(5); cpu_ldpirx_batch(); } } break;
+    case 0xB8: /* LDDR           */ { TMP = memory_read(HL); T(3); memory_write(DE, TMP); T(3); memory_contend(DE); T(1); memory_contend(DE); T(1); F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; if (BC) { memory_contend(DE); T(1); memory_contend(DE); T(1); memory_contend(DE); T(1); memory_contend(DE); T(1); memory_contend(DE); T(1); PC -= 2; } HL--; DE--; if (BC) { cpu_ldxr_batch(-1); } } break;
+    case 0xB9: /* CPDR           */ { u16_t result; Z = memory_read(HL); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); result = A - Z; --BC; if (!(BC == 0 || result == 0)) { memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); PC -= 2; } else { F = SZ53(result & 0xFF) | HF_SUB(A, Z, result) | (BC != 0) << VF_SHIFT | NF_MASK | (F & CF_MASK); } HL--; } break;
+    case 0xBA: /* INDR           */ { T(1); Z = io_read(BC); memory_write(HL, Z); T(3); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); if (--B) { memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); PC -= 2; } else { F |= ZF_MASK | NF_MASK; } HL--; if (B) { cpu_inxr_batch(-1); } } break;
+    case 0xBB: /* OTDR           */ { T(1); Z = memory_read(HL); T(3); --B; io_write(BC, Z); if (B) { memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); memory_contend(HL); T(1); PC -= 2; } else { F |= ZF_MASK | NF_MASK; } HL--; if (B) { cpu_otxr_batch(-1); } } break;
+    case 0xBC: /* LDRX           */ { TMP = memory_read(HL--); T(3); if (TMP != A) { memory_write(DE, TMP); T(5); } DE--; F &= ~(HF_MASK | VF_MASK | NF_MASK); F |= (--BC != 0) << VF_SHIFT; if (BC) { PC -= 2; T(5); cpu_lxrx_batch(-1); } } break;
+    default:
+      log_wrn("cpu: opcode ED%02X at PC=$%04X not implemented\n", opcode, PC - 1);
+      break;
+  }
+}
+
+inline
+static void execute_FDCB(void) {
+  TMP = memory_read(PC++); T(3);  /* displacement */
+  const u8_t opcode = memory_read(PC); T(3);
+  memory_contend(PC); T(1);
+  memory_contend(PC); T(1);
+  PC++;
+  switch (opcode) {
+    case 0x00: /* RLC B          */ { const u8_t carry = B >> 7; B = B << 1 | carry; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x01: /* RLC C          */ { const u8_t carry = C >> 7; C = C << 1 | carry; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x02: /* RLC D          */ { const u8_t carry = D >> 7; D = D << 1 | carry; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x03: /* RLC E          */ { const u8_t carry = E >> 7; E = E << 1 | carry; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x04: /* RLC H          */ { const u8_t carry = H >> 7; H = H << 1 | carry; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x05: /* RLC L          */ { const u8_t carry = L >> 7; L = L << 1 | carry; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x06: /* RLC (IY+d)     */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | carry; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x07: /* RLC A          */ { const u8_t carry = A >> 7; A = A << 1 | carry; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x08: /* RRC B          */ { const u8_t carry = B & 0x01; B = B >> 1 | carry << 7; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x09: /* RRC C          */ { const u8_t carry = C & 0x01; C = C >> 1 | carry << 7; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x0A: /* RRC D          */ { const u8_t carry = D & 0x01; D = D >> 1 | carry << 7; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x0B: /* RRC E          */ { const u8_t carry = E & 0x01; E = E >> 1 | carry << 7; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x0C: /* RRC H          */ { const u8_t carry = H & 0x01; H = H >> 1 | carry << 7; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x0D: /* RRC L          */ { const u8_t carry = L & 0x01; L = L >> 1 | carry << 7; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x0E: /* RRC (IY+d)     */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = TMP >> 1 | carry << 7; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x0F: /* RRC A          */ { const u8_t carry = A & 0x01; A = A >> 1 | carry << 7; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x10: /* RL B           */ { const u8_t carry = B >> 7; B = B << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x11: /* RL C           */ { const u8_t carry = C >> 7; C = C << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x12: /* RL D           */ { const u8_t carry = D >> 7; D = D << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x13: /* RL E           */ { const u8_t carry = E >> 7; E = E << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x14: /* RL H           */ { const u8_t carry = H >> 7; H = H << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x15: /* RL L           */ { const u8_t carry = L >> 7; L = L << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x16: /* RL (IY+d)      */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x17: /* RL A           */ { const u8_t carry = A >> 7; A = A << 1 | (F & CF_MASK) >> CF_SHIFT; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x18: /* RR B           */ { const u8_t carry = B & 0x01; B = B >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x19: /* RR C           */ { const u8_t carry = C & 0x01; C = C >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x1A: /* RR D           */ { const u8_t carry = D & 0x01; D = D >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x1B: /* RR E           */ { const u8_t carry = E & 0x01; E = E >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x1C: /* RR H           */ { const u8_t carry = H & 0x01; H = H >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x1D: /* RR L           */ { const u8_t carry = L & 0x01; L = L >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x1E: /* RR (IY+d)      */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = TMP >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x1F: /* RR A           */ { const u8_t carry = A & 0x01; A = A >> 1 | (F & CF_MASK) >> CF_SHIFT << 7; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x20: /* SLA B          */ { const u8_t carry = B >> 7; B <<= 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x21: /* SLA C          */ { const u8_t carry = C >> 7; C <<= 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x22: /* SLA D          */ { const u8_t carry = D >> 7; D <<= 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x23: /* SLA E          */ { const u8_t carry = E >> 7; E <<= 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x24: /* SLA H          */ { const u8_t carry = H >> 7; H <<= 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x25: /* SLA L          */ { const u8_t carry = L >> 7; L <<= 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x26: /* SLA (IY+d)     */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP <<= 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x27: /* SLA A          */ { const u8_t carry = A >> 7; A <<= 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x28: /* SRA B          */ { const u8_t carry = B & 0x01; B = (B & 0x80) | B >> 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x29: /* SRA C          */ { const u8_t carry = C & 0x01; C = (C & 0x80) | C >> 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x2A: /* SRA D          */ { const u8_t carry = D & 0x01; D = (D & 0x80) | D >> 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x2B: /* SRA E          */ { const u8_t carry = E & 0x01; E = (E & 0x80) | E >> 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x2C: /* SRA H          */ { const u8_t carry = H & 0x01; H = (H & 0x80) | H >> 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x2D: /* SRA L          */ { const u8_t carry = L & 0x01; L = (L & 0x80) | L >> 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x2E: /* SRA (IY+d)     */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP = (TMP & 0x80) | TMP >> 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x2F: /* SRA A          */ { const u8_t carry = A & 0x01; A = (A & 0x80) | A >> 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x30: /* SLL B          */ { const u8_t carry = B >> 7; B = B << 1 | 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x31: /* SLL C          */ { const u8_t carry = C >> 7; C = C << 1 | 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x32: /* SLL D          */ { const u8_t carry = D >> 7; D = D << 1 | 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x33: /* SLL E          */ { const u8_t carry = E >> 7; E = E << 1 | 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x34: /* SLL H          */ { const u8_t carry = H >> 7; H = H << 1 | 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x35: /* SLL L          */ { const u8_t carry = L >> 7; L = L << 1 | 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x36: /* SLL (IY+d)     */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP >> 7; TMP = TMP << 1 | 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x37: /* SLL A          */ { const u8_t carry = A >> 7; A = A << 1 | 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x38: /* SRL B          */ { const u8_t carry = B & 0x01; B >>= 1; F = SZ53P(B) | carry << CF_SHIFT; } break;
+    case 0x39: /* SRL C          */ { const u8_t carry = C & 0x01; C >>= 1; F = SZ53P(C) | carry << CF_SHIFT; } break;
+    case 0x3A: /* SRL D          */ { const u8_t carry = D & 0x01; D >>= 1; F = SZ53P(D) | carry << CF_SHIFT; } break;
+    case 0x3B: /* SRL E          */ { const u8_t carry = E & 0x01; E >>= 1; F = SZ53P(E) | carry << CF_SHIFT; } break;
+    case 0x3C: /* SRL H          */ { const u8_t carry = H & 0x01; H >>= 1; F = SZ53P(H) | carry << CF_SHIFT; } break;
+    case 0x3D: /* SRL L          */ { const u8_t carry = L & 0x01; L >>= 1; F = SZ53P(L) | carry << CF_SHIFT; } break;
+    case 0x3E: /* SRL (IY+d)     */ { u8_t carry; WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); carry = TMP & 0x01; TMP >>= 1; F = SZ53P(TMP) | carry << CF_SHIFT; memory_write(WZ, TMP); T(3); } break;
+    case 0x3F: /* SRL A          */ { const u8_t carry = A & 0x01; A >>= 1; F = SZ53P(A) | carry << CF_SHIFT; } break;
+    case 0x40: /* BIT 0,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x41: /* BIT 0,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x42: /* BIT 0,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x43: /* BIT 0,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x44: /* BIT 0,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x45: /* BIT 0,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x46: /* BIT 0,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x47: /* BIT 0,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 0 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x48: /* BIT 1,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x49: /* BIT 1,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4A: /* BIT 1,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4B: /* BIT 1,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4C: /* BIT 1,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4D: /* BIT 1,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4E: /* BIT 1,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x4F: /* BIT 1,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 1 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x50: /* BIT 2,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x51: /* BIT 2,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x52: /* BIT 2,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x53: /* BIT 2,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x54: /* BIT 2,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x55: /* BIT 2,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x56: /* BIT 2,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x57: /* BIT 2,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 2 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x58: /* BIT 3,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x59: /* BIT 3,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5A: /* BIT 3,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5B: /* BIT 3,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5C: /* BIT 3,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5D: /* BIT 3,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5E: /* BIT 3,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x5F: /* BIT 3,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 3 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x60: /* BIT 4,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x61: /* BIT 4,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x62: /* BIT 4,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x63: /* BIT 4,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x64: /* BIT 4,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x65: /* BIT 4,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x66: /* BIT 4,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x67: /* BIT 4,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 4 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x68: /* BIT 5,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x69: /* BIT 5,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6A: /* BIT 5,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6B: /* BIT 5,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6C: /* BIT 5,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6D: /* BIT 5,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6E: /* BIT 5,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x6F: /* BIT 5,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 5 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x70: /* BIT 6,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x71: /* BIT 6,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x72: /* BIT 6,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x73: /* BIT 6,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x74: /* BIT 6,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x75: /* BIT 6,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x76: /* BIT 6,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x77: /* BIT 6,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 6 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x78: /* BIT 7,B        */ { F &= ~(ZF_MASK | NF_MASK); F |= (B & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x79: /* BIT 7,C        */ { F &= ~(ZF_MASK | NF_MASK); F |= (C & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7A: /* BIT 7,D        */ { F &= ~(ZF_MASK | NF_MASK); F |= (D & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7B: /* BIT 7,E        */ { F &= ~(ZF_MASK | NF_MASK); F |= (E & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7C: /* BIT 7,H        */ { F &= ~(ZF_MASK | NF_MASK); F |= (H & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7D: /* BIT 7,L        */ { F &= ~(ZF_MASK | NF_MASK); F |= (L & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7E: /* BIT 7,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); F &= ~(ZF_MASK | NF_MASK); F |= (TMP & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x7F: /* BIT 7,A        */ { F &= ~(ZF_MASK | NF_MASK); F |= (A & 1 << 7 ? 0 : ZF_MASK) | HF_MASK; T(4); } break;
+    case 0x80: /* RES 0,B        */ { B &= ~(1 << 0); } break;
+    case 0x81: /* RES 0,C        */ { C &= ~(1 << 0); } break;
+    case 0x82: /* RES 0,D        */ { D &= ~(1 << 0); } break;
+    case 0x83: /* RES 0,E        */ { E &= ~(1 << 0); } break;
+    case 0x84: /* RES 0,H        */ { H &= ~(1 << 0); } break;
+    case 0x85: /* RES 0,L        */ { L &= ~(1 << 0); } break;
+    case 0x86: /* RES 0,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 0)); T(3); } break;
+    case 0x87: /* RES 0,A        */ { A &= ~(1 << 0); } break;
+    case 0x88: /* RES 1,B        */ { B &= ~(1 << 1); } break;
+    case 0x89: /* RES 1,C        */ { C &= ~(1 << 1); } break;
+    case 0x8A: /* RES 1,D        */ { D &= ~(1 << 1); } break;
+    case 0x8B: /* RES 1,E        */ { E &= ~(1 << 1); } break;
+    case 0x8C: /* RES 1,H        */ { H &= ~(1 << 1); } break;
+    case 0x8D: /* RES 1,L        */ { L &= ~(1 << 1); } break;
+    case 0x8E: /* RES 1,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 1)); T(3); } break;
+    case 0x8F: /* RES 1,A        */ { A &= ~(1 << 1); } break;
+    case 0x90: /* RES 2,B        */ { B &= ~(1 << 2); } break;
+    case 0x91: /* RES 2,C        */ { C &= ~(1 << 2); } break;
+    case 0x92: /* RES 2,D        */ { D &= ~(1 << 2); } break;
+    case 0x93: /* RES 2,E        */ { E &= ~(1 << 2); } break;
+    case 0x94: /* RES 2,H        */ { H &= ~(1 << 2); } break;
+    case 0x95: /* RES 2,L        */ { L &= ~(1 << 2); } break;
+    case 0x96: /* RES 2,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 2)); T(3); } break;
+    case 0x97: /* RES 2,A        */ { A &= ~(1 << 2); } break;
+    case 0x98: /* RES 3,B        */ { B &= ~(1 << 3); } break;
+    case 0x99: /* RES 3,C        */ { C &= ~(1 << 3); } break;
+    case 0x9A: /* RES 3,D        */ { D &= ~(1 << 3); } break;
+    case 0x9B: /* RES 3,E        */ { E &= ~(1 << 3); } break;
+    case 0x9C: /* RES 3,H        */ { H &= ~(1 << 3); } break;
+    case 0x9D: /* RES 3,L        */ { L &= ~(1 << 3); } break;
+    case 0x9E: /* RES 3,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 3)); T(3); } break;
+    case 0x9F: /* RES 3,A        */ { A &= ~(1 << 3); } break;
+    case 0xA0: /* RES 4,B        */ { B &= ~(1 << 4); } break;
+    case 0xA1: /* RES 4,C        */ { C &= ~(1 << 4); } break;
+    case 0xA2: /* RES 4,D        */ { D &= ~(1 << 4); } break;
+    case 0xA3: /* RES 4,E        */ { E &= ~(1 << 4); } break;
+    case 0xA4: /* RES 4,H        */ { H &= ~(1 << 4); } break;
+    case 0xA5: /* RES 4,L        */ { L &= ~(1 << 4); } break;
+    case 0xA6: /* RES 4,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 4)); T(3); } break;
+    case 0xA7: /* RES 4,A        */ { A &= ~(1 << 4); } break;
+    case 0xA8: /* RES 5,B        */ { B &= ~(1 << 5); } break;
+    case 0xA9: /* RES 5,C        */ { C &= ~(1 << 5); } break;
+    case 0xAA: /* RES 5,D        */ { D &= ~(1 << 5); } break;
+    case 0xAB: /* RES 5,E        */ { E &= ~(1 << 5); } break;
+    case 0xAC: /* RES 5,H        */ { H &= ~(1 << 5); } break;
+    case 0xAD: /* RES 5,L        */ { L &= ~(1 << 5); } break;
+    case 0xAE: /* RES 5,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 5)); T(3); } break;
+    case 0xAF: /* RES 5,A        */ { A &= ~(1 << 5); } break;
+    case 0xB0: /* RES 6,B        */ { B &= ~(1 << 6); } break;
+    case 0xB1: /* RES 6,C        */ { C &= ~(1 << 6); } break;
+    case 0xB2: /* RES 6,D        */ { D &= ~(1 << 6); } break;
+    case 0xB3: /* RES 6,E        */ { E &= ~(1 << 6); } break;
+    case 0xB4: /* RES 6,H        */ { H &= ~(1 << 6); } break;
+    case 0xB5: /* RES 6,L        */ { L &= ~(1 << 6); } break;
+    case 0xB6: /* RES 6,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 6)); T(3); } break;
+    case 0xB7: /* RES 6,A        */ { A &= ~(1 << 6); } break;
+    case 0xB8: /* RES 7,B        */ { B &= ~(1 << 7); } break;
+    case 0xB9: /* RES 7,C        */ { C &= ~(1 << 7); } break;
+    case 0xBA: /* RES 7,D        */ { D &= ~(1 << 7); } break;
+    case 0xBB: /* RES 7,E        */ { E &= ~(1 << 7); } break;
+    case 0xBC: /* RES 7,H        */ { H &= ~(1 << 7); } break;
+    case 0xBD: /* RES 7,L        */ { L &= ~(1 << 7); } break;
+    case 0xBE: /* RES 7,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP & ~(1 << 7)); T(3); } break;
+    case 0xBF: /* RES 7,A        */ { A &= ~(1 << 7); } break;
+    case 0xC0: /* SET 0,B        */ { B |= 1 << 0; } break;
+    case 0xC1: /* SET 0,C        */ { C |= 1 << 0; } break;
+    case 0xC2: /* SET 0,D        */ { D |= 1 << 0; } break;
+    case 0xC3: /* SET 0,E        */ { E |= 1 << 0; } break;
+    case 0xC4: /* SET 0,H        */ { H |= 1 << 0; } break;
+    case 0xC5: /* SET 0,L        */ { L |= 1 << 0; } break;
+    case 0xC6: /* SET 0,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 0); T(3); } break;
+    case 0xC7: /* SET 0,A        */ { A |= 1 << 0; } break;
+    case 0xC8: /* SET 1,B        */ { B |= 1 << 1; } break;
+    case 0xC9: /* SET 1,C        */ { C |= 1 << 1; } break;
+    case 0xCA: /* SET 1,D        */ { D |= 1 << 1; } break;
+    case 0xCB: /* SET 1,E        */ { E |= 1 << 1; } break;
+    case 0xCC: /* SET 1,H        */ { H |= 1 << 1; } break;
+    case 0xCD: /* SET 1,L        */ { L |= 1 << 1; } break;
+    case 0xCE: /* SET 1,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 1); T(3); } break;
+    case 0xCF: /* SET 1,A        */ { A |= 1 << 1; } break;
+    case 0xD0: /* SET 2,B        */ { B |= 1 << 2; } break;
+    case 0xD1: /* SET 2,C        */ { C |= 1 << 2; } break;
+    case 0xD2: /* SET 2,D        */ { D |= 1 << 2; } break;
+    case 0xD3: /* SET 2,E        */ { E |= 1 << 2; } break;
+    case 0xD4: /* SET 2,H        */ { H |= 1 << 2; } break;
+    case 0xD5: /* SET 2,L        */ { L |= 1 << 2; } break;
+    case 0xD6: /* SET 2,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 2); T(3); } break;
+    case 0xD7: /* SET 2,A        */ { A |= 1 << 2; } break;
+    case 0xD8: /* SET 3,B        */ { B |= 1 << 3; } break;
+    case 0xD9: /* SET 3,C        */ { C |= 1 << 3; } break;
+    case 0xDA: /* SET 3,D        */ { D |= 1 << 3; } break;
+    case 0xDB: /* SET 3,E        */ { E |= 1 << 3; } break;
+    case 0xDC: /* SET 3,H        */ { H |= 1 << 3; } break;
+    case 0xDD: /* SET 3,L        */ { L |= 1 << 3; } break;
+    case 0xDE: /* SET 3,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 3); T(3); } break;
+    case 0xDF: /* SET 3,A        */ { A |= 1 << 3; } break;
+    case 0xE0: /* SET 4,B        */ { B |= 1 << 4; } break;
+    case 0xE1: /* SET 4,C        */ { C |= 1 << 4; } break;
+    case 0xE2: /* SET 4,D        */ { D |= 1 << 4; } break;
+    case 0xE3: /* SET 4,E        */ { E |= 1 << 4; } break;
+    case 0xE4: /* SET 4,H        */ { H |= 1 << 4; } break;
+    case 0xE5: /* SET 4,L        */ { L |= 1 << 4; } break;
+    case 0xE6: /* SET 4,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 4); T(3); } break;
+    case 0xE7: /* SET 4,A        */ { A |= 1 << 4; } break;
+    case 0xE8: /* SET 5,B        */ { B |= 1 << 5; } break;
+    case 0xE9: /* SET 5,C        */ { C |= 1 << 5; } break;
+    case 0xEA: /* SET 5,D        */ { D |= 1 << 5; } break;
+    case 0xEB: /* SET 5,E        */ { E |= 1 << 5; } break;
+    case 0xEC: /* SET 5,H        */ { H |= 1 << 5; } break;
+    case 0xED: /* SET 5,L        */ { L |= 1 << 5; } break;
+    case 0xEE: /* SET 5,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 5); T(3); } break;
+    case 0xEF: /* SET 5,A        */ { A |= 1 << 5; } break;
+    case 0xF0: /* SET 6,B        */ { B |= 1 << 6; } break;
+    case 0xF1: /* SET 6,C        */ { C |= 1 << 6; } break;
+    case 0xF2: /* SET 6,D        */ { D |= 1 << 6; } break;
+    case 0xF3: /* SET 6,E        */ { E |= 1 << 6; } break;
+    case 0xF4: /* SET 6,H        */ { H |= 1 << 6; } break;
+    case 0xF5: /* SET 6,L        */ { L |= 1 << 6; } break;
+    case 0xF6: /* SET 6,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 6); T(3); } break;
+    case 0xF7: /* SET 6,A        */ { A |= 1 << 6; } break;
+    case 0xF8: /* SET 7,B        */ { B |= 1 << 7; } break;
+    case 0xF9: /* SET 7,C        */ { C |= 1 << 7; } break;
+    case 0xFA: /* SET 7,D        */ { D |= 1 << 7; } break;
+    case 0xFB: /* SET 7,E        */ { E |= 1 << 7; } break;
+    case 0xFC: /* SET 7,H        */ { H |= 1 << 7; } break;
+    case 0xFD: /* SET 7,L        */ { L |= 1 << 7; } break;
+    case 0xFE: /* SET 7,(IY+d)   */ { WZ = IY + (s8_t) TMP; TMP = memory_read(WZ); T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP | 1 << 7); T(3); } break;
+    case 0xFF: /* SET 7,A        */ { A |= 1 << 7; } break;
+    default:
+      log_wrn("cpu: opcode FDCB%02X at PC=$%04X not implemented\n", opcode, PC - 1);
+      break;
+  }
+}
+
+inline
+static void execute_FD(void) {
+  const u8_t opcode = memory_read(PC++); T(4);
+  switch (opcode) {
+    case 0x00: /* NOP            */ {  } break;
+    case 0x01: /* LD BC,nn       */ { C = memory_read(PC++); T(3); B = memory_read(PC++); T(3); } break;
+    case 0x02: /* LD (BC),A      */ { WZ = BC; memory_write(WZ, A); T(3); } break;
+    case 0x03: /* INC BC         */ { BC++; T(2); } break;
+    case 0x04: /* INC B          */ { B++; F = SZ53(B) | HF_ADD(B - 1, 1, B) | (B == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x05: /* DEC B          */ { B--; F = SZ53(B) | HF_SUB(B + 1, 1, B) | (B == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x06: /* LD B,n         */ { B = memory_read(PC++); T(3); } break;
+    case 0x07: /* RLCA           */ { const u8_t carry = A >> 7; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= carry << CF_SHIFT; A <<= 1; A |= carry; } break;
+    case 0x08: /* EX AF,AF'      */ { const u16_t tmp = AF; AF = AF_; AF_ = tmp; } break;
+    case 0x09: /* ADD IY,BC      */ { const u16_t prev = IY; const u8_t carry = IY > 0xFFFF - BC; IY += BC; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, BC >> 8, IY >> 8) | carry; T(7); } break;
+    case 0x0A: /* LD A,(BC)      */ { WZ = BC; A = memory_read(WZ); T(3); } break;
+    case 0x0B: /* DEC BC         */ { BC--; T(2); } break;
+    case 0x0C: /* INC C          */ { C++; F = SZ53(C) | HF_ADD(C - 1, 1, C) | (C == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x0D: /* DEC C          */ { C--; F = SZ53(C) | HF_SUB(C + 1, 1, C) | (C == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x0E: /* LD C,n         */ { C = memory_read(PC++); T(3); } break;
+    case 0x0F: /* RRCA           */ { const u8_t carry = A & 0x01; F &= ~(NF_MASK | HF_MASK | CF_MASK); F |= carry << CF_SHIFT; A >>= 1; A |= carry << 7; } break;
+    case 0x10: /* DJNZ e         */ { T(1); Z = memory_read(PC); T(3); if (--B) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x11: /* LD DE,nn       */ { E = memory_read(PC++); T(3); D = memory_read(PC++); T(3); } break;
+    case 0x12: /* LD (DE),A      */ { WZ = DE; memory_write(WZ, A); T(3); } break;
+    case 0x13: /* INC DE         */ { DE++; T(2); } break;
+    case 0x14: /* INC D          */ { D++; F = SZ53(D) | HF_ADD(D - 1, 1, D) | (D == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x15: /* DEC D          */ { D--; F = SZ53(D) | HF_SUB(D + 1, 1, D) | (D == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x16: /* LD D,n         */ { D = memory_read(PC++); T(3); } break;
+    case 0x17: /* RLA            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= (A & 0x80) >> 7 << CF_SHIFT; A <<= 1; A |= carry; } break;
+    case 0x18: /* JR e           */ { Z = memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; PC++; } break;
+    case 0x19: /* ADD IY,DE      */ { const u16_t prev = IY; const u8_t carry = IY > 0xFFFF - DE; IY += DE; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, DE >> 8, IY >> 8) | carry; T(7); } break;
+    case 0x1A: /* LD A,(DE)      */ { WZ = DE; A = memory_read(WZ); T(3); } break;
+    case 0x1B: /* DEC DE         */ { DE--; T(2); } break;
+    case 0x1C: /* INC E          */ { E++; F = SZ53(E) | HF_ADD(E - 1, 1, E) | (E == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x1D: /* DEC E          */ { E--; F = SZ53(E) | HF_SUB(E + 1, 1, E) | (E == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x1E: /* LD E,n         */ { E = memory_read(PC++); T(3); } break;
+    case 0x1F: /* RRA            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= (A & 0x01) << CF_SHIFT; A >>= 1; A |= carry << 7; } break;
+    case 0x20: /* JR NZ,e        */ { Z = memory_read(PC); T(3); if (!ZF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x21: /* LD IY,nn       */ { IYL = memory_read(PC++); T(3); IYH = memory_read(PC++); T(3); } break;
+    case 0x22: /* LD (nn),IY     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, IYL); T(3); memory_write(WZ + 1, IYH); T(3); } break;
+    case 0x23: /* INC IY         */ { IY++; T(2); } break;
+    case 0x24: /* INC IYH        */ { IYH++; F = SZ53(IYH) | HF_ADD(IYH - 1, 1, IYH) | (IYH == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x25: /* DEC IYH        */ { IYH--; F = SZ53(IYH) | HF_SUB(IYH + 1, 1, IYH) | (IYH == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x26: /* LD IYH,n       */ { IYH = memory_read(PC++); T(3); } break;
+    case 0x27: /* DAA            */ { const u8_t a = A; u8_t correction = 0; if ((F & HF_MASK) || ((A & 0x0F) > 9)) correction += 0x06; if ((F & CF_MASK) || (A > 0x99)) correction += 0x60; if (F & NF_MASK) { A -= correction; } else { A += correction; } F &= NF_MASK | CF_MASK; F |= SZ53P(A) | (a > 0x99) << CF_SHIFT | ((a ^ A) & 0x10) >> 4 << HF_SHIFT; } break;
+    case 0x28: /* JR Z,e         */ { Z = memory_read(PC); T(3); if (ZF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x29: /* ADD IY,IY      */ { const u16_t prev = IY; const u8_t carry = IY > 0xFFFF - IY; IY += IY; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, IY >> 8, IY >> 8) | carry; T(7); } break;
+    case 0x2A: /* LD IY,(nn)     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); IYL = memory_read(WZ); T(3); IYH = memory_read(WZ + 1); T(3); } break;
+    case 0x2B: /* DEC IY         */ { IY--; T(2); } break;
+    case 0x2C: /* INC IYL        */ { IYL++; F = SZ53(IYL) | HF_ADD(IYL - 1, 1, IYL) | (IYL == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x2D: /* DEC IYL        */ { IYL--; F = SZ53(IYL) | HF_SUB(IYL + 1, 1, IYL) | (IYL == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x2E: /* LD IYL,n       */ { IYL = memory_read(PC++); T(3); } break;
+    case 0x2F: /* CPL            */ { A = ~A; F |= HF_MASK | NF_MASK; } break;
+    case 0x30: /* JR NC,e        */ { Z = memory_read(PC); T(3); if (!CF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x31: /* LD SP,nn       */ { P = memory_read(PC++); T(3); S = memory_read(PC++); T(3); } break;
+    case 0x32: /* LD (nn),A      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, A); T(3); } break;
+    case 0x33: /* INC SP         */ { SP++; T(2); } break;
+    case 0x34: /* INC (IY+d)     */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ) + 1; T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP); T(3); F = SZ53(TMP) | HF_ADD(TMP - 1, 1, TMP) | (TMP == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x35: /* DEC (IY+d)     */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ) - 1; T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP); T(3); F = SZ53(TMP) | HF_SUB(TMP + 1, 1, TMP) | (TMP == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x36: /* LD (IY+d),n    */ { WZ = IY + (s8_t) memory_read(PC); T(3); PC++; TMP = memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_write(WZ, TMP); T(3); PC++; } break;
+    case 0x37: /* SCF            */ { F &= ~(HF_MASK | NF_MASK); F |= CF_MASK; } break;
+    case 0x38: /* JR C,e         */ { Z = memory_read(PC); T(3); if (CF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x39: /* ADD IY,SP      */ { const u16_t prev = IY; const u8_t carry = IY > 0xFFFF - SP; IY += SP; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, SP >> 8, IY >> 8) | carry; T(7); } break;
+    case 0x3A: /* LD A,(nn)      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); A = memory_read(WZ); T(3); } break;
+    case 0x3B: /* DEC SP         */ { SP--; T(2); } break;
+    case 0x3C: /* INC A          */ { A++; F = SZ53(A) | HF_ADD(A - 1, 1, A) | (A == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x3D: /* DEC A          */ { A--; F = SZ53(A) | HF_SUB(A + 1, 1, A) | (A == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x3E: /* LD A,n         */ { A = memory_read(PC++); T(3); } break;
+    case 0x3F: /* CCF            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= carry << HF_SHIFT | (1 - carry) << CF_SHIFT; } break;
+    case 0x40: /* LD B,B         */ { B = B; } break;
+    case 0x41: /* LD B,C         */ { B = C; } break;
+    case 0x42: /* LD B,D         */ { B = D; } break;
+    case 0x43: /* LD B,E         */ { B = E; } break;
+    case 0x44: /* LD B,IYH       */ { B = IYH; } break;
+    case 0x45: /* LD B,IYL       */ { B = IYL; } break;
+    case 0x46: /* LD B,(IY+d)    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; B = memory_read(WZ); T(3); } break;
+    case 0x47: /* LD B,A         */ { B = A; } break;
+    case 0x48: /* LD C,B         */ { C = B; } break;
+    case 0x49: /* LD C,C         */ { C = C; } break;
+    case 0x4A: /* LD C,D         */ { C = D; } break;
+    case 0x4B: /* LD C,E         */ { C = E; } break;
+    case 0x4C: /* LD C,IYH       */ { C = IYH; } break;
+    case 0x4D: /* LD C,IYL       */ { C = IYL; } break;
+    case 0x4E: /* LD C,(IY+d)    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; C = memory_read(WZ); T(3); } break;
+    case 0x4F: /* LD C,A         */ { C = A; } break;
+    case 0x50: /* LD D,B         */ { D = B; } break;
+    case 0x51: /* LD D,C         */ { D = C; } break;
+    case 0x52: /* LD D,D         */ { D = D; } break;
+    case 0x53: /* LD D,E         */ { D = E; } break;
+    case 0x54: /* LD D,IYH       */ { D = IYH; } break;
+    case 0x55: /* LD D,IYL       */ { D = IYL; } break;
+    case 0x56: /* LD D,(IY+d)    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; D = memory_read(WZ); T(3); } break;
+    case 0x57: /* LD D,A         */ { D = A; } break;
+    case 0x58: /* LD E,B         */ { E = B; } break;
+    case 0x59: /* LD E,C         */ { E = C; } break;
+    case 0x5A: /* LD E,D         */ { E = D; } break;
+    case 0x5B: /* LD E,E         */ { E = E; } break;
+    case 0x5C: /* LD E,IYH       */ { E = IYH; } break;
+    case 0x5D: /* LD E,IYL       */ { E = IYL; } break;
+    case 0x5E: /* LD E,(IY+d)    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; E = memory_read(WZ); T(3); } break;
+    case 0x5F: /* LD E,A         */ { E = A; } break;
+    case 0x60: /* LD IYH,B       */ { IYH = B; } break;
+    case 0x61: /* LD IYH,C       */ { IYH = C; } break;
+    case 0x62: /* LD IYH,D       */ { IYH = D; } break;
+    case 0x63: /* LD IYH,E       */ { IYH = E; } break;
+    case 0x64: /* LD IYH,IYH     */ { IYH = IYH; } break;
+    case 0x65: /* LD IYH,IYL     */ { IYH = IYL; } break;
+    case 0x66: /* LD H,(IY+d)    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; H = memory_read(WZ); T(3); } break;
+    case 0x67: /* LD IYH,A       */ { IYH = A; } break;
+    case 0x68: /* LD IYL,B       */ { IYL = B; } break;
+    case 0x69: /* LD IYL,C       */ { IYL = C; } break;
+    case 0x6A: /* LD IYL,D       */ { IYL = D; } break;
+    case 0x6B: /* LD IYL,E       */ { IYL = E; } break;
+    case 0x6C: /* LD IYL,IYH     */ { IYL = IYH; } break;
+    case 0x6D: /* LD IYL,IYL     */ { IYL = IYL; } break;
+    case 0x6E: /* LD L,(IY+d)    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; L = memory_read(WZ); T(3); } break;
+    case 0x6F: /* LD IYL,A       */ { IYL = A; } break;
+    case 0x70: /* LD (IY+d),B    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, B); T(3); } break;
+    case 0x71: /* LD (IY+d),C    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, C); T(3); } break;
+    case 0x72: /* LD (IY+d),D    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, D); T(3); } break;
+    case 0x73: /* LD (IY+d),E    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, E); T(3); } break;
+    case 0x74: /* LD (IY+d),H    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, H); T(3); } break;
+    case 0x75: /* LD (IY+d),L    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, L); T(3); } break;
+    case 0x76: /* HALT           */ { if (!(self.requests & CPU_REQUEST_IRQ) || (IFF1 == 0)) { PC--; self.is_halted = 1; } } break;
+    case 0x77: /* LD (IY+d),A    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; memory_write(WZ, A); T(3); } break;
+    case 0x78: /* LD A,B         */ { A = B; } break;
+    case 0x79: /* LD A,C         */ { A = C; } break;
+    case 0x7A: /* LD A,D         */ { A = D; } break;
+    case 0x7B: /* LD A,E         */ { A = E; } break;
+    case 0x7C: /* LD A,IYH       */ { A = IYH; } break;
+    case 0x7D: /* LD A,IYL       */ { A = IYL; } break;
+    case 0x7E: /* LD A,(IY+d)    */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A = memory_read(WZ); T(3); } break;
+    case 0x7F: /* LD A,A         */ { A = A; } break;
+    case 0x80: /* ADD A,B        */ { const u16_t result = A + B; F = SZ53(result & 0xFF) | HF_ADD(A, B, result) | VF_ADD(A, B, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x81: /* ADD A,C        */ { const u16_t result = A + C; F = SZ53(result & 0xFF) | HF_ADD(A, C, result) | VF_ADD(A, C, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x82: /* ADD A,D        */ { const u16_t result = A + D; F = SZ53(result & 0xFF) | HF_ADD(A, D, result) | VF_ADD(A, D, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x83: /* ADD A,E        */ { const u16_t result = A + E; F = SZ53(result & 0xFF) | HF_ADD(A, E, result) | VF_ADD(A, E, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x84: /* ADD A,IYH      */ { const u16_t result = A + IYH; F = SZ53(result & 0xFF) | HF_ADD(A, IYH, result) | VF_ADD(A, IYH, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x85: /* ADD A,IYL      */ { const u16_t result = A + IYL; F = SZ53(result & 0xFF) | HF_ADD(A, IYL, result) | VF_ADD(A, IYL, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x86: /* ADD A,(IY+d)   */ { u16_t result; WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A + TMP; F = SZ53(result & 0xFF) | HF_ADD(A, TMP, result) | VF_ADD(A, TMP, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x87: /* ADD A,A        */ { const u16_t result = A + A; F = SZ53(result & 0xFF) | HF_ADD(A, A, result) | VF_ADD(A, A, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x88: /* ADC A,B        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + B + carry; F = SZ53(result & 0xFF) | HF_ADD(A, B, result) | VF_ADD(A, B, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x89: /* ADC A,C        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + C + carry; F = SZ53(result & 0xFF) | HF_ADD(A, C, result) | VF_ADD(A, C, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8A: /* ADC A,D        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + D + carry; F = SZ53(result & 0xFF) | HF_ADD(A, D, result) | VF_ADD(A, D, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8B: /* ADC A,E        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + E + carry; F = SZ53(result & 0xFF) | HF_ADD(A, E, result) | VF_ADD(A, E, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8C: /* ADC A,IYH      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + IYH + carry; F = SZ53(result & 0xFF) | HF_ADD(A, IYH, result) | VF_ADD(A, IYH, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8D: /* ADC A,IYL      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + IYL + carry; F = SZ53(result & 0xFF) | HF_ADD(A, IYL, result) | VF_ADD(A, IYL, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8E: /* ADC A,(IY+d)   */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A + TMP + carry; F = SZ53(result & 0xFF) | HF_ADD(A, TMP, result) | VF_ADD(A, TMP, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8F: /* ADC A,A        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + A + carry; F = SZ53(result & 0xFF) | HF_ADD(A, A, result) | VF_ADD(A, A, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x90: /* SUB B          */ { const u16_t result = A - B; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x91: /* SUB C          */ { const u16_t result = A - C; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x92: /* SUB D          */ { const u16_t result = A - D; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x93: /* SUB E          */ { const u16_t result = A - E; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x94: /* SUB IYH        */ { const u16_t result = A - IYH; F = SZ53(result & 0xFF) | HF_SUB(A, IYH, result) | VF_SUB(A, IYH, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x95: /* SUB IYL        */ { const u16_t result = A - IYL; F = SZ53(result & 0xFF) | HF_SUB(A, IYL, result) | VF_SUB(A, IYL, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x96: /* SUB (IY+d)     */ { u16_t result; WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x97: /* SUB A          */ { const u16_t result = A - A; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x98: /* SBC A,B        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - B - carry; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x99: /* SBC A,C        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - C - carry; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9A: /* SBC A,D        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - D - carry; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9B: /* SBC A,E        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - E - carry; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9C: /* SBC A,IYH      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - IYH - carry; F = SZ53(result & 0xFF) | HF_SUB(A, IYH, result) | VF_SUB(A, IYH, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9D: /* SBC A,IYL      */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - IYL - carry; F = SZ53(result & 0xFF) | HF_SUB(A, IYL, result) | VF_SUB(A, IYL, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9E: /* SBC A,(IY+d)   */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A - TMP - carry; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9F: /* SBC A,A        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - A - carry; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xA0: /* AND B          */ { A &= B; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA1: /* AND C          */ { A &= C; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA2: /* AND D          */ { A &= D; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA3: /* AND E          */ { A &= E; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA4: /* AND IYH        */ { A &= IYH; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA5: /* AND IYL        */ { A &= IYL; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA6: /* AND (IY+d)     */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A &= memory_read(WZ); T(3); F = SZ53P(A) | HF_MASK; } break;
+    case 0xA7: /* AND A          */ { A &= A; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA8: /* XOR B          */ { A ^= B; F = SZ53P(A) | 0; } break;
+    case 0xA9: /* XOR C          */ { A ^= C; F = SZ53P(A) | 0; } break;
+    case 0xAA: /* XOR D          */ { A ^= D; F = SZ53P(A) | 0; } break;
+    case 0xAB: /* XOR E          */ { A ^= E; F = SZ53P(A) | 0; } break;
+    case 0xAC: /* XOR IYH        */ { A ^= IYH; F = SZ53P(A) | 0; } break;
+    case 0xAD: /* XOR IYL        */ { A ^= IYL; F = SZ53P(A) | 0; } break;
+    case 0xAE: /* XOR (IY+d)     */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A ^= memory_read(WZ); T(3); F = SZ53P(A) | 0; } break;
+    case 0xAF: /* XOR A          */ { A ^= A; F = SZ53P(A) | 0; } break;
+    case 0xB0: /* OR B           */ { A |= B; F = SZ53P(A) | 0; } break;
+    case 0xB1: /* OR C           */ { A |= C; F = SZ53P(A) | 0; } break;
+    case 0xB2: /* OR D           */ { A |= D; F = SZ53P(A) | 0; } break;
+    case 0xB3: /* OR E           */ { A |= E; F = SZ53P(A) | 0; } break;
+    case 0xB4: /* OR IYH         */ { A |= IYH; F = SZ53P(A) | 0; } break;
+    case 0xB5: /* OR IYL         */ { A |= IYL; F = SZ53P(A) | 0; } break;
+    case 0xB6: /* OR (IY+d)      */ { WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; A |= memory_read(WZ); T(3); F = SZ53P(A) | 0; } break;
+    case 0xB7: /* OR A           */ { A |= A; F = SZ53P(A) | 0; } break;
+    case 0xB8: /* CP B           */ { const u16_t result = A - B; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xB9: /* CP C           */ { const u16_t result = A - C; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBA: /* CP D           */ { const u16_t result = A - D; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBB: /* CP E           */ { const u16_t result = A - E; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBC: /* CP IYH         */ { const u16_t result = A - IYH; F = SZ53(result & 0xFF) | HF_SUB(A, IYH, result) | VF_SUB(A, IYH, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBD: /* CP IYL         */ { const u16_t result = A - IYL; F = SZ53(result & 0xFF) | HF_SUB(A, IYL, result) | VF_SUB(A, IYL, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBE: /* CP (IY+d)      */ { u16_t result; WZ = IY + (s8_t) memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC++; TMP = memory_read(WZ); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBF: /* CP A           */ { const u16_t result = A - A; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xC0: /* RET NZ         */ { T(1); if (!(F & ZF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xC1: /* POP BC         */ { C = memory_read(SP++); T(3); B = memory_read(SP++); T(3); } break;
+    case 0xC2: /* JP NZ,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & ZF_MASK)) { PC = WZ; } } break;
+    case 0xC3: /* JP nn          */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); PC = WZ; } break;
+    case 0xC4: /* CALL NZ,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & ZF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xC5: /* PUSH BC        */ { T(1); memory_write(--SP, B); T(3); memory_write(--SP, C); T(3); } break;
+    case 0xC6: /* ADD A,n        */ { const u8_t n = memory_read(PC++); T(3); const u16_t result = A + n; F = SZ53(result & 0xFF) | HF_ADD(A, n, result) | VF_ADD(A, n, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xC7: /* RST $00        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x00; } break;
+    case 0xC8: /* RET Z          */ { T(1); if (F & ZF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xC9: /* RET            */ { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } break;
+    case 0xCA: /* JP Z,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & ZF_MASK) { PC = WZ; } } break;
+    case 0xCB: execute_FDCB(); break;
+    case 0xCC: /* CALL Z,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & ZF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xCD: /* CALL nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } break;
+    case 0xCE: /* ADC A,n        */ { const u8_t n = memory_read(PC++); T(3); const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + n + carry; F = SZ53(result & 0xFF) | HF_ADD(A, n, result) | VF_ADD(A, n, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xCF: /* RST $08        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x08; } break;
+    case 0xD0: /* RET NC         */ { T(1); if (!(F & CF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xD1: /* POP DE         */ { E = memory_read(SP++); T(3); D = memory_read(SP++); T(3); } break;
+    case 0xD2: /* JP NC,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & CF_MASK)) { PC = WZ; } } break;
+    case 0xD3: /* OUT (n),A      */ { WZ = A << 8 | memory_read(PC++); T(3); io_write(WZ, A); } break;
+    case 0xD4: /* CALL NC,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & CF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xD5: /* PUSH DE        */ { T(1); memory_write(--SP, D); T(3); memory_write(--SP, E); T(3); } break;
+    case 0xD6: /* SUB n          */ { u16_t result; Z = memory_read(PC++); T(3); result = A - Z; F = SZ53(result & 0xFF) | HF_SUB(A, Z, result) | VF_SUB(A, Z, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xD7: /* RST $10        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x10; } break;
+    case 0xD8: /* RET C          */ { T(1); if (F & CF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xD9: /* EXX            */ { u16_t tmp; tmp = BC; BC = BC_; BC_ = tmp; tmp = DE; DE = DE_; DE_ = tmp; tmp = HL; HL = HL_; HL_ = tmp; } break;
+    case 0xDA: /* JP C,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & CF_MASK) { PC = WZ; } } break;
+    case 0xDB: /* IN A,(n)       */ { Z = memory_read(PC++); T(3); A = io_read(A << 8 | Z); } break;
+    case 0xDC: /* CALL C,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & CF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xDE: /* SBC A,n        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; TMP = memory_read(PC++); T(3); result = A - TMP - carry; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xDF: /* RST $18        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x18; } break;
+    case 0xE0: /* RET PO         */ { T(1); if (!(F & PF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xE1: /* POP IY         */ { IYL = memory_read(SP++); T(3); IYH = memory_read(SP++); T(3); } break;
+    case 0xE2: /* JP PO,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & PF_MASK)) { PC = WZ; } } break;
+    case 0xE3: /* EX (SP),IY     */ { Z = memory_read(SP); T(3); W = memory_read(SP + 1); T(4); memory_write(SP, IYL); T(3); memory_write(SP + 1, IYH); T(3); memory_contend(SP + 1); T(1); memory_contend(SP + 1); T(1); IYH = W; IYL = Z; } break;
+    case 0xE4: /* CALL PO,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & PF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xE5: /* PUSH IY        */ { T(1); memory_write(--SP, IYH); T(3); memory_write(--SP, IYL); T(3); } break;
+    case 0xE6: /* AND n          */ { A &= memory_read(PC++); T(3); F = SZ53P(A) | HF_MASK; } break;
+    case 0xE7: /* RST $20        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x20; } break;
+    case 0xE8: /* RET PE         */ { T(1); if (F & PF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xE9: /* JP (IY)        */ { PC = IY; } break;
+    case 0xEA: /* JP PE,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & PF_MASK) { PC = WZ; } } break;
+    case 0xEB: /* EX DE,HL       */ { const u16_t tmp = DE; DE = HL; HL = tmp; } break;
+    case 0xEC: /* CALL PE,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & PF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xEE: /* XOR n          */ { A ^= memory_read(PC++); T(3); F = SZ53P(A) | 0; } break;
+    case 0xEF: /* RST $28        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x28; } break;
+    case 0xF0: /* RET P          */ { T(1); if (!(F & SF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xF1: /* POP AF         */ { F = memory_read(SP++); T(3); A = memory_read(SP++); T(3); } break;
+    case 0xF2: /* JP P,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & SF_MASK)) { PC = WZ; } } break;
+    case 0xF3: /* DI             */ { IFF1 = IFF2 = 0; } break;
+    case 0xF4: /* CALL P,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & SF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xF5: /* PUSH AF        */ { T(1); memory_write(--SP, A); T(3); memory_write(--SP, F); T(3); } break;
+    case 0xF6: /* OR n           */ { A |= memory_read(PC++); T(3); F = SZ53P(A) | 0; } break;
+    case 0xF7: /* RST $30        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x30; } break;
+    case 0xF8: /* RET M          */ { T(1); if (F & SF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xF9: /* LD SP,IY       */ { SP = IY; T(2); } break;
+    case 0xFA: /* JP M,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & SF_MASK) { PC = WZ; } } break;
+    case 0xFB: /* EI             */ { IFF1 = IFF2 = 1; self.irq_delay = 1; } break;
+    case 0xFC: /* CALL M,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & SF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xFD: execute_FD(); break;
+    case 0xFE: /* CP n           */ { u16_t result; TMP = memory_read(PC++); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xFF: /* RST $38        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x38; } break;
+    default:
+      log_wrn("cpu: opcode FD%02X at PC=$%04X not implemented\n", opcode, PC - 1);
+      break;
+  }
+}
+
+inline
+static void cpu_execute_next_opcode(void) {
+  R = (R & 0x80) | ((R + 1) & 0x7F);
+
+  const u8_t opcode = memory_read_opcode(PC++); T(4);
+  switch (opcode) {
+    case 0x00: /* NOP            */ {  } break;
+    case 0x01: /* LD BC,nn       */ { C = memory_read(PC++); T(3); B = memory_read(PC++); T(3); } break;
+    case 0x02: /* LD (BC),A      */ { WZ = BC; memory_write(WZ, A); T(3); } break;
+    case 0x03: /* INC BC         */ { BC++; T(2); } break;
+    case 0x04: /* INC B          */ { B++; F = SZ53(B) | HF_ADD(B - 1, 1, B) | (B == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x05: /* DEC B          */ { B--; F = SZ53(B) | HF_SUB(B + 1, 1, B) | (B == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x06: /* LD B,n         */ { B = memory_read(PC++); T(3); } break;
+    case 0x07: /* RLCA           */ { const u8_t carry = A >> 7; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= carry << CF_SHIFT; A <<= 1; A |= carry; } break;
+    case 0x08: /* EX AF,AF'      */ { const u16_t tmp = AF; AF = AF_; AF_ = tmp; } break;
+    case 0x09: /* ADD HL,BC      */ { const u16_t prev = HL; const u8_t carry = HL > 0xFFFF - BC; HL += BC; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, BC >> 8, HL >> 8) | carry; T(7); } break;
+    case 0x0A: /* LD A,(BC)      */ { WZ = BC; A = memory_read(WZ); T(3); } break;
+    case 0x0B: /* DEC BC         */ { BC--; T(2); } break;
+    case 0x0C: /* INC C          */ { C++; F = SZ53(C) | HF_ADD(C - 1, 1, C) | (C == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x0D: /* DEC C          */ { C--; F = SZ53(C) | HF_SUB(C + 1, 1, C) | (C == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x0E: /* LD C,n         */ { C = memory_read(PC++); T(3); } break;
+    case 0x0F: /* RRCA           */ { const u8_t carry = A & 0x01; F &= ~(NF_MASK | HF_MASK | CF_MASK); F |= carry << CF_SHIFT; A >>= 1; A |= carry << 7; } break;
+    case 0x10: /* DJNZ e         */ { T(1); Z = memory_read(PC); T(3); if (--B) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x11: /* LD DE,nn       */ { E = memory_read(PC++); T(3); D = memory_read(PC++); T(3); } break;
+    case 0x12: /* LD (DE),A      */ { WZ = DE; memory_write(WZ, A); T(3); } break;
+    case 0x13: /* INC DE         */ { DE++; T(2); } break;
+    case 0x14: /* INC D          */ { D++; F = SZ53(D) | HF_ADD(D - 1, 1, D) | (D == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x15: /* DEC D          */ { D--; F = SZ53(D) | HF_SUB(D + 1, 1, D) | (D == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x16: /* LD D,n         */ { D = memory_read(PC++); T(3); } break;
+    case 0x17: /* RLA            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= (A & 0x80) >> 7 << CF_SHIFT; A <<= 1; A |= carry; } break;
+    case 0x18: /* JR e           */ { Z = memory_read(PC); T(3); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; PC++; } break;
+    case 0x19: /* ADD HL,DE      */ { const u16_t prev = HL; const u8_t carry = HL > 0xFFFF - DE; HL += DE; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, DE >> 8, HL >> 8) | carry; T(7); } break;
+    case 0x1A: /* LD A,(DE)      */ { WZ = DE; A = memory_read(WZ); T(3); } break;
+    case 0x1B: /* DEC DE         */ { DE--; T(2); } break;
+    case 0x1C: /* INC E          */ { E++; F = SZ53(E) | HF_ADD(E - 1, 1, E) | (E == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x1D: /* DEC E          */ { E--; F = SZ53(E) | HF_SUB(E + 1, 1, E) | (E == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x1E: /* LD E,n         */ { E = memory_read(PC++); T(3); } break;
+    case 0x1F: /* RRA            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= (A & 0x01) << CF_SHIFT; A >>= 1; A |= carry << 7; } break;
+    case 0x20: /* JR NZ,e        */ { Z = memory_read(PC); T(3); if (!ZF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x21: /* LD HL,nn       */ { L = memory_read(PC++); T(3); H = memory_read(PC++); T(3); } break;
+    case 0x22: /* LD (nn),HL     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, L); T(3); memory_write(WZ + 1, H); T(3); } break;
+    case 0x23: /* INC HL         */ { HL++; T(2); } break;
+    case 0x24: /* INC H          */ { H++; F = SZ53(H) | HF_ADD(H - 1, 1, H) | (H == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x25: /* DEC H          */ { H--; F = SZ53(H) | HF_SUB(H + 1, 1, H) | (H == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x26: /* LD H,n         */ { H = memory_read(PC++); T(3); } break;
+    case 0x27: /* DAA            */ { const u8_t a = A; u8_t correction = 0; if ((F & HF_MASK) || ((A & 0x0F) > 9)) correction += 0x06; if ((F & CF_MASK) || (A > 0x99)) correction += 0x60; if (F & NF_MASK) { A -= correction; } else { A += correction; } F &= NF_MASK | CF_MASK; F |= SZ53P(A) | (a > 0x99) << CF_SHIFT | ((a ^ A) & 0x10) >> 4 << HF_SHIFT; } break;
+    case 0x28: /* JR Z,e         */ { Z = memory_read(PC); T(3); if (ZF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x29: /* ADD HL,HL      */ { const u16_t prev = HL; const u8_t carry = HL > 0xFFFF - HL; HL += HL; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, HL >> 8, HL >> 8) | carry; T(7); } break;
+    case 0x2A: /* LD HL,(nn)     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); L = memory_read(WZ); T(3); H = memory_read(WZ + 1); T(3); } break;
+    case 0x2B: /* DEC HL         */ { HL--; T(2); } break;
+    case 0x2C: /* INC L          */ { L++; F = SZ53(L) | HF_ADD(L - 1, 1, L) | (L == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x2D: /* DEC L          */ { L--; F = SZ53(L) | HF_SUB(L + 1, 1, L) | (L == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x2E: /* LD L,n         */ { L = memory_read(PC++); T(3); } break;
+    case 0x2F: /* CPL            */ { A = ~A; F |= HF_MASK | NF_MASK; } break;
+    case 0x30: /* JR NC,e        */ { Z = memory_read(PC); T(3); if (!CF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x31: /* LD SP,nn       */ { P = memory_read(PC++); T(3); S = memory_read(PC++); T(3); } break;
+    case 0x32: /* LD (nn),A      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_write(WZ, A); T(3); } break;
+    case 0x33: /* INC SP         */ { SP++; T(2); } break;
+    case 0x34: /* INC (HL)       */ { WZ = HL; TMP = memory_read(WZ) + 1; T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP); T(3); F = SZ53(TMP) | HF_ADD(TMP - 1, 1, TMP) | (TMP == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x35: /* DEC (HL)       */ { WZ = HL; TMP = memory_read(WZ) - 1; T(3); memory_contend(WZ); T(1); memory_write(WZ, TMP); T(3); F = SZ53(TMP) | HF_SUB(TMP + 1, 1, TMP) | (TMP == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x36: /* LD (HL),n      */ { WZ = HL; TMP = memory_read(PC); T(3); memory_write(WZ, TMP); T(3); PC++; } break;
+    case 0x37: /* SCF            */ { F &= ~(HF_MASK | NF_MASK); F |= CF_MASK; } break;
+    case 0x38: /* JR C,e         */ { Z = memory_read(PC); T(3); if (CF) { memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); memory_contend(PC); T(1); PC += (s8_t) Z; } PC++; } break;
+    case 0x39: /* ADD HL,SP      */ { const u16_t prev = HL; const u8_t carry = HL > 0xFFFF - SP; HL += SP; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= HF_ADD(prev >> 8, SP >> 8, HL >> 8) | carry; T(7); } break;
+    case 0x3A: /* LD A,(nn)      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); A = memory_read(WZ); T(3); } break;
+    case 0x3B: /* DEC SP         */ { SP--; T(2); } break;
+    case 0x3C: /* INC A          */ { A++; F = SZ53(A) | HF_ADD(A - 1, 1, A) | (A == 0x80) << VF_SHIFT | (F & CF_MASK); } break;
+    case 0x3D: /* DEC A          */ { A--; F = SZ53(A) | HF_SUB(A + 1, 1, A) | (A == 0x7F) << VF_SHIFT | NF_MASK | (F & CF_MASK); } break;
+    case 0x3E: /* LD A,n         */ { A = memory_read(PC++); T(3); } break;
+    case 0x3F: /* CCF            */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; F &= ~(HF_MASK | NF_MASK | CF_MASK); F |= carry << HF_SHIFT | (1 - carry) << CF_SHIFT; } break;
+    case 0x40: /* LD B,B         */ { B = B; } break;
+    case 0x41: /* LD B,C         */ { B = C; } break;
+    case 0x42: /* LD B,D         */ { B = D; } break;
+    case 0x43: /* LD B,E         */ { B = E; } break;
+    case 0x44: /* LD B,H         */ { B = H; } break;
+    case 0x45: /* LD B,L         */ { B = L; } break;
+    case 0x46: /* LD B,(HL)      */ { WZ = HL; B = memory_read(WZ); T(3); } break;
+    case 0x47: /* LD B,A         */ { B = A; } break;
+    case 0x48: /* LD C,B         */ { C = B; } break;
+    case 0x49: /* LD C,C         */ { C = C; } break;
+    case 0x4A: /* LD C,D         */ { C = D; } break;
+    case 0x4B: /* LD C,E         */ { C = E; } break;
+    case 0x4C: /* LD C,H         */ { C = H; } break;
+    case 0x4D: /* LD C,L         */ { C = L; } break;
+    case 0x4E: /* LD C,(HL)      */ { WZ = HL; C = memory_read(WZ); T(3); } break;
+    case 0x4F: /* LD C,A         */ { C = A; } break;
+    case 0x50: /* LD D,B         */ { D = B; } break;
+    case 0x51: /* LD D,C         */ { D = C; } break;
+    case 0x52: /* LD D,D         */ { D = D; } break;
+    case 0x53: /* LD D,E         */ { D = E; } break;
+    case 0x54: /* LD D,H         */ { D = H; } break;
+    case 0x55: /* LD D,L         */ { D = L; } break;
+    case 0x56: /* LD D,(HL)      */ { WZ = HL; D = memory_read(WZ); T(3); } break;
+    case 0x57: /* LD D,A         */ { D = A; } break;
+    case 0x58: /* LD E,B         */ { E = B; } break;
+    case 0x59: /* LD E,C         */ { E = C; } break;
+    case 0x5A: /* LD E,D         */ { E = D; } break;
+    case 0x5B: /* LD E,E         */ { E = E; } break;
+    case 0x5C: /* LD E,H         */ { E = H; } break;
+    case 0x5D: /* LD E,L         */ { E = L; } break;
+    case 0x5E: /* LD E,(HL)      */ { WZ = HL; E = memory_read(WZ); T(3); } break;
+    case 0x5F: /* LD E,A         */ { E = A; } break;
+    case 0x60: /* LD H,B         */ { H = B; } break;
+    case 0x61: /* LD H,C         */ { H = C; } break;
+    case 0x62: /* LD H,D         */ { H = D; } break;
+    case 0x63: /* LD H,E         */ { H = E; } break;
+    case 0x64: /* LD H,H         */ { H = H; } break;
+    case 0x65: /* LD H,L         */ { H = L; } break;
+    case 0x66: /* LD H,(HL)      */ { WZ = HL; H = memory_read(WZ); T(3); } break;
+    case 0x67: /* LD H,A         */ { H = A; } break;
+    case 0x68: /* LD L,B         */ { L = B; } break;
+    case 0x69: /* LD L,C         */ { L = C; } break;
+    case 0x6A: /* LD L,D         */ { L = D; } break;
+    case 0x6B: /* LD L,E         */ { L = E; } break;
+    case 0x6C: /* LD L,H         */ { L = H; } break;
+    case 0x6D: /* LD L,L         */ { L = L; } break;
+    case 0x6E: /* LD L,(HL)      */ { WZ = HL; L = memory_read(WZ); T(3); } break;
+    case 0x6F: /* LD L,A         */ { L = A; } break;
+    case 0x70: /* LD (HL),B      */ { WZ = HL; memory_write(WZ, B); T(3); } break;
+    case 0x71: /* LD (HL),C      */ { WZ = HL; memory_write(WZ, C); T(3); } break;
+    case 0x72: /* LD (HL),D      */ { WZ = HL; memory_write(WZ, D); T(3); } break;
+    case 0x73: /* LD (HL),E      */ { WZ = HL; memory_write(WZ, E); T(3); } break;
+    case 0x74: /* LD (HL),H      */ { WZ = HL; memory_write(WZ, H); T(3); } break;
+    case 0x75: /* LD (HL),L      */ { WZ = HL; memory_write(WZ, L); T(3); } break;
+    case 0x76: /* HALT           */ { if (!(self.requests & CPU_REQUEST_IRQ) || (IFF1 == 0)) { PC--; self.is_halted = 1; } } break;
+    case 0x77: /* LD (HL),A      */ { WZ = HL; memory_write(WZ, A); T(3); } break;
+    case 0x78: /* LD A,B         */ { A = B; } break;
+    case 0x79: /* LD A,C         */ { A = C; } break;
+    case 0x7A: /* LD A,D         */ { A = D; } break;
+    case 0x7B: /* LD A,E         */ { A = E; } break;
+    case 0x7C: /* LD A,H         */ { A = H; } break;
+    case 0x7D: /* LD A,L         */ { A = L; } break;
+    case 0x7E: /* LD A,(HL)      */ { WZ = HL; A = memory_read(WZ); T(3); } break;
+    case 0x7F: /* LD A,A         */ { A = A; } break;
+    case 0x80: /* ADD A,B        */ { const u16_t result = A + B; F = SZ53(result & 0xFF) | HF_ADD(A, B, result) | VF_ADD(A, B, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x81: /* ADD A,C        */ { const u16_t result = A + C; F = SZ53(result & 0xFF) | HF_ADD(A, C, result) | VF_ADD(A, C, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x82: /* ADD A,D        */ { const u16_t result = A + D; F = SZ53(result & 0xFF) | HF_ADD(A, D, result) | VF_ADD(A, D, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x83: /* ADD A,E        */ { const u16_t result = A + E; F = SZ53(result & 0xFF) | HF_ADD(A, E, result) | VF_ADD(A, E, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x84: /* ADD A,H        */ { const u16_t result = A + H; F = SZ53(result & 0xFF) | HF_ADD(A, H, result) | VF_ADD(A, H, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x85: /* ADD A,L        */ { const u16_t result = A + L; F = SZ53(result & 0xFF) | HF_ADD(A, L, result) | VF_ADD(A, L, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x86: /* ADD A,(HL)     */ { u16_t result; WZ = HL; TMP = memory_read(WZ); T(3); result = A + TMP; F = SZ53(result & 0xFF) | HF_ADD(A, TMP, result) | VF_ADD(A, TMP, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x87: /* ADD A,A        */ { const u16_t result = A + A; F = SZ53(result & 0xFF) | HF_ADD(A, A, result) | VF_ADD(A, A, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x88: /* ADC A,B        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + B + carry; F = SZ53(result & 0xFF) | HF_ADD(A, B, result) | VF_ADD(A, B, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x89: /* ADC A,C        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + C + carry; F = SZ53(result & 0xFF) | HF_ADD(A, C, result) | VF_ADD(A, C, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8A: /* ADC A,D        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + D + carry; F = SZ53(result & 0xFF) | HF_ADD(A, D, result) | VF_ADD(A, D, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8B: /* ADC A,E        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + E + carry; F = SZ53(result & 0xFF) | HF_ADD(A, E, result) | VF_ADD(A, E, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8C: /* ADC A,H        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + H + carry; F = SZ53(result & 0xFF) | HF_ADD(A, H, result) | VF_ADD(A, H, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8D: /* ADC A,L        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + L + carry; F = SZ53(result & 0xFF) | HF_ADD(A, L, result) | VF_ADD(A, L, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8E: /* ADC A,(HL)     */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; WZ = HL; TMP = memory_read(WZ); T(3); result = A + TMP + carry; F = SZ53(result & 0xFF) | HF_ADD(A, TMP, result) | VF_ADD(A, TMP, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x8F: /* ADC A,A        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + A + carry; F = SZ53(result & 0xFF) | HF_ADD(A, A, result) | VF_ADD(A, A, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x90: /* SUB B          */ { const u16_t result = A - B; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x91: /* SUB C          */ { const u16_t result = A - C; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x92: /* SUB D          */ { const u16_t result = A - D; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x93: /* SUB E          */ { const u16_t result = A - E; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x94: /* SUB H          */ { const u16_t result = A - H; F = SZ53(result & 0xFF) | HF_SUB(A, H, result) | VF_SUB(A, H, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x95: /* SUB L          */ { const u16_t result = A - L; F = SZ53(result & 0xFF) | HF_SUB(A, L, result) | VF_SUB(A, L, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x96: /* SUB (HL)       */ { u16_t result; WZ = HL; TMP = memory_read(WZ); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x97: /* SUB A          */ { const u16_t result = A - A; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x98: /* SBC A,B        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - B - carry; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x99: /* SBC A,C        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - C - carry; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9A: /* SBC A,D        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - D - carry; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9B: /* SBC A,E        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - E - carry; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9C: /* SBC A,H        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - H - carry; F = SZ53(result & 0xFF) | HF_SUB(A, H, result) | VF_SUB(A, H, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9D: /* SBC A,L        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - L - carry; F = SZ53(result & 0xFF) | HF_SUB(A, L, result) | VF_SUB(A, L, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9E: /* SBC A,(HL)     */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; WZ = HL; TMP = memory_read(WZ); T(3); result = A - TMP - carry; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0x9F: /* SBC A,A        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A - A - carry; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xA0: /* AND B          */ { A &= B; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA1: /* AND C          */ { A &= C; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA2: /* AND D          */ { A &= D; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA3: /* AND E          */ { A &= E; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA4: /* AND H          */ { A &= H; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA5: /* AND L          */ { A &= L; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA6: /* AND (HL)       */ { WZ = HL; A &= memory_read(WZ); T(3); F = SZ53P(A) | HF_MASK; } break;
+    case 0xA7: /* AND A          */ { A &= A; F = SZ53P(A) | HF_MASK; } break;
+    case 0xA8: /* XOR B          */ { A ^= B; F = SZ53P(A) | 0; } break;
+    case 0xA9: /* XOR C          */ { A ^= C; F = SZ53P(A) | 0; } break;
+    case 0xAA: /* XOR D          */ { A ^= D; F = SZ53P(A) | 0; } break;
+    case 0xAB: /* XOR E          */ { A ^= E; F = SZ53P(A) | 0; } break;
+    case 0xAC: /* XOR H          */ { A ^= H; F = SZ53P(A) | 0; } break;
+    case 0xAD: /* XOR L          */ { A ^= L; F = SZ53P(A) | 0; } break;
+    case 0xAE: /* XOR (HL)       */ { WZ = HL; A ^= memory_read(WZ); T(3); F = SZ53P(A) | 0; } break;
+    case 0xAF: /* XOR A          */ { A ^= A; F = SZ53P(A) | 0; } break;
+    case 0xB0: /* OR B           */ { A |= B; F = SZ53P(A) | 0; } break;
+    case 0xB1: /* OR C           */ { A |= C; F = SZ53P(A) | 0; } break;
+    case 0xB2: /* OR D           */ { A |= D; F = SZ53P(A) | 0; } break;
+    case 0xB3: /* OR E           */ { A |= E; F = SZ53P(A) | 0; } break;
+    case 0xB4: /* OR H           */ { A |= H; F = SZ53P(A) | 0; } break;
+    case 0xB5: /* OR L           */ { A |= L; F = SZ53P(A) | 0; } break;
+    case 0xB6: /* OR (HL)        */ { WZ = HL; A |= memory_read(WZ); T(3); F = SZ53P(A) | 0; } break;
+    case 0xB7: /* OR A           */ { A |= A; F = SZ53P(A) | 0; } break;
+    case 0xB8: /* CP B           */ { const u16_t result = A - B; F = SZ53(result & 0xFF) | HF_SUB(A, B, result) | VF_SUB(A, B, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xB9: /* CP C           */ { const u16_t result = A - C; F = SZ53(result & 0xFF) | HF_SUB(A, C, result) | VF_SUB(A, C, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBA: /* CP D           */ { const u16_t result = A - D; F = SZ53(result & 0xFF) | HF_SUB(A, D, result) | VF_SUB(A, D, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBB: /* CP E           */ { const u16_t result = A - E; F = SZ53(result & 0xFF) | HF_SUB(A, E, result) | VF_SUB(A, E, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBC: /* CP H           */ { const u16_t result = A - H; F = SZ53(result & 0xFF) | HF_SUB(A, H, result) | VF_SUB(A, H, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBD: /* CP L           */ { const u16_t result = A - L; F = SZ53(result & 0xFF) | HF_SUB(A, L, result) | VF_SUB(A, L, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBE: /* CP (HL)        */ { u16_t result; WZ = HL; TMP = memory_read(WZ); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xBF: /* CP A           */ { const u16_t result = A - A; F = SZ53(result & 0xFF) | HF_SUB(A, A, result) | VF_SUB(A, A, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xC0: /* RET NZ         */ { T(1); if (!(F & ZF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xC1: /* POP BC         */ { C = memory_read(SP++); T(3); B = memory_read(SP++); T(3); } break;
+    case 0xC2: /* JP NZ,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & ZF_MASK)) { PC = WZ; } } break;
+    case 0xC3: /* JP nn          */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); PC = WZ; } break;
+    case 0xC4: /* CALL NZ,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & ZF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xC5: /* PUSH BC        */ { T(1); memory_write(--SP, B); T(3); memory_write(--SP, C); T(3); } break;
+    case 0xC6: /* ADD A,n        */ { const u8_t n = memory_read(PC++); T(3); const u16_t result = A + n; F = SZ53(result & 0xFF) | HF_ADD(A, n, result) | VF_ADD(A, n, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xC7: /* RST $00        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x00; } break;
+    case 0xC8: /* RET Z          */ { T(1); if (F & ZF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xC9: /* RET            */ { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } break;
+    case 0xCA: /* JP Z,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & ZF_MASK) { PC = WZ; } } break;
+    case 0xCB: execute_CB(); break;
+    case 0xCC: /* CALL Z,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & ZF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xCD: /* CALL nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } break;
+    case 0xCE: /* ADC A,n        */ { const u8_t n = memory_read(PC++); T(3); const u8_t carry = (F & CF_MASK) >> CF_SHIFT; const u16_t result = A + n + carry; F = SZ53(result & 0xFF) | HF_ADD(A, n, result) | VF_ADD(A, n, result) | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xCF: /* RST $08        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x08; } break;
+    case 0xD0: /* RET NC         */ { T(1); if (!(F & CF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xD1: /* POP DE         */ { E = memory_read(SP++); T(3); D = memory_read(SP++); T(3); } break;
+    case 0xD2: /* JP NC,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & CF_MASK)) { PC = WZ; } } break;
+    case 0xD3: /* OUT (n),A      */ { WZ = A << 8 | memory_read(PC++); T(3); io_write(WZ, A); } break;
+    case 0xD4: /* CALL NC,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & CF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xD5: /* PUSH DE        */ { T(1); memory_write(--SP, D); T(3); memory_write(--SP, E); T(3); } break;
+    case 0xD6: /* SUB n          */ { u16_t result; Z = memory_read(PC++); T(3); result = A - Z; F = SZ53(result & 0xFF) | HF_SUB(A, Z, result) | VF_SUB(A, Z, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xD7: /* RST $10        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x10; } break;
+    case 0xD8: /* RET C          */ { T(1); if (F & CF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xD9: /* EXX            */ { u16_t tmp; tmp = BC; BC = BC_; BC_ = tmp; tmp = DE; DE = DE_; DE_ = tmp; tmp = HL; HL = HL_; HL_ = tmp; } break;
+    case 0xDA: /* JP C,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & CF_MASK) { PC = WZ; } } break;
+    case 0xDB: /* IN A,(n)       */ { Z = memory_read(PC++); T(3); A = io_read(A << 8 | Z); } break;
+    case 0xDC: /* CALL C,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & CF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xDD: execute_DD(); break;
+    case 0xDE: /* SBC A,n        */ { const u8_t carry = (F & CF_MASK) >> CF_SHIFT; u16_t result; TMP = memory_read(PC++); T(3); result = A - TMP - carry; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); A = result & 0xFF; } break;
+    case 0xDF: /* RST $18        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x18; } break;
+    case 0xE0: /* RET PO         */ { T(1); if (!(F & PF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xE1: /* POP HL         */ { L = memory_read(SP++); T(3); H = memory_read(SP++); T(3); } break;
+    case 0xE2: /* JP PO,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & PF_MASK)) { PC = WZ; } } break;
+    case 0xE3: /* EX (SP),HL     */ { Z = memory_read(SP); T(3); W = memory_read(SP + 1); T(4); memory_write(SP, L); T(3); memory_write(SP + 1, H); T(3); memory_contend(SP + 1); T(1); memory_contend(SP + 1); T(1); H = W; L = Z; } break;
+    case 0xE4: /* CALL PO,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & PF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xE5: /* PUSH HL        */ { T(1); memory_write(--SP, H); T(3); memory_write(--SP, L); T(3); } break;
+    case 0xE6: /* AND n          */ { A &= memory_read(PC++); T(3); F = SZ53P(A) | HF_MASK; } break;
+    case 0xE7: /* RST $20        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x20; } break;
+    case 0xE8: /* RET PE         */ { T(1); if (F & PF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xE9: /* JP (HL)        */ { PC = HL; } break;
+    case 0xEA: /* JP PE,nn       */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & PF_MASK) { PC = WZ; } } break;
+    case 0xEB: /* EX DE,HL       */ { const u16_t tmp = DE; DE = HL; HL = tmp; } break;
+    case 0xEC: /* CALL PE,nn     */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & PF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xED: execute_ED(); break;
+    case 0xEE: /* XOR n          */ { A ^= memory_read(PC++); T(3); F = SZ53P(A) | 0; } break;
+    case 0xEF: /* RST $28        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x28; } break;
+    case 0xF0: /* RET P          */ { T(1); if (!(F & SF_MASK)) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xF1: /* POP AF         */ { F = memory_read(SP++); T(3); A = memory_read(SP++); T(3); } break;
+    case 0xF2: /* JP P,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & SF_MASK)) { PC = WZ; } } break;
+    case 0xF3: /* DI             */ { IFF1 = IFF2 = 0; } break;
+    case 0xF4: /* CALL P,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (!(F & SF_MASK)) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xF5: /* PUSH AF        */ { T(1); memory_write(--SP, A); T(3); memory_write(--SP, F); T(3); } break;
+    case 0xF6: /* OR n           */ { A |= memory_read(PC++); T(3); F = SZ53P(A) | 0; } break;
+    case 0xF7: /* RST $30        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x30; } break;
+    case 0xF8: /* RET M          */ { T(1); if (F & SF_MASK) { PCL = memory_read(SP++); T(3); PCH = memory_read(SP++); T(3); } } break;
+    case 0xF9: /* LD SP,HL       */ { SP = HL; T(2); } break;
+    case 0xFA: /* JP M,nn        */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & SF_MASK) { PC = WZ; } } break;
+    case 0xFB: /* EI             */ { IFF1 = IFF2 = 1; self.irq_delay = 1; } break;
+    case 0xFC: /* CALL M,nn      */ { Z = memory_read(PC++); T(3); W = memory_read(PC++); T(3); if (F & SF_MASK) { memory_contend(PC - 1); T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = WZ; } } break;
+    case 0xFD: execute_FD(); break;
+    case 0xFE: /* CP n           */ { u16_t result; TMP = memory_read(PC++); T(3); result = A - TMP; F = SZ53(result & 0xFF) | HF_SUB(A, TMP, result) | VF_SUB(A, TMP, result) | NF_MASK | (result & 0x0100 ? CF_MASK : 0); } break;
+    case 0xFF: /* RST $38        */ { T(1); memory_write(--SP, PCH); T(3); memory_write(--SP, PCL); T(3); PC = 0x38; } break;
+      log_wrn("cpu: opcode %02X at PC=$%04X not implemented\n", opcode, PC - 1);
+      break;
+  }
+}
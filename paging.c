@@ -2,6 +2,7 @@
 #include "log.h"
 #include "mmu.h"
 #include "paging.h"
+#include "rewind.h"
 #include "rom.h"
 #include "ula.h"
 
@@ -13,11 +14,14 @@ typedef struct self_t {
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 int paging_init(void) {
   paging_reset(E_RESET_HARD);
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
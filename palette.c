@@ -1,6 +1,7 @@
 #include "defs.h"
 #include "log.h"
 #include "palette.h"
+#include "rewind.h"
 
 
 #define N_PALETTES  (E_PALETTE_TILEMAP_SECOND - E_PALETTE_ULA_FIRST + 1)
@@ -11,10 +12,12 @@ typedef struct pal_t {
 } pal_t;
 
 
-static pal_t pal;
+static VIDEO_LOCAL pal_t pal;
 
 
 int palette_init(void) {
+  rewind_register(&pal, sizeof(pal), NULL);
+
   return 0;
 }
 
@@ -37,6 +40,8 @@ const palette_entry_t* palette_read(palette_t palette, u8_t index) {
 void palette_write_rgb8(palette_t palette, u8_t index, u8_t value) {
   palette_entry_t* entry = &pal.palette[palette][index];
 
+  slu_log4(E_SLU_OP_PALETTE_WRITE_RGB8, palette, index, value, 0);
+
   /**
    * https://gitlab.com/SpectrumNext/ZX_Spectrum_Next_FPGA/-/raw/master/cores/zxnext/nextreg.txt
    *
@@ -53,6 +58,8 @@ void palette_write_rgb8(palette_t palette, u8_t index, u8_t value) {
 void palette_write_rgb9(palette_t palette, u8_t index, u8_t value) {
   palette_entry_t* entry = &pal.palette[palette][index];
 
+  slu_log4(E_SLU_OP_PALETTE_WRITE_RGB9, palette, index, value, 0);
+
   entry->rgb9               = (entry->rgb9 & 0x1FE) | (value & 1);
   entry->rgb16              = PALETTE_RGB9_TO_RGB16(entry->rgb9);
   entry->is_layer2_priority = value >> 7;
@@ -0,0 +1,295 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string.h>
+#include "audio.h"
+#include "clock.h"
+#include "defs.h"
+#include "joystick.h"
+#include "keyboard.h"
+#include "log.h"
+#include "mouse.h"
+#include "replay.h"
+#include "rtc.h"
+
+
+/**
+ * Deterministic execution. The RTC follows emulated time, audio is handed
+ * over at host syncs, and input only changes at host syncs. The latter fall
+ * on fixed 28 MHz ticks, hence input is recorded to and replayed from a log
+ * of lines keyed by tick:
+ *
+ *   <tick> key <scancode> <0|1>
+ *   <tick> joy <n> <buttons>
+ *   <tick> mouse <x> <y> <buttons>
+ *   <tick> end
+ *
+ * Digests of all frames and audio buffers are logged on exit, to compare
+ * runs with.
+ */
+
+
+#define FNV_OFFSET_BASIS  0x811C9DC5
+#define FNV_PRIME         0x01000193
+
+#define MAX_LINE_LENGTH   64
+
+
+typedef enum {
+  E_ENTRY_KEY,
+  E_ENTRY_JOY,
+  E_ENTRY_MOUSE,
+  E_ENTRY_END
+} entry_type_t;
+
+
+typedef struct {
+  u64_t        ticks_28mhz;
+  entry_type_t type;
+  unsigned int args[3];
+} entry_t;
+
+
+typedef struct {
+  replay_mode_t mode;
+  FILE*         fp;
+  int           line;
+  entry_t       next;
+  int           is_next_valid;
+  u8_t          keys[SDL_NUM_SCANCODES];
+  u16_t         joystick_buttons[2];
+  u8_t          mouse_x;
+  u8_t          mouse_y;
+  u8_t          mouse_buttons;
+  u64_t         last_sync_ticks_28mhz;
+  u64_t         n_frames;
+  u32_t         frames_digest;
+  u64_t         n_audio_buffers;
+  u32_t         audio_digest;
+} self_t;
+
+
+static MACHINE_LOCAL self_t self;
+
+
+int replay_init(void) {
+  memset(&self, 0, sizeof(self));
+
+  self.mode          = E_REPLAY_MODE_OFF;
+  self.frames_digest = FNV_OFFSET_BASIS;
+  self.audio_digest  = FNV_OFFSET_BASIS;
+
+  return 0;
+}
+
+
+void replay_finit(void) {
+  if (self.mode == E_REPLAY_MODE_OFF) {
+    return;
+  }
+
+  if (self.mode == E_REPLAY_MODE_RECORD) {
+    fprintf(self.fp, "%llu end\n", self.last_sync_ticks_28mhz);
+  }
+
+  if (self.fp != NULL) {
+    fclose(self.fp);
+    self.fp = NULL;
+  }
+
+  log_wrn("replay: %llu frames with digest %08X, %llu audio buffers with digest %08X\n",
+          self.n_frames, self.frames_digest,
+          self.n_audio_buffers, self.audio_digest);
+
+  self.mode = E_REPLAY_MODE_OFF;
+}
+
+
+static u32_t replay_digest(u32_t digest, const u8_t* data, size_t n) {
+  size_t i;
+
+  for (i = 0; i < n; i++) {
+    digest = (digest ^ data[i]) * FNV_PRIME;
+  }
+
+  return digest;
+}
+
+
+/**
+ * Reads the next log entry, if any.
+ */
+static void replay_read_next(void) {
+  char     line[MAX_LINE_LENGTH];
+  char     type[8];
+  entry_t* entry = &self.next;
+  int      n;
+
+  self.is_next_valid = 0;
+
+  while (fgets(line, sizeof(line), self.fp) != NULL) {
+    self.line++;
+
+    n = sscanf(line, "%llu %7s %u %u %u", &entry->ticks_28mhz, type, &entry->args[0], &entry->args[1], &entry->args[2]);
+    if (n < 2) {
+      continue;
+    }
+
+    if (strcmp(type, "key") == 0 && n == 4 && entry->args[0] < SDL_NUM_SCANCODES) {
+      entry->type = E_ENTRY_KEY;
+    } else if (strcmp(type, "joy") == 0 && n == 4 && entry->args[0] < 2) {
+      entry->type = E_ENTRY_JOY;
+    } else if (strcmp(type, "mouse") == 0 && n == 5) {
+      entry->type = E_ENTRY_MOUSE;
+    } else if (strcmp(type, "end") == 0) {
+      entry->type = E_ENTRY_END;
+    } else {
+      log_wrn("replay: ignoring invalid entry on line %d\n", self.line);
+      continue;
+    }
+
+    self.is_next_valid = 1;
+    return;
+  }
+}
+
+
+int replay_start(replay_mode_t mode, const char* filename) {
+  if (mode == E_REPLAY_MODE_RECORD || mode == E_REPLAY_MODE_REPLAY) {
+    self.fp = fopen(filename, mode == E_REPLAY_MODE_RECORD ? "w" : "r");
+    if (self.fp == NULL) {
+      log_err("replay: could not open %s\n", filename);
+      return -1;
+    }
+
+    /* Input no longer comes straight from the host. */
+    keyboard_state_set(self.keys);
+    self.joystick_buttons[E_JOYSTICK_LEFT]  = joystick_buttons_get(E_JOYSTICK_LEFT);
+    self.joystick_buttons[E_JOYSTICK_RIGHT] = joystick_buttons_get(E_JOYSTICK_RIGHT);
+    self.mouse_x                            = mouse_read_x();
+    self.mouse_y                            = mouse_read_y();
+    self.mouse_buttons                      = mouse_read_buttons();
+
+    if (mode == E_REPLAY_MODE_REPLAY) {
+      replay_read_next();
+    }
+  }
+
+  self.mode = mode;
+
+  rtc_emulated_set(1);
+  audio_deterministic_set(1);
+
+  return 0;
+}
+
+
+int replay_is_deterministic(void) {
+  return self.mode != E_REPLAY_MODE_OFF;
+}
+
+
+int replay_is_replaying(void) {
+  return self.mode == E_REPLAY_MODE_REPLAY;
+}
+
+
+static void replay_record(void) {
+  const u8_t* state = SDL_GetKeyboardState(NULL);
+  const u64_t now   = clock_ticks();
+  joystick_t  n;
+  int         i;
+
+  for (i = 0; i < SDL_NUM_SCANCODES; i++) {
+    if (state[i] != self.keys[i]) {
+      self.keys[i] = state[i];
+      fprintf(self.fp, "%llu key %d %d\n", now, i, self.keys[i]);
+    }
+  }
+
+  for (n = E_JOYSTICK_LEFT; n <= E_JOYSTICK_RIGHT; n++) {
+    const u16_t buttons = joystick_buttons_get(n);
+    if (buttons != self.joystick_buttons[n]) {
+      self.joystick_buttons[n] = buttons;
+      fprintf(self.fp, "%llu joy %d %u\n", now, n, buttons);
+    }
+  }
+
+  if (mouse_read_x() != self.mouse_x || mouse_read_y() != self.mouse_y || mouse_read_buttons() != self.mouse_buttons) {
+    self.mouse_x       = mouse_read_x();
+    self.mouse_y       = mouse_read_y();
+    self.mouse_buttons = mouse_read_buttons();
+    fprintf(self.fp, "%llu mouse %u %u %u\n", now, self.mouse_x, self.mouse_y, self.mouse_buttons);
+  }
+}
+
+
+/**
+ * Applies all entries that are due, and returns non-zero when the log has
+ * ended.
+ */
+static int replay_replay(void) {
+  const u64_t    now   = clock_ticks();
+  const entry_t* entry = &self.next;
+
+  while (self.is_next_valid && entry->ticks_28mhz <= now) {
+    switch (entry->type) {
+      case E_ENTRY_KEY:
+        self.keys[entry->args[0]] = entry->args[1] ? 1 : 0;
+        break;
+
+      case E_ENTRY_JOY:
+        joystick_buttons_set(entry->args[0], entry->args[1]);
+        break;
+
+      case E_ENTRY_MOUSE:
+        mouse_set(entry->args[0], entry->args[1], entry->args[2]);
+        break;
+
+      case E_ENTRY_END:
+        return 1;
+    }
+
+    replay_read_next();
+  }
+
+  return !self.is_next_valid;
+}
+
+
+/**
+ * Called on every host sync, which happens at deterministic ticks, after
+ * the host input has been refreshed.
+ */
+int replay_sync(void) {
+  self.last_sync_ticks_28mhz = clock_ticks();
+
+  switch (self.mode) {
+    case E_REPLAY_MODE_RECORD:
+      replay_record();
+      break;
+
+    case E_REPLAY_MODE_REPLAY:
+      return replay_replay();
+
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+
+void replay_frame_completed(const u16_t* frame_buffer) {
+  if (self.mode == E_REPLAY_MODE_OFF) {
+    return;
+  }
+
+  self.frames_digest = replay_digest(self.frames_digest, (const u8_t *) frame_buffer, FRAME_BUFFER_SIZE);
+  self.n_frames++;
+}
+
+
+void replay_audio_completed(const s8_t* samples, size_t n) {
+  self.audio_digest = replay_digest(self.audio_digest, (const u8_t *) samples, n);
+  self.n_audio_buffers++;
+}
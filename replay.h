@@ -0,0 +1,26 @@
+#ifndef __REPLAY_H
+#define __REPLAY_H
+
+
+#include "defs.h"
+
+
+typedef enum {
+  E_REPLAY_MODE_OFF = 0,
+  E_REPLAY_MODE_DETERMINISTIC,
+  E_REPLAY_MODE_RECORD,
+  E_REPLAY_MODE_REPLAY
+} replay_mode_t;
+
+
+int  replay_init(void);
+void replay_finit(void);
+int  replay_start(replay_mode_t mode, const char* filename);
+int  replay_is_deterministic(void);
+int  replay_is_replaying(void);
+int  replay_sync(void);
+void replay_frame_completed(const u16_t* frame_buffer);
+void replay_audio_completed(const s8_t* samples, size_t n);
+
+
+#endif  /* __REPLAY_H */
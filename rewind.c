@@ -0,0 +1,327 @@
+#include <stdlib.h>
+#include <string.h>
+#include "defs.h"
+#include "log.h"
+#include "memory.h"
+#include "rewind.h"
+
+
+/**
+ * Keeps a window of snapshots, one per frame, to step back in time.
+ *
+ * Every REWIND_KEYFRAME_INTERVAL frames a keyframe holds all of SRAM, the
+ * snapshots in between only hold the SRAM pages written to since the
+ * previous one. All snapshots hold the module states, which modules
+ * register on init. Restoring copies the keyframe and replays the pages of
+ * the snapshots after it.
+ *
+ * When the window grows beyond REWIND_MAX_SNAPSHOTS or REWIND_MAX_BYTES,
+ * the oldest keyframe goes, along with the snapshots that depend on it.
+ */
+
+
+#define REWIND_KEYFRAME_INTERVAL  50
+#define REWIND_MAX_SNAPSHOTS      (10 * REWIND_KEYFRAME_INTERVAL)
+#define REWIND_MAX_BYTES          (64 * 1024 * 1024)
+#define REWIND_MAX_REGIONS        48
+
+#define N_SRAM_PAGES              (MEMORY_SRAM_SIZE / MEMORY_SRAM_PAGE_SIZE)
+
+
+typedef struct {
+  void*             state;
+  size_t            size;
+  rewind_restored_t restored;
+} region_t;
+
+
+typedef struct {
+  int    is_keyframe;
+  int    n_pages;
+  u8_t   pages[N_SRAM_PAGES];  /* SRAM page numbers, when not a keyframe. */
+  u8_t*  data;                 /* Module states, followed by the SRAM pages. */
+  size_t size;
+} snapshot_t;
+
+
+typedef struct {
+  region_t   regions[REWIND_MAX_REGIONS];
+  int        n_regions;
+  size_t     states_size;
+  int        is_enabled;
+  u8_t*      sram;
+  snapshot_t snapshots[REWIND_MAX_SNAPSHOTS];
+  int        first;
+  int        n_snapshots;
+  size_t     n_bytes;
+  u32_t      frames_since_keyframe;
+} self_t;
+
+
+static MACHINE_LOCAL self_t self;
+
+
+int rewind_init(void) {
+  memset(&self, 0, sizeof(self));
+  return 0;
+}
+
+
+static snapshot_t* rewind_snapshot_get(int i) {
+  return &self.snapshots[(self.first + i) % REWIND_MAX_SNAPSHOTS];
+}
+
+
+static void rewind_drop_last(void) {
+  snapshot_t* snapshot = rewind_snapshot_get(self.n_snapshots - 1);
+
+  self.n_bytes -= snapshot->size;
+  free(snapshot->data);
+  snapshot->data = NULL;
+  self.n_snapshots--;
+}
+
+
+/**
+ * Drops the oldest keyframe and the snapshots that build on it.
+ */
+static void rewind_drop_oldest(void) {
+  do {
+    snapshot_t* snapshot = rewind_snapshot_get(0);
+
+    self.n_bytes -= snapshot->size;
+    free(snapshot->data);
+    snapshot->data = NULL;
+    self.first     = (self.first + 1) % REWIND_MAX_SNAPSHOTS;
+    self.n_snapshots--;
+  } while (self.n_snapshots > 0 && !rewind_snapshot_get(0)->is_keyframe);
+}
+
+
+static void rewind_clear(void) {
+  while (self.n_snapshots > 0) {
+    rewind_drop_last();
+  }
+  self.first = 0;
+}
+
+
+void rewind_finit(void) {
+  rewind_clear();
+}
+
+
+/**
+ * Adds a piece of module state to every snapshot. The callback, if any, runs
+ * after all states have been restored, to rebuild what derives from them.
+ */
+void rewind_register(void* state, size_t size, rewind_restored_t restored) {
+  if (self.n_regions == REWIND_MAX_REGIONS) {
+    log_err("rewind: too many regions\n");
+    return;
+  }
+
+  self.regions[self.n_regions].state    = state;
+  self.regions[self.n_regions].size     = size;
+  self.regions[self.n_regions].restored = restored;
+  self.n_regions++;
+  self.states_size += size;
+}
+
+
+int rewind_enable(int enable) {
+  rewind_clear();
+
+  self.is_enabled            = enable;
+  self.sram                  = memory_sram();
+  self.frames_since_keyframe = 0;
+
+  memory_dirty_tracking_enable(enable);
+
+  return 0;
+}
+
+
+int rewind_is_enabled(void) {
+  return self.is_enabled;
+}
+
+
+/**
+ * Copies all module states to p, returning where they end.
+ */
+static u8_t* rewind_states_save(u8_t* p) {
+  int i;
+
+  for (i = 0; i < self.n_regions; i++) {
+    memcpy(p, self.regions[i].state, self.regions[i].size);
+    p += self.regions[i].size;
+  }
+
+  return p;
+}
+
+
+/**
+ * Copies all module states from p, then lets the modules rebuild what
+ * derives from them, returning where the states end.
+ */
+static const u8_t* rewind_states_load(const u8_t* p) {
+  int i;
+
+  for (i = 0; i < self.n_regions; i++) {
+    memcpy(self.regions[i].state, p, self.regions[i].size);
+    p += self.regions[i].size;
+  }
+  for (i = 0; i < self.n_regions; i++) {
+    if (self.regions[i].restored != NULL) {
+      self.regions[i].restored();
+    }
+  }
+
+  return p;
+}
+
+
+/**
+ * Takes a snapshot, which must happen between instructions.
+ */
+void rewind_snapshot(void) {
+  snapshot_t* snapshot;
+  u8_t*       p;
+  int         i;
+
+  if (!self.is_enabled) {
+    return;
+  }
+
+  if (self.n_snapshots == REWIND_MAX_SNAPSHOTS) {
+    rewind_drop_oldest();
+  }
+
+  snapshot              = rewind_snapshot_get(self.n_snapshots);
+  snapshot->is_keyframe = (self.n_snapshots == 0 || self.frames_since_keyframe == REWIND_KEYFRAME_INTERVAL);
+  snapshot->n_pages     = memory_dirty_pages_take(snapshot->pages);
+  if (snapshot->is_keyframe) {
+    snapshot->n_pages = N_SRAM_PAGES;
+  }
+
+  snapshot->size = self.states_size + snapshot->n_pages * MEMORY_SRAM_PAGE_SIZE;
+  snapshot->data = malloc(snapshot->size);
+  if (snapshot->data == NULL) {
+    log_wrn("rewind: out of memory\n");
+    rewind_enable(0);
+    return;
+  }
+
+  p = rewind_states_save(snapshot->data);
+
+  if (snapshot->is_keyframe) {
+    memcpy(p, self.sram, MEMORY_SRAM_SIZE);
+    self.frames_since_keyframe = 0;
+  } else {
+    for (i = 0; i < snapshot->n_pages; i++) {
+      memcpy(p, &self.sram[snapshot->pages[i] * MEMORY_SRAM_PAGE_SIZE], MEMORY_SRAM_PAGE_SIZE);
+      p += MEMORY_SRAM_PAGE_SIZE;
+    }
+  }
+
+  self.frames_since_keyframe++;
+  self.n_snapshots++;
+  self.n_bytes += snapshot->size;
+
+  while (self.n_bytes > REWIND_MAX_BYTES && self.n_snapshots > REWIND_KEYFRAME_INTERVAL) {
+    rewind_drop_oldest();
+  }
+}
+
+
+/**
+ * Returns how many frames we can go back.
+ */
+u32_t rewind_available(void) {
+  return self.n_snapshots;
+}
+
+
+/**
+ * Returns to the start of the n-th most recent frame, where the first one is
+ * the frame currently running. Later snapshots are discarded.
+ */
+int rewind_restore(u32_t n_frames) {
+  int         target = self.n_snapshots - (int) n_frames;
+  int         keyframe;
+  snapshot_t* snapshot;
+  u8_t        pages[N_SRAM_PAGES];
+  u8_t*       p;
+  int         i;
+  int         j;
+
+  if (!self.is_enabled || n_frames == 0 || target < 0) {
+    return -1;
+  }
+
+  for (keyframe = target; !rewind_snapshot_get(keyframe)->is_keyframe; keyframe--);
+
+  /* Rebuild SRAM as it was at the target. */
+  for (i = keyframe; i <= target; i++) {
+    snapshot = rewind_snapshot_get(i);
+    p        = snapshot->data + self.states_size;
+
+    if (snapshot->is_keyframe) {
+      memcpy(self.sram, p, MEMORY_SRAM_SIZE);
+    } else {
+      for (j = 0; j < snapshot->n_pages; j++) {
+        memcpy(&self.sram[snapshot->pages[j] * MEMORY_SRAM_PAGE_SIZE], p, MEMORY_SRAM_PAGE_SIZE);
+        p += MEMORY_SRAM_PAGE_SIZE;
+      }
+    }
+  }
+
+  rewind_states_load(rewind_snapshot_get(target)->data);
+
+  /* History starts over from the target. */
+  while (self.n_snapshots > target + 1) {
+    rewind_drop_last();
+  }
+  self.frames_since_keyframe = target - keyframe + 1;
+
+  /* What is written from here on goes into the next snapshot. */
+  (void) memory_dirty_pages_take(pages);
+
+  return 0;
+}
+
+
+/**
+ * Returns the size of a complete machine state, being all module states
+ * followed by SRAM.
+ */
+size_t rewind_state_size(void) {
+  return self.states_size + MEMORY_SRAM_SIZE;
+}
+
+
+/**
+ * Saves the complete machine state, which must happen between instructions.
+ */
+void rewind_state_save(u8_t* state) {
+  memcpy(rewind_states_save(state), memory_sram(), MEMORY_SRAM_SIZE);
+}
+
+
+/**
+ * Replaces the complete machine state with one saved before. Snapshots
+ * taken so far no longer apply, hence rewinding starts over.
+ */
+void rewind_state_load(const u8_t* state) {
+  u8_t pages[N_SRAM_PAGES];
+
+  memcpy(memory_sram(), state + self.states_size, MEMORY_SRAM_SIZE);
+  (void) rewind_states_load(state);
+
+  if (self.is_enabled) {
+    rewind_enable(1);
+  }
+  (void) memory_dirty_pages_take(pages);
+}
@@ -0,0 +1,24 @@
+#ifndef __REWIND_H
+#define __REWIND_H
+
+
+#include "defs.h"
+
+
+typedef void (*rewind_restored_t)(void);
+
+
+int    rewind_init(void);
+void   rewind_finit(void);
+void   rewind_register(void* state, size_t size, rewind_restored_t restored);
+int    rewind_enable(int enable);
+int    rewind_is_enabled(void);
+void   rewind_snapshot(void);
+u32_t  rewind_available(void);
+int    rewind_restore(u32_t n_frames);
+size_t rewind_state_size(void);
+void   rewind_state_save(u8_t* state);
+void   rewind_state_load(const u8_t* state);
+
+
+#endif  /* __REWIND_H */
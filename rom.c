@@ -4,6 +4,7 @@
 #include "log.h"
 #include "memory.h"
 #include "nextreg.h"
+#include "rewind.h"
 #include "rom.h"
 #include "utils.h"
 
@@ -20,7 +21,7 @@ typedef struct self_t {
 } self_t;
 
 
-static self_t self;
+static MACHINE_LOCAL self_t self;
 
 
 static void rom_refresh_ptr(void) {
@@ -69,6 +70,8 @@ int rom_init(u8_t* sram) {
 
   rom_refresh_ptr();
 
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -86,6 +89,11 @@ void rom_write(u16_t address, u8_t value) {
 }
 
 
+u32_t rom_sram_offset(u16_t address) {
+  return (self.ptr - self.sram) + address;
+}
+
+
 machine_type_t rom_machine_type_get(void) {
   return self.machine_type;
 }
@@ -112,6 +120,7 @@ void rom_select(rom_t rom) {
     rom_refresh_ptr();
 
     altrom_select(rom);
+    divmmc_automap_candidates_refresh();
   }
 }
 
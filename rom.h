@@ -19,6 +19,7 @@ int            rom_init(u8_t* sram);
 void           rom_finit(void);
 u8_t           rom_read(u16_t address);
 void           rom_write(u16_t address, u8_t value);
+u32_t          rom_sram_offset(u16_t address);
 void           rom_select(rom_t rom);
 rom_t          rom_selected(void);
 void           rom_lock(rom_t rom);
@@ -1,6 +1,8 @@
 #include <time.h>
+#include "clock.h"
 #include "defs.h"
 #include "log.h"
+#include "rewind.h"
 
 
 /**
@@ -11,17 +13,25 @@
 
 #define BCD(x)  (((x) / 10) << 4 | ((x) % 10))
 
+/* Emulated time starts at 2021-01-01 00:00:00 UTC. */
+#define EMULATED_EPOCH  1609459200
+
 
 typedef struct rtc_t {
   u8_t index;
+  int  is_emulated;
 } rtc_t;
 
 
-static rtc_t self;
+static MACHINE_LOCAL rtc_t self;
 
 
 int rtc_init(void) {
-  self.index = 0;
+  self.index       = 0;
+  self.is_emulated = 0;
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
@@ -35,13 +45,17 @@ u8_t rtc_read(void) {
   struct tm* now;
   u8_t       value;
 
-  if (time(&clock) == (time_t) -1) {
-    log_err("rtc: could not retrieve current time\n");
-    return 0x00;
+  if (self.is_emulated) {
+    clock = EMULATED_EPOCH + clock_ticks() / clock_28mhz_get();
+    now   = gmtime(&clock);
+  } else {
+    if (time(&clock) == (time_t) -1) {
+      log_err("rtc: could not retrieve current time\n");
+      return 0x00;
+    }
+    now = localtime(&clock);
   }
 
-  now = localtime(&clock);
-
   switch (self.index) {
     case 0x00:
       /* Seconds. */
@@ -92,3 +106,12 @@ u8_t rtc_read(void) {
 void rtc_write(u8_t value) {
   self.index = value % 64;
 }
+
+
+/**
+ * Lets the clock run from emulated rather than host time, for reproducible
+ * runs.
+ */
+void rtc_emulated_set(int is_emulated) {
+  self.is_emulated = is_emulated;
+}
@@ -9,6 +9,7 @@ int  rtc_init(void);
 void rtc_finit(void);
 u8_t rtc_read(void);
 void rtc_write(u8_t value);
+void rtc_emulated_set(int is_emulated);
 
 
 #endif  /* __RTC_H */
@@ -85,7 +85,7 @@ typedef struct sdcard_t {
 } sdcard_t;
 
 
-static sdcard_t self[N_SDCARDS];
+static MACHINE_LOCAL sdcard_t self[N_SDCARDS];
 
 
 int sdcard_init(void) {
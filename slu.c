@@ -1,15 +1,138 @@
 #include <SDL2/SDL.h>
 #include <string.h>
+#include "copper.h"
 #include "cpu.h"
 #include "defs.h"
 #include "log.h"
+#include "main.h"
+#include "memory.h"
 #include "palette.h"
+#include "replay.h"
+#include "rewind.h"
 #include "slu.h"
+#include "stats.h"
 
 
 #define MIN(a,b)  ((a) < (b) ? (a) : (b))
 #define MAX(a,b)  ((a) > (b) ? (a) : (b))
 
+#define SLU_LOG_SIZE_INITIAL  (64 * 1024)
+
+
+/**
+ * With a render thread, emulating and drawing a frame form a pipeline. The
+ * emulation thread runs the video modules as usual, for the beam, the
+ * interrupts, the copper and whatever the CPU reads back, but does not draw.
+ * Instead it logs every call that changes what is drawn, and every write to
+ * SRAM the video may show, with the beam position it happened at. The
+ * render thread then replays that log against a copy of the video state of
+ * its own and draws the frame, while the emulation thread runs the next.
+ */
+typedef enum slu_op_t {
+  E_SLU_OP_SRAM = 0,
+  E_SLU_OP_ADOPT,
+  E_SLU_OP_LAYER_PRIORITY_SET,
+  E_SLU_OP_TRANSPARENCY_FALLBACK_COLOUR_WRITE,
+  E_SLU_OP_ULA_CONTROL_WRITE,
+  E_SLU_OP_TRANSPARENT_SET,
+  E_SLU_OP_PALETTE_WRITE_RGB8,
+  E_SLU_OP_PALETTE_WRITE_RGB9,
+  E_SLU_OP_LAYER2_ACCESS_WRITE,
+  E_SLU_OP_LAYER2_CONTROL_WRITE,
+  E_SLU_OP_LAYER2_ACTIVE_BANK_WRITE,
+  E_SLU_OP_LAYER2_PALETTE_SET,
+  E_SLU_OP_LAYER2_CLIP_SET,
+  E_SLU_OP_LAYER2_OFFSET_X_MSB_WRITE,
+  E_SLU_OP_LAYER2_OFFSET_X_LSB_WRITE,
+  E_SLU_OP_LAYER2_OFFSET_Y_WRITE,
+  E_SLU_OP_LAYER2_ENABLE,
+  E_SLU_OP_SPRITES_PRIORITY_SET,
+  E_SLU_OP_SPRITES_ENABLE_SET,
+  E_SLU_OP_SPRITES_ENABLE_OVER_BORDER_SET,
+  E_SLU_OP_SPRITES_ENABLE_CLIPPING_OVER_BORDER_SET,
+  E_SLU_OP_SPRITES_CLIP_SET,
+  E_SLU_OP_SPRITES_ATTRIBUTE_SET,
+  E_SLU_OP_SPRITES_TRANSPARENCY_INDEX_WRITE,
+  E_SLU_OP_SPRITES_SLOT_SET,
+  E_SLU_OP_SPRITES_NEXT_PATTERN_SET,
+  E_SLU_OP_SPRITES_PALETTE_SET,
+  E_SLU_OP_TILEMAP_CONTROL_WRITE,
+  E_SLU_OP_TILEMAP_DEFAULT_ATTRIBUTE_WRITE,
+  E_SLU_OP_TILEMAP_BASE_ADDRESS_WRITE,
+  E_SLU_OP_TILEMAP_DEFINITIONS_ADDRESS_WRITE,
+  E_SLU_OP_TILEMAP_TRANSPARENCY_INDEX_WRITE,
+  E_SLU_OP_TILEMAP_OFFSET_X_MSB_WRITE,
+  E_SLU_OP_TILEMAP_OFFSET_X_LSB_WRITE,
+  E_SLU_OP_TILEMAP_OFFSET_Y_WRITE,
+  E_SLU_OP_TILEMAP_CLIP_SET,
+  E_SLU_OP_ULA_WRITE,
+  E_SLU_OP_ULA_TIMEX_WRITE,
+  E_SLU_OP_ULA_TIMING_SET,
+  E_SLU_OP_ULA_PALETTE_SET,
+  E_SLU_OP_ULA_CLIP_SET,
+  E_SLU_OP_ULA_SCREEN_BANK_SET,
+  E_SLU_OP_ULA_ATTRIBUTE_BYTE_FORMAT_WRITE,
+  E_SLU_OP_ULA_NEXT_MODE_ENABLE,
+  E_SLU_OP_ULA_60HZ_SET,
+  E_SLU_OP_ULA_LO_RES_ENABLE_SET,
+  E_SLU_OP_ULA_LO_RES_OFFSET_X_WRITE,
+  E_SLU_OP_ULA_LO_RES_OFFSET_Y_WRITE,
+  E_SLU_OP_ULA_HDMI_ENABLE,
+  E_SLU_OP_ULA_OFFSET_X_WRITE,
+  E_SLU_OP_ULA_OFFSET_Y_WRITE
+} slu_op_t;
+
+
+typedef struct slu_entry_t {
+  u32_t time;     /* See slu_log_time(). */
+  u8_t  op;
+  u8_t  args[4];
+} slu_entry_t;
+
+
+typedef struct slu_snapshot_t slu_snapshot_t;
+
+
+typedef struct slu_log_t {
+  slu_entry_t*    entries;
+  size_t          n_entries;
+  size_t          n_entries_max;
+  slu_snapshot_t* snapshots;       /* One per E_SLU_OP_ADOPT, in order. */
+  slu_snapshot_t* last_snapshot;
+} slu_log_t;
+
+
+/* What the emulation thread logs to, NULL unless there is a render thread. */
+static VIDEO_LOCAL slu_log_t* slu_frame_log;
+
+/* Whether the beam is amid a step, rather than between two. */
+static VIDEO_LOCAL int slu_is_stepping;
+
+/**
+ * Set on the render thread, where the video modules replay what they did on
+ * the emulation thread, without touching the rest of the machine again.
+ */
+static VIDEO_LOCAL int slu_is_replica;
+
+
+static void slu_log_append(slu_op_t op, u8_t a, u8_t b, u8_t c, u8_t d);
+
+
+inline
+static void slu_log(slu_op_t op, u8_t value) {
+  if (slu_frame_log != NULL) {
+    slu_log_append(op, value, 0, 0, 0);
+  }
+}
+
+
+inline
+static void slu_log4(slu_op_t op, u8_t a, u8_t b, u8_t c, u8_t d) {
+  if (slu_frame_log != NULL) {
+    slu_log_append(op, a, b, c, d);
+  }
+}
+
 
 /* Include these to let the compiler optimise better. */
 #include "palette.c"
@@ -40,6 +163,7 @@ typedef struct slu_t {
   u32_t                dirty_row2;
   u32_t                dirty_col1;
   u32_t                dirty_col2;
+  u32_t                copper_sleep;  /* 14 MHz ticks until the copper needs to run. */
 
   /* Resettable. */
   slu_layer_priority_t layer_priority;
@@ -53,7 +177,74 @@ typedef struct slu_t {
 } slu_t;
 
 
-static slu_t self;
+static VIDEO_LOCAL slu_t self;
+
+
+/**
+ * The video state of the emulation thread, for the render thread to adopt
+ * when it changed other than through logged calls and writes: on a reset,
+ * when rewinding and when loading a program. SRAM below the Spectrum RAM
+ * never shows.
+ */
+struct slu_snapshot_t {
+  slu_snapshot_t* next;
+  slu_t           self;
+  ula_t           ula;
+  layer2_t        layer2;
+  tilemap_t       tilemap;
+  sprites_t       sprites;
+  sprite_t        sprite_attributes[N_SPRITES];
+  u8_t            patterns[16 * 1024];
+  pal_t           pal;
+  u8_t            ram[MEMORY_SRAM_SIZE - MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM];
+};
+
+
+/**
+ * What the render thread has next to its copy of the video state. Allocated
+ * by the emulation thread.
+ */
+typedef struct slu_replica_t {
+  u8_t*       sram;
+  const u8_t* source_sram;             /* Of the emulation thread. */
+  u16_t*      frame_buffer;
+  u8_t*       patterns;
+  sprite_t*   sprites;
+  u16_t*      sprites_frame_buffer;
+  u8_t*       sprites_is_transparent;
+  int         is_beam_done;            /* Whether the step at the beam was drawn. */
+} slu_replica_t;
+
+
+static VIDEO_LOCAL slu_replica_t slu_replica;
+
+
+/**
+ * Shared by the emulation thread and the render thread. Lives outside of
+ * self to keep it out of rewind snapshots.
+ */
+typedef struct slu_pipeline_t {
+  SDL_Thread*     thread;
+  SDL_mutex*      mutex;
+  SDL_cond*       frame_ready;         /* Signals the render thread. */
+  SDL_cond*       frame_done;          /* Signals the emulation thread. */
+  slu_log_t       logs[2];
+  slu_log_t*      pending;             /* Being drawn, if not NULL. */
+  slu_snapshot_t* start;               /* Adopted before the first frame. */
+  slu_replica_t   replica;
+  SDL_Rect        dirty;
+  int             is_dirty;
+  int             is_done;             /* Whether a frame was drawn since taken. */
+  int             do_finit;
+} slu_pipeline_t;
+
+
+static MACHINE_LOCAL slu_pipeline_t slu_pipeline;
+
+
+static void slu_restored(void) {
+  slu_resync();
+}
 
 
 int slu_init(SDL_Renderer* renderer, SDL_Texture* texture) {
@@ -70,11 +261,18 @@ int slu_init(SDL_Renderer* renderer, SDL_Texture* texture) {
 
   slu_reset(E_RESET_HARD);
 
+  rewind_register(&self, sizeof(self), slu_restored);
+
   return 0;
 }
 
 
+static void slu_pipeline_stop(void);
+
+
 void slu_finit(void) {
+  slu_pipeline_stop();
+
   if (self.frame_buffer != NULL) {
     free(self.frame_buffer);
     self.frame_buffer = NULL;
@@ -93,72 +291,157 @@ void slu_reset(reset_t reset) {
 }
 
 
-static void slu_blit(void) {
-  if (self.dirty_row1 > self.dirty_row2) {
-    return;
-  }
-
+/**
+ * Copies the given area of a frame buffer to the texture.
+ */
+static int slu_texture_update(const u16_t* frame_buffer, const SDL_Rect* rect) {
   u16_t* pixels;
   int    pitch;
 
-  SDL_Rect src_rect = {
-    .y = self.dirty_row1,
-    .h = self.dirty_row2 - self.dirty_row1 + 1,
-    .x = self.dirty_col1,
-    .w = self.dirty_col2 - self.dirty_col1 + 1
-  };
-
-  if (SDL_LockTexture(self.texture, &src_rect, (void **) &pixels, &pitch) != 0) {
+  if (SDL_LockTexture(self.texture, rect, (void **) &pixels, &pitch) != 0) {
     log_err("slu: SDL_LockTexture error: %s\n", SDL_GetError());
-    return;
+    return -1;
   }
 
-  /* Only update the dirty pixels. */
-  u16_t* src = &self.frame_buffer[src_rect.y * FRAME_BUFFER_WIDTH + src_rect.x];
-  void*  dst = pixels;
-  for (int y = 0; y < src_rect.h; y++, dst += pitch, src += FRAME_BUFFER_WIDTH) {
-    memcpy(dst, src, src_rect.w * 2);
+  const u16_t* src = &frame_buffer[rect->y * FRAME_BUFFER_WIDTH + rect->x];
+  void*        dst = pixels;
+  for (int y = 0; y < rect->h; y++, dst += pitch, src += FRAME_BUFFER_WIDTH) {
+    memcpy(dst, src, rect->w * 2);
   }
 
   SDL_UnlockTexture(self.texture);
 
+  return 0;
+}
+
+
+static void slu_present(void) {
   if (SDL_RenderCopy(self.renderer, self.texture, NULL, NULL) != 0) {
     log_err("slu: SDL_RenderCopy error: %s\n", SDL_GetError());
     return;
   }
 
   SDL_RenderPresent(self.renderer);
+}
+
+
+/**
+ * Returns the area of the frame buffer that changed since it was last
+ * cleared, zero if none.
+ */
+static int slu_dirty_get(SDL_Rect* rect) {
+  if (self.dirty_row1 > self.dirty_row2) {
+    return 0;
+  }
 
+  rect->y = self.dirty_row1;
+  rect->h = self.dirty_row2 - self.dirty_row1 + 1;
+  rect->x = self.dirty_col1;
+  rect->w = self.dirty_col2 - self.dirty_col1 + 1;
+
+  return 1;
+}
+
+
+static void slu_dirty_clear(void) {
   /* Impossible reversed configuration indicates nothing is dirty. */
   self.dirty_row1 = self.dirty_col1 = FRAME_BUFFER_HEIGHT;
   self.dirty_row2 = self.dirty_col2 = 0;
 }
 
 
+static void slu_pipeline_blit(void);
+
+
+static void slu_blit(void) {
+  SDL_Rect src_rect;
+
+  if (slu_frame_log != NULL) {
+    /* The render thread draws instead. */
+    slu_pipeline_blit();
+    return;
+  }
+
+  if (!slu_dirty_get(&src_rect)) {
+    stats_count(E_STATS_COUNTER_FRAMES_SKIPPED);
+    return;
+  }
+
+  if (self.texture != NULL) {
+    /* Only update the dirty pixels. */
+    if (slu_texture_update(self.frame_buffer, &src_rect) != 0) {
+      return;
+    }
+    slu_present();
+  }
+
+  stats_count(E_STATS_COUNTER_FRAMES_RENDERED);
+
+  slu_dirty_clear();
+}
+
+
 /**
- * Beam (0, 0) is the top-left pixel of the (typically) 256x192 content
- * area.
+ * Without a texture, embedders read the frame buffer directly.
  */
-static void slu_beam_advance(void) {
+u16_t* slu_frame_buffer_get(void) {
+  return self.frame_buffer;
+}
+
+
+/**
+ * Advances the beam one pixel, returning whether it moved back to the top
+ * left of the display. Beam (0, 0) is the top-left pixel of the (typically)
+ * 256x192 content area.
+ */
+static int slu_beam_step(void) {
   /* Advance beam one pixel horizontally. */
   if (++self.beam_column < self.display_columns) {
-    return;
+    return 0;
   }
 
   /* Advance beam to beginning of next line. */
   self.beam_column = 0;
   if (++self.beam_row < self.display_rows) {
-    return;
+    return 0;
   }
 
   /* Move beam to top left of display. */
   self.beam_row = 0;
 
+  return 1;
+}
+
+
+static void slu_beam_advance(void) {
+  if (!slu_beam_step()) {
+    return;
+  }
+
+  /* What happens now, happens before the first pixel is drawn. */
+  slu_is_stepping = 1;
+
   /* Update display. */
-  slu_blit();
+  if (stats_is_enabled()) {
+    const u64_t start = stats_now();
+    slu_blit();
+    stats_timer_add(E_STATS_TIMER_BLIT, start);
+  } else {
+    slu_blit();
+  }
+
+  /* Digest the frame when comparing runs, or as the render thread's is shown. */
+  if (slu_frame_log == NULL) {
+    replay_frame_completed(self.frame_buffer);
+  }
 
   /* Notify the ULA that we completed a frame. */
-  ula_did_complete_frame();  
+  ula_did_complete_frame();
+
+  /* Allow for a rewind snapshot. */
+  main_frame_completed();
+
+  slu_is_stepping = 0;
 }
 
 
@@ -183,6 +466,53 @@ static void slu_irq(void) {
 }
 
 
+/**
+ * Returns the number of 14 MHz ticks until the beam reaches the given
+ * position, a full frame when it is already there.
+ */
+static u32_t slu_ticks_until_beam(u32_t row, u32_t column) {
+  const u32_t frame   = self.display_rows * self.display_columns;
+  const u32_t current = self.beam_row * self.display_columns + self.beam_column;
+  const u32_t target  = row * self.display_columns + column;
+
+  if (row >= self.display_rows) {
+    return frame;
+  }
+
+  return (target > current) ? target - current : frame - current + target;
+}
+
+
+/**
+ * Returns the number of 14 MHz ticks until the first one on which something
+ * may need the attention of the CPU: an IRQ being raised, or the copper
+ * waking up and possibly writing to a register.
+ */
+u32_t slu_ticks_until_irq(void) {
+  u32_t ticks;
+  u32_t until;
+  u32_t row;
+  u32_t column;
+
+  ula_irq_beam_get(&row, &column);
+  ticks = slu_ticks_until_beam(row, column);
+
+  if (self.line_irq_enabled && !self.line_irq_active) {
+    row   = (self.line_irq_row == 0) ? self.display_rows - 1 : self.line_irq_row - 1u;
+    until = (self.beam_row == row && self.beam_column >= 256 * 2) ? 1 : slu_ticks_until_beam(row, 256 * 2);
+    if (until < ticks) {
+      ticks = until;
+    }
+  }
+
+  if (self.copper_sleep != COPPER_SLEEP_FOREVER && self.copper_sleep + 1 < ticks) {
+    ticks = self.copper_sleep + 1;
+  }
+
+  return ticks;
+}
+
+
 void slu_mix_layer2(const palette_entry_t* layer2_rgb, const palette_entry_t* mix_rgb, int mix_rgb_transparent, u8_t* mixer_r, u8_t* mixer_g, u8_t* mixer_b) {
   u8_t r = ((layer2_rgb->rgb9 & 0x1C0) >> 2) | ((mix_rgb->rgb9 & 0x1C0) >> 6);
   u8_t g = ((layer2_rgb->rgb9 & 0x038) << 1) | ((mix_rgb->rgb9 & 0x038) >> 3);
@@ -224,7 +554,11 @@ void slu_mix_layer2(const palette_entry_t* layer2_rgb, const palette_entry_t* mi
 }
 
 
-void slu_run(u32_t ticks_14mhz) {
+/**
+ * Mixes the layers into the pixel at the given frame buffer position.
+ */
+inline
+static void slu_draw(u32_t frame_buffer_row, u32_t frame_buffer_column) {
   const palette_entry_t black = {
     .rgb8               = 0,
     .rgb9               = 0,
@@ -232,10 +566,6 @@ void slu_run(u32_t ticks_14mhz) {
     .is_layer2_priority = 0
   };
 
-  u32_t                  tick;
-  u32_t                  frame_buffer_row;
-  u32_t                  frame_buffer_column;
-
   /* These are the same names as in the VHDL for consistency. */
   int                    ula_en;
   int                    ula_border;
@@ -284,196 +614,907 @@ void slu_run(u32_t ticks_14mhz) {
 
   u16_t                  rgb_out;
 
+  ula_tick(    frame_buffer_row, frame_buffer_column, &ula_en, &ula_border, &ula_clipped, &ula_rgb);
+  tilemap_tick(frame_buffer_row, frame_buffer_column, &tm_en, &tm_pixel_en, &tm_pixel_below, &tm_pixel_textmode, &tm_rgb);
+  sprites_tick(frame_buffer_row, frame_buffer_column, &sprite_pixel_en, &sprite_rgb16);
+  layer2_tick( frame_buffer_row, frame_buffer_column, &layer2_pixel_en, &layer2_rgb, &layer2_priority);
+
+  ula_transparent = !ula_en || ula_clipped || (ula_rgb->rgb8 == self.transparent.rgb8);
+  tm_transparent  = !tm_en || !tm_pixel_en || (tm_pixel_textmode && tm_rgb->rgb8 == self.transparent.rgb8);
+
+  sprite_transparent = !sprite_pixel_en;
+
+  layer2_transparent = !layer2_pixel_en || (layer2_rgb->rgb8 == self.transparent.rgb8);
+  if (layer2_transparent) {
+    layer2_priority = 0;
+  }
+
+  if (self.stencil_mode && ula_en && tm_en) {
+    stencil_transparent   = ula_transparent || tm_transparent;
+    stencil_rgb.rgb16     = !stencil_transparent ? (ula_rgb->rgb16 & tm_rgb->rgb16) : 0;
+    ula_final_rgb         = &stencil_rgb;
+    ula_final_transparent = stencil_transparent;
+  } else {
+    if (ula_transparent) ula_rgb = &black;
+    if (tm_transparent)  tm_rgb  = &black;
+
+    ulatm_transparent     = ula_transparent && tm_transparent;
+    ulatm_rgb             = (!tm_transparent && (!tm_pixel_below || ula_transparent)) ? tm_rgb : ula_rgb;
+    ula_final_rgb         = ulatm_rgb;
+    ula_final_transparent = ulatm_transparent;
+  }
+
+  rgb_out = self.fallback_rgba;
+
+  switch (self.layer_priority)
+  {
+    case E_SLU_LAYER_PRIORITY_SLU:
+      if (layer2_priority) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!sprite_transparent) {
+        rgb_out = sprite_rgb16;
+      } else if (!layer2_transparent) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!ula_final_transparent) {
+        rgb_out = ula_final_rgb->rgb16;
+      }
+      break;
+
+    case E_SLU_LAYER_PRIORITY_LSU:
+      if (!layer2_transparent) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!sprite_transparent) {
+        rgb_out = sprite_rgb16;
+      } else if (!ula_final_transparent) {
+        rgb_out = ula_final_rgb->rgb16;
+      }
+      break;
+
+    case E_SLU_LAYER_PRIORITY_SUL:
+      if (layer2_priority) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!sprite_transparent) {
+        rgb_out = sprite_rgb16;
+      } else if (!ula_final_transparent) {
+        rgb_out = ula_final_rgb->rgb16;
+      } else if (!layer2_transparent) {
+        rgb_out = layer2_rgb->rgb16;
+      }
+      break;
+
+    case E_SLU_LAYER_PRIORITY_LUS:
+      if (!layer2_transparent) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!ula_final_transparent && !(ula_border && tm_transparent && !sprite_transparent)) {
+        rgb_out = ula_final_rgb->rgb16;
+      } else if (!sprite_transparent) {
+        rgb_out = sprite_rgb16;
+      }
+      break;
+      
+    case E_SLU_LAYER_PRIORITY_USL:
+      if (layer2_priority) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!ula_final_transparent && !(ula_border && tm_transparent && !sprite_transparent)) {
+        rgb_out = ula_final_rgb->rgb16;
+      } else if (!sprite_transparent) {
+        rgb_out = sprite_rgb16;
+      } else if (!layer2_transparent) {
+        rgb_out = layer2_rgb->rgb16;
+      }
+      break;
+
+    case E_SLU_LAYER_PRIORITY_ULS:
+      if (layer2_priority) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!ula_final_transparent && !(ula_border && tm_transparent && !sprite_transparent)) {
+        rgb_out = ula_final_rgb->rgb16;
+      } else if (!layer2_transparent) {
+        rgb_out = layer2_rgb->rgb16;
+      } else if (!sprite_transparent) {
+        rgb_out = sprite_rgb16;
+      }
+      break;
+
+    case E_SLU_LAYER_PRIORITY_BLEND:
+    case E_SLU_LAYER_PRIORITY_BLEND_5:
+      ula_mix_transparent = ula_clipped || (ula_rgb->rgb8 == self.transparent.rgb8);
+      ula_mix_rgb         = ula_mix_transparent ? ula_rgb : &black;
+
+      switch (self.blend_mode) {
+        case E_BLEND_MODE_ULA:
+          mix_rgb             = ula_mix_rgb;
+          mix_rgb_transparent = ula_mix_transparent;
+          mix_top_transparent = tm_transparent || tm_pixel_below;
+          mix_top_rgb         = tm_rgb;
+          mix_bot_transparent = tm_transparent || !tm_pixel_below;
+          mix_bot_rgb         = tm_rgb;
+          break;
+
+        case E_BLEND_MODE_ULA_TILEMAP_MIX:
+          mix_rgb             = ula_final_rgb;
+          mix_rgb_transparent = ula_final_transparent;
+          mix_top_transparent = 1;
+          mix_top_rgb         = tm_rgb;
+          mix_bot_transparent = 1;
+          mix_bot_rgb         = tm_rgb;
+          break;
+
+        case E_BLEND_MODE_TILEMAP:
+          mix_rgb             = tm_rgb;
+          mix_rgb_transparent = tm_transparent;
+          mix_top_transparent = ula_transparent || !tm_pixel_below;
+          mix_top_rgb         = ula_rgb;
+          mix_bot_transparent = ula_transparent || tm_pixel_below;
+          mix_bot_rgb         = ula_rgb;
+          break;
+
+        default:
+          mix_rgb             = 0;
+          mix_rgb_transparent = 1;
+          if (tm_pixel_below) {
+            mix_top_transparent = ula_transparent;
+            mix_top_rgb         = ula_rgb;
+            mix_bot_transparent = tm_transparent;
+            mix_bot_rgb         = tm_rgb;
+          } else {
+            mix_top_transparent = tm_transparent;
+            mix_top_rgb         = tm_rgb;
+            mix_bot_transparent = ula_transparent;
+            mix_bot_rgb         = ula_rgb;
+          }
+          break;
+      }
+
+      if (layer2_priority) {
+        slu_mix_layer2(layer2_rgb, mix_rgb, mix_rgb_transparent, &mixer_r, &mixer_g, &mixer_b);
+        rgb_out = (mixer_r << 13) | (mixer_g << 9) | (mixer_b << 5);
+      } else if (!mix_top_transparent) {
+        rgb_out = mix_top_rgb->rgb16;
+      } else if (!sprite_transparent) {
+        rgb_out = sprite_rgb16;
+      } else if (!mix_bot_transparent) {
+        rgb_out = mix_bot_rgb->rgb16;
+      } else if (!layer2_transparent) {
+        slu_mix_layer2(layer2_rgb, mix_rgb, mix_rgb_transparent, &mixer_r, &mixer_g, &mixer_b);
+        rgb_out = (mixer_r << 13) | (mixer_g << 9) | (mixer_b << 5);
+      }
+      break;
+  }
+  
+  u16_t* rgb_existing = &self.frame_buffer[frame_buffer_row * FRAME_BUFFER_WIDTH + frame_buffer_column];
+  if (rgb_out != *rgb_existing) {
+    *rgb_existing = rgb_out;
+
+    self.dirty_row1 = MIN(self.dirty_row1, frame_buffer_row);
+    self.dirty_row2 = MAX(self.dirty_row2, frame_buffer_row);
+    self.dirty_col1 = MIN(self.dirty_col1, frame_buffer_column);
+    self.dirty_col2 = MAX(self.dirty_col2, frame_buffer_column);
+  }
+}
+
+
+void slu_run(u32_t ticks_14mhz) {
+  u32_t tick;
+  u32_t frame_buffer_row;
+  u32_t frame_buffer_column;
+
   for (tick = 0; tick < ticks_14mhz; tick++) {
     slu_beam_advance();
     slu_irq();
 
-    /* Copper runs at 28 MHz. */
-    copper_tick(self.beam_row, self.beam_column, 2);
+    /* Copper runs at 28 MHz, but sleeps while waiting for the beam. */
+    if (self.copper_sleep == 0) {
+      slu_is_stepping   = 1;
+      self.copper_sleep = copper_tick(self.beam_row, self.beam_column, 2, self.display_rows, self.display_columns);
+      slu_is_stepping   = 0;
+    } else {
+      self.copper_sleep--;
+    }
 
     if (!ula_beam_to_frame_buffer(self.beam_row, self.beam_column, &frame_buffer_row, &frame_buffer_column)) {
       /* Beam is outside frame buffer. */
       continue;
     }
 
-    ula_tick(    frame_buffer_row, frame_buffer_column, &ula_en, &ula_border, &ula_clipped, &ula_rgb);
-    tilemap_tick(frame_buffer_row, frame_buffer_column, &tm_en, &tm_pixel_en, &tm_pixel_below, &tm_pixel_textmode, &tm_rgb);
-    sprites_tick(frame_buffer_row, frame_buffer_column, &sprite_pixel_en, &sprite_rgb16);
-    layer2_tick( frame_buffer_row, frame_buffer_column, &layer2_pixel_en, &layer2_rgb, &layer2_priority);
+    if (slu_frame_log != NULL) {
+      /* The render thread draws a frame later. */
+      ula_tick_undrawn();
+      sprites_tick_undrawn(frame_buffer_row, frame_buffer_column);
+      continue;
+    }
+
+    slu_draw(frame_buffer_row, frame_buffer_column);
+  }
+}
 
-    ula_transparent = !ula_en || ula_clipped || (ula_rgb->rgb8 == self.transparent.rgb8);
-    tm_transparent  = !tm_en || !tm_pixel_en || (tm_pixel_textmode && tm_rgb->rgb8 == self.transparent.rgb8);
 
-    sprite_transparent = !sprite_pixel_en;
+/**
+ * Orders the log by beam position. Changes amid a step, by the copper or as
+ * a frame completes, precede drawing the pixel at the beam. Changes between
+ * steps, by the CPU, follow it.
+ */
+inline
+static u32_t slu_log_time(int is_between_steps) {
+  return (((self.beam_row << 16) | self.beam_column) << 1) | is_between_steps;
+}
 
-    layer2_transparent = !layer2_pixel_en || (layer2_rgb->rgb8 == self.transparent.rgb8);
-    if (layer2_transparent) {
-      layer2_priority = 0;
-    }
 
-    if (self.stencil_mode && ula_en && tm_en) {
-      stencil_transparent   = ula_transparent || tm_transparent;
-      stencil_rgb.rgb16     = !stencil_transparent ? (ula_rgb->rgb16 & tm_rgb->rgb16) : 0;
-      ula_final_rgb         = &stencil_rgb;
-      ula_final_transparent = stencil_transparent;
-    } else {
-      if (ula_transparent) ula_rgb = &black;
-      if (tm_transparent)  tm_rgb  = &black;
+static void slu_log_append(slu_op_t op, u8_t a, u8_t b, u8_t c, u8_t d) {
+  slu_log_t*   log = slu_frame_log;
+  slu_entry_t* entry;
 
-      ulatm_transparent     = ula_transparent && tm_transparent;
-      ulatm_rgb             = (!tm_transparent && (!tm_pixel_below || ula_transparent)) ? tm_rgb : ula_rgb;
-      ula_final_rgb         = ulatm_rgb;
-      ula_final_transparent = ulatm_transparent;
+  if (log->n_entries == log->n_entries_max) {
+    entry = realloc(log->entries, log->n_entries_max * 2 * sizeof(slu_entry_t));
+    if (entry == NULL) {
+      log_err("slu: out of memory\n");
+      return;
     }
+    log->entries        = entry;
+    log->n_entries_max *= 2;
+  }
 
-    rgb_out = self.fallback_rgba;
-
-    switch (self.layer_priority)
-    {
-      case E_SLU_LAYER_PRIORITY_SLU:
-        if (layer2_priority) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!sprite_transparent) {
-          rgb_out = sprite_rgb16;
-        } else if (!layer2_transparent) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!ula_final_transparent) {
-          rgb_out = ula_final_rgb->rgb16;
-        }
-        break;
+  entry          = &log->entries[log->n_entries++];
+  entry->time    = slu_log_time(!slu_is_stepping);
+  entry->op      = op;
+  entry->args[0] = a;
+  entry->args[1] = b;
+  entry->args[2] = c;
+  entry->args[3] = d;
+}
 
-      case E_SLU_LAYER_PRIORITY_LSU:
-        if (!layer2_transparent) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!sprite_transparent) {
-          rgb_out = sprite_rgb16;
-        } else if (!ula_final_transparent) {
-          rgb_out = ula_final_rgb->rgb16;
-        }
-        break;
 
-      case E_SLU_LAYER_PRIORITY_SUL:
-        if (layer2_priority) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!sprite_transparent) {
-          rgb_out = sprite_rgb16;
-        } else if (!ula_final_transparent) {
-          rgb_out = ula_final_rgb->rgb16;
-        } else if (!layer2_transparent) {
-          rgb_out = layer2_rgb->rgb16;
-        }
-        break;
+static void slu_log_clear(slu_log_t* log) {
+  slu_snapshot_t* snapshot;
 
-      case E_SLU_LAYER_PRIORITY_LUS:
-        if (!layer2_transparent) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!ula_final_transparent && !(ula_border && tm_transparent && !sprite_transparent)) {
-          rgb_out = ula_final_rgb->rgb16;
-        } else if (!sprite_transparent) {
-          rgb_out = sprite_rgb16;
-        }
-        break;
-        
-      case E_SLU_LAYER_PRIORITY_USL:
-        if (layer2_priority) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!ula_final_transparent && !(ula_border && tm_transparent && !sprite_transparent)) {
-          rgb_out = ula_final_rgb->rgb16;
-        } else if (!sprite_transparent) {
-          rgb_out = sprite_rgb16;
-        } else if (!layer2_transparent) {
-          rgb_out = layer2_rgb->rgb16;
-        }
-        break;
+  while (log->snapshots != NULL) {
+    snapshot       = log->snapshots;
+    log->snapshots = snapshot->next;
+    free(snapshot);
+  }
 
-      case E_SLU_LAYER_PRIORITY_ULS:
-        if (layer2_priority) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!ula_final_transparent && !(ula_border && tm_transparent && !sprite_transparent)) {
-          rgb_out = ula_final_rgb->rgb16;
-        } else if (!layer2_transparent) {
-          rgb_out = layer2_rgb->rgb16;
-        } else if (!sprite_transparent) {
-          rgb_out = sprite_rgb16;
-        }
-        break;
+  log->last_snapshot = NULL;
+  log->n_entries     = 0;
+}
 
-      case E_SLU_LAYER_PRIORITY_BLEND:
-      case E_SLU_LAYER_PRIORITY_BLEND_5:
-        ula_mix_transparent = ula_clipped || (ula_rgb->rgb8 == self.transparent.rgb8);
-        ula_mix_rgb         = ula_mix_transparent ? ula_rgb : &black;
 
-        switch (self.blend_mode) {
-          case E_BLEND_MODE_ULA:
-            mix_rgb             = ula_mix_rgb;
-            mix_rgb_transparent = ula_mix_transparent;
-            mix_top_transparent = tm_transparent || tm_pixel_below;
-            mix_top_rgb         = tm_rgb;
-            mix_bot_transparent = tm_transparent || !tm_pixel_below;
-            mix_bot_rgb         = tm_rgb;
-            break;
+/**
+ * Called by the memory for every write to SRAM the video may show, while
+ * there is a render thread.
+ */
+void slu_sram_written(u32_t offset, u8_t value) {
+  slu_log4(E_SLU_OP_SRAM, offset >> 16, offset >> 8, offset, value);
+}
 
-          case E_BLEND_MODE_ULA_TILEMAP_MIX:
-            mix_rgb             = ula_final_rgb;
-            mix_rgb_transparent = ula_final_transparent;
-            mix_top_transparent = 1;
-            mix_top_rgb         = tm_rgb;
-            mix_bot_transparent = 1;
-            mix_bot_rgb         = tm_rgb;
-            break;
 
-          case E_BLEND_MODE_TILEMAP:
-            mix_rgb             = tm_rgb;
-            mix_rgb_transparent = tm_transparent;
-            mix_top_transparent = ula_transparent || !tm_pixel_below;
-            mix_top_rgb         = ula_rgb;
-            mix_bot_transparent = ula_transparent || tm_pixel_below;
-            mix_bot_rgb         = ula_rgb;
-            break;
-
-          default:
-            mix_rgb             = 0;
-            mix_rgb_transparent = 1;
-            if (tm_pixel_below) {
-              mix_top_transparent = ula_transparent;
-              mix_top_rgb         = ula_rgb;
-              mix_bot_transparent = tm_transparent;
-              mix_bot_rgb         = tm_rgb;
-            } else {
-              mix_top_transparent = tm_transparent;
-              mix_top_rgb         = tm_rgb;
-              mix_bot_transparent = ula_transparent;
-              mix_bot_rgb         = ula_rgb;
-            }
-            break;
-        }
-
-        if (layer2_priority) {
-          slu_mix_layer2(layer2_rgb, mix_rgb, mix_rgb_transparent, &mixer_r, &mixer_g, &mixer_b);
-          rgb_out = (mixer_r << 13) | (mixer_g << 9) | (mixer_b << 5);
-        } else if (!mix_top_transparent) {
-          rgb_out = mix_top_rgb->rgb16;
-        } else if (!sprite_transparent) {
-          rgb_out = sprite_rgb16;
-        } else if (!mix_bot_transparent) {
-          rgb_out = mix_bot_rgb->rgb16;
-        } else if (!layer2_transparent) {
-          slu_mix_layer2(layer2_rgb, mix_rgb, mix_rgb_transparent, &mixer_r, &mixer_g, &mixer_b);
-          rgb_out = (mixer_r << 13) | (mixer_g << 9) | (mixer_b << 5);
-        }
+static void slu_snapshot_save(slu_snapshot_t* snapshot) {
+  snapshot->self    = self;
+  snapshot->ula     = ula;
+  snapshot->layer2  = layer2;
+  snapshot->tilemap = tilemap;
+  snapshot->sprites = sprites;
+  snapshot->pal     = pal;
+
+  memcpy(snapshot->sprite_attributes, sprites.sprites, sizeof(snapshot->sprite_attributes));
+  memcpy(snapshot->patterns, sprites.patterns, sizeof(snapshot->patterns));
+  memcpy(snapshot->ram, &memory_sram()[MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM], sizeof(snapshot->ram));
+}
+
+
+static slu_snapshot_t* slu_snapshot_take(void) {
+  slu_snapshot_t* snapshot = malloc(sizeof(slu_snapshot_t));
+
+  if (snapshot == NULL) {
+    log_err("slu: out of memory\n");
+    return NULL;
+  }
+
+  snapshot->next = NULL;
+  slu_snapshot_save(snapshot);
+
+  return snapshot;
+}
+
+
+/**
+ * Has the render thread, if any, adopt the video state as it is, after it
+ * changed other than through logged calls and writes.
+ */
+void slu_resync(void) {
+  slu_log_t*      log = slu_frame_log;
+  slu_snapshot_t* snapshot;
+  size_t          n_entries;
+
+  if (log == NULL) {
+    return;
+  }
+
+  if (log->n_entries > 0 && log->entries[log->n_entries - 1].op == E_SLU_OP_ADOPT && log->entries[log->n_entries - 1].time == slu_log_time(!slu_is_stepping)) {
+    /* Nothing happened since the previous one, which this supersedes. */
+    slu_snapshot_save(log->last_snapshot);
+    return;
+  }
+
+  snapshot = slu_snapshot_take();
+  if (snapshot == NULL) {
+    return;
+  }
+
+  n_entries = log->n_entries;
+  slu_log(E_SLU_OP_ADOPT, 0);
+  if (log->n_entries == n_entries) {
+    free(snapshot);
+    return;
+  }
+
+  if (log->last_snapshot == NULL) {
+    log->snapshots = snapshot;
+  } else {
+    log->last_snapshot->next = snapshot;
+  }
+  log->last_snapshot = snapshot;
+}
+
+
+/**
+ * Translates a pointer into the SRAM of the emulation thread to one into the
+ * copy of the render thread.
+ */
+static u8_t* slu_replica_pointer(u8_t* pointer) {
+  if (pointer < slu_replica.source_sram || pointer >= slu_replica.source_sram + MEMORY_SRAM_SIZE) {
+    return pointer;
+  }
+
+  return &slu_replica.sram[pointer - slu_replica.source_sram];
+}
+
+
+/**
+ * Takes over the video state from a snapshot, keeping what the render
+ * thread has of its own.
+ */
+static void slu_adopt(const slu_snapshot_t* snapshot) {
+  const slu_t     own         = self;
+  const sprites_t own_sprites = sprites;
+
+  self              = snapshot->self;
+  self.renderer     = NULL;
+  self.texture      = NULL;
+  self.frame_buffer = own.frame_buffer;
+  self.dirty_row1   = own.dirty_row1;
+  self.dirty_row2   = own.dirty_row2;
+  self.dirty_col1   = own.dirty_col1;
+  self.dirty_col2   = own.dirty_col2;
+
+  ula                 = snapshot->ula;
+  ula.sram            = slu_replica_pointer(ula.sram);
+  ula.display_ram     = slu_replica_pointer(ula.display_ram);
+  ula.display_ram_alt = slu_replica_pointer(ula.display_ram_alt);
+  ula.attribute_ram   = slu_replica_pointer(ula.attribute_ram);
+  ula.transparent     = &self.transparent;
+
+  layer2     = snapshot->layer2;
+  layer2.ram = slu_replica_pointer(layer2.ram);
+
+  tilemap       = snapshot->tilemap;
+  tilemap.bank5 = slu_replica_pointer(tilemap.bank5);
+
+  sprites                = snapshot->sprites;
+  sprites.patterns       = own_sprites.patterns;
+  sprites.sprites        = own_sprites.sprites;
+  sprites.frame_buffer   = own_sprites.frame_buffer;
+  sprites.is_transparent = own_sprites.is_transparent;
+
+  pal = snapshot->pal;
+
+  memcpy(sprites.sprites, snapshot->sprite_attributes, sizeof(snapshot->sprite_attributes));
+  memcpy(sprites.patterns, snapshot->patterns, sizeof(snapshot->patterns));
+  memcpy(&slu_replica.sram[MEMORY_RAM_OFFSET_ZX_SPECTRUM_RAM], snapshot->ram, sizeof(snapshot->ram));
+
+  ula_cell_refresh();
+  tilemap_row_invalidate();
+}
+
+
+/**
+ * Does again what the emulation thread did, to the video state of the render
+ * thread.
+ */
+static void slu_replay(const slu_entry_t* entry, const slu_snapshot_t** snapshot) {
+  const u8_t* args = entry->args;
+
+  switch (entry->op) {
+    case E_SLU_OP_SRAM:
+      slu_replica.sram[(args[0] << 16) | (args[1] << 8) | args[2]] = args[3];
+      break;
+
+    case E_SLU_OP_ADOPT:
+      slu_adopt(*snapshot);
+      *snapshot = (*snapshot)->next;
+      break;
+
+    case E_SLU_OP_LAYER_PRIORITY_SET:
+      slu_layer_priority_set(args[0]);
+      break;
+
+    case E_SLU_OP_TRANSPARENCY_FALLBACK_COLOUR_WRITE:
+      slu_transparency_fallback_colour_write(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_CONTROL_WRITE:
+      slu_ula_control_write(args[0]);
+      break;
+
+    case E_SLU_OP_TRANSPARENT_SET:
+      slu_transparent_set(args[0]);
+      break;
+
+    case E_SLU_OP_PALETTE_WRITE_RGB8:
+      palette_write_rgb8(args[0], args[1], args[2]);
+      break;
+
+    case E_SLU_OP_PALETTE_WRITE_RGB9:
+      palette_write_rgb9(args[0], args[1], args[2]);
+      break;
+
+    case E_SLU_OP_LAYER2_ACCESS_WRITE:
+      layer2_access_write(args[0]);
+      break;
+
+    case E_SLU_OP_LAYER2_CONTROL_WRITE:
+      layer2_control_write(args[0]);
+      break;
+
+    case E_SLU_OP_LAYER2_ACTIVE_BANK_WRITE:
+      layer2_active_bank_write(args[0]);
+      break;
+
+    case E_SLU_OP_LAYER2_PALETTE_SET:
+      layer2_palette_set(args[0]);
+      break;
+
+    case E_SLU_OP_LAYER2_CLIP_SET:
+      layer2_clip_set(args[0], args[1], args[2], args[3]);
+      break;
+
+    case E_SLU_OP_LAYER2_OFFSET_X_MSB_WRITE:
+      layer2_offset_x_msb_write(args[0]);
+      break;
+
+    case E_SLU_OP_LAYER2_OFFSET_X_LSB_WRITE:
+      layer2_offset_x_lsb_write(args[0]);
+      break;
+
+    case E_SLU_OP_LAYER2_OFFSET_Y_WRITE:
+      layer2_offset_y_write(args[0]);
+      break;
+
+    case E_SLU_OP_LAYER2_ENABLE:
+      layer2_enable(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_PRIORITY_SET:
+      sprites_priority_set(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_ENABLE_SET:
+      sprites_enable_set(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_ENABLE_OVER_BORDER_SET:
+      sprites_enable_over_border_set(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_ENABLE_CLIPPING_OVER_BORDER_SET:
+      sprites_enable_clipping_over_border_set(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_CLIP_SET:
+      sprites_clip_set(args[0], args[1], args[2], args[3]);
+      break;
+
+    case E_SLU_OP_SPRITES_ATTRIBUTE_SET:
+      sprites_attribute_set(args[0], args[1], args[2]);
+      break;
+
+    case E_SLU_OP_SPRITES_TRANSPARENCY_INDEX_WRITE:
+      sprites_transparency_index_write(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_SLOT_SET:
+      sprites_slot_set(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_NEXT_PATTERN_SET:
+      sprites_next_pattern_set(args[0]);
+      break;
+
+    case E_SLU_OP_SPRITES_PALETTE_SET:
+      sprites_palette_set(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_CONTROL_WRITE:
+      tilemap_tilemap_control_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_DEFAULT_ATTRIBUTE_WRITE:
+      tilemap_default_tilemap_attribute_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_BASE_ADDRESS_WRITE:
+      tilemap_tilemap_base_address_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_DEFINITIONS_ADDRESS_WRITE:
+      tilemap_tilemap_tile_definitions_address_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_TRANSPARENCY_INDEX_WRITE:
+      tilemap_transparency_index_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_OFFSET_X_MSB_WRITE:
+      tilemap_offset_x_msb_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_OFFSET_X_LSB_WRITE:
+      tilemap_offset_x_lsb_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_OFFSET_Y_WRITE:
+      tilemap_offset_y_write(args[0]);
+      break;
+
+    case E_SLU_OP_TILEMAP_CLIP_SET:
+      tilemap_clip_set(args[0], args[1], args[2], args[3]);
+      break;
+
+    case E_SLU_OP_ULA_WRITE:
+      ula_write(0xFE, args[0]);
+      break;
+
+    case E_SLU_OP_ULA_TIMEX_WRITE:
+      ula_timex_write(0xFF, args[0]);
+      break;
+
+    case E_SLU_OP_ULA_TIMING_SET:
+      ula_timing_set(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_PALETTE_SET:
+      ula_palette_set(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_CLIP_SET:
+      ula_clip_set(args[0], args[1], args[2], args[3]);
+      break;
+
+    case E_SLU_OP_ULA_SCREEN_BANK_SET:
+      ula_screen_bank_set(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_ATTRIBUTE_BYTE_FORMAT_WRITE:
+      ula_attribute_byte_format_write(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_NEXT_MODE_ENABLE:
+      ula_next_mode_enable(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_60HZ_SET:
+      ula_60hz_set(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_LO_RES_ENABLE_SET:
+      ula_lo_res_enable_set(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_LO_RES_OFFSET_X_WRITE:
+      ula_lo_res_offset_x_write(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_LO_RES_OFFSET_Y_WRITE:
+      ula_lo_res_offset_y_write(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_HDMI_ENABLE:
+      ula_hdmi_enable(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_OFFSET_X_WRITE:
+      ula_offset_x_write(args[0]);
+      break;
+
+    case E_SLU_OP_ULA_OFFSET_Y_WRITE:
+      ula_offset_y_write(args[0]);
+      break;
+  }
+}
+
+
+/**
+ * Draws a frame on the render thread, replaying its log as the beam reaches
+ * the position each change happened at.
+ */
+static void slu_replica_frame(const slu_log_t* log) {
+  const slu_entry_t*    entry    = log->entries;
+  const slu_entry_t*    end      = &log->entries[log->n_entries];
+  const slu_snapshot_t* snapshot = log->snapshots;
+  u32_t                 frame_buffer_row;
+  u32_t                 frame_buffer_column;
+
+  for (;;) {
+    if (slu_replica.is_beam_done) {
+      /* Adopting a snapshot may move the beam, hence check every time. */
+      while (entry < end && entry->time <= slu_log_time(1)) {
+        slu_replay(entry++, &snapshot);
+      }
+
+      if (slu_beam_step()) {
+        slu_replica.is_beam_done = 0;
         break;
+      }
+    }
+
+    while (entry < end && entry->time <= slu_log_time(0)) {
+      slu_replay(entry++, &snapshot);
+    }
+
+    slu_replica.is_beam_done = 1;
+
+    if (ula_beam_to_frame_buffer(self.beam_row, self.beam_column, &frame_buffer_row, &frame_buffer_column)) {
+      slu_draw(frame_buffer_row, frame_buffer_column);
+    }
+  }
+
+  /* Whatever is left happened as the frame completed. */
+  while (entry < end) {
+    slu_replay(entry++, &snapshot);
+  }
+
+  ula_did_complete_frame();
+}
+
+
+static int slu_render_thread(void* ptr) {
+  slu_pipeline_t*  pipeline = ptr;
+  const slu_log_t* log;
+
+  slu_is_replica = 1;
+  slu_replica    = pipeline->replica;
+
+  self.frame_buffer      = slu_replica.frame_buffer;
+  sprites.patterns       = slu_replica.patterns;
+  sprites.sprites        = slu_replica.sprites;
+  sprites.frame_buffer   = slu_replica.sprites_frame_buffer;
+  sprites.is_transparent = slu_replica.sprites_is_transparent;
+
+  slu_dirty_clear();
+  slu_adopt(pipeline->start);
+
+  SDL_LockMutex(pipeline->mutex);
+
+  while (!pipeline->do_finit) {
+    if (pipeline->pending == NULL) {
+      SDL_CondWait(pipeline->frame_ready, pipeline->mutex);
+      continue;
     }
-    
-    u16_t* rgb_existing = &self.frame_buffer[frame_buffer_row * FRAME_BUFFER_WIDTH + frame_buffer_column];
-    if (rgb_out != *rgb_existing) {
-      *rgb_existing = rgb_out;
-
-      self.dirty_row1 = MIN(self.dirty_row1, frame_buffer_row);
-      self.dirty_row2 = MAX(self.dirty_row2, frame_buffer_row);
-      self.dirty_col1 = MIN(self.dirty_col1, frame_buffer_column);
-      self.dirty_col2 = MAX(self.dirty_col2, frame_buffer_column);
+
+    log = pipeline->pending;
+    SDL_UnlockMutex(pipeline->mutex);
+
+    slu_replica_frame(log);
+
+    SDL_LockMutex(pipeline->mutex);
+
+    pipeline->is_dirty = slu_dirty_get(&pipeline->dirty);
+    pipeline->is_done  = 1;
+    pipeline->pending  = NULL;
+    slu_dirty_clear();
+
+    SDL_CondSignal(pipeline->frame_done);
+  }
+
+  SDL_UnlockMutex(pipeline->mutex);
+
+  return 0;
+}
+
+
+/**
+ * Waits for the render thread to finish the frame it was handed, if any,
+ * and copies what changed to the texture. Returns whether there is anything
+ * to present.
+ */
+static int slu_pipeline_take(void) {
+  int is_done;
+
+  SDL_LockMutex(slu_pipeline.mutex);
+  while (slu_pipeline.pending != NULL) {
+    SDL_CondWait(slu_pipeline.frame_done, slu_pipeline.mutex);
+  }
+  is_done              = slu_pipeline.is_done;
+  slu_pipeline.is_done = 0;
+  SDL_UnlockMutex(slu_pipeline.mutex);
+
+  if (!is_done) {
+    return 0;
+  }
+
+  /* Digest the frame when comparing runs. */
+  replay_frame_completed(slu_pipeline.replica.frame_buffer);
+
+  if (!slu_pipeline.is_dirty) {
+    stats_count(E_STATS_COUNTER_FRAMES_SKIPPED);
+    return 0;
+  }
+
+  if (self.texture != NULL && slu_texture_update(slu_pipeline.replica.frame_buffer, &slu_pipeline.dirty) != 0) {
+    return 0;
+  }
+
+  stats_count(E_STATS_COUNTER_FRAMES_RENDERED);
+
+  return self.texture != NULL;
+}
+
+
+/**
+ * Shows the previous frame, drawn meanwhile, and hands the render thread
+ * the log of the one just emulated.
+ */
+static void slu_pipeline_blit(void) {
+  const int do_present = slu_pipeline_take();
+
+  SDL_LockMutex(slu_pipeline.mutex);
+  slu_pipeline.pending = slu_frame_log;
+  SDL_CondSignal(slu_pipeline.frame_ready);
+  SDL_UnlockMutex(slu_pipeline.mutex);
+
+  slu_frame_log = (slu_frame_log == &slu_pipeline.logs[0]) ? &slu_pipeline.logs[1] : &slu_pipeline.logs[0];
+  slu_log_clear(slu_frame_log);
+
+  if (do_present) {
+    slu_present();
+  }
+}
+
+
+static void slu_replica_free(slu_replica_t* replica) {
+  free(replica->sprites_is_transparent);
+  free(replica->sprites_frame_buffer);
+  free(replica->sprites);
+  free(replica->patterns);
+  free(replica->frame_buffer);
+  free(replica->sram);
+}
+
+
+/**
+ * Moves drawing to a render thread, which draws a frame while the next one
+ * is emulated. Frames are still presented by the calling thread, which
+ * created the renderer.
+ */
+int slu_pipeline_start(void) {
+  slu_replica_t* replica = &slu_pipeline.replica;
+  int            i;
+
+  memset(&slu_pipeline, 0, sizeof(slu_pipeline));
+
+  replica->sram                   = malloc(MEMORY_SRAM_SIZE);
+  replica->frame_buffer           = malloc(FRAME_BUFFER_SIZE);
+  replica->patterns               = malloc(16 * 1024);
+  replica->sprites                = malloc(N_SPRITES * sizeof(sprite_t));
+  replica->sprites_frame_buffer   = malloc(FRAME_BUFFER_HEIGHT * (FRAME_BUFFER_WIDTH / 2) * 2);
+  replica->sprites_is_transparent = malloc(FRAME_BUFFER_HEIGHT * (FRAME_BUFFER_WIDTH / 2));
+  replica->source_sram            = memory_sram();
+  replica->is_beam_done           = 1;
+
+  if (replica->sram == NULL || replica->frame_buffer == NULL || replica->patterns == NULL || replica->sprites == NULL || replica->sprites_frame_buffer == NULL || replica->sprites_is_transparent == NULL) {
+    log_err("slu: out of memory\n");
+    goto exit_replica;
+  }
+
+  /* The render thread carries on where this one left off. */
+  memcpy(replica->frame_buffer, self.frame_buffer, FRAME_BUFFER_SIZE);
+  memcpy(replica->sprites_frame_buffer, sprites.frame_buffer, FRAME_BUFFER_HEIGHT * (FRAME_BUFFER_WIDTH / 2) * 2);
+  memcpy(replica->sprites_is_transparent, sprites.is_transparent, FRAME_BUFFER_HEIGHT * (FRAME_BUFFER_WIDTH / 2));
+
+  for (i = 0; i < 2; i++) {
+    slu_pipeline.logs[i].entries       = malloc(SLU_LOG_SIZE_INITIAL * sizeof(slu_entry_t));
+    slu_pipeline.logs[i].n_entries_max = SLU_LOG_SIZE_INITIAL;
+    if (slu_pipeline.logs[i].entries == NULL) {
+      log_err("slu: out of memory\n");
+      goto exit_logs;
     }
   }
+
+  slu_pipeline.start = slu_snapshot_take();
+  if (slu_pipeline.start == NULL) {
+    goto exit_logs;
+  }
+
+  slu_pipeline.mutex = SDL_CreateMutex();
+  if (slu_pipeline.mutex == NULL) {
+    log_err("slu: SDL_CreateMutex error: %s\n", SDL_GetError());
+    goto exit_start;
+  }
+
+  slu_pipeline.frame_ready = SDL_CreateCond();
+  if (slu_pipeline.frame_ready == NULL) {
+    log_err("slu: SDL_CreateCond error: %s\n", SDL_GetError());
+    goto exit_mutex;
+  }
+
+  slu_pipeline.frame_done = SDL_CreateCond();
+  if (slu_pipeline.frame_done == NULL) {
+    log_err("slu: SDL_CreateCond error: %s\n", SDL_GetError());
+    goto exit_frame_ready;
+  }
+
+  slu_pipeline.thread = SDL_CreateThread(slu_render_thread, "render_thread", &slu_pipeline);
+  if (slu_pipeline.thread == NULL) {
+    log_err("slu: SDL_CreateThread error: %s\n", SDL_GetError());
+    goto exit_frame_done;
+  }
+
+  slu_frame_log = &slu_pipeline.logs[0];
+  memory_video_logging_enable(1);
+
+  return 0;
+
+exit_frame_done:
+  SDL_DestroyCond(slu_pipeline.frame_done);
+exit_frame_ready:
+  SDL_DestroyCond(slu_pipeline.frame_ready);
+exit_mutex:
+  SDL_DestroyMutex(slu_pipeline.mutex);
+exit_start:
+  free(slu_pipeline.start);
+exit_logs:
+  free(slu_pipeline.logs[0].entries);
+  free(slu_pipeline.logs[1].entries);
+exit_replica:
+  slu_replica_free(replica);
+  memset(&slu_pipeline, 0, sizeof(slu_pipeline));
+  return -1;
+}
+
+
+static void slu_pipeline_stop(void) {
+  int i;
+
+  if (slu_pipeline.thread == NULL) {
+    return;
+  }
+
+  /* Show the last frame. */
+  if (slu_pipeline_take()) {
+    slu_present();
+  }
+
+  SDL_LockMutex(slu_pipeline.mutex);
+  slu_pipeline.do_finit = 1;
+  SDL_CondSignal(slu_pipeline.frame_ready);
+  SDL_UnlockMutex(slu_pipeline.mutex);
+
+  SDL_WaitThread(slu_pipeline.thread, NULL);
+  slu_pipeline.thread = NULL;
+
+  memory_video_logging_enable(0);
+  slu_frame_log = NULL;
+
+  for (i = 0; i < 2; i++) {
+    slu_log_clear(&slu_pipeline.logs[i]);
+    free(slu_pipeline.logs[i].entries);
+  }
+
+  SDL_DestroyCond(slu_pipeline.frame_done);
+  SDL_DestroyCond(slu_pipeline.frame_ready);
+  SDL_DestroyMutex(slu_pipeline.mutex);
+  free(slu_pipeline.start);
+  slu_replica_free(&slu_pipeline.replica);
+  memset(&slu_pipeline, 0, sizeof(slu_pipeline));
 }
 
 
@@ -483,6 +1524,8 @@ u32_t slu_active_video_line_get(void) {
 
 
 void slu_layer_priority_set(slu_layer_priority_t priority) {
+  slu_log(E_SLU_OP_LAYER_PRIORITY_SET, priority);
+
   self.layer_priority = priority & 0x07;
 }
 
@@ -493,6 +1536,8 @@ slu_layer_priority_t slu_layer_priority_get(void) {
 
 
 void slu_transparency_fallback_colour_write(u8_t value) {
+  slu_log(E_SLU_OP_TRANSPARENCY_FALLBACK_COLOUR_WRITE, value);
+
   self.fallback_rgba = palette_rgb8_rgb16(value);
 }
 
@@ -524,6 +1569,8 @@ void slu_line_interrupt_value_lsb_write(u8_t value) {
 
 
 void slu_ula_control_write(u8_t value) {
+  slu_log(E_SLU_OP_ULA_CONTROL_WRITE, value);
+
   ula_enable_set((value & 0x80) == 0);
   self.blend_mode               = (value & 0x60) >> 5;
   self.stencil_mode             = value & 0x01;
@@ -531,6 +1578,8 @@ void slu_ula_control_write(u8_t value) {
 
 
 void slu_transparent_set(u8_t rgb8) {
+  slu_log(E_SLU_OP_TRANSPARENT_SET, rgb8);
+
   self.transparent.rgb8               = rgb8;
   self.transparent.rgb9               = PALETTE_RGB8_TO_RGB9(rgb8);
   self.transparent.rgb16              = PALETTE_RGB9_TO_RGB16(self.transparent.rgb9);
@@ -557,4 +1606,13 @@ void slu_line_interrupt_enable_set(int enable) {
 void slu_display_size_set(unsigned int rows, unsigned int columns) {
   self.display_rows    = rows;
   self.display_columns = columns;
+  self.copper_sleep    = 0;
+}
+
+
+/**
+ * Called when the copper may have to run before its scheduled wake-up.
+ */
+void slu_copper_wake(void) {
+  self.copper_sleep = 0;
 }
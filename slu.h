@@ -22,6 +22,7 @@ typedef enum {
 int                    slu_init(SDL_Renderer* renderer, SDL_Texture* texture);
 void                   slu_finit(void);
 void                   slu_run(u32_t ticks_14mhz);
+u32_t                  slu_ticks_until_irq(void);
 void                   slu_layer_priority_set(slu_layer_priority_t priority);
 slu_layer_priority_t   slu_layer_priority_get(void);
 void                   slu_transparency_fallback_colour_write(u8_t value);
@@ -36,6 +37,11 @@ void                   slu_transparent_set(u8_t rgb8);
 const palette_entry_t* slu_transparent_get(void);
 void                   slu_reset(reset_t reset);
 void                   slu_display_size_set(unsigned int rows, unsigned int columns);
+void                   slu_copper_wake(void);
+int                    slu_pipeline_start(void);
+void                   slu_sram_written(u32_t offset, u8_t value);
+void                   slu_resync(void);
+u16_t*                 slu_frame_buffer_get(void);
 
 
 #endif  /* __SLU_H */
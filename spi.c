@@ -1,5 +1,6 @@
 #include "defs.h"
 #include "log.h"
+#include "rewind.h"
 #include "sdcard.h"
 
 
@@ -28,11 +29,14 @@ typedef struct spi_t {
 } spi_t;
 
 
-static spi_t self;
+static MACHINE_LOCAL spi_t self;
 
 
 int spi_init(void) {
   self.device = E_SPI_DEVICE_NONE;
+
+  rewind_register(&self, sizeof(self), NULL);
+
   return 0;
 }
 
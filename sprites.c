@@ -2,6 +2,7 @@
 #include <string.h>
 #include "log.h"
 #include "palette.h"
+#include "rewind.h"
 #include "sprites.h"
 
 
@@ -98,7 +99,7 @@ typedef struct sprites_t {
 } sprites_t;
 
 
-static sprites_t sprites;
+static VIDEO_LOCAL sprites_t sprites;
 
 
 int sprites_init(void) {
@@ -123,6 +124,10 @@ int sprites_init(void) {
 
   sprites_reset(E_RESET_HARD);
 
+  rewind_register(&sprites, sizeof(sprites), NULL);
+  rewind_register(sprites.patterns, 16 * 1024, NULL);
+  rewind_register(sprites.sprites, N_SPRITES * sizeof(sprite_t), NULL);
+
   return 0;
 }
 
@@ -618,6 +623,18 @@ static void draw_sprites(void) {
 }
 
 
+/**
+ * What sprites_tick() does to the sprites state, without drawing, for when
+ * the render thread draws instead.
+ */
+inline
+static void sprites_tick_undrawn(u32_t row, u32_t column) {
+  if (sprites.is_enabled && sprites.is_dirty && row == sprites.clip_y1_eff && column == sprites.clip_x1_eff) {
+    sprites.is_dirty = 0;
+  }
+}
+
+
 inline
 static void sprites_tick(u32_t row, u32_t column, int* is_enabled, u16_t* rgb) {
   size_t offset;
@@ -644,6 +661,8 @@ int sprites_priority_get(void) {
 
 
 void sprites_priority_set(int is_zero_on_top) {
+  slu_log(E_SLU_OP_SPRITES_PRIORITY_SET, is_zero_on_top);
+
   if (is_zero_on_top != sprites.is_zero_on_top) {
     sprites.is_zero_on_top = is_zero_on_top;
     sprites.is_dirty       = 1;
@@ -657,6 +676,8 @@ int sprites_enable_get(void) {
 
 
 void sprites_enable_set(int enable) {
+  slu_log(E_SLU_OP_SPRITES_ENABLE_SET, enable);
+
   if (enable != sprites.is_enabled) {
     sprites.is_enabled = enable;
   }
@@ -669,6 +690,8 @@ int sprites_enable_over_border_get(void) {
 
 
 void sprites_enable_over_border_set(int enable) {
+  slu_log(E_SLU_OP_SPRITES_ENABLE_OVER_BORDER_SET, enable);
+
   if (enable != sprites.is_enabled_over_border) {
     sprites.is_enabled_over_border = enable;
     sprites.is_dirty               = 1;
@@ -684,6 +707,8 @@ int sprites_enable_clipping_over_border_get(void) {
 
 
 void sprites_enable_clipping_over_border_set(int enable) {
+  slu_log(E_SLU_OP_SPRITES_ENABLE_CLIPPING_OVER_BORDER_SET, enable);
+
   if (enable != sprites.is_enabled_clipping_over_border) {
     sprites.is_enabled_clipping_over_border = enable;
     sprites.is_dirty                        = 1;
@@ -694,6 +719,8 @@ void sprites_enable_clipping_over_border_set(int enable) {
 
 
 void sprites_clip_set(u8_t x1, u8_t x2, u8_t y1, u8_t y2) {
+  slu_log4(E_SLU_OP_SPRITES_CLIP_SET, x1, x2, y1, y2);
+
   if (x1 != sprites.clip_x1 || x2 != sprites.clip_x2 || y1 != sprites.clip_y1 || y2 != sprites.clip_y2) {
     sprites.clip_x1  = x1;
     sprites.clip_x2  = x2;
@@ -709,6 +736,8 @@ void sprites_clip_set(u8_t x1, u8_t x2, u8_t y1, u8_t y2) {
 void sprites_attribute_set(u8_t slot, u8_t attribute_index, u8_t value) {
   sprite_t* sprite = &sprites.sprites[slot & 0x7F];
 
+  slu_log4(E_SLU_OP_SPRITES_ATTRIBUTE_SET, slot, attribute_index, value, 0);
+
   if (attribute_index > 4) {
     return;
   }
@@ -774,6 +803,8 @@ void sprites_attribute_set(u8_t slot, u8_t attribute_index, u8_t value) {
 
 
 void sprites_transparency_index_write(u8_t value) {
+  slu_log(E_SLU_OP_SPRITES_TRANSPARENCY_INDEX_WRITE, value);
+
   if (value != sprites.transparency_index) {
     sprites.transparency_index = value;
     sprites.is_dirty           = 1;
@@ -787,6 +818,8 @@ u8_t sprites_slot_get(void) {
 
 
 void sprites_slot_set(u8_t slot) {
+  slu_log(E_SLU_OP_SPRITES_SLOT_SET, slot);
+
   sprites.sprite_index    = slot & 0x7F;
   sprites.attribute_index = 0;
   sprites.pattern_index   = ((slot & 0x3F) << 1) | ((slot & 0x80) >> 7);
@@ -808,6 +841,8 @@ void sprites_next_attribute_set(u8_t value) {
 
 
 void sprites_next_pattern_set(u8_t value) {
+  slu_log(E_SLU_OP_SPRITES_NEXT_PATTERN_SET, value);
+
   if (sprites.patterns[sprites.pattern_address] != value) {
     sprites.patterns[sprites.pattern_address] = value;
     sprites.is_dirty                       = 1;
@@ -818,6 +853,9 @@ void sprites_next_pattern_set(u8_t value) {
 
 void sprites_palette_set(int use_second) {
   const palette_t palette = use_second ? E_PALETTE_SPRITES_SECOND : E_PALETTE_SPRITES_FIRST;
+
+  slu_log(E_SLU_OP_SPRITES_PALETTE_SET, use_second);
+
   if (sprites.palette != palette) {
     sprites.palette  = palette;
     sprites.is_dirty = 1;
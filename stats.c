@@ -0,0 +1,184 @@
+#include <SDL2/SDL.h>
+#include <string.h>
+#include "defs.h"
+#include "log.h"
+#include "main.h"
+#include "stats.h"
+
+
+#define N_TIMERS    (E_STATS_TIMER_LAST   - E_STATS_TIMER_FIRST   + 1)
+#define N_COUNTERS  (E_STATS_COUNTER_LAST - E_STATS_COUNTER_FIRST + 1)
+
+
+/* Statistics over one reporting interval. */
+typedef struct stats_interval_t {
+  double seconds;
+  double speed_ratio;                 /* Emulated time over host time. */
+  double timer_percent[N_TIMERS];
+  double cpu_percent;                 /* Whatever is not accounted for by the timers. */
+  u64_t  counters[N_COUNTERS];
+} stats_interval_t;
+
+
+typedef struct self_t {
+  int              is_enabled;
+  u64_t            timers[N_TIMERS];
+  u64_t            counters[N_COUNTERS];
+  u64_t            totals[N_COUNTERS];
+  u64_t            start_host_counter;
+  u64_t            start_now;
+  u64_t            start_ticks_28mhz;
+  u64_t            host_frequency;
+  stats_interval_t last;
+} self_t;
+
+
+static MACHINE_LOCAL self_t self;
+
+
+static const char* timer_names[N_TIMERS] = {
+  "slu", "blit", "ay", "audio-lock", "sync", "audio-wait"
+};
+
+
+static void stats_restart_interval(u64_t ticks_28mhz) {
+  memset(self.timers,   0, sizeof(self.timers));
+  memset(self.counters, 0, sizeof(self.counters));
+
+  self.start_host_counter = SDL_GetPerformanceCounter();
+  self.start_now          = stats_now();
+  self.start_ticks_28mhz  = ticks_28mhz;
+}
+
+
+int stats_init(void) {
+  memset(&self, 0, sizeof(self));
+
+  self.host_frequency = SDL_GetPerformanceFrequency();
+  stats_restart_interval(0);
+
+  return 0;
+}
+
+
+void stats_finit(void) {
+}
+
+
+int stats_is_enabled(void) {
+  return self.is_enabled;
+}
+
+
+/**
+ * Enables the per-subsystem timers and the periodic CSV line on stderr. The
+ * emulated speed, frame and audio counters are always kept, as they are
+ * cheap.
+ */
+void stats_enable(int enable) {
+  if (enable && !self.is_enabled) {
+    fprintf(stderr, "stats,seconds,speed,frames,skipped,underruns,cpu");
+    for (int i = 0; i < N_TIMERS; i++) {
+      fprintf(stderr, ",%s", timer_names[i]);
+    }
+    fprintf(stderr, "\n");
+  }
+
+  self.is_enabled = enable;
+}
+
+
+void stats_timer_add(stats_timer_t timer, u64_t start) {
+  self.timers[timer] += stats_now() - start;
+}
+
+
+void stats_count(stats_counter_t counter) {
+  self.counters[counter]++;
+  self.totals[counter]++;
+}
+
+
+u64_t stats_counter_get(stats_counter_t counter) {
+  return self.totals[counter];
+}
+
+
+static void stats_print_csv(void) {
+  fprintf(stderr, "stats,%.3f,%.3f,%llu,%llu,%llu,%.1f",
+    self.last.seconds,
+    self.last.speed_ratio,
+    self.last.counters[E_STATS_COUNTER_FRAMES_RENDERED],
+    self.last.counters[E_STATS_COUNTER_FRAMES_SKIPPED],
+    self.last.counters[E_STATS_COUNTER_AUDIO_UNDERRUNS],
+    self.last.cpu_percent);
+  for (int i = 0; i < N_TIMERS; i++) {
+    fprintf(stderr, ",%.1f", self.last.timer_percent[i]);
+  }
+  fprintf(stderr, "\n");
+}
+
+
+/**
+ * Called on every host sync, closes the current interval about once a
+ * second of host time.
+ */
+void stats_sync(u64_t ticks_28mhz, u32_t clock_28mhz) {
+  const u64_t host_counter = SDL_GetPerformanceCounter();
+  const u64_t elapsed      = host_counter - self.start_host_counter;
+  u64_t       total;
+  double      emulated;
+
+  if (elapsed < self.host_frequency) {
+    return;
+  }
+
+  total    = stats_now() - self.start_now;
+  emulated = (double) (ticks_28mhz - self.start_ticks_28mhz) / clock_28mhz;
+
+  self.last.seconds     = (double) elapsed / self.host_frequency;
+  self.last.speed_ratio = emulated / self.last.seconds;
+  memcpy(self.last.counters, self.counters, sizeof(self.counters));
+
+  /* The CPU gets what is left after the top-level subsystems. */
+  self.last.cpu_percent = 100.0;
+  for (int i = 0; i < N_TIMERS; i++) {
+    self.last.timer_percent[i] = total ? 100.0 * self.timers[i] / total : 0.0;
+  }
+  self.last.cpu_percent -= self.last.timer_percent[E_STATS_TIMER_SLU];
+  self.last.cpu_percent -= self.last.timer_percent[E_STATS_TIMER_AY];
+  self.last.cpu_percent -= self.last.timer_percent[E_STATS_TIMER_SYNC];
+
+  main_show_stats((int) (self.last.speed_ratio * 100 + 0.5), (int) (self.last.counters[E_STATS_COUNTER_FRAMES_RENDERED] / self.last.seconds + 0.5));
+
+  if (self.is_enabled) {
+    stats_print_csv();
+  }
+
+  stats_restart_interval(ticks_28mhz);
+}
+
+
+void stats_show(void) {
+  fprintf(stderr, "Last %.3f s: speed %.1f%%, %llu frames rendered, %llu skipped, %llu audio underruns\n",
+    self.last.seconds,
+    self.last.speed_ratio * 100,
+    self.last.counters[E_STATS_COUNTER_FRAMES_RENDERED],
+    self.last.counters[E_STATS_COUNTER_FRAMES_SKIPPED],
+    self.last.counters[E_STATS_COUNTER_AUDIO_UNDERRUNS]);
+
+  fprintf(stderr, "Total: %llu frames rendered, %llu skipped, %llu audio underruns\n",
+    self.totals[E_STATS_COUNTER_FRAMES_RENDERED],
+    self.totals[E_STATS_COUNTER_FRAMES_SKIPPED],
+    self.totals[E_STATS_COUNTER_AUDIO_UNDERRUNS]);
+
+  if (!self.is_enabled) {
+    fprintf(stderr, "Timers disabled, use 'stats 1' to enable\n");
+    return;
+  }
+
+  fprintf(stderr, "%12s %5.1f%%\n", "cpu", self.last.cpu_percent);
+  for (int i = 0; i < N_TIMERS; i++) {
+    fprintf(stderr, "%12s %5.1f%%\n", timer_names[i], self.last.timer_percent[i]);
+  }
+}
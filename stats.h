@@ -0,0 +1,64 @@
+#ifndef __STATS_H
+#define __STATS_H
+
+
+#include <SDL2/SDL.h>
+#include "defs.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+/**
+ * Host time spent in the various subsystems. Some nest: blitting happens
+ * inside the SLU, waiting for audio inside the host sync, and the audio lock
+ * is taken from both the CPU (beeper, DACs) and the AY.
+ */
+typedef enum {
+  E_STATS_TIMER_FIRST = 0,
+  E_STATS_TIMER_SLU   = E_STATS_TIMER_FIRST,
+  E_STATS_TIMER_BLIT,
+  E_STATS_TIMER_AY,
+  E_STATS_TIMER_AUDIO_LOCK,
+  E_STATS_TIMER_SYNC,
+  E_STATS_TIMER_AUDIO_WAIT,
+  E_STATS_TIMER_LAST  = E_STATS_TIMER_AUDIO_WAIT
+} stats_timer_t;
+
+
+typedef enum {
+  E_STATS_COUNTER_FIRST           = 0,
+  E_STATS_COUNTER_FRAMES_RENDERED = E_STATS_COUNTER_FIRST,
+  E_STATS_COUNTER_FRAMES_SKIPPED,
+  E_STATS_COUNTER_AUDIO_UNDERRUNS,
+  E_STATS_COUNTER_LAST            = E_STATS_COUNTER_AUDIO_UNDERRUNS
+} stats_counter_t;
+
+
+int   stats_init(void);
+void  stats_finit(void);
+int   stats_is_enabled(void);
+void  stats_enable(int enable);
+void  stats_timer_add(stats_timer_t timer, u64_t start);
+void  stats_count(stats_counter_t counter);
+u64_t stats_counter_get(stats_counter_t counter);
+void  stats_sync(u64_t ticks_28mhz, u32_t clock_28mhz);
+void  stats_show(void);
+
+
+/**
+ * Cheapest monotonic host timestamp available. Only ever compared against
+ * itself, so the unit does not matter.
+ */
+inline
+static u64_t stats_now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return SDL_GetPerformanceCounter();
+#endif
+}
+
+
+#endif  /* __STATS_H */
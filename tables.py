@@ -345,6 +345,7 @@ def halt() -> C:
     return '''
         if (!(self.requests & CPU_REQUEST_IRQ) || (IFF1 == 0)) {
           PC--;
+          self.is_halted = 1;
         }
     '''
 
@@ -419,6 +420,9 @@ def inxr(op: str) -> C:
             F |= ZF_MASK | NF_MASK;
         }}
         HL{op}{op};
+        if (B) {{
+            cpu_inxr_batch({op}1);
+        }}
     '''
 
 def jr_c_e(cond: Optional[str] = None) -> C:
@@ -576,6 +580,21 @@ def ld_r_n(r: str) -> C:
 def ld_r_r(r1: str, r2: str) -> C:
     return f'{r1} = {r2};'
 
+def ldpirx() -> C:
+    return '''
+        TMP = memory_read((HL & 0xFFF8) | (E & 0x07)); T(3);
+        if (TMP != A) {
+            memory_write(DE, TMP);     T(5);
+        }
+        DE++;
+        F &= ~(HF_MASK | VF_MASK | NF_MASK);
+        F |= (--BC != 0) << VF_SHIFT;
+        if (BC) {
+          PC -= 2; T(5);
+          cpu_ldpirx_batch();
+        }
+    '''
+
 def ldws() -> C:
     return '''
         TMP = memory_read(HL); T(3);
@@ -614,6 +633,9 @@ def ldxr(op: str) -> C:
         }}
         HL{op}{op}; 
         DE{op}{op};
+        if (BC) {{
+            cpu_ldxr_batch({op}1);
+        }}
     '''
 
 def ldxx(op: str) -> C:
@@ -657,6 +679,7 @@ def lxrx(op: str) -> C:
         F |= (--BC != 0) << VF_SHIFT;
         if (BC) {{
           PC -= 2; T(5);
+          cpu_lxrx_batch({op}1);
         }}
     '''
 
@@ -720,6 +743,9 @@ def otxr(op: str) -> C:
             F |= ZF_MASK | NF_MASK;
         }}
         HL{op}{op};
+        if (B) {{
+            cpu_otxr_batch({op}1);
+        }}
     '''
 
 def out_C_r(r: str) -> C:
@@ -1273,7 +1299,7 @@ def ed_table() -> Table:
         0xB2: ('INIR',           partial(inxr, '+')),
         0xB3: ('OTIR',           partial(otxr, '+')),
         0xB4: ('LIRX',           partial(lxrx, '+')),
-        # TODO 0xB7: LDPIRX / LPRX
+        0xB7: ('LDPIRX',         ldpirx),
         0xB8: ('LDDR',           partial(ldxr, '-')),
         0xB9: ('CPDR',           partial(cpxr, '-')),
         0xBA: ('INDR',           partial(inxr, '-')),
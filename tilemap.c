@@ -2,14 +2,11 @@
 #include "log.h"
 #include "memory.h"
 #include "palette.h"
+#include "rewind.h"
 #include "tilemap.h"
 
 
-/**
- * TODO:
- * - tile rotation
- * - tile mirroring
- */
+#define TILEMAP_ROW_NONE  0xFFFFFFFF
 
 
 typedef struct tilemap_t {
@@ -34,7 +31,31 @@ typedef struct tilemap_t {
 } tilemap_t;
 
 
-static tilemap_t tilemap;
+static VIDEO_LOCAL tilemap_t tilemap;
+
+
+/**
+ * The row of the tile the beam is in, decoded into palette indices when the
+ * beam enters the tile. Derived from the tilemap state, hence not part of it.
+ */
+typedef struct tilemap_row_t {
+  u32_t key;             /* Row and map column decoded. */
+  u8_t  indices[8];
+  u8_t  palette_offset;
+  int   is_below;
+} tilemap_row_t;
+
+
+static VIDEO_LOCAL tilemap_row_t tilemap_row;
+
+
+/**
+ * Drops the decoded row, which must follow every change to what it was
+ * decoded from, other than the tile definitions themselves.
+ */
+static void tilemap_row_invalidate(void) {
+  tilemap_row.key = TILEMAP_ROW_NONE;
+}
 
 
 int tilemap_init(u8_t* sram) {
@@ -44,6 +65,8 @@ int tilemap_init(u8_t* sram) {
 
   tilemap_reset(E_RESET_HARD);
 
+  rewind_register(&tilemap, sizeof(tilemap), tilemap_row_invalidate);
+
   return 0;
 }
 
@@ -70,10 +93,14 @@ void tilemap_reset(reset_t reset) {
   tilemap.use_512_tiles            = 0;
   tilemap.tilemap_over_ula         = 0;
   tilemap.default_attribute        = 0x00;
+
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_tilemap_control_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_CONTROL_WRITE, value);
+
   tilemap.is_enabled            = value & 0x80;
   tilemap.use_80x32             = value & 0x40;
   tilemap.use_default_attribute = value & 0x20;
@@ -82,25 +109,38 @@ void tilemap_tilemap_control_write(u8_t value) {
   tilemap.tilemap_over_ula      = value & 0x01;
 
   tilemap.palette = (value & 0x10) ? E_PALETTE_TILEMAP_SECOND : E_PALETTE_TILEMAP_FIRST;
+
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_default_tilemap_attribute_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_DEFAULT_ATTRIBUTE_WRITE, value);
+
   tilemap.default_attribute = value;
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_tilemap_base_address_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_BASE_ADDRESS_WRITE, value);
+
   tilemap.tilemap_base_address = (value & 0x3F) << 8;
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_tilemap_tile_definitions_address_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_DEFINITIONS_ADDRESS_WRITE, value);
+
   tilemap.definitions_base_address = (value & 0x3F) << 8;
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_transparency_index_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_TRANSPARENCY_INDEX_WRITE, value);
+
   tilemap.transparency_index = value;
 }
 
@@ -127,6 +167,59 @@ static u8_t tilemap_attribute_get(u32_t row, u32_t column) {
 }
 
 
+/**
+ * Returns the 4-bit pixel at a row and column of a tile definition.
+ */
+inline
+static u8_t tilemap_definition_pixel_get(u16_t definition, u8_t def_row, u8_t def_column) {
+  const u8_t pattern = tilemap.bank5[definition + def_row * 4 + def_column / 2];
+
+  return (def_column & 0x01) ? (pattern & 0x0F) : (pattern >> 4);
+}
+
+
+/**
+ * Decodes a row of the tile at a position into palette indices. In text mode
+ * a row is a single byte with a bit per pixel, otherwise each pixel has four
+ * bits and the attribute can rotate the tile clockwise and then mirror it,
+ * like sprites.
+ */
+static void tilemap_row_decode(u32_t key, u32_t row, u32_t column) {
+  const u16_t map_offset = tilemap_map_offset_get(row, column);
+  const u8_t  attribute  = tilemap_attribute_get(row, column);
+  const u16_t tile       = tilemap.bank5[map_offset] | (tilemap.use_512_tiles ? (attribute & 0x01) << 8 : 0);
+  const u8_t  def_row    = row % 8;
+  u8_t        i;
+
+  if (tilemap.use_text_mode) {
+    const u8_t pattern = tilemap.bank5[tilemap.definitions_base_address + tile * 8 + def_row];
+
+    for (i = 0; i < 8; i++) {
+      tilemap_row.indices[i] = (pattern & (0x80 >> i)) ? 1 : 0;
+    }
+    tilemap_row.palette_offset = attribute & 0xFE;
+  } else {
+    const u16_t definition    = tilemap.definitions_base_address + tile * 32;
+    const int   is_x_mirrored = attribute & 0x08;
+    const int   is_y_mirrored = attribute & 0x04;
+    const int   is_rotated    = attribute & 0x02;
+    const u8_t  mirrored_row  = is_y_mirrored ? 7 - def_row : def_row;
+
+    for (i = 0; i < 8; i++) {
+      const u8_t mirrored_column = is_x_mirrored ? 7 - i : i;
+
+      tilemap_row.indices[i] = is_rotated
+        ? tilemap_definition_pixel_get(definition, 7 - mirrored_column, mirrored_row)
+        : tilemap_definition_pixel_get(definition, mirrored_row, mirrored_column);
+    }
+    tilemap_row.palette_offset = attribute & 0xF0;
+  }
+
+  tilemap_row.is_below = tilemap.use_512_tiles ? 0 : (attribute & 1);
+  tilemap_row.key      = key;
+}
+
+
 inline
 static void tilemap_tick(u32_t row, u32_t column, int* is_enabled, int* is_pixel_enabled, int* is_pixel_below, int* is_pixel_textmode, const palette_entry_t** rgb) {
   if (!tilemap.is_enabled) {
@@ -141,45 +234,51 @@ static void tilemap_tick(u32_t row, u32_t column, int* is_enabled, int* is_pixel
     row        < tilemap.clip_y1 || row        > tilemap.clip_y2 ||
     column / 4 < tilemap.clip_x1 || column / 4 > tilemap.clip_x2;
 
-  const u16_t map_offset     = tilemap_map_offset_get(row, column);
-  const u8_t  attribute      = tilemap_attribute_get(row, column);
-  const u8_t  tile           = tilemap.bank5[map_offset] | (tilemap.use_512_tiles ? (attribute & 0x01) << 8 : 0);
-  const u8_t  def_row        = row    % 8;
+  const u32_t key            = row * 128 + column / (tilemap.use_80x32 ? 8 : 16);
   const u8_t  def_column     = (column / (tilemap.use_80x32 ? 1 : 2)) % 8;
-  const u16_t def_offset     = tilemap.use_text_mode
-    ? (tilemap.definitions_base_address + (tile *  8 + def_row))
-    : (tilemap.definitions_base_address + (tile * 32 + def_row * 4 + def_column / 2));
-  const u8_t  pattern        = tilemap.bank5[def_offset];
-  const u8_t  palette_offset = attribute & (tilemap.use_text_mode ? 0xFE : 0xF0);
-  const u8_t  palette_index  = (tilemap.use_text_mode
-                                ? ((pattern & (0x80 >> def_column)) ? 1 : 0)
-                                : ((def_column & 0x01) ? (pattern & 0x0F) : (pattern >> 4)));
+
+  if (key != tilemap_row.key) {
+    tilemap_row_decode(key, row, column);
+  }
+
+  const u8_t  palette_index  = tilemap_row.indices[def_column];
   const int   is_transparent = palette_index == tilemap.transparency_index;
 
   *is_enabled        = 1;
   *is_pixel_enabled  = !(is_clipped || is_transparent);
-  *is_pixel_below    = tilemap.use_512_tiles ? 0 : (attribute & 1);
+  *is_pixel_below    = tilemap_row.is_below;
   *is_pixel_textmode = tilemap.use_text_mode;
-  *rgb               = palette_read_inline(tilemap.palette, palette_offset | palette_index);
+  *rgb               = palette_read_inline(tilemap.palette, tilemap_row.palette_offset | palette_index);
 }
 
 
 void tilemap_offset_x_msb_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_OFFSET_X_MSB_WRITE, value);
+
   tilemap.offset_x = (value << 8) | (tilemap.offset_x & 0x00FF);
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_offset_x_lsb_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_OFFSET_X_LSB_WRITE, value);
+
   tilemap.offset_x = (tilemap.offset_x & 0xFF00) | value;
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_offset_y_write(u8_t value) {
+  slu_log(E_SLU_OP_TILEMAP_OFFSET_Y_WRITE, value);
+
   tilemap.offset_y = value;
+  tilemap_row_invalidate();
 }
 
 
 void tilemap_clip_set(u8_t x1, u8_t x2, u8_t y1, u8_t y2) {
+  slu_log4(E_SLU_OP_TILEMAP_CLIP_SET, x1, x2, y1, y2);
+
   tilemap.clip_x1 = x1;
   tilemap.clip_x2 = x2;
   tilemap.clip_y1 = y1;
@@ -1,11 +1,21 @@
 #include <ctype.h>
+#include <stddef.h>
 #include "clock.h"
 #include "defs.h"
 #include "esp.h"
 #include "log.h"
+#include "rewind.h"
 #include "uart.h"
 
 
+/* FIFO depths of the real thing. */
+#define RX_FIFO_SIZE  512
+#define TX_FIFO_SIZE   64
+
+/* How often to look for data from an idle ESP, about once a millisecond. */
+#define IDLE_POLL_TICKS_28MHZ  28000
+
+
 /**
  * TODO Support UARTs redirected to joysticks?
  */
@@ -24,16 +34,29 @@ typedef struct uart_t {
 } uart_t;
 
 
+typedef struct fifo_t {
+  u8_t  data[RX_FIFO_SIZE];
+  u16_t read_index;
+  u16_t n_elements;
+} fifo_t;
+
+
 typedef struct uarts_t {
   uart_t   uart[2];
   device_t selected;
+  fifo_t   rx;            /* ESP to Z80. */
+  fifo_t   tx;            /* Z80 to ESP. */
+  int      is_unlimited;  /* Bytes move as fast as the Z80 does. */
 } uarts_t;
 
 
-static uarts_t self;
+static MACHINE_LOCAL uarts_t self;
 
 
 int uart_init(void) {
+  /* The clock events move bytes through the FIFOs, so rewind along. */
+  rewind_register(&self, offsetof(uarts_t, is_unlimited), NULL);
+
   return 0;
 }
 
@@ -47,9 +70,100 @@ static u32_t baudrate(u32_t prescalar) {
 }
 
 
+static void fifo_push(fifo_t* fifo, size_t size, u8_t value) {
+  fifo->data[(fifo->read_index + fifo->n_elements) % size] = value;
+  fifo->n_elements++;
+}
+
+
+static u8_t fifo_pop(fifo_t* fifo, size_t size) {
+  const u8_t value = fifo->data[fifo->read_index];
+
+  fifo->read_index = (fifo->read_index + 1) % size;
+  fifo->n_elements--;
+
+  return value;
+}
+
+
+/**
+ * Number of 28 MHz ticks to move one byte to or from the ESP, including the
+ * start, parity and stop bits. The prescalar counts 28 MHz ticks per bit.
+ */
+static u64_t uart_byte_ticks(void) {
+  const uart_t* uart = &self.uart[E_DEVICE_ESP];
+  const u32_t   bits = 1 + uart->bits_per_frame + uart->use_parity_check + (uart->use_two_stop_bits ? 2 : 1);
+
+  return (u64_t) (uart->prescalar ? uart->prescalar : 1) * bits;
+}
+
+
+/**
+ * Makes the receiver look for data from the ESP no later than a byte from
+ * now, e.g. because it may have a response.
+ */
+static void uart_rx_wake(void) {
+  const u64_t ticks = clock_ticks() + uart_byte_ticks();
+
+  if (!self.is_unlimited && clock_event_get(E_CLOCK_EVENT_UART_RX) > ticks) {
+    clock_event_schedule(E_CLOCK_EVENT_UART_RX, ticks);
+  }
+}
+
+
+/**
+ * Receives a byte from the ESP, if it has any and there is room for it.
+ * When there is not, holds off as if using flow control.
+ */
+void uart_rx_clock_event(void) {
+  u64_t ticks = uart_byte_ticks();
+
+  if (self.rx.n_elements < RX_FIFO_SIZE) {
+    if (esp_tx_read() & 0x01) {
+      fifo_push(&self.rx, RX_FIFO_SIZE, esp_rx_read());
+    } else if (ticks < IDLE_POLL_TICKS_28MHZ) {
+      ticks = IDLE_POLL_TICKS_28MHZ;
+    }
+  }
+
+  clock_event_schedule(E_CLOCK_EVENT_UART_RX, clock_ticks() + ticks);
+}
+
+
+/**
+ * The byte at the head of the transmit FIFO has been shifted out.
+ */
+void uart_tx_clock_event(void) {
+  if (self.tx.n_elements == 0) {
+    return;
+  }
+
+  esp_tx_write(fifo_pop(&self.tx, TX_FIFO_SIZE));
+
+  if (self.tx.n_elements > 0) {
+    clock_event_schedule(E_CLOCK_EVENT_UART_TX, clock_ticks() + uart_byte_ticks());
+  }
+
+  uart_rx_wake();
+}
+
+
+void uart_unlimited_set(int is_unlimited) {
+  self.is_unlimited = is_unlimited;
+  uart_reset(E_RESET_SOFT);
+}
+
+
 void uart_reset(reset_t reset) {
   self.selected = E_DEVICE_ESP;
 
+  self.rx.read_index = 0;
+  self.rx.n_elements = 0;
+  self.tx.read_index = 0;
+  self.tx.n_elements = 0;
+  clock_event_cancel(E_CLOCK_EVENT_UART_TX);
+  clock_event_cancel(E_CLOCK_EVENT_UART_RX);
+
   if (reset == E_RESET_HARD) {
     int i;
 
@@ -64,6 +178,8 @@ void uart_reset(reset_t reset) {
 
   esp_baudrate_set(baudrate(self.uart[self.selected].prescalar));
   esp_dataformat_set(self.uart[E_DEVICE_ESP].bits_per_frame, self.uart[E_DEVICE_ESP].use_parity_check, self.uart[E_DEVICE_ESP].use_odd_parity, self.uart[E_DEVICE_ESP].use_two_stop_bits);
+
+  uart_rx_wake();
 }
 
 
@@ -123,7 +239,10 @@ void uart_frame_write(u8_t value) {
 u8_t uart_rx_read(void) {
   switch (self.selected) {
     case E_DEVICE_ESP:
-      return esp_rx_read();
+      if (self.is_unlimited) {
+        return esp_rx_read();
+      }
+      return (self.rx.n_elements > 0) ? fifo_pop(&self.rx, RX_FIFO_SIZE) : 0x00;
 
     default:
       break;
@@ -152,7 +271,13 @@ void uart_rx_write(u8_t value) {
 u8_t uart_tx_read(void) {
   switch (self.selected) {
     case E_DEVICE_ESP:
-      return esp_tx_read();
+      if (self.is_unlimited) {
+        return esp_tx_read();
+      }
+      return (self.tx.n_elements == 0)                    << 4 /* Tx empty      */
+           | (self.rx.n_elements >= RX_FIFO_SIZE * 3 / 4) << 3 /* Rx near full  */
+           | (self.tx.n_elements == TX_FIFO_SIZE)         << 1 /* Tx full       */
+           | (self.rx.n_elements > 0);                         /* Rx not empty  */
 
     default:
       break;
@@ -166,7 +291,14 @@ void uart_tx_write(u8_t value) {
   switch (self.selected) {
     case E_DEVICE_ESP:
       /* log_wrn("%c", isprint(value) ? value : '.'); */
-      esp_tx_write(value);
+      if (self.is_unlimited) {
+        esp_tx_write(value);
+      } else if (self.tx.n_elements < TX_FIFO_SIZE) {
+        if (self.tx.n_elements == 0) {
+          clock_event_schedule(E_CLOCK_EVENT_UART_TX, clock_ticks() + uart_byte_ticks());
+        }
+        fifo_push(&self.tx, TX_FIFO_SIZE, value);
+      }
       break;
 
     default:
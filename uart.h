@@ -16,6 +16,9 @@ u8_t uart_rx_read(void);
 void uart_rx_write(u8_t value);
 u8_t uart_tx_read(void);
 void uart_tx_write(u8_t value);
+void uart_rx_clock_event(void);
+void uart_tx_clock_event(void);
+void uart_unlimited_set(int is_unlimited);
 
 
 #endif  /* __UART_H */
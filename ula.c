@@ -1,3 +1,4 @@
+#include <string.h>
 #include <time.h>
 #include "audio.h"
 #include "clock.h"
@@ -8,7 +9,9 @@
 #include "log.h"
 #include "main.h"
 #include "memory.h"
+#include "mmu.h"
 #include "palette.h"
+#include "rewind.h"
 #include "slu.h"
 #include "ula.h"
 
@@ -27,6 +30,9 @@ typedef enum ula_display_mode_t {
 #define N_IRQ_TSTATES          32
 #define N_DISPLAY_TIMINGS      (E_MACHINE_TYPE_LAST - E_MACHINE_TYPE_FIRST + 1)
 #define N_REFRESH_FREQUENCIES  2
+#define ULA_MAX_FRAME_TSTATES  (320 * 228)
+#define ULA_TRANSPARENT        0x100  /* Palette index of a transparent pixel. */
+#define ULA_CELL_NONE          0xFFFFFFFF
 
 
 /**
@@ -343,7 +349,7 @@ typedef struct ula_t {
 } ula_t;
 
 
-static ula_t ula;
+static VIDEO_LOCAL ula_t ula;
 
 
 #define N_DISPLAY_MODES   (E_ULA_DISPLAY_MODE_LAST - E_ULA_DISPLAY_MODE_FIRST + 1)
@@ -394,66 +400,267 @@ static const u8_t ula_mode_x_attribute_byte_get(u32_t row, u32_t column) {
 }
 
 
-inline
-static const palette_entry_t* ula_display_mode_screen_x(u32_t row, u32_t column) {
-  const u32_t halved_column    = column / 2;
-  const u8_t  mask             = 1 << (7 - (halved_column & 0x07));
-  const u8_t  display_byte     = ula_mode_x_display_byte_get(row, halved_column);
-  const u8_t  attribute_byte   = ula_mode_x_attribute_byte_get(row, halved_column);
-  const int   is_foreground    = display_byte & mask;
+/**
+ * Palette index of the ink and paper for every attribute byte, which takes
+ * BRIGHT, FLASH and the ULANext format into account, and the last 8-pixel
+ * cell expanded with it. The ULA fetches the display and attribute bytes
+ * once per cell as well. Derived from the ULA state, hence not part of it.
+ */
+typedef struct ula_cell_t {
+  u16_t                      ink[256];
+  u16_t                      paper[256];
+  u32_t                      key;         /* Row and cell expanded. */
+  u16_t                      indices[8];
+} ula_cell_t;
 
-  if (ula.is_ula_next_mode) {
-    if (is_foreground) {
-      return palette_read_inline(ula.palette, attribute_byte & ula.ula_next_mask_ink);
-    }
-    
-    if (ula.ula_next_rshift_paper == 0) {
-      return ula.transparent;
+
+static VIDEO_LOCAL ula_cell_t ula_cell;
+
+
+/**
+ * Rebuilds the attribute tables, which must follow every change to the
+ * ULANext mode and format and to the blink state.
+ */
+static void ula_cell_refresh(void) {
+  u32_t attribute_byte;
+
+  for (attribute_byte = 0; attribute_byte < 256; attribute_byte++) {
+    if (ula.is_ula_next_mode) {
+      ula_cell.ink[attribute_byte]   = attribute_byte & ula.ula_next_mask_ink;
+      ula_cell.paper[attribute_byte] = (ula.ula_next_rshift_paper == 0)
+        ? ULA_TRANSPARENT
+        : 128 + ((attribute_byte & ~ula.ula_next_mask_ink) >> ula.ula_next_rshift_paper);
+    } else {
+      const u8_t  bright = (attribute_byte & 0x40) >> 3;
+      const u16_t ink    = 0  + bright + (attribute_byte & 0x07);
+      const u16_t paper  = 16 + bright + ((attribute_byte >> 3) & 0x07);
+      const int   invert = (attribute_byte & 0x80) && ula.blink_state;
+
+      ula_cell.ink[attribute_byte]   = invert ? paper : ink;
+      ula_cell.paper[attribute_byte] = invert ? ink   : paper;
     }
+  }
+
+  ula_cell.key = ULA_CELL_NONE;
+}
+
 
-    return palette_read_inline(ula.palette, 128 + ((attribute_byte & ~ula.ula_next_mask_ink) >> ula.ula_next_rshift_paper));
+/**
+ * Expands a cell into the palette indices of its 8 pixels.
+ */
+inline
+static void ula_cell_expand(u32_t key, u8_t display_byte, u8_t attribute_byte) {
+  const u16_t ink   = ula_cell.ink[attribute_byte];
+  const u16_t paper = ula_cell.paper[attribute_byte];
+  int         i;
+
+  for (i = 0; i < 8; i++) {
+    ula_cell.indices[i] = (display_byte & (0x80 >> i)) ? ink : paper;
   }
+  ula_cell.key = key;
+}
 
-  const u8_t             bright = (attribute_byte & 0x40) >> 3;
-  const palette_entry_t* ink    = palette_read_inline(ula.palette, 0  + bright + (attribute_byte & 0x07));
-  const palette_entry_t* paper  = palette_read_inline(ula.palette, 16 + bright + ((attribute_byte >> 3) & 0x07));;
-  const u8_t             blink  = attribute_byte & 0x80;
 
-  return is_foreground
-    ? ((blink && ula.blink_state) ? paper : ink)
-    : ((blink && ula.blink_state) ? ink : paper);
+inline
+static const palette_entry_t* ula_cell_pixel(u32_t pixel) {
+  return (ula_cell.indices[pixel] == ULA_TRANSPARENT)
+    ? ula.transparent
+    : palette_read_inline(ula.palette, ula_cell.indices[pixel]);
+}
+
+
+inline
+static const palette_entry_t* ula_display_mode_screen_x(u32_t row, u32_t column) {
+  const u32_t halved_column = column / 2;
+  const u32_t key           = row * 32 + halved_column / 8;
+
+  if (key != ula_cell.key) {
+    ula_cell_expand(key,
+                    ula_mode_x_display_byte_get(row, halved_column),
+                    ula_mode_x_attribute_byte_get(row, halved_column));
+  }
+
+  return ula_cell_pixel(halved_column & 0x07);
 }
 
 
 inline
 static const palette_entry_t* ula_display_mode_hi_colour(u32_t row, u32_t column) {
-  const u32_t halved_column    = column / 2;
-  const u16_t attribute_offset = ((row & 0xC0) << 5) | ((row & 0x07) << 8) | ((row & 0x38) << 2) | ((halved_column / 8) & 0x1F);
-  const u8_t  attribute_byte   = ula.attribute_ram[attribute_offset];
-  const u8_t  display_byte     = ula.display_ram[attribute_offset];
-  const u8_t  mask             = 1 << (7 - (halved_column & 0x07));
-  const int   is_foreground    = display_byte & mask;
+  const u32_t halved_column = column / 2;
+  const u32_t key           = row * 32 + halved_column / 8;
 
-  if (ula.is_ula_next_mode) {
-    if (is_foreground) {
-      return palette_read_inline(ula.palette, attribute_byte & ula.ula_next_mask_ink);
-    }
-    
-    if (ula.ula_next_rshift_paper == 0) {
-      return ula.transparent;
+  if (key != ula_cell.key) {
+    const u16_t attribute_offset = ((row & 0xC0) << 5) | ((row & 0x07) << 8) | ((row & 0x38) << 2) | ((halved_column / 8) & 0x1F);
+
+    ula_cell_expand(key,
+                    ula.display_ram[attribute_offset],
+                    ula.attribute_ram[attribute_offset]);
+  }
+
+  return ula_cell_pixel(halved_column & 0x07);
+}
+
+
+/**
+ * https://worldofspectrum.org/faq/reference/48kreference.htm#Contention
+ * https://worldofspectrum.org/faq/reference/128kreference.htm#Contention
+ * https://worldofspectrum.org/faq/reference/plus3reference.htm
+ *
+ * Contention starts one T-state *before* the first pixel in the top-left
+ * corner is drawn on the 48K and 128K, and a few after it on the +2A/+3. It
+ * then repeats an eight T-state pattern during the 128 T-states of each of
+ * the 192 content lines. The +2A/+3 only contends cycles that access memory,
+ * not port I/O nor internal cycles.
+ *
+ * The first T-states are those documented for 50 Hz, other displays are
+ * aligned with them on the first pixel.
+ */
+typedef struct ula_contention_spec_t {
+  u32_t first_tstate;                  /** First contended T-state at 50 Hz. */
+  u8_t  delays[8];                     /** Delay per T-state in the pattern. */
+  int   is_mreq_only;                  /** Whether only memory is contended. */
+} ula_contention_spec_t;
+
+
+static const ula_contention_spec_t ula_contention_spec_48k = {
+  14335, { 6, 5, 4, 3, 2, 1, 0, 0 }, 0
+};
+
+
+static const ula_contention_spec_t ula_contention_spec_128k = {
+  14361, { 6, 5, 4, 3, 2, 1, 0, 0 }, 0
+};
+
+
+static const ula_contention_spec_t ula_contention_spec_plus3 = {
+  14365, { 1, 0, 7, 6, 5, 4, 3, 2 }, 1
+};
+
+
+static const ula_contention_spec_t* ula_contention_specs[N_DISPLAY_TIMINGS] = {
+  NULL,
+  &ula_contention_spec_48k,
+  &ula_contention_spec_128k,
+  &ula_contention_spec_plus3,
+  NULL
+};
+
+
+/**
+ * Delay per T-state since the frame IRQ, built for a timing and display.
+ * Derived from the ULA state, hence not part of it to keep snapshots small.
+ */
+typedef struct ula_contention_t {
+  const ula_display_spec_t*  display_spec;
+  machine_type_t             display_timing;
+  u32_t                      n_tstates;
+  u8_t                       delays[ULA_MAX_FRAME_TSTATES];
+  int                        is_active;
+  int                        is_mreq_only;
+  u8_t                       banks;
+} ula_contention_t;
+
+
+static MACHINE_LOCAL ula_contention_t ula_contention;
+
+
+/**
+ * Returns the T-state since the frame IRQ at which the first content pixel
+ * is drawn.
+ */
+static u32_t ula_first_pixel_tstate(const ula_display_spec_t* spec) {
+  return ((spec->rows - spec->vsync_row) * spec->columns - spec->vsync_column) / 4;
+}
+
+
+static void ula_contention_build(const ula_contention_spec_t* contention_spec) {
+  const ula_display_spec_t* spec  = ula.display_spec;
+  const u32_t               line  = spec->columns / 4;
+  const u32_t               first = contention_spec->first_tstate
+                                  - ula_first_pixel_tstate(&ula_display_spec_vga[ula.display_timing][0])
+                                  + ula_first_pixel_tstate(spec);
+  u32_t                     row;
+  u32_t                     column;
+  u32_t                     tstate;
+
+  ula_contention.n_tstates = spec->rows * spec->columns / 4;
+  if (ula_contention.n_tstates > ULA_MAX_FRAME_TSTATES) {
+    ula_contention.n_tstates = ULA_MAX_FRAME_TSTATES;
+  }
+
+  memset(ula_contention.delays, 0, sizeof(ula_contention.delays));
+
+  for (row = 0; row < 192; row++) {
+    for (column = 0; column < 128; column++) {
+      tstate = first + row * line + column;
+      if (tstate < ula_contention.n_tstates) {
+        ula_contention.delays[tstate] = contention_spec->delays[column % 8];
+      }
     }
+  }
+}
+
+
+static int ula_is_bank_contended(u8_t bank) {
+  switch (ula.display_timing) {
+    case E_MACHINE_TYPE_ZX_48K:
+      /* Only bank 5 is contended. */
+      return bank == 5;
+
+    case E_MACHINE_TYPE_ZX_128K_PLUS2:
+      /* Only odd banks are contended. */
+      return (bank & 1) == 1;
+
+    case E_MACHINE_TYPE_ZX_PLUS2A_PLUS2B_PLUS3:
+      /* Only banks four and above are contended. */
+      return bank > 3;
+
+    default:
+      return 0;
+  }
+}
+
+
+/**
+ * Brings contention in line with the machine timing, display, CPU speed and
+ * whether it is enabled at all. The table is only rebuilt when the timing or
+ * display changed. When nothing can be contended, the MMU is told so and
+ * memory accesses skip contention altogether.
+ */
+void ula_contention_refresh(void) {
+  const ula_contention_spec_t* contention_spec;
+  u8_t                         bank;
 
-    return palette_read_inline(ula.palette, 128 + ((attribute_byte & ~ula.ula_next_mask_ink) >> ula.ula_next_rshift_paper));
+  if (ula.display_spec == NULL) {
+    /* Not initialized yet. */
+    return;
+  }
+
+  contention_spec = ula_contention_specs[ula.display_timing];
+
+  if (contention_spec != NULL && (ula.display_spec != ula_contention.display_spec || ula.display_timing != ula_contention.display_timing)) {
+    ula_contention_build(contention_spec);
+    ula_contention.display_spec   = ula.display_spec;
+    ula_contention.display_timing = ula.display_timing;
   }
 
-  const u8_t             bright = (attribute_byte & 0x40) >> 3;
-  const palette_entry_t* ink    = palette_read_inline(ula.palette, 0  + bright + (attribute_byte & 0x07));
-  const palette_entry_t* paper  = palette_read_inline(ula.palette, 16 + bright + ((attribute_byte >> 3) & 0x07));;
-  const u8_t             blink  = attribute_byte & 0x80;
+  /* Contention only plays a role when running at 3.5 MHz, and can be
+   * disabled by writing to a Next register. */
+  ula_contention.is_active    = contention_spec != NULL
+                             && ula.do_contend
+                             && clock_cpu_speed_get() == E_CPU_SPEED_3MHZ;
+  ula_contention.is_mreq_only = contention_spec != NULL && contention_spec->is_mreq_only;
+  ula_contention.banks        = 0;
+
+  if (ula_contention.is_active) {
+    for (bank = 0; bank < 8; bank++) {
+      if (ula_is_bank_contended(bank)) {
+        ula_contention.banks |= 1 << bank;
+      }
+    }
+  }
 
-  return is_foreground
-    ? ((blink && ula.blink_state) ? paper : ink)
-    : ((blink && ula.blink_state) ? ink : paper);
+  mmu_contended_banks_set(ula_contention.banks);
 }
 
 
@@ -509,8 +716,12 @@ static void ula_display_reconfigure(void) {
   }
 
   slu_display_size_set(ula.display_spec->rows, ula.display_spec->columns);
+  ula_cell.key = ULA_CELL_NONE;
 
-  main_show_refresh(ula.is_60hz);
+  if (!slu_is_replica) {
+    ula_contention_refresh();
+    main_show_refresh(ula.is_60hz);
+  }
 }
 
 
@@ -525,6 +736,7 @@ void ula_did_complete_frame(void) {
    */
   if ((++ula.frame_counter & 15) == 0) {
     ula.blink_state ^= 1;
+    ula_cell_refresh();
   }
 
   if (ula.did_display_spec_change) {
@@ -552,12 +764,14 @@ static int ula_beam_to_frame_buffer(u32_t beam_row, u32_t beam_column, u32_t* fr
   ula.tstates_x4++;
 
   if (beam_row == ula.display_spec->vsync_row && beam_column == ula.display_spec->vsync_column) {
-    copper_irq();
-    if (!ula.disable_ula_irq) {
-      cpu_irq(E_CPU_IRQ_ULA, 1);
+    if (!slu_is_replica) {
+      copper_irq();
+      if (!ula.disable_ula_irq) {
+        cpu_irq(E_CPU_IRQ_ULA, 1);
+      }
     }
     ula.tstates_x4 = 0;
-  } else if (ula.tstates_x4 == N_IRQ_TSTATES * 4) {
+  } else if (ula.tstates_x4 == N_IRQ_TSTATES * 4 && !slu_is_replica) {
     cpu_irq(E_CPU_IRQ_ULA, 0);
   }
 
@@ -580,6 +794,29 @@ static int ula_beam_to_frame_buffer(u32_t beam_row, u32_t beam_column, u32_t* fr
 }
 
 
+/**
+ * Latches the border colour every 4th T-state.
+ */
+inline
+static void ula_border_latch(void) {
+  if (ula.tstates_x4 % (4 * 4) == 0) {
+    ula.border_colour = ula.border_colour_latched;
+  }
+}
+
+
+/**
+ * What ula_tick() does to the ULA state, without drawing, for when the
+ * render thread draws instead.
+ */
+inline
+static void ula_tick_undrawn(void) {
+  if (ula.is_enabled) {
+    ula_border_latch();
+  }
+}
+
+
 /**
  * Returns the ULA pixel colour for the frame buffer position, if any, and
  * whether it is transparent or not.
@@ -591,10 +828,7 @@ static void ula_tick(u32_t row, u32_t column, int* is_enabled, int* is_border, i
     return;
   }
 
-  /* Latch border colour every 4th T-state. */
-  if (ula.tstates_x4 % (4 * 4) == 0) {
-    ula.border_colour = ula.border_colour_latched;
-  }
+  ula_border_latch();
 
   if (row >= 32 && row < 32 + 192 && column >= 32 * 2 && column < (32 + 256) * 2) {
     row    -= 32;
@@ -646,6 +880,15 @@ static void ula_tick(u32_t row, u32_t column, int* is_enabled, int* is_border, i
 }
 
 
+/**
+ * Rebuilds what derives from the ULA state after a rewind.
+ */
+static void ula_restored(void) {
+  ula_contention_refresh();
+  ula_cell_refresh();
+}
+
+
 int ula_init(u8_t* sram) {
   ula.sram                = sram;
   ula.speaker_state       = 0;
@@ -656,6 +899,8 @@ int ula_init(u8_t* sram) {
 
   ula_reset(E_RESET_HARD);
 
+  rewind_register(&ula, sizeof(ula), ula_restored);
+
   return 0;
 }
 
@@ -690,6 +935,7 @@ void ula_reset(reset_t reset) {
   ula.is_lo_res_enabled_requested = 0;
   ula.did_display_spec_change     = 1;
   ula_display_reconfigure();
+  ula_cell_refresh();
 }
 
 
@@ -702,7 +948,11 @@ void ula_write(u16_t address, u8_t value) {
   const u8_t speaker_state = value & 0x10;
   const s8_t sample        = speaker_state ? AUDIO_MAX_VOLUME : 0;
 
-  audio_add_sample(E_AUDIO_SOURCE_BEEPER, sample);
+  slu_log(E_SLU_OP_ULA_WRITE, value);
+
+  if (!slu_is_replica) {
+    audio_add_sample(E_AUDIO_SOURCE_BEEPER, sample);
+  }
 
   ula.speaker_state         = speaker_state;
   ula.border_colour_latched = value & 0x07;
@@ -726,8 +976,10 @@ u8_t ula_timex_read(u16_t address) {
 
 
 void ula_timex_write(u16_t address, u8_t value) {
+  slu_log(E_SLU_OP_ULA_TIMEX_WRITE, value);
+
   ula.disable_ula_irq = (value & 0x40) >> 6;
-  if (ula.disable_ula_irq) {
+  if (ula.disable_ula_irq && !slu_is_replica) {
     cpu_irq(E_CPU_IRQ_ULA, 0);
   }
 
@@ -771,19 +1023,28 @@ void ula_timing_set(machine_type_t machine) {
     return;
   }
 
+  slu_log(E_SLU_OP_ULA_TIMING_SET, machine);
+
   ula.display_timing          = machine;
   ula.did_display_spec_change = 1;
 
-  main_show_machine_type(ula.display_timing);
+  if (!slu_is_replica) {
+    ula_contention_refresh();
+    main_show_machine_type(ula.display_timing);
+  }
 }
 
 
 void ula_palette_set(int use_second) {
+  slu_log(E_SLU_OP_ULA_PALETTE_SET, use_second);
+
   ula.palette = use_second ? E_PALETTE_ULA_SECOND : E_PALETTE_ULA_FIRST;
 }
 
 
 void ula_clip_set(u8_t x1, u8_t x2, u8_t y1, u8_t y2) {
+  slu_log4(E_SLU_OP_ULA_CLIP_SET, x1, x2, y1, y2);
+
   ula.clip_x1 = x1;
   ula.clip_x2 = x2;
   ula.clip_y1 = y1;
@@ -792,6 +1053,8 @@ void ula_clip_set(u8_t x1, u8_t x2, u8_t y1, u8_t y2) {
 
 
 void ula_screen_bank_set(ula_screen_bank_t bank) {
+  slu_log(E_SLU_OP_ULA_SCREEN_BANK_SET, bank);
+
   if (bank != ula.screen_bank) {
     ula.screen_bank            = bank;
     ula.display_mode_requested = ula.display_mode;  /* Does not change. */
@@ -814,106 +1077,59 @@ int ula_contention_get(void) {
 
 void ula_contention_set(int do_contend) {
   ula.do_contend = do_contend;
+  ula_contention_refresh();
 }
 
 
 /**
- * https://worldofspectrum.org/faq/reference/48kreference.htm#Contention
- *
- * The contention actually starts at t-state 14335, i.e. one t-state *before*
- * the first pixel in the top-left corner is being drawn.
- *
- * We could otherwise have used ula.displaying_content, but that is one t-state
- * too late.
+ * Delays the CPU as per the contention table, at the current T-state.
  */
-static void ula_contend_48k(void) {
-  const u32_t delays[8] = {
-    6, 5, 4, 3, 2, 1, 0, 0
-  };
-  const u32_t tstates = ula.tstates_x4 / 4;
-  u32_t       relative_tstate;
-  u32_t       delay;
-
-  if (tstates < 14335 || tstates >= 14335 + 192 * 224) {
-    /* Outside visible area. */
-    return;
-  }
-
-  relative_tstate = (tstates - 14335) % 224;
-  if (relative_tstate >= 128) {
-    /* In one of the borders or horizontal blanking. */
-    return;
-  }
+inline
+static void ula_contend_now(void) {
+  const u32_t tstate = ula.tstates_x4 / 4;
 
-  delay = delays[relative_tstate % 8];
-  if (delay) {
-    clock_run(delay);
+  if (tstate < ula_contention.n_tstates && ula_contention.delays[tstate]) {
+    clock_run(ula_contention.delays[tstate]);
   }
 }
 
 
-typedef void (*contend_handler)(void);
-
-
+/**
+ * Contends a cycle in which the CPU does not access memory, such as port I/O
+ * and internal cycles.
+ */
 void ula_contend(void) {
-  const contend_handler handlers[E_MACHINE_TYPE_LAST - E_MACHINE_TYPE_FIRST + 1] = {
-    NULL,
-    ula_contend_48k,
-    NULL,
-    NULL,
-    NULL
-  };
-
-  contend_handler handler;
-
-  if (!ula.do_contend) {
-    /* Contention can be disabled by writing to a Next register. */
-    return;
+  if (ula_contention.is_active && !ula_contention.is_mreq_only) {
+    ula_contend_now();
   }
+}
 
-  if (clock_cpu_speed_get() != E_CPU_SPEED_3MHZ) {
-    /* Contention only plays a role when running at 3.5 MHz. */
-    return;
-  }
 
-  handler = handlers[ula.display_timing];
-  if (handler) {
-    handler();
-  }
+/**
+ * Contends a memory access to a contended bank, for which the MMU keeps its
+ * own copy of the contended banks.
+ */
+void ula_contend_memory(void) {
+  ula_contend_now();
 }
 
 
+/**
+ * Contends an internal cycle that puts an address in a bank on the bus.
+ */
 void ula_contend_bank(u8_t bank) {
-  if (bank > 7) {
-    /* Only banks 0-7 can be contended. */
-    return;
+  if (!ula_contention.is_mreq_only && bank < 8 && (ula_contention.banks & (1 << bank))) {
+    ula_contend_now();
   }
+}
 
-  switch (ula.display_timing) {
-    case E_MACHINE_TYPE_ZX_48K:
-      if (bank == 5) {
-        /* Only bank 5 is contended. */
-        ula_contend();
-      }
-      break;
-
-    case E_MACHINE_TYPE_ZX_128K_PLUS2:
-      if ((bank & 1) == 1) {
-        /* Only odd banks are contended. */
-        ula_contend();
-      }
-      break;
-
-    case E_MACHINE_TYPE_ZX_PLUS2A_PLUS2B_PLUS3:
-      if (bank > 3) {
-        /* Only banks four and above are contended. */
-        ula_contend();
-      }
-      break;
 
-    default:
-      break;
-  }
+/**
+ * Whether an access to a bank can currently be delayed by contention, so
+ * that bulk transfers know when they cannot skip it.
+ */
+int ula_bank_may_contend(u8_t bank) {
+  return bank < 8 && (ula_contention.banks & (1 << bank));
 }
 
 
@@ -928,6 +1144,8 @@ void ula_transparent_set(const palette_entry_t* transparent) {
 
 
 void ula_attribute_byte_format_write(u8_t value) {
+  slu_log(E_SLU_OP_ULA_ATTRIBUTE_BYTE_FORMAT_WRITE, value);
+
   ula.ula_next_mask_ink = value;;
 
   switch (value) {
@@ -963,6 +1181,8 @@ void ula_attribute_byte_format_write(u8_t value) {
       ula.ula_next_rshift_paper = 0;
       break;      
   }
+
+  ula_cell_refresh();
 }
 
 
@@ -972,11 +1192,16 @@ u8_t ula_attribute_byte_format_read(void) {
 
 
 void ula_next_mode_enable(int do_enable) {
+  slu_log(E_SLU_OP_ULA_NEXT_MODE_ENABLE, do_enable);
+
   ula.is_ula_next_mode = do_enable;
+  ula_cell_refresh();
 }
 
 
 void ula_60hz_set(int enable) {
+  slu_log(E_SLU_OP_ULA_60HZ_SET, enable);
+
   ula.is_60hz_requested       = enable;
   ula.did_display_spec_change = 1;
 }
@@ -1003,22 +1228,30 @@ int ula_lo_res_enable_get(void) {
 
 
 void ula_lo_res_enable_set(int enable) {
+  slu_log(E_SLU_OP_ULA_LO_RES_ENABLE_SET, enable);
+
   ula.is_lo_res_enabled_requested = enable;
   ula.did_display_spec_change     = 1;
 }
 
 
 void ula_lo_res_offset_x_write(u8_t value) {
+  slu_log(E_SLU_OP_ULA_LO_RES_OFFSET_X_WRITE, value);
+
   ula.lo_res_offset_x = value;
 }
 
 
 void ula_lo_res_offset_y_write(u8_t value) {
+  slu_log(E_SLU_OP_ULA_LO_RES_OFFSET_Y_WRITE, value);
+
   ula.lo_res_offset_y = value;
 }
 
 
 void ula_hdmi_enable(int enable) {
+  slu_log(E_SLU_OP_ULA_HDMI_ENABLE, enable);
+
   ula.is_hdmi_requested       = enable;
   ula.did_display_spec_change = 1;
 }
@@ -1030,6 +1263,8 @@ u8_t ula_offset_x_read(void) {
 
 
 void ula_offset_x_write(u8_t value) {
+  slu_log(E_SLU_OP_ULA_OFFSET_X_WRITE, value);
+
   ula.offset_x = value;
 }
 
@@ -1040,6 +1275,8 @@ u8_t ula_offset_y_read(void) {
 
 
 void ula_offset_y_write(u8_t value) {
+  slu_log(E_SLU_OP_ULA_OFFSET_Y_WRITE, value);
+
   ula.offset_y = value;
 }
 
@@ -1144,3 +1381,12 @@ u8_t ula_floating_bus_read(void) {
 u32_t ula_tstates_get(void) {
   return ula.tstates_x4 / 4;
 }
+
+
+/**
+ * Returns the beam position at which the frame IRQ is raised.
+ */
+void ula_irq_beam_get(u32_t* row, u32_t* column) {
+  *row    = ula.display_spec->vsync_row;
+  *column = ula.display_spec->vsync_column;
+}
@@ -29,8 +29,11 @@ void              ula_screen_bank_set(ula_screen_bank_t bank);
 ula_screen_bank_t ula_screen_bank_get(void);
 int               ula_contention_get(void);
 void              ula_contention_set(int do_contend);
+void              ula_contention_refresh(void);
 void              ula_contend(void);
+void              ula_contend_memory(void);
 void              ula_contend_bank(u8_t bank);
+int               ula_bank_may_contend(u8_t bank);
 void              ula_enable_set(int enable);
 void              ula_did_complete_frame(void);
 void              ula_transparent_set(const palette_entry_t* transparent);
@@ -52,6 +55,7 @@ u8_t              ula_offset_y_read(void);
 void              ula_offset_y_write(u8_t value);
 u8_t              ula_floating_bus_read(void);
 u32_t             ula_tstates_get(void);
+void              ula_irq_beam_get(u32_t* row, u32_t* column);
 
 
 #endif  /* __ULA_H */
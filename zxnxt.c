@@ -0,0 +1,366 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_net.h>
+#include <stdlib.h>
+#include <string.h>
+#include "audio.h"
+#include "clock.h"
+#include "cpu.h"
+#include "defs.h"
+#include "joystick.h"
+#include "keyboard.h"
+#include "loader.h"
+#include "log.h"
+#include "machine.h"
+#include "main.h"
+#include "mouse.h"
+#include "nextreg.h"
+#include "rtc.h"
+#include "slu.h"
+#include "zxnxt.h"
+
+
+/**
+ * Embeds Nexts in other programs, built as libzxnxt.a instead of main.c.
+ *
+ * The modules keep their state in file-static structs, which the library
+ * build makes thread-local, see MACHINE_LOCAL in defs.h. Hence every thread
+ * owns at most one machine: it is created, reset, loaded, run and destroyed
+ * on that thread, and machines on different threads run in parallel. Other
+ * threads may read frames and audio and hand in input at any time.
+ *
+ * There is no audio device or render thread. Audio is collected on host
+ * syncs and the RTC follows emulated time. Every machine opens the SD card
+ * image for itself and has its own ESP behind the UART, so machines that
+ * write to the same image trample each other.
+ */
+
+
+#define ZXNXT_AUDIO_BUFFERS  16
+#define ZXNXT_AUDIO_SAMPLES  (AUDIO_BUFFER_LENGTH * AUDIO_N_CHANNELS)
+
+
+struct zxnxt_machine_t {
+  SDL_mutex* lock;             /* Guards what other threads exchange with the machine. */
+  u16_t*     frame;            /* Last completed frame. */
+  u64_t      n_frames;
+  u8_t       keys[SDL_NUM_SCANCODES];
+  u8_t       keys_synced[SDL_NUM_SCANCODES];  /* As seen since the last host sync. */
+  u16_t      joystick_buttons[2];
+  u8_t       mouse_x;
+  u8_t       mouse_y;
+  u8_t       mouse_buttons;
+  s8_t       audio[ZXNXT_AUDIO_BUFFERS * ZXNXT_AUDIO_SAMPLES];
+  size_t     audio_read_index;   /* Running freely, masked on access. */
+  size_t     audio_write_index;
+};
+
+
+typedef struct self_t {
+  zxnxt_machine_t* current;    /* The machine owned by this thread. */
+  u32_t            frames_left;
+} self_t;
+
+
+static MACHINE_LOCAL self_t self;
+
+
+int zxnxt_init(void) {
+  if (log_init() != 0) {
+    goto exit;
+  }
+
+  if (SDLNet_Init() != 0) {
+    log_err("SDLNet_Init: %s\n", SDLNet_GetError());
+    goto exit_log;
+  }
+
+  return 0;
+
+exit_log:
+  log_finit();
+exit:
+  return -1;
+}
+
+
+void zxnxt_finit(void) {
+  SDLNet_Quit();
+  log_finit();
+}
+
+
+/**
+ * Creates a machine owned by the calling thread, which must not own one
+ * already.
+ */
+zxnxt_machine_t* zxnxt_create(void) {
+  zxnxt_machine_t* machine;
+
+  if (self.current != NULL) {
+    log_err("zxnxt: thread already owns a machine\n");
+    goto exit;
+  }
+
+  machine = calloc(1, sizeof(*machine));
+  if (machine == NULL) {
+    log_err("zxnxt: out of memory\n");
+    goto exit;
+  }
+
+  machine->frame = calloc(1, FRAME_BUFFER_SIZE);
+  if (machine->frame == NULL) {
+    log_err("zxnxt: out of memory\n");
+    goto exit_machine;
+  }
+
+  machine->lock = SDL_CreateMutex();
+  if (machine->lock == NULL) {
+    log_err("zxnxt: SDL_CreateMutex error: %s\n", SDL_GetError());
+    goto exit_frame;
+  }
+
+  /* No audio device, texture, game controllers or GDB. */
+  if (machine_init(0, NULL, NULL, NULL, NULL, 0) != 0) {
+    goto exit_lock;
+  }
+
+  rtc_emulated_set(1);
+  audio_deterministic_set(1);
+  keyboard_state_set(machine->keys_synced);
+
+  self.current     = machine;
+  self.frames_left = 0;
+
+  return machine;
+
+exit_lock:
+  SDL_DestroyMutex(machine->lock);
+exit_frame:
+  free(machine->frame);
+exit_machine:
+  free(machine);
+exit:
+  return NULL;
+}
+
+
+/**
+ * Whether the calling thread owns the machine, as it must to drive it.
+ */
+static int zxnxt_is_owned(const zxnxt_machine_t* machine, const char* what) {
+  if (machine != self.current) {
+    log_err("zxnxt: %s on a thread that does not own the machine\n", what);
+    return 0;
+  }
+  return 1;
+}
+
+
+void zxnxt_destroy(zxnxt_machine_t* machine) {
+  if (!zxnxt_is_owned(machine, "destroy")) {
+    return;
+  }
+
+  machine_finit();
+  self.current = NULL;
+
+  SDL_DestroyMutex(machine->lock);
+  free(machine->frame);
+  free(machine);
+}
+
+
+void zxnxt_reset(zxnxt_machine_t* machine, reset_t reset) {
+  if (zxnxt_is_owned(machine, "reset")) {
+    nextreg_write_internal(E_NEXTREG_REGISTER_RESET, reset == E_RESET_HARD ? 0x02 : 0x01);
+  }
+}
+
+
+/**
+ * Loads a .nex, .sna or .z80 file straight into memory and prepares to run
+ * it, see loader.c.
+ */
+int zxnxt_load(zxnxt_machine_t* machine, const char* filename) {
+  if (!zxnxt_is_owned(machine, "load")) {
+    return -1;
+  }
+
+  return loader_load(filename);
+}
+
+
+/**
+ * Runs until either the ticks have passed or the frames have completed,
+ * whichever comes first. Breakpoints are of no use here, so are ignored.
+ */
+static void zxnxt_run(zxnxt_machine_t* machine, u64_t ticks_28mhz, u32_t n_frames) {
+  u64_t start;
+
+  if (!zxnxt_is_owned(machine, "run")) {
+    return;
+  }
+
+  start            = clock_ticks();
+  self.frames_left = n_frames;
+
+  while (clock_ticks() - start < ticks_28mhz && self.frames_left > 0) {
+    (void) cpu_step();
+  }
+}
+
+
+void zxnxt_run_ticks(zxnxt_machine_t* machine, u64_t ticks_28mhz) {
+  zxnxt_run(machine, ticks_28mhz, (u32_t) -1);
+}
+
+
+void zxnxt_run_frames(zxnxt_machine_t* machine, u32_t n_frames) {
+  zxnxt_run(machine, (u64_t) -1, n_frames);
+}
+
+
+u64_t zxnxt_frames_get(zxnxt_machine_t* machine) {
+  u64_t n_frames;
+
+  SDL_LockMutex(machine->lock);
+  n_frames = machine->n_frames;
+  SDL_UnlockMutex(machine->lock);
+
+  return n_frames;
+}
+
+
+/**
+ * Copies the last completed frame.
+ */
+void zxnxt_frame_read(zxnxt_machine_t* machine, u16_t* frame) {
+  SDL_LockMutex(machine->lock);
+  memcpy(frame, machine->frame, FRAME_BUFFER_SIZE);
+  SDL_UnlockMutex(machine->lock);
+}
+
+
+/**
+ * Takes up to n samples, returning how many there were. When not read in
+ * time, the oldest audio is dropped.
+ */
+size_t zxnxt_audio_read(zxnxt_machine_t* machine, s8_t* samples, size_t n) {
+  const size_t mask = sizeof(machine->audio) - 1;
+  size_t       i;
+
+  SDL_LockMutex(machine->lock);
+  for (i = 0; i < n && machine->audio_read_index != machine->audio_write_index; i++) {
+    samples[i] = machine->audio[machine->audio_read_index++ & mask];
+  }
+  SDL_UnlockMutex(machine->lock);
+
+  return i;
+}
+
+
+/**
+ * Keys, joysticks and the mouse are seen by the machine from its next host
+ * sync on.
+ */
+void zxnxt_key_set(zxnxt_machine_t* machine, SDL_Scancode scancode, int is_pressed) {
+  SDL_LockMutex(machine->lock);
+  machine->keys[scancode] = is_pressed ? 1 : 0;
+  SDL_UnlockMutex(machine->lock);
+}
+
+
+void zxnxt_joystick_set(zxnxt_machine_t* machine, joystick_t n, u16_t buttons) {
+  SDL_LockMutex(machine->lock);
+  machine->joystick_buttons[n] = buttons;
+  SDL_UnlockMutex(machine->lock);
+}
+
+
+void zxnxt_mouse_set(zxnxt_machine_t* machine, u8_t x, u8_t y, u8_t buttons) {
+  SDL_LockMutex(machine->lock);
+  machine->mouse_x       = x;
+  machine->mouse_y       = y;
+  machine->mouse_buttons = buttons;
+  SDL_UnlockMutex(machine->lock);
+}
+
+
+/* What follows stands in for main.c. */
+
+
+u32_t main_next_host_sync_get(u32_t freq_28mhz) {
+  return (unsigned long) freq_28mhz * AUDIO_BUFFER_LENGTH / AUDIO_SAMPLE_RATE;
+}
+
+
+void main_sync(void) {
+  zxnxt_machine_t* machine = self.current;
+  const size_t     mask    = sizeof(machine->audio) - 1;
+  const s8_t*      samples;
+  size_t           i;
+
+  /* The clock already runs while the modules come up. */
+  if (machine == NULL) {
+    return;
+  }
+
+  audio_flush();
+  samples = audio_flushed_get();
+
+  SDL_LockMutex(machine->lock);
+
+  memcpy(machine->keys_synced, machine->keys, sizeof(machine->keys));
+  joystick_buttons_set(E_JOYSTICK_LEFT,  machine->joystick_buttons[E_JOYSTICK_LEFT]);
+  joystick_buttons_set(E_JOYSTICK_RIGHT, machine->joystick_buttons[E_JOYSTICK_RIGHT]);
+  mouse_set(machine->mouse_x, machine->mouse_y, machine->mouse_buttons);
+
+  for (i = 0; i < ZXNXT_AUDIO_SAMPLES; i++) {
+    machine->audio[machine->audio_write_index++ & mask] = samples[i];
+  }
+  if (machine->audio_write_index - machine->audio_read_index > sizeof(machine->audio)) {
+    machine->audio_read_index = machine->audio_write_index - sizeof(machine->audio);
+  }
+
+  SDL_UnlockMutex(machine->lock);
+
+  keyboard_sync();
+}
+
+
+void main_frame_completed(void) {
+  zxnxt_machine_t* machine = self.current;
+
+  if (machine == NULL) {
+    return;
+  }
+
+  SDL_LockMutex(machine->lock);
+  memcpy(machine->frame, slu_frame_buffer_get(), FRAME_BUFFER_SIZE);
+  machine->n_frames++;
+  SDL_UnlockMutex(machine->lock);
+
+  if (self.frames_left > 0) {
+    self.frames_left--;
+  }
+}
+
+
+void main_show_refresh(int is_60hz) {
+}
+
+
+void main_show_machine_type(machine_type_t machine) {
+}
+
+
+void main_show_timing(timing_t timing) {
+}
+
+
+void main_show_cpu_speed(cpu_speed_t speed) {
+}
+
+
+void main_show_stats(int speed_percent, int fps) {
+}
@@ -0,0 +1,37 @@
+#ifndef __ZXNXT_H
+#define __ZXNXT_H
+
+
+#include <SDL2/SDL.h>
+#include "defs.h"
+#include "joystick.h"
+
+
+/**
+ * Library interface to run Nexts without a window. Frames are
+ * FRAME_BUFFER_WIDTH by FRAME_BUFFER_HEIGHT RGBA4444 pixels, audio comes as
+ * interleaved signed 8-bit stereo at AUDIO_SAMPLE_RATE.
+ *
+ * A thread owns at most one machine, which runs in parallel with those of
+ * other threads, see zxnxt.c.
+ */
+typedef struct zxnxt_machine_t zxnxt_machine_t;
+
+
+int              zxnxt_init(void);
+void             zxnxt_finit(void);
+zxnxt_machine_t* zxnxt_create(void);
+void             zxnxt_destroy(zxnxt_machine_t* machine);
+void             zxnxt_reset(zxnxt_machine_t* machine, reset_t reset);
+int              zxnxt_load(zxnxt_machine_t* machine, const char* filename);
+void             zxnxt_run_ticks(zxnxt_machine_t* machine, u64_t ticks_28mhz);
+void             zxnxt_run_frames(zxnxt_machine_t* machine, u32_t n_frames);
+u64_t            zxnxt_frames_get(zxnxt_machine_t* machine);
+void             zxnxt_frame_read(zxnxt_machine_t* machine, u16_t* frame);
+size_t           zxnxt_audio_read(zxnxt_machine_t* machine, s8_t* samples, size_t n);
+void             zxnxt_key_set(zxnxt_machine_t* machine, SDL_Scancode scancode, int is_pressed);
+void             zxnxt_joystick_set(zxnxt_machine_t* machine, joystick_t n, u16_t buttons);
+void             zxnxt_mouse_set(zxnxt_machine_t* machine, u8_t x, u8_t y, u8_t buttons);
+
+
+#endif  /* __ZXNXT_H */